@@ -9,6 +9,7 @@
 #include <map>
 #include <exception>
 #include <unordered_map>
+#include <atomic>
 
 // ~~~~~~~~~ ROOT include files ~~~~~~~~~
 #include "TH1.h"
@@ -32,6 +33,7 @@
 
 #include "../interface/CommonFunction.h"
 #include "../interface/SaturationCorrection.h"
+#include "../interface/PseudoExperiments.h"
 #include "tdrstyle.h"
 #include "HistoTools.h"
 #include "ArgumentParser.h"
@@ -112,6 +114,86 @@ int main(int argc, char* argv[]) {
 }
 
 
+//=============================================================
+//
+//     Pseudo-experiments of the mass prediction
+//
+//     Run with runPseudoExperiments on flat copies of the
+//     projections of the current cut (PseudoExperiments.h).
+//     Each pseudo-experiment fills its own predictionPE, the
+//     Pred_Prof_* rows are written from them afterwards.
+//
+//=============================================================
+
+struct predictionPE {
+    double P = 0;                     // predicted number of events
+    std::vector<double> PDist;        // normalised p distribution
+    std::vector<double> Mass;         // mass distribution, to be scaled by P
+    std::vector<double> Mass_CB, Mass_GFA, Mass_GB, Mass_HA, Mass_CF;  // predictions in eta bins
+    std::vector<double> EtaP;         // weighted (eta, p) distribution, only kept when it is saved
+};
+
+// Integral of a 1D flat histogram, under- and overflow bins excluded (TH1::Integral)
+double integralFlat(const flatHisto& h){
+    double sum = 0;
+    for(int i=1;i<=h.nx;i++) sum += h(i);
+    return sum;
+}
+
+// TH1::Scale of a flat histogram
+void scaleFlat(flatHisto& h, double c){
+    for(unsigned int i=0;i<h.content.size();i++) h.content[i] *= c;
+}
+
+// Same as symmetrizeHisto on the flat copy of a TH1D or TH2D
+void symmetrizeHisto(flatHisto& h, int mode) {
+  const int n = h.nx;
+  const int yLast = h.ny > 0 ? h.ny + 1 : 0;  // transform the overflow as well
+  int limit, shift = 0;
+  if (n % 2 == 0)
+    limit = n / 2;
+  else {
+    limit = (n - 1) / 2;  // in that case ignore the middle bin
+    shift = 2;
+  }
+  auto integral = [&](int first, int last) {
+    double sum = 0;
+    for (int y = 0; y <= yLast; y++)
+      for (int x = first; x <= last; x++)
+        sum += h(x, y);
+    return sum;
+  };
+  if (mode == 0) {  // take (histogram + mirrored histogram)/2
+    for (int y = 0; y <= yLast; y++) {
+      for (int x = 0; x <= limit; x++) {
+        h(x, y) = 0.5 * h(x, y) + 0.5 * h(n - x, y);
+        h(n - x, y) = h(x, y);
+      }
+    }
+  } else if (mode > 0) {
+    int left = integral(0, limit);
+    int right = integral(limit + shift, n + 1);
+    for (int y = 0; y <= yLast; y++) {
+      if (mode == 1 || mode == 3) {  // take the larger (1) or the smaller (3) half only
+        if ((mode == 1 && right > left) || (mode == 3 && right < left)) {
+          for (int x = 0; x <= limit; x++)
+            h(x, y) = h(n - x, y);
+        } else {
+          for (int x = n; x >= limit; x--)
+            h(x, y) = h(n - x, y);
+        }
+      } else if (mode == 2 || mode == 4) {  // take the larger (2) or the smaller (4) of the two opposite bins
+        for (int x = 0; x <= n; x++) {
+          if ((mode == 2 && h(n - x, y) >= h(x, y)) || (mode == 4 && h(n - x, y) <= h(x, y)))
+            h(x, y) = h(n - x, y);
+          else
+            h(n - x, y) = h(x, y);
+        }
+      }
+    }
+  }
+}
+
 void Analysis_Step2_BackgroundPrediction(string RootFile, int TypeMode)
 {
    bool symmetrizeHistos = false;
@@ -129,6 +211,8 @@ void Analysis_Step2_BackgroundPrediction(string RootFile, int TypeMode)
    gStyle->SetNdivisions(505);*/
 
    unsigned int NPseudoExp = 100; //Number of PseudoExperiment to run
+   int NThreads = 0; //Number of threads running the PseudoExperiments, 0: one per core
+   unsigned int Seed = 4357; //PseudoExperiment pe uses the seed Seed+pe
 
    //7TeV DXY/DZ/ANGLE 85/326  86/327   10/251
    double CosmicVetoInEfficiency7TeV    = 0.26 * 0.26 * 0.04 ; 
@@ -510,10 +594,6 @@ void Analysis_Step2_BackgroundPrediction(string RootFile, int TypeMode)
                 if (symmetrizeHistos) symmetrizeHisto(Pred_EtaS_Proj,TypeMode);
                 if (symmetrizeHistos) symmetrizeHisto(Pred_EtaS2_Proj,TypeMode);
 
-                TH1D* Pred_EtaB_Proj_PE  = (TH1D*)Pred_EtaB_Proj ->Clone("Pred_EtaB_Proj_PE");  Pred_EtaB_Proj_PE ->Reset();
-                TH1D* Pred_EtaS_Proj_PE  = (TH1D*)Pred_EtaS_Proj ->Clone("Pred_EtaS_Proj_PE");  Pred_EtaS_Proj_PE ->Reset();
-                TH1D* Pred_EtaS2_Proj_PE = (TH1D*)Pred_EtaS2_Proj->Clone("Pred_EtaS2_Proj_PE"); Pred_EtaS2_Proj_PE->Reset();
-
                 Pred_EtaP->GetXaxis()->SetRange(CutIndex+1,CutIndex+1);
                 TH2D* Pred_EtaPWeighted    = (TH2D*)Pred_EtaP->Project3D("zy");
                 //----------------------------------------------------------------------------------------------------Prediction in eta bins PZ4
@@ -532,9 +612,6 @@ void Analysis_Step2_BackgroundPrediction(string RootFile, int TypeMode)
                 TH2D* Pred_EtaPWeighted_PE = (TH2D*)Pred_EtaPWeighted->Clone("Pred_EtaPWeightedPE");   Pred_EtaPWeighted_PE->Reset();
 
                 TH1D* Pred_I_Proj = Pred_I->ProjectionY("ProjI",CutIndex+1,CutIndex+1);
-                TH1D* Pred_T_Proj = Pred_TOF->ProjectionY("ProjT",CutIndex+1,CutIndex+1);
-                TH1D* Pred_I_ProjPE = (TH1D*) Pred_I_Proj->Clone("Pred_I_ProjPE"); Pred_I_ProjPE->Reset();
-                TH1D* Pred_T_ProjPE = (TH1D*) Pred_T_Proj->Clone("Pred_T_ProjPE"); Pred_T_ProjPE->Reset();
 
                 TH2D* Pred_Prof_Mass     =  new TH2D("Pred_Prof_Mass"    ,"Pred_Prof_Mass"    ,MassNBins,0,MassHistoUpperBound, NPseudoExp, 0, NPseudoExp); 
                 TH2D* Pred_Prof_MassTOF  =  new TH2D("Pred_Prof_MassTOF" ,"Pred_Prof_MassTOF" ,MassNBins,0,MassHistoUpperBound, NPseudoExp, 0, NPseudoExp);  
@@ -547,226 +624,165 @@ void Analysis_Step2_BackgroundPrediction(string RootFile, int TypeMode)
                 TH2D* Pred_Prof_Mass_CF     =  new TH2D("Pred_Prof_Mass_CF"    ,"Pred_Prof_Mass_CF"    ,MassNBins,0,MassHistoUpperBound, NPseudoExp, 0, NPseudoExp); 
                 //----------------------------------------------------------------------------------------------------Prediction in eta bins
 
-                for(int x=0;x<=Pred_Mass->GetNbinsY()+1;x++){ // taking the overflow as well
-                    for(unsigned int pe=0;pe<NPseudoExp;pe++){
-                        Pred_Prof_Mass    ->SetBinContent(x, pe, 0);
-                        Pred_Prof_MassTOF ->SetBinContent(x, pe, 0);
-                        Pred_Prof_MassComb->SetBinContent(x, pe, 0);
-                        //----------------------------------------------------------------------------------------------------Prediction in eta bins PZ6
-                        Pred_Prof_Mass_CB ->SetBinContent(x, pe, 0);
-                        Pred_Prof_Mass_GFA->SetBinContent(x, pe, 0);
-                        Pred_Prof_Mass_GB ->SetBinContent(x, pe, 0);
-                        Pred_Prof_Mass_HA ->SetBinContent(x, pe, 0);
-                        Pred_Prof_Mass_CF ->SetBinContent(x, pe, 0);
-                        //----------------------------------------------------------------------------------------------------Prediction in eta bins
-                    }
-                }
+                // flat copies of the inputs of the pseudo-experiments, read by all the threads
+                const flatHisto EtaB(*Pred_EtaB_Proj), EtaS(*Pred_EtaS_Proj), EtaS2(*Pred_EtaS2_Proj);
+                const flatHisto EtaP(*Pred_EtaPWeighted), I(*Pred_I_Proj);
+                const flatHisto PDF_A(*PDF_A_Eta_2D), PDF_E(*PDF_E_Eta_2D), PDF_H(*PDF_H_EtaMass_2D);
+                const flatHisto PDF_G(*PDF_G_EtaP_2D), PDF_C(*PDF_C_EtaP_2D), PDF_F(*PDF_F_EtaICK_2D), PDF_B(*PDF_B_EtaICK_2D);
+                const TAxis massAxis(MassNBins,0,MassHistoUpperBound);
+                // the weighted (eta, p) distribution of the last pseudo-experiment is saved for this cut
+                const bool saveEtaP = DirName.find("13TeV16G")==string::npos && is2016 && CutIndex == 4;
 
-                TRandom3* RNG = new TRandom3();
                 printf("Predicting (%4i / %4i)     :",CutIndex+1,HCuts_Pt->GetXaxis()->GetNbins());
                 int TreeStep = NPseudoExp/50;if(TreeStep==0)TreeStep=1;
-                // loop over pseudo-experiments
-                for(unsigned int pe=0;pe<NPseudoExp;pe++){    
-                    if(pe%TreeStep==0){printf(".");fflush(stdout);}
-
-                    TH1D* tmpH_Mass     =  new TH1D("tmpH_Mass"    ,"tmpH_Mass"    ,MassNBins,0,MassHistoUpperBound);
-                    TH1D* tmpH_MassTOF  =  new TH1D("tmpH_MassTOF" ,"tmpH_MassTOF" ,MassNBins,0,MassHistoUpperBound);
-                    TH1D* tmpH_MassComb =  new TH1D("tmpH_MassComb","tmpH_MassComb",MassNBins,0,MassHistoUpperBound);
-
-
-                    double PE_A=RNG->Poisson(A);
-                    double PE_B=RNG->Poisson(B);
-                    double PE_C=RNG->Poisson(C);
-                    double PE_E=RNG->Poisson(E);
-                    double PE_F=RNG->Poisson(F);
-                    double PE_G=RNG->Poisson(G);
+                std::atomic<int> nDone(0);
+                // loop over pseudo-experiments, each one fills its own predictionPE
+                std::vector<predictionPE> vPE = runPseudoExperiments<predictionPE>(NPseudoExp,NThreads,Seed,[&](TRandom3& RNG, predictionPE& pred){
+                    if(nDone++%TreeStep==0){printf(".");fflush(stdout);}
+
+                    double PE_A=RNG.Poisson(A);
+                    double PE_B=RNG.Poisson(B);
+                    double PE_C=RNG.Poisson(C);
+                    double PE_E=RNG.Poisson(E);
+                    double PE_F=RNG.Poisson(F);
+                    double PE_G=RNG.Poisson(G);
                     double PE_P = 0;
 
                     if(E>0){        PE_P    = (PE_E>0 ? (PE_A*PE_F*PE_G)/(PE_E*PE_E) : 0);}
                     else if(A>0){   PE_P    = (PE_A>0 ? ((PE_C*PE_B)/PE_A) : 0);}
+                    pred.P = PE_P;
+
+                    // fluctuated copies, the last overflow bin of the eta, I distributions and of the eta axis of (eta, p) is left empty
+                    flatHisto EtaB_PE(EtaB), EtaS_PE(EtaS), EtaS2_PE(EtaS2), EtaP_PE(EtaP), I_PE(I);
+                    EtaB_PE(EtaB.nx+1) = 0; EtaS_PE(EtaS.nx+1) = 0; EtaS2_PE(EtaS2.nx+1) = 0; I_PE(I.nx+1) = 0;
+                    for(int j=0;j<=EtaP.ny+1;j++) EtaP_PE(EtaP.nx+1,j) = 0;
 
-                    for(int i=0;i<Pred_EtaB_Proj_PE->GetNbinsX()+1;i++){Pred_EtaB_Proj_PE->SetBinContent(i,RNG->Poisson(Pred_EtaB_Proj->GetBinContent(i)) );}    Pred_EtaB_Proj_PE->Scale(1.0/Pred_EtaB_Proj_PE->Integral());
-                    for(int i=0;i<Pred_EtaS_Proj_PE->GetNbinsX()+1;i++){Pred_EtaS_Proj_PE->SetBinContent(i,RNG->Poisson(Pred_EtaS_Proj->GetBinContent(i)) );}    Pred_EtaS_Proj_PE->Scale(1.0/Pred_EtaS_Proj_PE->Integral());
-                    for(int i=0;i<Pred_EtaS2_Proj_PE->GetNbinsX()+1;i++){Pred_EtaS2_Proj_PE->SetBinContent(i,RNG->Poisson(Pred_EtaS2_Proj->GetBinContent(i)) );} Pred_EtaS2_Proj_PE->Scale(1.0/Pred_EtaS2_Proj_PE->Integral());
+                    for(int i=0;i<EtaB.nx+1;i++){EtaB_PE(i)=RNG.Poisson(EtaB(i));}    scaleFlat(EtaB_PE,1.0/integralFlat(EtaB_PE));
+                    for(int i=0;i<EtaS.nx+1;i++){EtaS_PE(i)=RNG.Poisson(EtaS(i));}    scaleFlat(EtaS_PE,1.0/integralFlat(EtaS_PE));
+                    for(int i=0;i<EtaS2.nx+1;i++){EtaS2_PE(i)=RNG.Poisson(EtaS2(i));} scaleFlat(EtaS2_PE,1.0/integralFlat(EtaS2_PE));
 
-                    for(int i=0;i<Pred_EtaPWeighted_PE->GetNbinsX()+1;i++){
-                        for(int j=0;j<=Pred_EtaPWeighted_PE->GetNbinsY()+1;j++){ // take the overflow as well
-                            Pred_EtaPWeighted_PE->SetBinContent(i,j,RNG->Poisson(Pred_EtaPWeighted->GetBinContent(i,j)));
+                    for(int i=0;i<EtaP.nx+1;i++){
+                        for(int j=0;j<=EtaP.ny+1;j++){ // take the overflow as well
+                            EtaP_PE(i,j)=RNG.Poisson(EtaP(i,j));
                         }
                     }
-                    /*
-                    // this part does the reweighing in terms of removing either high or
-                    // low momentum tracks (currently set on removing low momenta first) to match the Eta distribution
-                    // to remove high momenta, change this loop a few lines below
-                    // for (int y = 0; y <= EtaPC->GetNbinsY()+1; y++)
-                    // loop into
-                    // for (int y = EtaPC->GetNbinsY()+1; --y;)
-                    // if you opt for this reweighing, be sure to use EtaPC in the end for your momentum distribution
-                    // instead of Pred_EtaPWeighted_PE
-                    //
-                        TH1D* AbsoluteWeight = Pred_EtaPWeighted_PE->ProjectionX("PWeighted");
-                        Pred_EtaB_Proj_PE->Scale(AbsoluteWeight->GetMaximum()/Pred_EtaB_Proj_PE->GetMaximum());
-                        Pred_EtaS_Proj_PE->Scale(AbsoluteWeight->GetMaximum()/Pred_EtaS_Proj_PE->GetMaximum());
-                        for (int x = 0; x < AbsoluteWeight->GetNbinsX()+1; x++) {
-                                AbsoluteWeight->SetBinContent(x, Pred_EtaB_Proj_PE->GetBinContent(x) - Pred_EtaS_Proj_PE->GetBinContent(x));
-                                if (AbsoluteWeight->GetBinContent(x)<0) AbsoluteWeight->SetBinContent(x, 0);
-                        }
-                        TH2D* EtaPC = (TH2D*) Pred_EtaPWeighted_PE->Clone("EtaPC");
-                        for (int x = 0; x < EtaPC->GetNbinsX()+1; x++){
-                                if (AbsoluteWeight->GetBinContent(x)<=0) continue;
-                                for (int y = 0; y <= EtaPC->GetNbinsY()+1; y++){
-                                if (EtaPC->GetBinContent(x,y)>0){
-                                    if (AbsoluteWeight->GetBinContent(x) >= EtaPC->GetBinContent(x,y)){
-                                        AbsoluteWeight->SetBinContent(x, AbsoluteWeight->GetBinContent(x) - EtaPC->GetBinContent(x,y));
-                                        EtaPC->SetBinContent(x, y, 0);
-                                        if (AbsoluteWeight->GetBinContent(x)<=0) break;
-                                    } else {
-                                        EtaPC->SetBinContent(x, y, EtaPC->GetBinContent(x, y) - AbsoluteWeight->GetBinContent(x));
-                                        break;
-                                    }
-                                }
-                                }
-                        }
-                        delete AbsoluteWeight;
-                    */
-                    if (symmetrizeHistos) symmetrizeHisto(Pred_EtaB_Proj_PE,TypeMode);
-                    if (symmetrizeHistos) symmetrizeHisto(Pred_EtaS_Proj_PE,TypeMode);
-                    if (symmetrizeHistos) symmetrizeHisto(Pred_EtaS2_Proj_PE,TypeMode);
-                    if (symmetrizeHistos) symmetrizeHisto(Pred_EtaPWeighted_PE,TypeMode);
-                    Pred_EtaB_Proj_PE->Scale(1.0/Pred_EtaB_Proj_PE->Integral());
-                    Pred_EtaS_Proj_PE->Scale(1.0/Pred_EtaS_Proj_PE->Integral());
-                    if(TypeMode==2) Pred_EtaS2_Proj_PE->Scale(1.0/Pred_EtaS2_Proj_PE->Integral());// jesli normalizowac, to wszystkie
-
-
-                    double WeightP = 0.0;
-                    for(int x=0;x<=Pred_EtaPWeighted_PE->GetXaxis()->GetNbins();x++){
-                        WeightP = 0.0;
-                        //          reweigh C_Eta on B_Eta/A_Eta
-                        if(Pred_EtaB_Proj_PE->GetBinContent(x)>0){
-                            //mk pz    WeightP = 1.;
-                            WeightP = Pred_EtaS_Proj_PE ->GetBinContent(x)/Pred_EtaB_Proj_PE->GetBinContent(x);
-                            if(TypeMode==2)WeightP*= Pred_EtaS2_Proj_PE->GetBinContent(x)/Pred_EtaB_Proj_PE->GetBinContent(x);
+                    if (symmetrizeHistos) symmetrizeHisto(EtaB_PE,TypeMode);
+                    if (symmetrizeHistos) symmetrizeHisto(EtaS_PE,TypeMode);
+                    if (symmetrizeHistos) symmetrizeHisto(EtaS2_PE,TypeMode);
+                    if (symmetrizeHistos) symmetrizeHisto(EtaP_PE,TypeMode);
+                    scaleFlat(EtaB_PE,1.0/integralFlat(EtaB_PE));
+                    scaleFlat(EtaS_PE,1.0/integralFlat(EtaS_PE));
+                    if(TypeMode==2) scaleFlat(EtaS2_PE,1.0/integralFlat(EtaS2_PE));
+
+                    //          reweigh C_Eta on B_Eta/A_Eta
+                    for(int x=0;x<=EtaP.nx;x++){
+                        double WeightP = 0.0;
+                        if(EtaB_PE(x)>0){
+                            WeightP = EtaS_PE(x)/EtaB_PE(x);
+                            if(TypeMode==2)WeightP*= EtaS2_PE(x)/EtaB_PE(x);
                         }
-
-                        /*
-                        //          reweigh C_Eta on B_Eta/C_Eta -- not out of the box, in this case we don't need the    
-                        //	    TH1D* Pred_EtaCRegion = (TH1D*) Pred_EtaPWeighted->ProjectionX ("Pred_EtaCRegion");
-                                TH1D* Pred_EtaCRegion = (TH1D*) EtaPC->ProjectionX ("Pred_EtaCRegion", 0, EtaPC->GetNbinsY()+1);
-                                Pred_EtaCRegion->Scale(1.0/Pred_EtaCRegion->Integral());
-                                    if(Pred_EtaCRegion->GetBinContent(x)>0){
-                                                    WeightP = Pred_EtaS_Proj_PE ->GetBinContent(x)/Pred_EtaCRegion->GetBinContent(x);
-                                    if(TypeMode==2)WeightP*= Pred_EtaS2_Proj_PE->GetBinContent(x)/Pred_EtaCRegion->GetBinContent(x);
-                                    }
-                                delete Pred_EtaCRegion;
-                        */
-                        for(int y=0;y<=Pred_EtaPWeighted_PE->GetYaxis()->GetNbins()+1;y++){ // take the overflow as well
-                            Pred_EtaPWeighted_PE->SetBinContent(x,y,Pred_EtaPWeighted_PE->GetBinContent(x,y)*WeightP);
-                                //EtaPC->SetBinContent(x,y,EtaPC->GetBinContent(x,y)*WeightP);
+                        for(int y=0;y<=EtaP.ny+1;y++){ // take the overflow as well
+                            EtaP_PE(x,y) = EtaP_PE(x,y)*WeightP;
                         }
                     }
+                    if(saveEtaP) pred.EtaP = EtaP_PE.content;
 
-                    // Plus side
-
-                    //         TH1D* Pred_P_ProjPE = Pred_EtaPWeighted_PE /*EtaPC*/->ProjectionY("Pred_P_ProjPE", 0, 30);                                                        Pred_P_ProjPE->Scale(1.0/Pred_P_ProjPE->Integral(0, Pred_P_ProjPE->GetNbinsX()+1)); // include overflow
-
-
-                    TH1D* Pred_P_ProjPE = Pred_EtaPWeighted_PE /*EtaPC*/->ProjectionY("Pred_P_ProjPE", 1, Pred_EtaPWeighted_PE->GetXaxis()->GetNbins());                                                        Pred_P_ProjPE->Scale(1.0/Pred_P_ProjPE->Integral(0, Pred_P_ProjPE->GetNbinsX()+1)); // include overflow
-                    // Minus side
-                    //         TH1D* Pred_P_ProjPE_M = Pred_EtaPWeighted_PE /*EtaPC*/->ProjectionY("Pred_P_ProjPE", 0, 30);                                                        Pred_P_ProjPE->Scale(1.0/Pred_P_ProjPE->Integral(0, Pred_P_ProjPE->GetNbinsX()+1)); // include overflow
-                    for(int i=0;i<Pred_I_ProjPE->GetNbinsX()+1;i++){Pred_I_ProjPE->SetBinContent(i,RNG->Poisson(Pred_I_Proj->GetBinContent(i)) );}   Pred_I_ProjPE->Scale(1.0/Pred_I_ProjPE->Integral());
-                    for(int i=0;i<Pred_T_ProjPE->GetNbinsX()+1;i++){Pred_T_ProjPE->SetBinContent(i,RNG->Poisson(Pred_T_Proj->GetBinContent(i)) );}   Pred_T_ProjPE->Scale(1.0/Pred_T_ProjPE->Integral());
-
-                    //save the predP distribution
-                    for(int x=0;x<=Pred_P_ProjPE->GetNbinsX()+1;x++){Pred_P->SetBinContent(CutIndex+1, x, Pred_P->GetBinContent(CutIndex+1, x) + Pred_P_ProjPE->GetBinContent(x) * PE_P);}; // overflow
-
-                    double Proba, MI, MComb;//, MT=0, ProbaT=0;
-                    for(int x=0;x<=Pred_P_ProjPE->GetNbinsX()+1;x++){    
-                        if(Pred_P_ProjPE->GetBinContent(x)<=0.0){continue;}  
-                        const double& p = (x<Pred_P_ProjPE->GetNbinsX()+1)?Pred_P_ProjPE->GetBinCenter(x):Pred_P_ProjPE->GetBinCenter(x+3); //overflow bin
-                        for(int y=0;y<Pred_I_ProjPE->GetNbinsX()+1;y++){    if(Pred_I_ProjPE->GetBinContent(y)<=0.0){continue;}  const double& i = Pred_I_ProjPE->GetBinCenter(y);
-                            Proba = Pred_P_ProjPE->GetBinContent(x) * Pred_I_ProjPE->GetBinContent(y);  if(Proba<=0 || isnan((float)Proba))continue;
-                            //MI = GetMass(p,i, false);
-                            MI = GetMass(p,i, dEdxK_MC, dEdxC_MC);
-                            MComb = MI;
-                            tmpH_Mass->Fill(MI,Proba);
-
-                            //if(MI>500 && MI<800 && pe==0 && (CutIndex==3 || CutIndex==4)){printf("Index=%i p=%7.2f i=%7.2f M=%7.2f P=%7.5E( = %7.5E x %7.5E) --> %7.5E | %7.5E\n",CutIndex,p,i,MI,Proba,Pred_P_ProjPE->GetBinContent(x),Pred_I_ProjPE->GetBinContent(y),Pred_P_ProjPE->GetBinContent(x)*1,Pred_I_ProjPE->GetBinContent(y)*1);}
-
-                            //commented part there is related to the prediction of the mass reconstructed from TOF.
-                            //if(TypeMode==2){
-                            //for(int z=0;z<Pred_T_ProjPE->GetNbinsX()+1;z++){   if(Pred_T_ProjPE->GetBinContent(z)<=0.0){continue;}   const double& t = Pred_T_ProjPE->GetBinCenter(z);
-                            //   ProbaT = Proba * Pred_T_ProjPE->GetBinContent(z);  if(ProbaT<=0 || isnan(ProbaT))continue;
-                            //   MT = GetTOFMass(p,t);
-                            //   tmpH_MassTOF->Fill(MT,ProbaT);
-                            //   MComb = GetMassFromBeta(p, (GetIBeta(i, false) + (1/t))*0.5 );        
-                            //   tmpH_MassComb->Fill(MComb,ProbaT);
-                            //}}else{
-                            tmpH_MassComb->Fill(MComb,Proba);
-                            //}
-                        }
+                    // p distribution, projection of the weighted (eta, p) on p, overflow included
+                    pred.PDist.assign(EtaP.ny+2,0.);
+                    for(int y=0;y<=EtaP.ny+1;y++){
+                        for(int x=1;x<=EtaP.nx;x++) pred.PDist[y] += EtaP_PE(x,y);
                     }
-
-                    for(int x=0;x<tmpH_Mass->GetNbinsX()+1;x++){
-                        Pred_Prof_Mass    ->SetBinContent(x, pe, tmpH_Mass    ->GetBinContent(x) * PE_P);
-                        Pred_Prof_MassTOF ->SetBinContent(x, pe, tmpH_MassTOF ->GetBinContent(x) * PE_P);
-                        Pred_Prof_MassComb->SetBinContent(x, pe, tmpH_MassComb->GetBinContent(x) * PE_P);
-                        if(isnan((float)(tmpH_Mass    ->GetBinContent(x) * PE_P))){printf("%f x %f\n",tmpH_Mass    ->GetBinContent(x), P /*PE_P*/); fflush(stdout);exit(0);}
+                    double PIntegral = 0;
+                    for(int y=0;y<=EtaP.ny+1;y++) PIntegral += pred.PDist[y];
+                    for(int y=0;y<=EtaP.ny+1;y++) pred.PDist[y] *= 1.0/PIntegral;
+                    for(int i=0;i<I.nx+1;i++){I_PE(i)=RNG.Poisson(I(i));}   scaleFlat(I_PE,1.0/integralFlat(I_PE));
+
+                    pred.Mass.assign(MassNBins+2,0.);
+                    for(int x=0;x<=EtaP.ny+1;x++){
+                        if(pred.PDist[x]<=0.0){continue;}
+                        const double p = (x<EtaP.ny+1)?EtaP.yaxis.GetBinCenter(x):EtaP.yaxis.GetBinCenter(x+3); //overflow bin
+                        for(int y=0;y<I.nx+1;y++){    if(I_PE(y)<=0.0){continue;}  const double i = I.xaxis.GetBinCenter(y);
+                            double Proba = pred.PDist[x] * I_PE(y);  if(Proba<=0 || isnan((float)Proba))continue;
+                            double MI = GetMass(p,i, dEdxK_MC, dEdxC_MC);
+                            pred.Mass[massAxis.FindFixBin(MI)] += Proba;
+                        }
                     }
-            
-                    if (DirName.find("13TeV16G")==string::npos && is2016 && CutIndex == 4) {Pred_EtaPWeighted_PE->SaveAs("Pred_EtaPWeighted_PE.root");/* if (EtaPC) EtaPC->SaveAs("EtaPC.root");*/}
-                    //         delete EtaPC;
-                    delete Pred_P_ProjPE;
-                    delete tmpH_Mass;
-                    delete tmpH_MassTOF;
-                    delete tmpH_MassComb;
                     //----------------------------------------------------------------------------------------------------Prediction in eta bins PZ7
-                    /*
-                    if(E>0){continue;          //Prediction in Pt-Is-TOF space
-                    }else if(A>0){continue;    //Prediction in Pt-Is     space
-                    }else {printf("A==0&&E==0 no eta bins prediction possible, CutIndex= %i5\n",CutIndex);}
-                    */
+                    pred.Mass_CB.assign(MassNBins+2,0.);
+                    pred.Mass_GFA.assign(MassNBins+2,0.);
+                    pred.Mass_GB.assign(MassNBins+2,0.);
+                    pred.Mass_HA.assign(MassNBins+2,0.);
+                    pred.Mass_CF.assign(MassNBins+2,0.);
 
                     double EE=0, AA=0, HH=0, GG=0, CC=0, FF=0, BB=0, MOM=0, ICK=0, MassH=0;
 
                     //loop over eta bins (without overflows)
-                    for (int ee=1;ee<PDF_A_Eta_2D->GetNbinsX()+1;ee++){ 
-                        EE=RNG->Poisson(PDF_E_Eta_2D->GetBinContent(ee));
-                        AA=RNG->Poisson(PDF_A_Eta_2D->GetBinContent(ee));
+                    for (int ee=1;ee<PDF_A.nx+1;ee++){ 
+                        EE=RNG.Poisson(PDF_E(ee));
+                        AA=RNG.Poisson(PDF_A(ee));
                         if(EE>0){         //Prediction in Pt-Is-TOF space for HA only where one has a Mass PDF already
                             //loop over p bins (including overflow)
-                            for(int mm=1;    mm<PDF_H_EtaMass_2D->GetNbinsY()+2;mm++){ 
-                                HH=RNG->Poisson(  PDF_H_EtaMass_2D->GetBinContent(ee,mm));  
-                                MassH=((TAxis*)   PDF_H_EtaMass_2D->GetYaxis())->GetBinCenter(mm); // Mass
-                                Pred_Prof_Mass_HA ->Fill(MassH,pe,HH*AA/EE);
+                            for(int mm=1;    mm<PDF_H.ny+2;mm++){ 
+                                HH=RNG.Poisson(PDF_H(ee,mm));  
+                                MassH=PDF_H.yaxis.GetBinCenter(mm); // Mass
+                                pred.Mass_HA[massAxis.FindFixBin(MassH)] += HH*AA/EE;
                             }
                         }
                         //loop over p bins (without overflows)
-                        for (int pp=1;pp<PDF_C_EtaP_2D->GetNbinsY()+1;pp++){ 
-                            MOM=((TAxis*)   PDF_C_EtaP_2D->GetYaxis())->GetBinCenter(pp); // momentum
-                            GG=RNG->Poisson(PDF_G_EtaP_2D->GetBinContent(ee,pp));
-                            CC=RNG->Poisson(PDF_C_EtaP_2D->GetBinContent(ee,pp));             
-                            for (int ii=0;ii<PDF_B_EtaICK_2D->GetNbinsY()+1;ii++){ //loop over Ias bins (without overflows)
-                                ICK=((TAxis*)   PDF_B_EtaICK_2D->GetYaxis())->GetBinCenter(ii); // ICK
-                                FF=RNG->Poisson(PDF_F_EtaICK_2D->GetBinContent(ee,ii));
-                                BB=RNG->Poisson(PDF_B_EtaICK_2D->GetBinContent(ee,ii));             
+                        for (int pp=1;pp<PDF_C.ny+1;pp++){ 
+                            MOM=PDF_C.yaxis.GetBinCenter(pp); // momentum
+                            GG=RNG.Poisson(PDF_G(ee,pp));
+                            CC=RNG.Poisson(PDF_C(ee,pp));             
+                            for (int ii=0;ii<PDF_B.ny+1;ii++){ //loop over Ias bins (without overflows)
+                                ICK=PDF_B.yaxis.GetBinCenter(ii); // ICK
+                                FF=RNG.Poisson(PDF_F(ee,ii));
+                                BB=RNG.Poisson(PDF_B(ee,ii));             
                                 if(E>0){         //Prediction in Pt-Is-TOF space
                                     if(EE>0&&ICK>0){
-                                        Pred_Prof_Mass_GFA->Fill(MOM*sqrt(ICK),pe,GG*FF/EE*AA/EE);
-                                        Pred_Prof_Mass_GB ->Fill(MOM*sqrt(ICK),pe,GG*BB/EE);
-                                        Pred_Prof_Mass_CF ->Fill(MOM*sqrt(ICK),pe,CC*FF/EE);
+                                        pred.Mass_GFA[massAxis.FindFixBin(MOM*sqrt(ICK))] += GG*FF/EE*AA/EE;
+                                        pred.Mass_GB [massAxis.FindFixBin(MOM*sqrt(ICK))] += GG*BB/EE;
+                                        pred.Mass_CF [massAxis.FindFixBin(MOM*sqrt(ICK))] += CC*FF/EE;
                                     }
                                 }else if(A>0){   //Prediction in Pt-Is     space
                                     if(AA>0&&ICK>0){
-                                        Pred_Prof_Mass_CB ->Fill(MOM*sqrt(ICK),pe,CC*BB/AA);
+                                        pred.Mass_CB [massAxis.FindFixBin(MOM*sqrt(ICK))] += CC*BB/AA;
                                     }
                                 }
                             }
                         }// END loop over p bins
                     }// END loop over eta bins
                     //----------------------------------------------------------------------------------------------------Prediction in eta bins
-	            }// END // loop over pseudo-experiments
+                });// END // loop over pseudo-experiments
                 printf("\n");
 
+                // each pseudo-experiment writes its row, in the order of the pseudo-experiments
+                for(unsigned int pe=0;pe<NPseudoExp;pe++){
+                    const predictionPE& pred = vPE[pe];
+                    //save the predP distribution
+                    for(int x=0;x<=EtaP.ny+1;x++){Pred_P->SetBinContent(CutIndex+1, x, Pred_P->GetBinContent(CutIndex+1, x) + pred.PDist[x] * pred.P);}; // overflow
+
+                    for(int x=0;x<MassNBins+1;x++){
+                        Pred_Prof_Mass    ->SetBinContent(x, pe, pred.Mass[x] * pred.P);
+                        Pred_Prof_MassTOF ->SetBinContent(x, pe, 0);
+                        Pred_Prof_MassComb->SetBinContent(x, pe, pred.Mass[x] * pred.P);
+                        if(isnan((float)(pred.Mass[x] * pred.P))){printf("%f x %f\n",pred.Mass[x], P /*PE_P*/); fflush(stdout);exit(0);}
+                    }
+                    // as Fill(mass, pe, weight) did, pseudo-experiment pe is in the y bin pe+1 of the eta bins predictions
+                    for(int x=0;x<MassNBins+2;x++){
+                        Pred_Prof_Mass_CB ->SetBinContent(x, pe+1, pred.Mass_CB[x]);
+                        Pred_Prof_Mass_GFA->SetBinContent(x, pe+1, pred.Mass_GFA[x]);
+                        Pred_Prof_Mass_GB ->SetBinContent(x, pe+1, pred.Mass_GB[x]);
+                        Pred_Prof_Mass_HA ->SetBinContent(x, pe+1, pred.Mass_HA[x]);
+                        Pred_Prof_Mass_CF ->SetBinContent(x, pe+1, pred.Mass_CF[x]);
+                    }
+                }
+                if (saveEtaP) {
+                    for(int x=0;x<=EtaP.nx+1;x++){
+                        for(int y=0;y<=EtaP.ny+1;y++) Pred_EtaPWeighted_PE->SetBinContent(x,y,vPE.back().EtaP[x*EtaP.stride()+y]);
+                    }
+                    Pred_EtaPWeighted_PE->SaveAs("Pred_EtaPWeighted_PE.root");
+                }
+
                 TH2D* MassesLooseCut = NULL;
                 if (CutIndex == 4) MassesLooseCut = new TH2D ("MassesLooseCut", "MassesLooseCut", NPseudoExp, 0, NPseudoExp, MassNBins,0,MassHistoUpperBound);
                 //       vector <double> masses;
@@ -802,19 +818,13 @@ void Analysis_Step2_BackgroundPrediction(string RootFile, int TypeMode)
                 if (MassesLooseCut && is2016 && DirName.find("13TeV16G")==string::npos){
                     MassesLooseCut->SaveAs("MassesLooseCut.root");Pred_EtaPWeighted_PE->SaveAs("Pred_EtaP_Weighted_PE.root"); delete MassesLooseCut;
                 }
-                delete Pred_EtaB_Proj_PE;
-                delete Pred_EtaS_Proj_PE;
-                delete Pred_EtaS2_Proj_PE;
 
                 delete Pred_Prof_Mass;
                 delete Pred_Prof_MassTOF;
                 delete Pred_Prof_MassComb;
                 delete Pred_EtaPWeighted_PE;
-                delete Pred_I_ProjPE;
-                delete Pred_T_ProjPE;
 
                 delete Pred_I_Proj;
-                delete Pred_T_Proj;
                 delete Pred_EtaB_Proj;
                 delete Pred_EtaS_Proj;
                 delete Pred_EtaS2_Proj;
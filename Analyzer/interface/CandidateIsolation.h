@@ -0,0 +1,193 @@
+#ifndef SUSYBSMAnalysis_Analyzer_CandidateIsolation_h
+#define SUSYBSMAnalysis_Analyzer_CandidateIsolation_h
+
+#include <vector>
+
+#include "DataFormats/Common/interface/Handle.h"
+#include "DataFormats/ParticleFlowCandidate/interface/PFCandidate.h"
+#include "DataFormats/ParticleFlowCandidate/interface/PFCandidateFwd.h"
+#include "DataFormats/TrackReco/interface/Track.h"
+#include "DataFormats/TrackReco/interface/TrackFwd.h"
+
+#include "SUSYBSMAnalysis/Analyzer/interface/CommonFunction.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/EtaPhiGrid.h"
+
+//=============================================================
+//
+//     PF and track isolation of an HSCP candidate
+//
+//     Everything the candidate loop needs from the PF
+//     candidates and the general tracks around the candidate
+//     track. It only reads the event collections and the grids,
+//     so the records of all the candidates of an event can be
+//     computed concurrently, each in its own record, before
+//     the candidate loop reads them. The sums are done in the
+//     order of the grid queries, as in the candidate loop.
+//
+//=============================================================
+
+struct pfIsoSums {
+  float charHadPt = 0;  // charged hadrons from the PV
+  float neutHadPt = 0;
+  float photonPt = 0;
+  float puPt = 0;  // charged hadrons not from the PV
+};
+
+struct candidateIsolation {
+  // PF candidate built from the candidate track
+  bool pf_isPfTrack = false;
+  bool pf_isMuon = false, pf_isElectron = false, pf_isChHadron = false, pf_isNeutHadron = false;
+  bool pf_isPhoton = false, pf_isUndefined = false;
+  float pf_energy = 0, pf_ecal_energy = 0, pf_hcal_energy = 0;
+  float EleGsfMomentum = 0, ElePFMomentum = 0, EleFbremLost = 0;
+
+  // PF cone sums, the candidate track is not in
+  pfIsoSums PFIso005, PFIso01, PFIso03, PFIso05;
+  pfIsoSums PFMiniIso;
+  float PFMiniIso_sumMuonPt = 0;
+  float PFMiniIso_sumLeptonPt = 0;
+  float PFMiniIso_otherPt = 0;
+
+  // general track cone sums, the candidate track is not in
+  float genTrackMiniIsoSumPt = 0;
+  float genTrackIsoSumPt_dr03 = 0;
+
+  // dz: of the track to the PV, pfCandOfTrack: first PF candidate index by track key, -1 if none,
+  // nextPfCandOfTrack: next PF candidate index with the same track by PF candidate index, -1 if none
+  void compute(const reco::TrackRef& track,
+               float dz,
+               const edm::Handle<reco::PFCandidateCollection>& pfCandHandle,
+               const std::vector<int>& pfCandOfTrack,
+               const std::vector<int>& nextPfCandOfTrack,
+               const etaPhiGrid& pfCandGrid,
+               const edm::Handle<reco::TrackCollection>& trackCollectionHandle,
+               const etaPhiGrid& trackGrid,
+               std::vector<unsigned int>& coneIndices) {
+    float drForMiniIso = 0.0;
+    if (track->pt() < 50) {
+      drForMiniIso = 0.2;
+    } else if (track->pt() < 200) {
+      drForMiniIso = 10 / track->pt();
+    } else {
+      drForMiniIso = 0.05;
+    }
+
+    if (pfCandHandle.isValid() && !pfCandHandle->empty()) {
+      const reco::PFCandidateCollection* pf = pfCandHandle.product();
+      // the PF candidates built from the track, in collection order, the last one sets the PF type
+      for (int j = track.key() < pfCandOfTrack.size() ? pfCandOfTrack[track.key()] : -1; j >= 0;
+           j = nextPfCandOfTrack[j]) {
+        const reco::PFCandidate* pfCand = &(*pf)[j];
+        const auto type = pfCand->translatePdgIdToType(pfCand->pdgId());
+        pf_isElectron = type == reco::PFCandidate::ParticleType::e;
+        if (pf_isElectron) {
+          const auto& gsfTrackRef = pfCand->gsfTrackRef();
+          const auto& gsfEleRef = pfCand->gsfElectronRef();
+          if (gsfTrackRef.isNonnull()) {
+            EleGsfMomentum = gsfTrackRef->p();
+            EleFbremLost = gsfEleRef->fbrem();
+            ElePFMomentum = pfCand->p4().P();
+          }
+        }
+        pf_isMuon = type == reco::PFCandidate::ParticleType::mu;
+        pf_isPhoton = type == reco::PFCandidate::ParticleType::gamma;
+        pf_isChHadron = type == reco::PFCandidate::ParticleType::h;
+        pf_isNeutHadron = type == reco::PFCandidate::ParticleType::h0;
+        pf_isUndefined = type == reco::PFCandidate::ParticleType::X;
+        pf_isPfTrack = true;
+        pf_energy = pfCand->ecalEnergy() + pfCand->hcalEnergy();
+        pf_ecal_energy = pfCand->ecalEnergy();
+        pf_hcal_energy = pfCand->hcalEnergy();
+      }
+
+      // https://github.com/cms-sw/cmssw/blob/72d0fc00976da53d1fb745eb7f37b2a4ad965d7e/
+      // PhysicsTools/PatAlgos/plugins/PATIsolatedTrackProducer.cc#L555
+      const bool fromPV = (fabs(dz) < 0.1);
+      pfCandGrid.query(track->eta(), track->phi(), 0.5, coneIndices);
+      for (unsigned int i : coneIndices) {
+        const reco::PFCandidate* pfCand = &(*pf)[i];
+        if (pfCand->trackRef().isNonnull() && pfCand->trackRef().key() == track.key())
+          continue;
+        const auto type = pfCand->translatePdgIdToType(pfCand->pdgId());
+        const bool isElectron = type == reco::PFCandidate::ParticleType::e;
+        const bool isMuon = type == reco::PFCandidate::ParticleType::mu;
+        const bool isPhoton = type == reco::PFCandidate::ParticleType::gamma;
+        const bool isChHadron = type == reco::PFCandidate::ParticleType::h;
+        const bool isNeutHadron = type == reco::PFCandidate::ParticleType::h0;
+
+        float dr = deltaR(pfCand->eta(), pfCand->phi(), track->eta(), track->phi());
+        float pt = pfCand->p4().pt();
+        if (dr < drForMiniIso) {
+          // Leptons get added to trackIso (this is not in the official definition)
+          if (isElectron || isMuon)
+            PFMiniIso_sumLeptonPt += pt;
+          if (isChHadron && fromPV)
+            PFMiniIso.charHadPt += pt;
+          else if (isChHadron)
+            PFMiniIso.puPt += pt;
+          if (isNeutHadron)
+            PFMiniIso.neutHadPt += pt;
+          if (isPhoton)
+            PFMiniIso.photonPt += pt;
+          if (isMuon)
+            PFMiniIso_sumMuonPt += pt;
+          if (!isElectron && !isMuon && !isChHadron && !isNeutHadron && !isPhoton)
+            PFMiniIso_otherPt += pt;
+        }
+        if (dr < 0.05) {
+          if (isChHadron && fromPV)
+            PFIso005.charHadPt += pt;
+          else if (isChHadron)
+            PFIso005.puPt += pt;
+          if (isNeutHadron)
+            PFIso005.neutHadPt += pt;
+          if (isPhoton)
+            PFIso005.photonPt += pt;
+        }
+        if (dr < 0.1) {
+          if (isChHadron && fromPV)
+            PFIso01.charHadPt += pt;
+          else if (isChHadron)
+            PFIso01.puPt += pt;
+          if (isNeutHadron)
+            PFIso01.neutHadPt += pt;
+          if (isPhoton)
+            PFIso01.photonPt += pt;
+        }
+        // the 0.3 and 0.5 cones count a candidate in a single category
+        if (dr < 0.3)
+          addExclusive(PFIso03, pt, isChHadron, fromPV, isNeutHadron, isPhoton);
+        if (dr < 0.5)
+          addExclusive(PFIso05, pt, isChHadron, fromPV, isNeutHadron, isPhoton);
+      }
+    }
+
+    trackGrid.query(track->eta(), track->phi(), 0.3, coneIndices);
+    for (unsigned int c : coneIndices) {
+      reco::TrackRef genTrackRef = reco::TrackRef(trackCollectionHandle.product(), c);
+      // Dont count the HSCP candidate in
+      if (genTrackRef.isNonnull() && genTrackRef.key() != track.key()) {
+        float pt = genTrackRef->pt();
+        float dr = deltaR(genTrackRef->eta(), genTrackRef->phi(), track->eta(), track->phi());
+        if (dr < 0.3)
+          genTrackIsoSumPt_dr03 += pt;
+        if (dr < drForMiniIso)
+          genTrackMiniIsoSumPt += pt;
+      }
+    }
+  }
+
+private:
+  static void addExclusive(pfIsoSums& sums, float pt, bool isChHadron, bool fromPV, bool isNeutHadron, bool isPhoton) {
+    if (isChHadron && fromPV)
+      sums.charHadPt += pt;
+    else if (isChHadron)
+      sums.puPt += pt;
+    else if (isNeutHadron)
+      sums.neutHadPt += pt;
+    else if (isPhoton)
+      sums.photonPt += pt;
+  }
+};
+
+#endif
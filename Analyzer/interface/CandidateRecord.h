@@ -0,0 +1,197 @@
+#ifndef SUSYBSMAnalysis_Analyzer_CandidateRecord_h
+#define SUSYBSMAnalysis_Analyzer_CandidateRecord_h
+
+#include <cmath>
+#include <vector>
+
+#include "DataFormats/HepMCCandidate/interface/GenParticle.h"
+#include "DataFormats/Math/interface/deltaR.h"
+#include "DataFormats/MuonReco/interface/MuonTimeExtra.h"
+#include "DataFormats/TrackReco/interface/DeDxData.h"
+#include "DataFormats/TrackReco/interface/DeDxHitInfo.h"
+#include "DataFormats/TrackReco/interface/Track.h"
+#include "DataFormats/TrackReco/interface/TrackFwd.h"
+
+#include "SUSYBSMAnalysis/Analyzer/interface/CandidateIsolation.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/DeDxEstimator.h"
+
+//=============================================================
+//
+//     Pre-computed quantities of an HSCP candidate
+//
+//     The isolation, the gen matching, the dE/dx estimators
+//     and the recomputed TOF of a candidate only read the event
+//     collections and the calibrations. Each candidate has its
+//     own dE/dx hit table and CPE cache, and each thread its own
+//     copy of the timing calculator, so the records of all the
+//     candidates of an event are computed concurrently before
+//     the candidate loop, which then fills the histograms and
+//     the tree from them in order. Records are not modified
+//     once computed.
+//
+//=============================================================
+
+struct candidateGenMatch {
+  int closestGenIndex = -1;
+  float dRMinGen = 9999.0;
+  float dPtMinGen = 9999.0;
+  // status 91 / > 2 in the 0.001 environment of the closest gen particle
+  bool envHasStatus91 = false;
+  bool envHasStatusHigherThan2 = false;
+
+  // onlyHSCP: only the particles for which isHSCP is true are matched
+  template <class IsHSCP>
+  void compute(const std::vector<reco::GenParticle>& genColl,
+               const reco::Track& track,
+               bool onlyHSCP,
+               const IsHSCP& isHSCP) {
+    for (unsigned int g = 0; g < genColl.size(); g++) {
+      if (onlyHSCP && !isHSCP(genColl[g]))
+        continue;
+      if (genColl[g].pt() < 5)
+        continue;
+      if (genColl[g].status() != 1)
+        continue;
+
+      float dr = deltaR(genColl[g].eta(), genColl[g].phi(), track.eta(), track.phi());
+      float dPt = (fabs(genColl[g].pt() - track.pt())) / track.pt();
+      if (dr < dRMinGen) {
+        dRMinGen = dr;
+        closestGenIndex = g;
+      }
+      if (dPt < dPtMinGen) {
+        dPtMinGen = dPt;
+      }
+    }
+
+    // the first gen particle stands for the candidate when the closest one is not after it
+    unsigned int closest = closestGenIndex > 0 ? closestGenIndex : 0;
+    for (unsigned int g = 0; g < genColl.size(); g++) {
+      // Exclude the canidate when looking at its envirment
+      if (g == closest)
+        continue;
+      if (deltaR(genColl[g].eta(), genColl[g].phi(), genColl[closest].eta(), genColl[closest].phi()) > 0.001)
+        continue;
+      if (genColl[g].status() == 91)
+        envHasStatus91 = true;
+      if (genColl[g].status() > 2)
+        envHasStatusHigherThan2 = true;
+    }
+  }
+};
+
+struct candidateDeDx {
+  // Ih-like estimators
+  reco::DeDxData Ih, IhUp, IhNoL1, Ih15drop, IhStripOnly, IhStripOnly15drop, IhPixelOnlyNoL1,
+      IhSaturationCorrectionFromFits;
+  // error of the last harmonic-2 estimator with an error, in the order above
+  float dEdxErr = 0;
+  // empty without templates, otherwise: Ias, Ias no BPIXL1, Ias without TIB, TID and 3 first TEC layers,
+  // Ias pixel only, Ias strip only, Ias pixel only no BPIXL1, Is strip only, FiStrips
+  std::vector<reco::DeDxData> ias;
+
+  // table: hit table of the candidate, filled here and kept for the other estimators of the candidate loop
+  void compute(dedxHitTable& table,
+               pixelCPECache& cpeCache,
+               const trackerDetTable& detTable,
+               const reco::TrackRef& track,
+               const reco::DeDxHitInfo* dedxHits,
+               const float* scaleFactors,
+               const dedxTemplate* iasTemplates,
+               bool useClusterCleaning,
+               bool mustBeInside,
+               size_t MaxStripNOM,
+               bool useTemplateLayer,
+               bool correctFEDSat) {
+    // Decode and clean the hits of the track once, all the dEdx estimators below are evaluated on this table
+    // dedxEstimator: templates, usePixel, useStrip, useClusterCleaning, useTruncated,
+    //                mustBeInside, MaxStripNOM, lowDeDxDrop, computeError, useTemplateLayer_,
+    //                skipPixelL1, skip_templates_ias, symmetricSmirnov, useMorrisMethod, usePixelClusterCleaning
+    table.fill(track->eta(), dedxHits, scaleFactors, detTable, cpeCache, track.key(),
+               track->px(), track->py(), track->pz(), track->charge(), correctFEDSat);
+
+    //correction inverseXtalk = 1 --> modify the amplitudes based on xtalk for non-saturated cluster + correct for saturation
+    //(always applied by the hit table)
+    //
+    //skip_templates_ias = 0 --> no skip
+    //skip_templates_ias = 1 --> no Pix, no TIB, no TID, no 3 first layers TEC
+    //skip_templates_ias = 2 --> Pixel Only
+
+    // Ih
+    Ih = table.evaluate(
+        dedxEstimator(nullptr, true, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, true, useTemplateLayer),
+        &dEdxErr);
+    // Ih Up
+    IhUp = table.evaluate(
+        dedxEstimator(nullptr, true, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.15, false, useTemplateLayer));
+    // Ih no pixel L1
+    IhNoL1 = table.evaluate(dedxEstimator(nullptr, true, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, true,
+                                          useTemplateLayer, true),
+                            &dEdxErr);
+    // Ih 0.15 low values drop
+    // Should useTruncated be true ?
+    Ih15drop = table.evaluate(
+        dedxEstimator(nullptr, true, true, useClusterCleaning, true, mustBeInside, MaxStripNOM, 0.15, true, useTemplateLayer),
+        &dEdxErr);
+    // Ih Strip only
+    IhStripOnly = table.evaluate(
+        dedxEstimator(nullptr, false, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, true, useTemplateLayer),
+        &dEdxErr);
+    // Ih Strip only and 0.15 low values drop
+    IhStripOnly15drop = table.evaluate(dedxEstimator(nullptr, false, true, useClusterCleaning, true, mustBeInside, MaxStripNOM,
+                                                     0.15, true, useTemplateLayer, true),
+                                       &dEdxErr);
+    // Ih Pixel only no BPIXL1
+    IhPixelOnlyNoL1 = table.evaluate(dedxEstimator(nullptr, true, false, useClusterCleaning, false, mustBeInside, MaxStripNOM,
+                                                   0.0, true, useTemplateLayer, true),
+                                     &dEdxErr);
+    // Ih correct saturation from fits
+    // crossTalkInvAlgo = 2 was always overridden to 1 in computedEdx, so this is the same as Ih Strip only
+    IhSaturationCorrectionFromFits = table.evaluate(dedxEstimator(nullptr, false, true, useClusterCleaning, false, mustBeInside,
+                                                                  MaxStripNOM, 0.0, true, useTemplateLayer, true),
+                                                    &dEdxErr);
+
+    if (iasTemplates) {
+      std::vector<dedxEstimator> iasEstimators = {
+          //globalIas_
+          dedxEstimator(iasTemplates, true, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, false, useTemplateLayer),
+          //globalIas_ no BPIXL1
+          dedxEstimator(iasTemplates, true, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, false, useTemplateLayer,
+                        true, 2),
+          //globalIas_ without TIB, TID, and 3 first TEC layers
+          dedxEstimator(iasTemplates, true, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, false, useTemplateLayer,
+                        true, 1),
+          //globalIas_ Pixel only
+          dedxEstimator(iasTemplates, true, false, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, false, useTemplateLayer,
+                        false, 2),
+          //globalIas_ Strip only
+          dedxEstimator(iasTemplates, false, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, false, useTemplateLayer,
+                        false, 0),
+          //globalIas_ Pixel only no BPIXL1
+          dedxEstimator(iasTemplates, true, false, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, false, useTemplateLayer,
+                        true, 2),
+          //symmetric Smirnov discriminator - Is
+          dedxEstimator(iasTemplates, true, false, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, false, useTemplateLayer,
+                        true, 2, true),
+          // the FiStrips variable
+          dedxEstimator(iasTemplates, false, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, false, useTemplateLayer,
+                        false, 0, false, true)};
+      table.evaluate(iasEstimators, ias);
+    }
+  }
+};
+
+struct candidateTOF {
+  // recomputed with the time offsets of the run, otherwise the TOF maps of the event are used
+  bool recomputed = false;
+  reco::MuonTimeExtra dt, csc, combined;
+};
+
+struct candidateRecord {
+  candidateIsolation iso;
+  candidateGenMatch gen;
+  candidateDeDx dedx;
+  candidateTOF tof;
+};
+
+#endif
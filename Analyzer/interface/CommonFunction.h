@@ -11,6 +11,11 @@
 // Need to load the correction parameters from a file
 //
 //=======================================================================================
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "SaturationCorrection.h"  // New procedure for the correction of the saturation phenomena
 SaturationCorrection sc;
 void LoadCorrectionParameters() {
@@ -67,6 +72,102 @@ void LoadCorrectionParameters() {
    float scaleValR2[calmax];
    float errorScaleValR2[calmax];
 
+//====================================================================
+//
+//  Pixel scale factors resolved for one year and run
+//
+//  One value per BPIX layer and per FPIX side, so that the scale
+//  factor of a module is a single array read.
+//
+//====================================================================
+
+struct pixelGains {
+  pixelGains() {
+    std::fill(bpix, bpix + 16, 1.f);
+    std::fill(fpix, fpix + 4, 1.f);
+  }
+
+  float operator()(int subdetid_, UInt_t detid_) const {
+    if (subdetid_ == 1) return bpix[(detid_ >> bpixShift) & 0xF];
+    if (subdetid_ == 2) return fpix[(detid_ >> 23) & 0x3];  // 1=FPIX- 2=FPIX+
+    return 1.;
+  }
+
+  float bpix[16];  // by layer
+  float fpix[4];   // by side
+  int bpixShift = 20;  // 16 for the 2016 detids
+};
+
+//====================================================================
+//
+//  Pixel scale factor tables of all the layers and sides
+//
+//  Copy of the run ranges read by loadSFPixel, resolved into a
+//  pixelGains when the run changes. The run ranges and the edge
+//  cases (unknown layer: 0, no range found or no year: 1) are the
+//  ones of the former per-hit lookup.
+//
+//====================================================================
+
+class pixelGainTable {
+public:
+  enum { L1, L2, L3, L4, R1, R2, nTables };
+
+  void load() {
+    set(L1, irunMinValL1, scaleValL1, icalibL1, icalibL1_2017);
+    set(L2, irunMinValL2, scaleValL2, icalibL2, icalibL2_2017);
+    set(L3, irunMinValL3, scaleValL3, icalibL3, icalibL3_2017);
+    set(L4, irunMinValL4, scaleValL4, icalibL4, icalibL4_2017);
+    set(R1, irunMinValR1, scaleValR1, icalibR1, icalibR1_2017);
+    set(R2, irunMinValR2, scaleValR2, icalibR2, icalibR2_2017);
+  }
+
+  pixelGains resolve(const std::string& year, int run) const {
+    pixelGains gains;
+    if (year.empty()) return gains;
+    if (year == "2016") gains.bpixShift = 16;
+    std::fill(gains.bpix, gains.bpix + 16, 0.f);
+    std::fill(gains.fpix, gains.fpix + 4, 0.f);
+    const bool is2017 = (year == "2017"), is2018 = (year == "2018");
+    for (int l = 1; l <= 4; l++)
+      gains.bpix[l] = (is2017 || is2018) ? scale(tables_[L1 + l - 1], is2018, run) : 1.;
+    for (int s = 1; s <= 2; s++)
+      gains.fpix[s] = (is2017 || is2018) ? scale(tables_[R1 + s - 1], is2018, run) : 1.;
+    return gains;
+  }
+
+private:
+  struct calib {
+    std::vector<int> runMin;  // one more than scale, the end of the last 2017 range
+    std::vector<float> scale;
+    int n2017 = 0;
+  };
+
+  void set(int table, const int* runMin, const float* scale, int n, int n2017) {
+    calib& c = tables_[table];
+    n = std::max(0, n);
+    c.runMin.assign(runMin, runMin + std::min(n + 1, calmax));
+    c.scale.assign(scale, scale + n);
+    c.n2017 = std::min(n2017, n);
+  }
+
+  static float scale(const calib& c, bool is2018, int run) {
+    const int n = c.scale.size();
+    const int last = c.runMin.size() - 1;
+    const int begin = is2018 ? c.n2017 : 0;
+    const int end = is2018 ? n - 1 : c.n2017;
+    for (int i = begin; i < end && i < last; i++) {
+      if (run >= c.runMin[i] && run < c.runMin[i + 1]) return c.scale[i];
+    }
+    if (is2018 && n > 0 && run >= c.runMin[n - 1]) return c.scale[n - 1];
+    return 1.;
+  }
+
+  calib tables_[nTables];
+};
+
+pixelGainTable pixelGainCalib;
+
 
 //====================================================================
 //
@@ -244,6 +345,8 @@ void loadSFPixel(int sampleType_) {
    }
    icalibR2_2018=icalibR2-icalibR2_2017;
    file_calib12.close ();
+
+   pixelGainCalib.load();
 }
 
 //====================================================================
@@ -252,187 +355,7 @@ void loadSFPixel(int sampleType_) {
 //
 //====================================================================
 float GetSFPixel(int subdetid_, UInt_t detid_, string year, int run) {
-
-    if(year=="") return 1.;
-   int pix = 0;
-   int layerorside = 0;
-
-   if (subdetid_==1) {
-        pix =1 ;
-        if (year=="2016") {
-                layerorside = int((detid_>>16)&0xF);
-        }
-        else {
-                layerorside = int((detid_>>20)&0xF);
-        }
-
-   }
-   if (subdetid_==2) {
-        pix =2 ;
-        layerorside = int((detid_>>23)&0x3); // 1=FPIX- 2=FPIX+
-   }
-
-   float scale =1 ;
-   if (pix==1) {
-     if (layerorside==1) {
-
-       if (year=="2017") {
-        for (int i=0; i<icalibL1_2017; i++) {
-         if (run >= irunMinValL1[i] && run<irunMinValL1[i+1]) {
-                scale = scaleValL1[i];
-                return scale;
-         }
-        }
-       }
-       else if (year=="2018") {
-        for (int i=icalibL1_2017; i<icalibL1-1; i++) {
-         if (run >= irunMinValL1[i] && run<irunMinValL1[i+1]) {
-                scale = scaleValL1[i];
-                return scale;
-         }
-        }
-        if (run >= irunMinValL1[icalibL1-1]) {
-                scale = scaleValL1[icalibL1-1];
-                return scale;
-        }
-       }
-
-     }
-     else if (layerorside==2) {
-
-       if (year=="2017") {
-        for (int i=0; i<icalibL2_2017; i++) {
-         if (run >= irunMinValL2[i] && run<irunMinValL2[i+1]) {
-                scale = scaleValL2[i];
-                return scale;
-         }
-        }
-       }
-       else if (year=="2018") {
-        for (int i=icalibL2_2017; i<icalibL2-1; i++) {
-         if (run >= irunMinValL2[i] && run<irunMinValL2[i+1]) {
-                scale = scaleValL2[i];
-                return scale;
-         }
-        }
-        if (run >= irunMinValL2[icalibL2-1]) {
-                scale = scaleValL2[icalibL2-1];
-                return scale;
-        }
-       }
-
-     }
-     else if (layerorside==3) {
-
-       if (year=="2017") {
-        for (int i=0; i<icalibL3_2017; i++) {
-         if (run >= irunMinValL3[i] && run<irunMinValL3[i+1]) {
-                scale = scaleValL3[i];
-                return scale;
-         }
-        }
-       }
-       else if (year=="2018") {
-        for (int i=icalibL3_2017; i<icalibL3-1; i++) {
-         if (run >= irunMinValL3[i] && run<irunMinValL3[i+1]) {
-                scale = scaleValL3[i];
-                return scale;
-         }
-        }
-        if (run >= irunMinValL3[icalibL3-1]) {
-                scale = scaleValL3[icalibL3-1];
-                return scale;
-        }
-       }
-
-     }
-     else if (layerorside==4) {
-
-       if (year=="2017") {
-        for (int i=0; i<icalibL4_2017; i++) {
-         if (run >= irunMinValL4[i] && run<irunMinValL4[i+1]) {
-                scale = scaleValL4[i];
-                return scale;
-         }
-        }
-       }
-       else if (year=="2018") {
-        for (int i=icalibL4_2017; i<icalibL4-1; i++) {
-         if (run >= irunMinValL4[i] && run<irunMinValL4[i+1]) {
-                scale = scaleValL4[i];
-                return scale;
-         }
-        }
-        if (run >= irunMinValL4[icalibL4-1]) {
-                scale = scaleValL4[icalibL4-1];
-                return scale;
-        }
-       }
-
-     }
-     else {
-        std::cout << "unknowm layer number in Barrel Pixel " << layerorside << std::endl;
-        return 0;
-     }
-
-   }
-   else if (pix==2) {
-     if (layerorside==1) {
-
-       if (year=="2017") {
-        for (int i=0; i<icalibR1_2017; i++) {
-         if (run >= irunMinValR1[i] && run<irunMinValR1[i+1]) {
-                scale = scaleValR1[i];
-                return scale;
-         }
-        }
-       }
-       else if (year=="2018") {
-        for (int i=icalibR1_2017; i<icalibR1-1; i++) {
-         if (run >= irunMinValR1[i] && run<irunMinValR1[i+1]) {
-                scale = scaleValR1[i];
-                return scale;
-         }
-        }
-        if (run >= irunMinValR1[icalibR1-1]) {
-                scale = scaleValR1[icalibR1-1];
-                return scale;
-        }
-       }
-
-     }
-     else if (layerorside==2) {
-
-       if (year=="2017") {
-        for (int i=0; i<icalibR2_2017; i++) {
-         if (run >= irunMinValR2[i] && run<irunMinValR2[i+1]) {
-                scale = scaleValR2[i];
-                return scale;
-         }
-        }
-       }
-       else if (year=="2018") {
-        for (int i=icalibR2_2017; i<icalibR2-1; i++) {
-         if (run >= irunMinValR2[i] && run<irunMinValR2[i+1]) {
-                scale = scaleValR2[i];
-                return scale;
-         }
-        }
-        if (run >= irunMinValR2[icalibR2-1]) {
-                scale = scaleValR2[icalibR2-1];
-                return scale;
-        }
-       }
-
-     }
-     else {
-        std::cout << "unknowm ring number in EndCap Pixel " << layerorside << std::endl;
-        return 0;
-     }
-   }
-
-   return scale;
-
+  return pixelGainCalib.resolve(year, run)(subdetid_, detid_);
 }
 
 
@@ -812,7 +735,7 @@ public:
 
   void SetHIPTrackLossRate(const edm::Event& iEvent,
                            edm::EDGetTokenT<std::vector<reco::Vertex>> offlinePrimaryVerticesToken) {
-    std::vector<reco::Vertex> vertexColl = iEvent.get(offlinePrimaryVerticesToken);
+    const std::vector<reco::Vertex>& vertexColl = iEvent.get(offlinePrimaryVerticesToken);
     if (vertexColl.size() < 1) {
       lossRate = 1.0;
       return;
@@ -1025,101 +948,166 @@ std::vector<int> Correction(const std::vector<int>& Q,
 
 
 
-std::vector<int> SaturationCorrection(const std::vector<int>&  Q, const float x1, const float x2, bool way,float threshold,float thresholdSat) {
-  const unsigned N=Q.size();
-  std::vector<int> QII;
-  std::vector<float> QI(N,0);
+//=============================================================
+//
+//     Inverse of the strip cross-talk matrix
+//
+//     The matrix only depends on the cluster size (2 to 8
+//     strips) and on the x1, x2 couplings, so its inverses are
+//     computed once with TMatrix::InvertFast, as CrossTalkInv
+//     used to do for each cluster, and kept as float tables.
+//
+//=============================================================
 
-//---  only for one max well-defined
- if(Q.size()<2 || Q.size()>8){
-        for (unsigned int i=0;i<Q.size();i++){
-                QII.push_back((int) Q[i]);
+class crossTalkInverse {
+public:
+  static const unsigned int minSize = 2;
+  static const unsigned int maxSize = 8;
+
+  crossTalkInverse(const float x1, const float x2) : x1_(x1), x2_(x2) {
+    for (unsigned int N = minSize; N <= maxSize; N++) {
+      Double_t a = 1 - 2 * x1 - 2 * x2;
+      TMatrix A(N, N);
+      for (unsigned int i = 0; i < N; i++) {
+        A(i, i) = a;
+        if (i < N - 1) {
+          A(i + 1, i) = x1;
+          A(i, i + 1) = x1;
+        } else
+          continue;
+        if (i < N - 2) {
+          A(i + 2, i) = x2;
+          A(i, i + 2) = x2;
         }
-        return QII;
+      }
+      A.InvertFast();
+      for (unsigned int i = 0; i < N; i++)
+        for (unsigned int j = 0; j < N; j++)
+          inv_[N][i][j] = A(i, j);
+    }
   }
- if(way){
-          vector<int>::const_iterator mQ = max_element(Q.begin(), Q.end())      ;
-          if(*mQ>253){
-                 if(*mQ==255 && *(mQ-1)>253 && *(mQ+1)>253 ) return Q ;
-                 if(*(mQ-1)>thresholdSat && *(mQ+1)>thresholdSat && *(mQ-1)<254 && *(mQ+1)<254 &&  abs(*(mQ-1) - *(mQ+1)) < 40 ){
-                     QII.push_back((10*(*(mQ-1))+10*(*(mQ+1)))/2); return QII;}
-          }
-      else{
-          return Q; // no saturation --> no x-talk inversion
+
+  float x1() const { return x1_; }
+  float x2() const { return x2_; }
+
+  // row i of the inverse for a cluster of N strips
+  const float* row(unsigned int N, unsigned int i) const { return inv_[N][i]; }
+
+private:
+  float x1_, x2_;
+  float inv_[maxSize + 1][maxSize][maxSize];
+};
+
+// the nominal couplings are built once, other ones are rebuilt when they change
+const crossTalkInverse& getCrossTalkInverse(const float x1, const float x2) {
+  static const crossTalkInverse nominal(0.10, 0.04);
+  if (x1 == nominal.x1() && x2 == nominal.x2())
+    return nominal;
+  thread_local std::unique_ptr<crossTalkInverse> other;
+  if (!other || x1 != other->x1() || x2 != other->x2())
+    other.reset(new crossTalkInverse(x1, x2));
+  return *other;
+}
+
+// Q has N strips, the corrected cluster is written in QII (at most N strips) and its size is returned
+unsigned int SaturationCorrection(const int* Q, unsigned int N, int* QII, bool way, float thresholdSat) {
+  std::copy(Q, Q + N, QII);
+//---  only for one max well-defined
+  if (N < 2 || N > 8)
+    return N;
+  if (way) {
+    const int* mQ = std::max_element(Q, Q + N);
+    if (*mQ > 253) {
+      if (*mQ == 255 && *(mQ - 1) > 253 && *(mQ + 1) > 253)
+        return N;
+      if (*(mQ - 1) > thresholdSat && *(mQ + 1) > thresholdSat && *(mQ - 1) < 254 && *(mQ + 1) < 254 &&
+          abs(*(mQ - 1) - *(mQ + 1)) < 40) {
+        QII[0] = (10 * (*(mQ - 1)) + 10 * (*(mQ + 1))) / 2;
+        return 1;
       }
+    }
   }
 //---
  // do nothing else
- return Q;
+  return N;
 }
 
-std::vector<int> CrossTalkInv(const std::vector<int>& Q,
-                              const float x1 = 0.10,
-                              const float x2 = 0.04,
-                              bool way = true,
-                              float threshold = 20,
-                              float thresholdSat = 25,
-                              bool isClusterCleaning = false) {
-  const unsigned N = Q.size();
-  std::vector<int> QII;
-  std::vector<float> QI(N, 0);
-  Double_t a = 1 - 2 * x1 - 2 * x2;
-  //  bool debugbool=false;
-  TMatrix A(N, N);
+std::vector<int> SaturationCorrection(const std::vector<int>&  Q, const float x1, const float x2, bool way,float threshold,float thresholdSat) {
+  std::vector<int> QII(Q.size());
+  QII.resize(SaturationCorrection(Q.data(), Q.size(), QII.data(), way, thresholdSat));
+  return QII;
+}
 
+// Q has N strips, the inverted cluster is written in QII (at most N strips) and its size is returned
+unsigned int CrossTalkInv(const int* Q,
+                          unsigned int N,
+                          int* QII,
+                          const float x1,
+                          const float x2,
+                          bool way,
+                          float threshold,
+                          float thresholdSat) {
   //---
-  if (Q.size() < 2 || Q.size() > 8) {
-    for (unsigned int i = 0; i < Q.size(); i++) {
-      QII.push_back((int)Q[i]);
-    }
-    return QII;
+  if (N < crossTalkInverse::minSize || N > crossTalkInverse::maxSize) {
+    std::copy(Q, Q + N, QII);
+    return N;
   }
 
-  if(way){
-      std::vector<int>::const_iterator mQ = max_element(Q.begin(), Q.end()) ;
-      if(*mQ>253){
-         if(*mQ==255 && *(mQ-1)>253 && *(mQ+1)>253 ) return Q ;
-         if(*(mQ-1)>thresholdSat && *(mQ+1)>thresholdSat && *(mQ-1)<254 && *(mQ+1)<254 &&  abs(*(mQ-1) - *(mQ+1)) < 40 ){
-             QII.push_back((10*(*(mQ-1))+10*(*(mQ+1)))/2); return QII;}
+  if (way) {
+    const int* mQ = std::max_element(Q, Q + N);
+    if (*mQ > 253) {
+      if (*mQ == 255 && *(mQ - 1) > 253 && *(mQ + 1) > 253) {
+        std::copy(Q, Q + N, QII);
+        return N;
+      }
+      if (*(mQ - 1) > thresholdSat && *(mQ + 1) > thresholdSat && *(mQ - 1) < 254 && *(mQ + 1) < 254 &&
+          abs(*(mQ - 1) - *(mQ + 1)) < 40) {
+        QII[0] = (10 * (*(mQ - 1)) + 10 * (*(mQ + 1))) / 2;
+        return 1;
       }
-   }
-  //---
-
-  for (unsigned int i = 0; i < N; i++) {
-    A(i, i) = a;
-    if (i < N - 1) {
-      A(i + 1, i) = x1;
-      A(i, i + 1) = x1;
-    } else
-      continue;
-    if (i < N - 2) {
-      A(i + 2, i) = x2;
-      A(i, i + 2) = x2;
     }
   }
+  //---
 
-  if (N == 1)
-    A(0, 0) = 1 / a;
-  else
-    A.InvertFast();
-
+  const crossTalkInverse& inverse = getCrossTalkInverse(x1, x2);
   for (unsigned int i = 0; i < N; i++) {
+    const float* A = inverse.row(N, i);
+    float QI = 0;
     for (unsigned int j = 0; j < N; j++) {
-      QI[i] += A(i, j) * (float)Q[j];
+      QI += A[j] * (float)Q[j];
     }
+    if (QI < threshold)
+      QI = 0;
+    QII[i] = (int)QI;
   }
+  return N;
+}
 
-  for (unsigned int i = 0; i < QI.size(); i++) {
-    if (QI[i] < threshold)
-      QI[i] = 0;
-    QII.push_back((int)QI[i]);
-  }
-
+std::vector<int> CrossTalkInv(const std::vector<int>& Q,
+                              const float x1 = 0.10,
+                              const float x2 = 0.04,
+                              bool way = true,
+                              float threshold = 20,
+                              float thresholdSat = 25,
+                              bool isClusterCleaning = false) {
+  std::vector<int> QII(Q.size());
+  QII.resize(CrossTalkInv(Q.data(), Q.size(), QII.data(), x1, x2, way, threshold, thresholdSat));
   return QII;
 }
 
+// read-only view of strip amplitudes, for clusterCleaning on a caller buffer
+struct stripAmplitudes {
+  const int* data;
+  unsigned int n;
+  stripAmplitudes(const int* data_, unsigned int n_) : data(data_), n(n_) {}
+  size_t size() const { return n; }
+  int operator[](size_t i) const { return data[i]; }
+};
+
 #ifdef FWCORE
-bool clusterCleaning(std::vector<int> ampls, int crosstalkInv = 0, uint8_t* exitCode = nullptr) {
+// ampls: std::vector<int> or stripAmplitudes
+template <class Amplitudes>
+bool clusterCleaning(const Amplitudes& ampls, int crosstalkInv = 0, uint8_t* exitCode = nullptr) {
 
 
   // ---------------- Count the number of maximas    --------------------------
@@ -1502,338 +1490,6 @@ bool isHitInsideTkModule(const LocalPoint hitPos, const DetId& detid, const SiSt
   return true;
 }
 
-reco::DeDxData computedEdx(const float& track_eta,
-                           const edm::EventSetup& iSetup,
-                           const int& run_number,
-                           string year,
-                           const reco::DeDxHitInfo* dedxHits,
-                           float* scaleFactors,
-                           TH3* templateHisto = nullptr,
-                           bool usePixel = false,
-                           bool useStrip = true,
-                           bool useClusterCleaning = true,
-                           bool useTruncated = false,
-                           bool mustBeInside = false,
-                           size_t MaxStripNOM = 999,
-                           bool correctFEDSat = false,
-                           int crossTalkInvAlgo = 0,
-                           float dropLowerDeDxValue = 0.0,
-                           float* dEdxErr = nullptr,
-                           bool useTemplateLayer = false,
-                           bool skipPixelL1 = false,
-                           int  skip_templates_ias = 0,
-                           bool symmetricSmirnov = false,
-                           bool useMorrisMethod = false,
-                           bool usePixelClusterCleaning = true,
-                           const std::string pixelCPE_ = "",
-                           const TrackerTopology* tTopo = nullptr,
-                           const float& track_px=0,
-                           const float& track_py=0,
-                           const float& track_pz=0,
-                           const int& track_charge=0) {
-
-  if (!dedxHits)
-    return reco::DeDxData(-1, -1, -1);
-
-  std::vector<float> vect;
-  std::vector<float> vectStrip;
-  std::vector<float> vectPixel;
-
-
-  edm::ESHandle<TrackerGeometry> tkGeometry;
-  iSetup.get<TrackerDigiGeometryRecord>().get(tkGeometry);
-  edm::ESHandle<PixelClusterParameterEstimator> pixelCPE;
-  iSetup.get<TkPixelCPERecord>().get(pixelCPE_, pixelCPE);
-
-  // loop in order to have the number of saturated clusters in a track
-  unsigned int nsatclust = 0;
-  for (unsigned int t = 0; t < dedxHits->size(); t++) {
-    DetId detid(dedxHits->detId(t));
-    bool test_sat = false;
-    if (detid.subdetId() < 3)
-      continue;
-    const SiStripCluster* cluster = dedxHits->stripCluster(t);
-    std::vector<int> amplitudes = convert(cluster->amplitudes());
-    for (unsigned int s = 0; s < amplitudes.size(); s++) {
-      if (amplitudes[s] > 253)
-        test_sat = true;
-    }
-    if (test_sat)
-      nsatclust++;
-  }
-  float rsat = (float)nsatclust / (float)dedxHits->size();
-
-  unsigned int NSat = 0;
-  unsigned int SiStripNOM = 0;
-  //float lowerStripDeDx=1000; UNUSED
-  //int lowerStripDeDxIndex=-1; UNUSED
-  for (unsigned int h = 0; h < dedxHits->size(); h++) {
-    DetId detid(dedxHits->detId(h));
-    if (!usePixel && detid.subdetId() < 3)
-      continue;  // skip pixels
-    if (!useStrip && detid.subdetId() >= 3)
-      continue;  // skip strips
-
-    if (mustBeInside &&
-        !isHitInsideTkModule(dedxHits->pos(h), detid, detid.subdetId() >= 3 ? dedxHits->stripCluster(h) : nullptr))
-      continue;
-    if (detid.subdetId() >= 3 && ++SiStripNOM > MaxStripNOM)
-      continue;  // skip remaining strips, but not pixel
-
-    int ClusterCharge = dedxHits->charge(h);
-
-//    if (skipPixelL1 && detid.subdetId() == 1 && ((detid >> 20) & 0xF) == 1) //decoding mask for 2017-2018
-    if (skipPixelL1 && detid.subdetId() == 1 && abs(int(tTopo->pxbLayer(detid))) == 1) //decoding mask through the topology
-      continue;
-
-//
-    if (detid.subdetId() <3 && usePixelClusterCleaning) { // for pixel only
-         auto const* pixelCluster =  dedxHits->pixelCluster(h);
-         if (pixelCluster == nullptr)  continue;
-         const GeomDetUnit& geomDet = *tkGeometry->idToDetUnit(detid);
-         LocalVector lv = geomDet.toLocal(GlobalVector(track_px, track_py, track_pz));
-         auto reCPE = std::get<2>(pixelCPE->getParameters(*pixelCluster, geomDet, LocalTrajectoryParameters(dedxHits->pos(h), lv, track_charge)));
-         float probQ = SiPixelRecHitQuality::thePacking.probabilityQ(reCPE);
-         float probXY = SiPixelRecHitQuality::thePacking.probabilityXY(reCPE);
-         bool cpeHasFailed = false;
-         if (!SiPixelRecHitQuality::thePacking.hasFilledProb(reCPE)) {
-          cpeHasFailed = true;
-         }
-         if (cpeHasFailed) continue;
-
-        if (probQ <= 0.0 || probQ >= 1.f) probQ = 1.f;
-        if (probXY <= 0.0 || probXY >= 1.f) probXY = 0.f;
-        bool isOnEdge = SiPixelRecHitQuality::thePacking.isOnEdge(reCPE);
-        bool hasBadPixels = SiPixelRecHitQuality::thePacking.hasBadPixels(reCPE);
-        bool spansTwoROCs = SiPixelRecHitQuality::thePacking.spansTwoROCs(reCPE);
-        bool specInCPE = (isOnEdge || hasBadPixels || spansTwoROCs) ? true : false;
-
-        if (specInCPE) continue;
-        if (probQ>0.8) continue;
-
-        auto clustSizeX = pixelCluster->sizeX();
-        auto clustSizeY = pixelCluster->sizeY();
-        if (clustSizeX==1 && clustSizeY==1) continue;
-
-    }
-    if (detid.subdetId() >= 3) {  //for strip only
-      
-      if(fabs(track_eta) < 1.0 && !(detid.subdetId() == 3 || detid.subdetId() == 5)) continue; // eta < 1.0 -> only TIB+TOB hits
-      if(fabs(track_eta) > 1.0 && track_eta < 1.7 && !(detid.subdetId() == 3 || detid.subdetId() == 4 || detid.subdetId() == 6)) continue; // 1.0 < eta < 1.7 -> only TIB+TID+TEC hits
-      if(fabs(track_eta) > 1.7 && !(detid.subdetId() == 4 || detid.subdetId() == 6)) continue; // eta > 1.7 -> only TID+TEC hits
-
-      SiStripDetId Sdetid(dedxHits->detId(h));
-      const SiStripCluster* cluster = dedxHits->stripCluster(h);
-      std::vector<int> amplitudes = convert(cluster->amplitudes());
-      std::vector<int> amplitudesPrim = CrossTalkInv(amplitudes,0.10,0.04,true);
-
-      // why is this hardcoded now?
-      //if (useClusterCleaning && !clusterCleaning(amplitudes, crossTalkInvAlgo))
-      if (useClusterCleaning && !clusterCleaning(amplitudesPrim, 1))
-        continue;
-
-      //////////////////////////////////////////////////////////////
-      //
-      //     0: no correction & no cross-talk inversion
-      //     1: standard correction & use of cross-talk inversion
-      //     2: correction from fits & no cross-talk inversion
-      //     3: correction from fits & use of cross-talk inversion (no recorrection -- see bool=false)
-      //
-      //////////////////////////////////////////////////////////////
-
-      //if (crossTalkInvAlgo>0) amplitudes = CrossTalkInv(amplitudes, 0.10, 0.04, true);
-
-crossTalkInvAlgo=1;
-
-      if (crossTalkInvAlgo == 1)
-        //amplitudes = CrossTalkInv(amplitudes, 0.10, 0.04, true);
-        amplitudes = SaturationCorrection(amplitudes,0.10,0.04,true,20,25);
-      if (crossTalkInvAlgo == 2)
-        amplitudes = Correction(amplitudes, Sdetid.moduleGeometry(), rsat, 25, 40, 0.6);
-      if (crossTalkInvAlgo == 3)
-        amplitudes =
-            CrossTalkInv(Correction(amplitudes, Sdetid.moduleGeometry(), rsat, 25, 40, 0.6), 0.10, 0.04, false);
-
-      float gain = 1.0;
-      bool isSatCluster = false;
-      ClusterCharge = 0;
-      for (unsigned int s = 0; s < amplitudes.size(); s++) {
-        int StripCharge = amplitudes[s];
-        if (StripCharge < 254) {
-          // TAV: it's kinda funny to divide with 1.0
-          StripCharge = (int)(StripCharge / gain);
-          if (StripCharge >= 1024) {
-            StripCharge = 255;
-          } else if (StripCharge >= 254) {
-            StripCharge = 254;
-          }
-        }
-
-        if (StripCharge >= 254) {
-          isSatCluster = true;
-        }
-        if (StripCharge >= 255 && correctFEDSat) {
-          StripCharge = 512;
-        }
-        ClusterCharge += StripCharge;
-      }
-      if (isSatCluster)
-        NSat++;
-    }
-
-    float scaleFactor = scaleFactors[0];
-    if (detid.subdetId() < 3){
-      scaleFactor *= scaleFactors[1];  // add pixel scaling
-      float pixelScaling = GetSFPixel(detid.subdetId(), detid, year, run_number);
-      scaleFactor *= pixelScaling;
-    }
-
-    if (templateHisto) {  //save discriminator probability
-      float ChargeOverPathlength =
-          scaleFactor * ClusterCharge / (dedxHits->pathlength(h) * 10.0 * (detid.subdetId() < 3 ? 265 : 1));
-
-      int moduleGeometry = 0;  // underflow for debug
-      int layer = 0;
-      if (detid.subdetId() < 3) {
-        moduleGeometry = 15;
-      }  // 15 == pixel
-      else {
-        SiStripDetId SSdetId(detid);
-        moduleGeometry = SSdetId.moduleGeometry();
-      }
-/*
-      if (detid.subdetId() == 3) {
-        layer = ((detid >> 14) & 0x7);
-      }  //TIB
-      if (detid.subdetId() == 4) {
-        layer = ((detid >> 9) & 0x3) + 10;
-      }  //TID
-      if (detid.subdetId() == 5) {
-        layer = ((detid >> 14) & 0x7) + 4;
-      }  //TOB
-      if (detid.subdetId() == 6) {
-        layer = ((detid >> 5) & 0x7) + 13;
-      }  //TEC
-*/
-      if (detid.subdetId() == StripSubdetector::TIB) layer= abs(int(tTopo->tibLayer(detid)));
-      if (detid.subdetId() == StripSubdetector::TOB) layer= abs(int(tTopo->tobLayer(detid))) + 4;
-      if (detid.subdetId() == StripSubdetector::TID) layer= abs(int(tTopo->tidWheel(detid))) + 10;
-      if (detid.subdetId() == StripSubdetector::TEC) layer= abs(int(tTopo->tecWheel(detid))) + 13;
-
-      //skip templates ias = 1 --> skip pixel, TIB, TID, 3 first TEC layers
-      if (skip_templates_ias == 1 && (
-                     detid.subdetId()<5 ||
-                     layer == 14 ||
-                     layer == 15 ||
-                     layer == 16
-                  )
-        ){continue;}
-
-      //skip templates ias = 2 --> pixel only, with pixL1 or not
-      //
-      bool isBPIXL1=false;
-      int numLayers = tkGeometry->numberOfLayers(PixelSubdetector::PixelBarrel);
-      if ((numLayers == 4) && ((detid.subdetId() == PixelSubdetector::PixelBarrel) && (tTopo->pxbLayer(detid) == 1))) isBPIXL1=true;  // only for 2017 and 2018
-      if (skip_templates_ias == 2 && (
-                  detid.subdetId()>2 ||
-                  isBPIXL1 
-                  //(skipPixelL1 && detid.subdetId() == 1 && ((detid >> 16) & 0xF) == 1) //decoding mask for 2016 !
-                  //(skipPixelL1 && detid.subdetId() == 1 && ((detid >> 20) & 0xF) == 1) //decoding mask for 2017-2018
-                  )
-        ){continue;}
-
-      int BinX = templateHisto->GetXaxis()->FindBin(moduleGeometry);
-      if (useTemplateLayer)
-        BinX = templateHisto->GetXaxis()->FindBin(layer);
-      int BinY = templateHisto->GetYaxis()->FindBin(dedxHits->pathlength(h) * 10.0);  //*10 because of cm-->mm
-      int BinZ = templateHisto->GetZaxis()->FindBin(ChargeOverPathlength);
-      float Prob = templateHisto->GetBinContent(BinX, BinY, BinZ);
-      //printf("%i %i %i  %f\n", BinX, BinY, BinZ, Prob);
-      vect.push_back(Prob);  //save probability
-      //printf("%i %i %i %i  %f\n", layer, BinX, BinY, BinZ, Prob);
-    } else {
-      float Norm = (detid.subdetId() < 3) ? 3.61e-06 : 3.61e-06 * 265;
-      float ChargeOverPathlength = scaleFactor * Norm * ClusterCharge / dedxHits->pathlength(h);
-
-      vect.push_back(ChargeOverPathlength);  //save charge
-      if (detid.subdetId() < 3)
-        vectPixel.push_back(ChargeOverPathlength);
-        //vectPixel.push_back(ClusterCharge/dedxHits->pathlength(h));
-      if (detid.subdetId() >= 3)
-        vectStrip.push_back(ChargeOverPathlength);
-        //vectStrip.push_back(ClusterCharge/dedxHits->pathlength(h));
-      //           printf("%i - %f / %f = %f\n", h, scaleFactor*Norm*dedxHits->charge(h), dedxHits->pathlength(h), ChargeOverPathlength);
-    }
-  }
-
-  if (dropLowerDeDxValue > 0) {
-    std::vector<float> tmp(vect.size());
-    std::copy(vect.begin(), vect.end(), tmp.begin());
-    std::sort(tmp.begin(), tmp.end(), std::greater<float>());
-    int nTrunc = tmp.size() * dropLowerDeDxValue;
-    vect.clear();
-    for (unsigned int t = 0; t + nTrunc < tmp.size(); t++) {
-      vect.push_back(tmp[t]);
-    }
-  }
-
-  float result;
-  int size = vect.size();
-
-  if (size > 0) {
-    if (templateHisto) {
-      if (useMorrisMethod) {
-        // FiStrips discriminator
-        float alpha = 1;
-        for (int i = 0; i < size; i++) {
-          alpha *= vect[i];
-        }
-        float logAlpha = log(alpha);
-        float probQm = 0;
-        for (int i = 0; i < size; i++) {
-          probQm += ((pow(-logAlpha, i)) / (factorial(i)));
-        }
-        result = alpha * probQm;
-      } else {
-        //Ias discriminator
-        result = 1.0 / (12 * size);
-        std::sort(vect.begin(), vect.end(), std::less<float>());
-        for (int i = 1; i <= size; i++) {
-          if(!symmetricSmirnov) result += vect[i - 1] * pow(vect[i - 1] - ((2.0 * i - 1.0) / (2.0 * size)), 2); //Ias 
-          else result += pow(vect[i - 1] - ((2.0 * i - 1.0) / (2.0 * size)), 2); //Is 
-        }
-        result *= (3.0 / size);
-       }
-    } else {  //dEdx estimator
-      if (useTruncated) {
-        //truncated40 estimator
-        std::sort(vect.begin(), vect.end(), std::less<float>());
-        result = 0;
-        int nTrunc = size * 0.40;
-        for (int i = 0; i + nTrunc < size; i++) {
-          result += vect[i];
-        }
-        result /= (size - nTrunc);
-      } else {
-        //harmonic2 estimator (Ih)
-        result = 0;
-        float expo = -2;
-        if (dEdxErr) *dEdxErr = 0;
-
-        for (int i = 0; i < size; i++) {
-          result += pow(vect[i], expo);
-          if (dEdxErr) *dEdxErr += pow(vect[i], 2 * (expo - 1)) * pow(0.01, 2);
-        }
-        result = pow(result / size, 1. / expo);
-        if (dEdxErr) *dEdxErr = result * result * result * sqrt(*dEdxErr) / size;
-      }
-      //           printf("Ih = %f\n------------------\n",result);
-    }
-  } else {
-    result = -1;
-  }
-  return reco::DeDxData(result, NSat, size);
-}
 #endif  //FWCORE
 
 // compute mass out of a momentum and dEdx value
@@ -2217,7 +1873,7 @@ float TkBasedIsolationWithPVConstrain(const std::vector<reco::Track>& tkTracks,
     return -1;
   float SumPt = 0.;
   for (unsigned int i = 0; i < tkTracks.size(); i++) {
-    reco::Track itTrack = tkTracks[i];
+    const reco::Track& itTrack = tkTracks[i];
     if (itTrack.pt() < trackSelection)
       continue;
     if (fabs(itTrack.pt() - TkRef->pt()) < 0.1 && fabs(itTrack.eta() - TkRef->eta()) < 0.05)
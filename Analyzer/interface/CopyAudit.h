@@ -0,0 +1,76 @@
+#ifndef SUSYBSMAnalysis_Analyzer_CopyAudit_h
+#define SUSYBSMAnalysis_Analyzer_CopyAudit_h
+
+#include <cstdio>
+#include <map>
+#include <ostream>
+#include <string>
+
+//=============================================================
+//
+//     Audit of the event product accesses
+//
+//     Counts, per product, the bytes read in place (the
+//     elements of a collection bound by reference, what a
+//     by-value access would have copied) and the bytes still
+//     copied out of the event. Reported per event at the end
+//     of the job, so a by-value access that comes back shows
+//     up as copied bytes. Only the shallow size of the
+//     elements is counted, not what they own on the heap.
+//
+//=============================================================
+
+class copyAudit {
+public:
+  copyAudit() {}
+  ~copyAudit() {}
+
+  void setEnabled(bool enabled) { enabled_ = enabled; }
+  bool enabled() const { return enabled_; }
+
+  template <class C>
+  void inPlace(const char* product, const C& collection) {
+    if (enabled_)
+      products_[product].inPlace += collection.size() * sizeof(typename C::value_type);
+  }
+
+  template <class T>
+  void copied(const char* product, const T&) {
+    if (enabled_)
+      products_[product].copied += sizeof(T);
+  }
+
+  void newEvent() {
+    if (enabled_)
+      nEvents_++;
+  }
+
+  void report(std::ostream& out) const {
+    if (!enabled_)
+      return;
+    const double n = nEvents_ > 0 ? nEvents_ : 1;
+    double inPlace = 0, copied = 0;
+    char line[128];
+    out << "Event product bytes per event over " << nEvents_ << " events:\n";
+    for (const auto& p : products_) {
+      snprintf(line, sizeof(line), "  %-32s %12.0f in place %12.0f copied\n", p.first.c_str(), p.second.inPlace / n, p.second.copied / n);
+      out << line;
+      inPlace += p.second.inPlace;
+      copied += p.second.copied;
+    }
+    snprintf(line, sizeof(line), "  %-32s %12.0f in place %12.0f copied\n", "total", inPlace / n, copied / n);
+    out << line;
+  }
+
+private:
+  struct bytes {
+    double inPlace = 0;
+    double copied = 0;
+  };
+
+  bool enabled_ = false;
+  unsigned long nEvents_ = 0;
+  std::map<std::string, bytes> products_;
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef SUSYBSMAnalysis_Analyzer_CutGrid_h
+#define SUSYBSMAnalysis_Analyzer_CutGrid_h
+
+#include <vector>
+
+#include "TH2.h"
+
+//=============================================================
+//
+//     Grid of final selections (pt, Ias, TOF thresholds)
+//
+//     Same decision as Analyzer::passSelection for every
+//     CutIndex, done in one branch-free pass over the
+//     threshold arrays. The rescaled variants (RescaleP/I/T)
+//     are obtained by passing the rescaled pt, Ias and 1/beta
+//     of the candidate. The result is a mask with one byte per
+//     CutIndex, and the list of the passing CutIndex.
+//
+//=============================================================
+
+class cutGrid {
+public:
+  cutGrid() {}
+  ~cutGrid() {}
+
+  // isFlip: TOF selection with 1/beta below the threshold (background check)
+  void set(const std::vector<float>& CutPt,
+           const std::vector<float>& CutI,
+           const std::vector<float>& CutTOF,
+           int typeMode,
+           bool isFlip) {
+    pt_ = CutPt;
+    ias_ = CutI;
+    tof_ = CutTOF;
+    useIas_ = typeMode != 3;
+    useTOF_ = typeMode > 1 && typeMode != 5;
+    isFlip_ = isFlip;
+    index_.resize(pt_.size());
+    for (unsigned int i = 0; i < index_.size(); i++)
+      index_[i] = i;
+  }
+
+  unsigned int size() const { return pt_.size(); }
+
+  // pt is a double as in the track, so that the comparison is the one of passSelection
+  void select(double pt, float ias, float tof, std::vector<unsigned char>& mask) const {
+    const unsigned int n = pt_.size();
+    mask.resize(n);
+    const float* ptCut = pt_.data();
+    const float* iasCut = ias_.data();
+    const float* tofCut = tof_.data();
+    unsigned char* out = mask.data();
+    const bool noIas = !useIas_, noTOF = !useTOF_;
+    if (isFlip_) {
+      for (unsigned int i = 0; i < n; i++)
+        out[i] = !(pt < ptCut[i]) & (noIas | !(ias < iasCut[i])) & (noTOF | !(tof > tofCut[i]));
+    } else {
+      for (unsigned int i = 0; i < n; i++)
+        out[i] = !(pt < ptCut[i]) & (noIas | !(ias < iasCut[i])) & (noTOF | !(tof < tofCut[i]));
+    }
+  }
+
+  // passing CutIndex, in increasing order
+  void select(double pt, float ias, float tof, std::vector<unsigned char>& mask, std::vector<int>& passing) const {
+    select(pt, ias, tof, mask);
+    passing.clear();
+    for (unsigned int i = 0; i < mask.size(); i++)
+      if (mask[i])
+        passing.push_back(i);
+  }
+
+  // all the CutIndex, for the fills which don't depend on the selection
+  const std::vector<int>& all() const { return index_; }
+
+private:
+  std::vector<float> pt_;
+  std::vector<float> ias_;
+  std::vector<float> tof_;
+  std::vector<int> index_;
+  bool useIas_ = true;
+  bool useTOF_ = false;
+  bool isFlip_ = false;
+};
+
+//=============================================================
+//
+//     Batch fill of a (CutIndex, value) histogram
+//
+//     Fills h at (CutIndex, y) with weight w for each CutIndex
+//     of the list, through a single TH2::FillN call.
+//
+//=============================================================
+
+class cutIndexFiller {
+public:
+  void fill(TH2* h, const std::vector<int>& cutIndices, double y, double w) {
+    const unsigned int n = cutIndices.size();
+    if (!h || n == 0)
+      return;
+    x_.resize(n);
+    for (unsigned int i = 0; i < n; i++)
+      x_[i] = cutIndices[i];
+    y_.assign(n, y);
+    w_.assign(n, w);
+    h->FillN(n, x_.data(), y_.data(), w_.data());
+  }
+
+private:
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> w_;
+};
+
+#endif
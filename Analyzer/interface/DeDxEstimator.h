@@ -0,0 +1,583 @@
+#ifndef SUSYBSMAnalysis_Analyzer_DeDxEstimator_h
+#define SUSYBSMAnalysis_Analyzer_DeDxEstimator_h
+
+#include <deque>
+#include <unordered_map>
+
+#include "SUSYBSMAnalysis/Analyzer/interface/CommonFunction.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/DeDxUtility.h"
+
+#ifdef FWCORE
+//=============================================================
+//
+//     Cache of the pixel CPE re-run
+//
+//     The CPE is re-run on each pixel cluster with the track
+//     direction to get probQ / probXY and the quality flags.
+//     Results are kept for the event, keyed by (track key, hit
+//     index), so the estimators, the probQ combination and the
+//     control plots of the same track share a single call.
+//
+//=============================================================
+
+struct pixelCPEResult {
+  bool hasCluster = false;
+  LocalVector localDir;  // track direction in the module frame
+  SiPixelRecHitQuality::QualWordType qualWord = 0;
+
+  bool hasFilledProb() const { return SiPixelRecHitQuality::thePacking.hasFilledProb(qualWord); }
+  float probabilityQ() const { return SiPixelRecHitQuality::thePacking.probabilityQ(qualWord); }
+  float probabilityXY() const { return SiPixelRecHitQuality::thePacking.probabilityXY(qualWord); }
+  bool isOnEdge() const { return SiPixelRecHitQuality::thePacking.isOnEdge(qualWord); }
+  bool hasBadPixels() const { return SiPixelRecHitQuality::thePacking.hasBadPixels(qualWord); }
+  bool spansTwoROCs() const { return SiPixelRecHitQuality::thePacking.spansTwoROCs(qualWord); }
+};
+
+class pixelCPECache {
+public:
+  pixelCPECache() {}
+  ~pixelCPECache() {}
+
+  // to be called at the beginning of each event
+  void newEvent(const TrackerGeometry* tkGeometry, const PixelClusterParameterEstimator* pixelCPE) {
+    cache_.clear();
+    tkGeometry_ = tkGeometry;
+    pixelCPE_ = pixelCPE;
+  }
+
+  // CPE result for the pixel hit h of the track, the CPE is only run on the first request
+  const pixelCPEResult& get(unsigned int trackKey,
+                            const reco::DeDxHitInfo* dedxHits,
+                            unsigned int h,
+                            const float& track_px,
+                            const float& track_py,
+                            const float& track_pz,
+                            const int& track_charge) {
+    uint64_t key = (uint64_t(trackKey) << 32) | h;
+    auto it = cache_.find(key);
+    if (it != cache_.end())
+      return it->second;
+
+    pixelCPEResult& result = cache_[key];
+    auto const* pixelCluster = dedxHits->pixelCluster(h);
+    if (pixelCluster == nullptr)
+      return result;
+    const GeomDetUnit& geomDet = *tkGeometry_->idToDetUnit(DetId(dedxHits->detId(h)));
+    result.localDir = geomDet.toLocal(GlobalVector(track_px, track_py, track_pz));
+    // getParameters will return std::tuple<LocalPoint, LocalError, SiPixelRecHitQuality::QualWordType>;
+    result.qualWord = std::get<2>(pixelCPE_->getParameters(
+        *pixelCluster, geomDet, LocalTrajectoryParameters(dedxHits->pos(h), result.localDir, track_charge)));
+    result.hasCluster = true;
+    return result;
+  }
+
+private:
+  const TrackerGeometry* tkGeometry_ = nullptr;
+  const PixelClusterParameterEstimator* pixelCPE_ = nullptr;
+  std::unordered_map<uint64_t, pixelCPEResult> cache_;
+};
+
+//=============================================================
+//
+//     Per-module attributes of the tracker
+//
+//     What the hit loops need to know about a module (geometry
+//     unit, subdetector, layer, strip module geometry, pixel
+//     layer 1 flags, pixel scale factor of the run) decoded
+//     once per geometry IOV for all the modules, then a single
+//     lookup per hit. The pixel scale factors are updated by
+//     setRun when the run or the year changes.
+//
+//=============================================================
+
+struct trackerDetInfo {
+  const GeomDetUnit* det = nullptr;
+  int subdet = 0;
+  int layer = 0;  // strips: TIB 1-4, TOB 5-10, TID 11-13, TEC 14-22; 0 for the pixels
+  int pixelLayer = 0;  // BPIX layer or FPIX disk, 0 for the strips
+  int moduleGeometry = 0;  // 15 == pixel
+  bool isPixelL1 = false;  // BPIX layer 1
+  bool isBPIXL1 = false;  // BPIX layer 1 of the phase-1 detector
+  bool isPixelNoL1 = false;  // pixel module which is not isBPIXL1 (all the pixels of the phase-0 detector)
+  float pixelSF = 1;  // pixel scale factor of the current year and run
+};
+
+class trackerDetTable {
+public:
+  trackerDetTable() {}
+  ~trackerDetTable() {}
+
+  // to be called when the tracker geometry changes
+  void build(const TrackerGeometry* tkGeometry, const TrackerTopology* tTopo) {
+    reset(tkGeometry, tTopo);
+    const auto& dets = tkGeometry->detUnits();
+    index_.reserve(dets.size());
+    for (const auto* det : dets)
+      add(det->geographicalId());
+    updatePixelSF();
+  }
+
+  // empty table, the modules are decoded on their first lookup
+  void reset(const TrackerGeometry* tkGeometry, const TrackerTopology* tTopo) {
+    tkGeometry_ = tkGeometry;
+    tTopo_ = tTopo;
+    numLayers_ = tkGeometry->numberOfLayers(PixelSubdetector::PixelBarrel);
+    info_.clear();
+    index_.clear();
+  }
+
+  // pixel scale factors of the year and run, nothing to do if they didn't change
+  void setRun(const std::string& year, int run) {
+    if (year == year_ && run == run_)
+      return;
+    year_ = year;
+    run_ = run;
+    gains_ = pixelGainCalib.resolve(year_, run_);
+    updatePixelSF();
+  }
+
+  int numberOfPixelBarrelLayers() const { return numLayers_; }
+
+  const trackerDetInfo& operator[](DetId detid) {
+    auto it = index_.find(detid.rawId());
+    if (it != index_.end())
+      return info_[it->second];
+    // not a unit of the geometry, decoded on the first call
+    trackerDetInfo& info = add(detid);
+    if (info.subdet < 3)
+      info.pixelSF = gains_(info.subdet, detid);
+    return info;
+  }
+
+  // same as operator[] without adding anything to the table, so it can be called concurrently:
+  // a module which is not a unit of the geometry is decoded into scratch
+  const trackerDetInfo& find(DetId detid, trackerDetInfo& scratch) const {
+    auto it = index_.find(detid.rawId());
+    if (it != index_.end())
+      return info_[it->second];
+    scratch = trackerDetInfo();
+    decode(detid, scratch);
+    if (scratch.subdet < 3)
+      scratch.pixelSF = gains_(scratch.subdet, detid);
+    return scratch;
+  }
+
+private:
+  trackerDetInfo& add(DetId detid) {
+    index_[detid.rawId()] = info_.size();
+    info_.emplace_back();
+    trackerDetInfo& info = info_.back();
+    decode(detid, info);
+    return info;
+  }
+
+  void decode(DetId detid, trackerDetInfo& info) const {
+    info.det = tkGeometry_->idToDetUnit(detid);
+    info.subdet = detid.subdetId();
+    if (info.subdet < 3) {
+      info.moduleGeometry = 15;
+      if (info.subdet == PixelSubdetector::PixelBarrel) {
+        info.pixelLayer = tTopo_->pxbLayer(detid);
+        info.isPixelL1 = (abs(int(tTopo_->pxbLayer(detid))) == 1);
+        info.isBPIXL1 = (numLayers_ == 4) && (tTopo_->pxbLayer(detid) == 1);
+      } else {
+        info.pixelLayer = tTopo_->pxfDisk(detid);
+      }
+      info.isPixelNoL1 = (numLayers_ == 3) || ((numLayers_ == 4) && !info.isBPIXL1);
+    } else {
+      SiStripDetId SSdetId(detid);
+      info.moduleGeometry = SSdetId.moduleGeometry();
+      if (info.subdet == StripSubdetector::TIB)
+        info.layer = abs(int(tTopo_->tibLayer(detid)));
+      if (info.subdet == StripSubdetector::TOB)
+        info.layer = abs(int(tTopo_->tobLayer(detid))) + 4;
+      if (info.subdet == StripSubdetector::TID)
+        info.layer = abs(int(tTopo_->tidWheel(detid))) + 10;
+      if (info.subdet == StripSubdetector::TEC)
+        info.layer = abs(int(tTopo_->tecWheel(detid))) + 13;
+    }
+  }
+
+  void updatePixelSF() {
+    for (auto& it : index_) {
+      trackerDetInfo& info = info_[it.second];
+      if (info.subdet < 3)
+        info.pixelSF = gains_(info.subdet, it.first);
+    }
+  }
+
+  const TrackerGeometry* tkGeometry_ = nullptr;
+  const TrackerTopology* tTopo_ = nullptr;
+  int numLayers_ = 0;
+  std::string year_;
+  int run_ = -1;
+  pixelGains gains_;  // of year_ and run_
+  std::deque<trackerDetInfo> info_;  // the references given by operator[] stay valid when a module is added
+  std::unordered_map<uint32_t, unsigned int> index_;
+};
+
+//=============================================================
+//
+//     Strip cluster chain
+//
+//     Conversion of the cluster amplitudes, cross-talk
+//     inversion with cleaning, and saturation correction,
+//     all done in fixed buffers owned by the chain. The results
+//     are the ones of
+//       clusterCleaning(CrossTalkInv(convert(a), 0.10, 0.04, true), 1)
+//       SaturationCorrection(convert(a), 0.10, 0.04, true, 20, 25)
+//
+//=============================================================
+
+class stripClusterChain {
+public:
+  static const unsigned int maxStrips = 768;  // strips of a module
+
+  stripClusterChain() {
+    // the saturation checks look at the neighbours of the highest strip, which can be the first or the last one
+    raw_[0] = 0;
+  }
+  ~stripClusterChain() {}
+
+  // saturation corrected amplitudes, valid until the next call; passCleaning: cleaning of the x-talk inverted cluster
+  stripAmplitudes process(const std::vector<unsigned char>& input, bool& passCleaning) {
+    const unsigned int n = input.size();
+    if (n > maxStrips) {
+      rawLarge_ = convert(input);
+      passCleaning = clusterCleaning(CrossTalkInv(rawLarge_, 0.10, 0.04, true), 1);
+      correctedLarge_ = SaturationCorrection(rawLarge_, 0.10, 0.04, true, 20, 25);
+      return stripAmplitudes(correctedLarge_.data(), correctedLarge_.size());
+    }
+    int* raw = raw_ + 1;
+    for (unsigned int i = 0; i < n; i++)
+      raw[i] = input[i];
+    raw[n] = 0;
+
+    unsigned int nInverted = CrossTalkInv(raw, n, inverted_, 0.10, 0.04, true, 20, 25);
+    passCleaning = clusterCleaning(stripAmplitudes(inverted_, nInverted), 1);
+    unsigned int nCorrected = SaturationCorrection(raw, n, corrected_, true, 25);
+    return stripAmplitudes(corrected_, nCorrected);
+  }
+
+private:
+  int raw_[maxStrips + 2];  // one empty strip on each side of the cluster
+  int inverted_[maxStrips];
+  int corrected_[maxStrips];
+  std::vector<int> rawLarge_, correctedLarge_;
+};
+
+//=============================================================
+//
+//     Single-pass dE/dx estimators
+//
+//     dedxHitTable decodes and cleans each hit of a track once
+//     (cluster cleaning, saturation, pixel CPE, gains, layers),
+//     then any number of dedxEstimator can be evaluated on it.
+//     Each estimator gives the same result as the former
+//     computedEdx called with the same options. The det table
+//     is only read, so the tables of several tracks can be
+//     filled concurrently, each with its own CPE cache.
+//
+//=============================================================
+
+struct dedxEstimator {
+  const dedxTemplate* templates = nullptr;  // nullptr for Ih-like estimators, template for Ias / Is / FiStrips
+  bool usePixel = false;
+  bool useStrip = true;
+  bool useClusterCleaning = true;
+  bool useTruncated = false;
+  bool mustBeInside = false;
+  size_t MaxStripNOM = 999;
+  float dropLowerDeDxValue = 0.0;
+  bool useTemplateLayer = false;
+  bool skipPixelL1 = false;
+  int skip_templates_ias = 0;
+  bool symmetricSmirnov = false;
+  bool useMorrisMethod = false;
+  bool usePixelClusterCleaning = true;
+  bool computeError = false;  // fill dEdxErr for the harmonic-2 estimator
+
+  dedxEstimator() {}
+  dedxEstimator(const dedxTemplate* templates_,
+                bool usePixel_,
+                bool useStrip_,
+                bool useClusterCleaning_,
+                bool useTruncated_,
+                bool mustBeInside_,
+                size_t MaxStripNOM_,
+                float dropLowerDeDxValue_,
+                bool computeError_,
+                bool useTemplateLayer_,
+                bool skipPixelL1_ = false,
+                int skip_templates_ias_ = 0,
+                bool symmetricSmirnov_ = false,
+                bool useMorrisMethod_ = false,
+                bool usePixelClusterCleaning_ = true)
+      : templates(templates_),
+        usePixel(usePixel_),
+        useStrip(useStrip_),
+        useClusterCleaning(useClusterCleaning_),
+        useTruncated(useTruncated_),
+        mustBeInside(mustBeInside_),
+        MaxStripNOM(MaxStripNOM_),
+        dropLowerDeDxValue(dropLowerDeDxValue_),
+        useTemplateLayer(useTemplateLayer_),
+        skipPixelL1(skipPixelL1_),
+        skip_templates_ias(skip_templates_ias_),
+        symmetricSmirnov(symmetricSmirnov_),
+        useMorrisMethod(useMorrisMethod_),
+        usePixelClusterCleaning(usePixelClusterCleaning_),
+        computeError(computeError_) {}
+};
+
+// everything the estimators need to know about one hit
+struct dedxHit {
+  int subdet = 0;
+  int clusterCharge = 0;  // after saturation correction for strips
+  float pathlength = 0;
+  float scaleFactor = 1;  // dEdxSF (and pixel gain) applied on the charge
+  int moduleGeometry = 0;  // 15 == pixel
+  int layer = 0;
+  bool isInside = true;
+  bool isPixelL1 = false;  // BPIX layer 1 from the topology, used by skipPixelL1
+  bool isBPIXL1 = false;  // BPIX layer 1 of the phase-1 detector, used by skip_templates_ias == 2
+  bool passPixelCleaning = false;
+  bool passStripEta = false;
+  bool passStripCleaning = false;
+  bool isSatCluster = false;
+};
+
+class dedxHitTable {
+public:
+  dedxHitTable() {}
+  ~dedxHitTable() {}
+
+  // decode, clean and calibrate the hits of the track (once per track)
+  void fill(const float& track_eta,
+            const reco::DeDxHitInfo* dedxHits,
+            const float* scaleFactors,
+            const trackerDetTable& detTable,
+            pixelCPECache& cpeCache,
+            unsigned int trackKey,
+            const float& track_px,
+            const float& track_py,
+            const float& track_pz,
+            const int& track_charge,
+            bool correctFEDSat = false) {
+    hits_.clear();
+    valid_ = (dedxHits != nullptr);
+    if (!valid_)
+      return;
+    hits_.reserve(dedxHits->size());
+
+    for (unsigned int h = 0; h < dedxHits->size(); h++) {
+      DetId detid(dedxHits->detId(h));
+      const trackerDetInfo& det = detTable.find(detid, scratchDet_);
+      dedxHit hit;
+      hit.subdet = det.subdet;
+      hit.pathlength = dedxHits->pathlength(h);
+      hit.clusterCharge = dedxHits->charge(h);
+      hit.isInside =
+          isHitInsideTkModule(dedxHits->pos(h), detid, hit.subdet >= 3 ? dedxHits->stripCluster(h) : nullptr);
+
+      if (hit.subdet < 3) {
+        hit.moduleGeometry = 15;
+        hit.isPixelL1 = det.isPixelL1;
+        hit.isBPIXL1 = det.isBPIXL1;
+
+        const pixelCPEResult& cpe =
+            cpeCache.get(trackKey, dedxHits, h, track_px, track_py, track_pz, track_charge);
+        if (cpe.hasCluster) {
+          auto const* pixelCluster = dedxHits->pixelCluster(h);
+          float probQ = cpe.probabilityQ();
+          if (probQ <= 0.0 || probQ >= 1.f)
+            probQ = 1.f;
+          bool specInCPE = (cpe.isOnEdge() || cpe.hasBadPixels() || cpe.spansTwoROCs());
+          hit.passPixelCleaning = cpe.hasFilledProb() && !specInCPE && probQ <= 0.8 &&
+                                  !(pixelCluster->sizeX() == 1 && pixelCluster->sizeY() == 1);
+        }
+
+        hit.scaleFactor = scaleFactors[0];
+        hit.scaleFactor *= scaleFactors[1];  // add pixel scaling
+        hit.scaleFactor *= det.pixelSF;
+      } else {
+        hit.moduleGeometry = det.moduleGeometry;
+        hit.layer = det.layer;
+
+        // eta < 1.0 -> only TIB+TOB hits, 1.0 < eta < 1.7 -> only TIB+TID+TEC hits, eta > 1.7 -> only TID+TEC hits
+        hit.passStripEta = true;
+        if (fabs(track_eta) < 1.0 && !(hit.subdet == 3 || hit.subdet == 5))
+          hit.passStripEta = false;
+        if (fabs(track_eta) > 1.0 && track_eta < 1.7 && !(hit.subdet == 3 || hit.subdet == 4 || hit.subdet == 6))
+          hit.passStripEta = false;
+        if (fabs(track_eta) > 1.7 && !(hit.subdet == 4 || hit.subdet == 6))
+          hit.passStripEta = false;
+
+        const SiStripCluster* cluster = dedxHits->stripCluster(h);
+        // crossTalkInvAlgo == 1: saturation correction, as was hardcoded in computedEdx
+        stripAmplitudes amplitudes = stripChain_.process(cluster->amplitudes(), hit.passStripCleaning);
+        hit.clusterCharge = 0;
+        for (unsigned int s = 0; s < amplitudes.size(); s++) {
+          int StripCharge = amplitudes[s];
+          if (StripCharge < 254) {
+            if (StripCharge >= 1024) {
+              StripCharge = 255;
+            } else if (StripCharge >= 254) {
+              StripCharge = 254;
+            }
+          }
+          if (StripCharge >= 254) {
+            hit.isSatCluster = true;
+          }
+          if (StripCharge >= 255 && correctFEDSat) {
+            StripCharge = 512;
+          }
+          hit.clusterCharge += StripCharge;
+        }
+
+        hit.scaleFactor = scaleFactors[0];
+      }
+      hits_.push_back(hit);
+    }
+  }
+
+  // evaluate one estimator on the decoded hits
+  reco::DeDxData evaluate(const dedxEstimator& est, float* dEdxErr = nullptr) {
+    if (!valid_)
+      return reco::DeDxData(-1, -1, -1);
+
+    vect_.clear();
+    unsigned int NSat = 0;
+    size_t SiStripNOM = 0;
+    for (const auto& hit : hits_) {
+      bool isPixel = (hit.subdet < 3);
+      if (!est.usePixel && isPixel)
+        continue;  // skip pixels
+      if (!est.useStrip && !isPixel)
+        continue;  // skip strips
+      if (est.mustBeInside && !hit.isInside)
+        continue;
+      if (!isPixel && ++SiStripNOM > est.MaxStripNOM)
+        continue;  // skip remaining strips, but not pixel
+      if (est.skipPixelL1 && hit.isPixelL1)
+        continue;
+      if (isPixel && est.usePixelClusterCleaning && !hit.passPixelCleaning)
+        continue;
+      if (!isPixel) {
+        if (!hit.passStripEta)
+          continue;
+        if (est.useClusterCleaning && !hit.passStripCleaning)
+          continue;
+        if (hit.isSatCluster)
+          NSat++;
+      }
+
+      if (est.templates) {  //save discriminator probability
+        //skip templates ias = 1 --> skip pixel, TIB, TID, 3 first TEC layers
+        if (est.skip_templates_ias == 1 && (hit.subdet < 5 || hit.layer == 14 || hit.layer == 15 || hit.layer == 16))
+          continue;
+        //skip templates ias = 2 --> pixel only, with pixL1 or not
+        if (est.skip_templates_ias == 2 && (hit.subdet > 2 || hit.isBPIXL1))
+          continue;
+
+        float ChargeOverPathlength =
+            hit.scaleFactor * hit.clusterCharge / (hit.pathlength * 10.0 * (isPixel ? 265 : 1));
+        vect_.push_back(est.templates->probability(est.useTemplateLayer ? hit.layer : hit.moduleGeometry,
+                                                   hit.pathlength * 10.0,  //*10 because of cm-->mm
+                                                   ChargeOverPathlength));  //save probability
+      } else {
+        float Norm = isPixel ? 3.61e-06 : 3.61e-06 * 265;
+        vect_.push_back(hit.scaleFactor * Norm * hit.clusterCharge / hit.pathlength);  //save charge
+      }
+    }
+
+    float result = reduce(est, est.computeError ? dEdxErr : nullptr);
+    return reco::DeDxData(result, NSat, vect_.size());
+  }
+
+  // evaluate a list of estimators in one go, results are in the same order as the list
+  void evaluate(const std::vector<dedxEstimator>& estimators, std::vector<reco::DeDxData>& results, float* dEdxErr = nullptr) {
+    results.clear();
+    results.reserve(estimators.size());
+    for (const auto& est : estimators)
+      results.push_back(evaluate(est, dEdxErr));
+  }
+
+  const std::vector<dedxHit>& hits() const { return hits_; }
+
+private:
+  // turn the selected per-hit values into the estimator value
+  float reduce(const dedxEstimator& est, float* dEdxErr) {
+    if (est.dropLowerDeDxValue > 0) {
+      std::sort(vect_.begin(), vect_.end(), std::greater<float>());
+      int nTrunc = vect_.size() * est.dropLowerDeDxValue;
+      vect_.resize(vect_.size() - nTrunc);
+    }
+
+    float result;
+    int size = vect_.size();
+    if (size <= 0)
+      return -1;
+
+    if (est.templates) {
+      if (est.useMorrisMethod) {
+        // FiStrips discriminator
+        float alpha = 1;
+        for (int i = 0; i < size; i++) {
+          alpha *= vect_[i];
+        }
+        float logAlpha = log(alpha);
+        float probQm = 0;
+        for (int i = 0; i < size; i++) {
+          probQm += ((pow(-logAlpha, i)) / (factorial(i)));
+        }
+        result = alpha * probQm;
+      } else {
+        //Ias discriminator
+        result = 1.0 / (12 * size);
+        std::sort(vect_.begin(), vect_.end(), std::less<float>());
+        for (int i = 1; i <= size; i++) {
+          if (!est.symmetricSmirnov)
+            result += vect_[i - 1] * pow(vect_[i - 1] - ((2.0 * i - 1.0) / (2.0 * size)), 2);  //Ias
+          else
+            result += pow(vect_[i - 1] - ((2.0 * i - 1.0) / (2.0 * size)), 2);  //Is
+        }
+        result *= (3.0 / size);
+      }
+    } else if (est.useTruncated) {
+      //truncated40 estimator
+      std::sort(vect_.begin(), vect_.end(), std::less<float>());
+      result = 0;
+      int nTrunc = size * 0.40;
+      for (int i = 0; i + nTrunc < size; i++) {
+        result += vect_[i];
+      }
+      result /= (size - nTrunc);
+    } else {
+      //harmonic2 estimator (Ih)
+      result = 0;
+      float expo = -2;
+      if (dEdxErr)
+        *dEdxErr = 0;
+      for (int i = 0; i < size; i++) {
+        result += pow(vect_[i], expo);
+        if (dEdxErr)
+          *dEdxErr += pow(vect_[i], 2 * (expo - 1)) * pow(0.01, 2);
+      }
+      result = pow(result / size, 1. / expo);
+      if (dEdxErr)
+        *dEdxErr = result * result * result * sqrt(*dEdxErr) / size;
+    }
+    return result;
+  }
+
+  bool valid_ = false;
+  std::vector<dedxHit> hits_;
+  std::vector<float> vect_;  // scratch buffer reused between estimators
+  stripClusterChain stripChain_;
+  trackerDetInfo scratchDet_;  // module which is not in the det table
+};
+
+#endif  //FWCORE
+
+#endif
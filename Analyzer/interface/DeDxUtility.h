@@ -1,6 +1,19 @@
 #ifndef SUSYBSMAnalysis_Analyzer_Calibration_h
 #define SUSYBSMAnalysis_Analyzer_Calibration_h
 
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "TAxis.h"
+#include "TFile.h"
+#include "TH3.h"
+
 //=============================================================
 //
 //     DeDx tools
@@ -51,56 +64,256 @@ void loadDeDxParameters(
   }
 }
 
-TH3F* loadDeDxTemplate(std::string path, bool splitByModuleType,bool puTreatment,int puBin) {
-  TFile* InputFile = new TFile(path.c_str());
-  TH3F* DeDxMap_;
-  if(!puTreatment) {
-     DeDxMap_ = (TH3F*)GetObjectFromPath(InputFile, "Calibration_GiTemplate"); // used to be Charge_Vs_Path 
-  } else{
-    if( puBin > 5) {
-      printf("puBin > 5");
-      exit(0);
-    } else{  
-      std::string template_name = "Calibration_GiTemplate_PU_" + to_string(puBin);
-      DeDxMap_ = (TH3F*)GetObjectFromPath(InputFile, template_name.c_str());
+//=============================================================
+//
+//     Dense dE/dx template
+//
+//     Copy of a template TH3 (geometry or layer, pathlength,
+//     charge over pathlength) in a flat float array with the
+//     edges of its axes, so that the per-hit lookup has no
+//     virtual call. The bin finding follows TAxis::FindFixBin,
+//     the result is the same as the TH3 one. It is read only
+//     once built and can be shared between threads.
+//
+//=============================================================
+
+class dedxTemplate {
+public:
+  dedxTemplate() {}
+  explicit dedxTemplate(const TH3& h) { build(h); }
+  ~dedxTemplate() {}
+
+  void build(const TH3& h) {
+    x_.set(*h.GetXaxis());
+    y_.set(*h.GetYaxis());
+    z_.set(*h.GetZaxis());
+    content_.resize((x_.n + 2) * (y_.n + 2) * (z_.n + 2));
+    for (int k = 0; k <= z_.n + 1; k++)
+      for (int j = 0; j <= y_.n + 1; j++)
+        for (int i = 0; i <= x_.n + 1; i++)
+          content_[index(i, j, k)] = h.GetBinContent(i, j, k);
+  }
+
+  // cumulative probability along the charge axis of the raw template raw, per (geometry, pathlength) bin.
+  // The prefix sums are done in one pass, with the same float arithmetic as summing each bin from scratch.
+  void buildCumulative(const TH3F& raw, bool splitByModuleType) {
+    x_.set(*raw.GetXaxis());
+    y_.set(*raw.GetYaxis());
+    z_.set(*raw.GetZaxis());
+    //FIXME is it still relevant with pixels?
+    if (!splitByModuleType) {  // <-- do not include pixel in the inclusive
+      TH3F* rebinned = (TH3F*)raw.Clone("Prob_ChargePath_rebinned");
+      rebinned->SetDirectory(0);
+      rebinned->RebinX(rebinned->GetNbinsX() - 1);
+      x_.set(*rebinned->GetXaxis());
+      delete rebinned;
+    }
+    const int rawNx = raw.GetNbinsX() + 2, rawNy = raw.GetNbinsY() + 2;
+    const float* rawContent = raw.GetArray();
+    content_.resize((x_.n + 2) * (y_.n + 2) * (z_.n + 2));
+    for (int i = 0; i <= x_.n + 1; i++) {    // loop over geometry/layer
+      for (int j = 0; j <= y_.n + 1; j++) {  // loop over pathlength
+        float Ni = 0;
+        for (int k = 0; k <= z_.n + 1; k++)  // loop over ChargeOverPathlength
+          Ni += rawContent[i + rawNx * (j + rawNy * k)];
+        float tmp = 0;
+        for (int k = 0; k <= z_.n + 1; k++) {
+          tmp += rawContent[i + rawNx * (j + rawNy * k)];
+          content_[index(i, j, k)] = Ni > 0 ? tmp / Ni : 0;
+        }
+      }
     }
+    // the TH3 template was filled with one SetBinContent per bin, which counts one entry each
+    entries_ = content_.size();
   }
 
-  if (!DeDxMap_) {
-    printf("dEdx templates in file %s can't be open\n", path.c_str());
-    exit(0);
+  bool empty() const { return content_.empty(); }
+  double entries() const { return entries_; }
+
+  void write(std::ostream& out) const {
+    x_.write(out);
+    y_.write(out);
+    z_.write(out);
+    out.write((const char*)&entries_, sizeof(entries_));
+    out.write((const char*)content_.data(), content_.size() * sizeof(float));
   }
 
-  TH3F* Prob_ChargePath = (TH3F*)(DeDxMap_->Clone("Prob_ChargePath"));
-  Prob_ChargePath->Reset();
-  Prob_ChargePath->SetDirectory(0);
+  bool read(std::istream& in) {
+    if (!x_.read(in) || !y_.read(in) || !z_.read(in))
+      return false;
+    in.read((char*)&entries_, sizeof(entries_));
+    content_.resize((x_.n + 2) * (y_.n + 2) * (z_.n + 2));
+    in.read((char*)content_.data(), content_.size() * sizeof(float));
+    return bool(in);
+  }
 
-  //FIXME is it still relevant with pixels?
-  if (!splitByModuleType) {
-    Prob_ChargePath->RebinX(Prob_ChargePath->GetNbinsX() - 1);  // <-- do not include pixel in the inclusive
+  // same as h->GetBinContent(h->GetXaxis()->FindBin(x), h->GetYaxis()->FindBin(y), h->GetZaxis()->FindBin(z))
+  float probability(double x, double y, double z) const {
+    return content_[index(x_.findBin(x), y_.findBin(y), z_.findBin(z))];
   }
 
-  for (int i = 0; i <= Prob_ChargePath->GetXaxis()->GetNbins() + 1; i++) {    // loop over geometry/layer
-    for (int j = 0; j <= Prob_ChargePath->GetYaxis()->GetNbins() + 1; j++) {  // loop over pathlength
-      float Ni = 0;
-      for (int k = 0; k <= Prob_ChargePath->GetZaxis()->GetNbins() + 1; k++) {  // loop over ChargeOverPathlength
-        Ni += DeDxMap_->GetBinContent(i, j, k);
-      }
-      for (int k = 0; k <= Prob_ChargePath->GetZaxis()->GetNbins() + 1; k++) {  // loop over ChargeOverPathlength
-        float tmp = 0;
-        for (int l = 0; l <= k; l++) {
-          tmp += DeDxMap_->GetBinContent(i, j, l);
-        }
-        if (Ni > 0) {
-          Prob_ChargePath->SetBinContent(i, j, k, tmp / Ni);
-        } else {
-          Prob_ChargePath->SetBinContent(i, j, k, 0);
-        }
-      }
+private:
+  struct axis {
+    int n = 0;
+    double min = 0;
+    double max = 0;
+    std::vector<double> edges;  // empty for uniform bins
+
+    void set(const TAxis& a) {
+      n = a.GetNbins();
+      min = a.GetXmin();
+      max = a.GetXmax();
+      edges.clear();
+      if (a.GetXbins()->fN)
+        edges.assign(a.GetXbins()->GetArray(), a.GetXbins()->GetArray() + a.GetXbins()->fN);
+    }
+
+    void write(std::ostream& out) const {
+      unsigned int nEdges = edges.size();
+      out.write((const char*)&n, sizeof(n));
+      out.write((const char*)&min, sizeof(min));
+      out.write((const char*)&max, sizeof(max));
+      out.write((const char*)&nEdges, sizeof(nEdges));
+      out.write((const char*)edges.data(), nEdges * sizeof(double));
     }
+
+    bool read(std::istream& in) {
+      unsigned int nEdges = 0;
+      in.read((char*)&n, sizeof(n));
+      in.read((char*)&min, sizeof(min));
+      in.read((char*)&max, sizeof(max));
+      in.read((char*)&nEdges, sizeof(nEdges));
+      if (!in || n <= 0 || n > 100000 || (nEdges != 0 && nEdges != (unsigned int)n + 1))
+        return false;
+      edges.resize(nEdges);
+      in.read((char*)edges.data(), nEdges * sizeof(double));
+      return bool(in);
+    }
+
+    // underflow is 0, overflow (and NaN) is n+1
+    int findBin(double v) const {
+      if (v < min)
+        return 0;
+      if (!(v < max))
+        return n + 1;
+      if (edges.empty())
+        return 1 + int(n * (v - min) / (max - min));
+      return std::upper_bound(edges.begin(), edges.end(), v) - edges.begin();
+    }
+  };
+
+  int index(int i, int j, int k) const { return i + (x_.n + 2) * (j + (y_.n + 2) * k); }
+
+  axis x_, y_, z_;
+  double entries_ = 0;
+  std::vector<float> content_;
+};
+
+//=============================================================
+//
+//     Loading of the dE/dx templates
+//
+//     Opens the template file once and builds the cumulative
+//     templates: the inclusive one, or one per PU bin. With a
+//     cache path, the finished templates are written to a
+//     small binary file, tagged with the size and date of the
+//     ROOT file and the options, and read back by later jobs
+//     instead of being rebuilt.
+//
+//=============================================================
+
+namespace dedxTemplateCache {
+  const char magic[8] = {'H', 'S', 'C', 'P', 'G', 'i', 'T', '1'};
+
+  struct header {
+    char magic[8];
+    long long sourceSize;
+    long long sourceTime;
+    int splitByModuleType;
+    int puTreatment;
+    int nTemplates;
+  };
+
+  inline header makeHeader(const std::string& path, bool splitByModuleType, bool puTreatment, int nTemplates) {
+    header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, magic, sizeof(magic));
+    struct stat info;
+    if (stat(path.c_str(), &info) == 0) {
+      h.sourceSize = info.st_size;
+      h.sourceTime = info.st_mtime;
+    }
+    h.splitByModuleType = splitByModuleType;
+    h.puTreatment = puTreatment;
+    h.nTemplates = nTemplates;
+    return h;
+  }
+
+  inline bool read(const std::string& cachePath, const header& expected, std::vector<dedxTemplate>& templates) {
+    std::ifstream in(cachePath, std::ios::binary);
+    if (!in)
+      return false;
+    header h;
+    in.read((char*)&h, sizeof(h));
+    if (!in || std::memcmp(&h, &expected, sizeof(h)) != 0)
+      return false;
+    templates.resize(h.nTemplates);
+    for (auto& t : templates)
+      if (!t.read(in))
+        return false;
+    return true;
+  }
+
+  // written next to the final file and renamed, so that a concurrent job never reads a partial cache
+  inline void write(const std::string& cachePath, const header& h, const std::vector<dedxTemplate>& templates) {
+    std::string tmpPath = cachePath + ".tmp" + std::to_string(getpid());
+    std::ofstream out(tmpPath, std::ios::binary);
+    out.write((const char*)&h, sizeof(h));
+    for (const auto& t : templates)
+      t.write(out);
+    out.close();
+    if (!out || std::rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+      printf("dEdx template cache %s can't be written\n", cachePath.c_str());
+      std::remove(tmpPath.c_str());
+    }
+  }
+}  // namespace dedxTemplateCache
+
+// puTreatment false: one inclusive template, true: one template per PU bin (nPuBins of them)
+std::vector<dedxTemplate> loadDeDxTemplates(const std::string& path,
+                                            bool splitByModuleType,
+                                            bool puTreatment,
+                                            int nPuBins,
+                                            const std::string& cachePath = "") {
+  int nTemplates = puTreatment ? nPuBins : 1;
+  if (puTreatment && nPuBins > 5) {
+    printf("puBin > 5");
+    exit(0);
+  }
+
+  std::vector<dedxTemplate> templates;
+  dedxTemplateCache::header h = dedxTemplateCache::makeHeader(path, splitByModuleType, puTreatment, nTemplates);
+  if (!cachePath.empty() && dedxTemplateCache::read(cachePath, h, templates))
+    return templates;
+
+  TFile* InputFile = new TFile(path.c_str());
+  templates.assign(nTemplates, dedxTemplate());
+  for (int i = 0; i < nTemplates; i++) {
+    std::string template_name =
+        puTreatment ? "Calibration_GiTemplate_PU_" + to_string(i + 1) : "Calibration_GiTemplate";  // used to be Charge_Vs_Path
+    TH3F* DeDxMap_ = (TH3F*)GetObjectFromPath(InputFile, template_name);
+    if (!DeDxMap_) {
+      printf("dEdx templates in file %s can't be open\n", path.c_str());
+      exit(0);
+    }
+    templates[i].buildCumulative(*DeDxMap_, splitByModuleType);
   }
   InputFile->Close();
-  return Prob_ChargePath;
+  delete InputFile;
+
+  if (!cachePath.empty())
+    dedxTemplateCache::write(cachePath, h, templates);
+  return templates;
 }
 
 class dedxGainCorrector {
@@ -0,0 +1,110 @@
+#ifndef SUSYBSMAnalysis_Analyzer_EtaPhiGrid_h
+#define SUSYBSMAnalysis_Analyzer_EtaPhiGrid_h
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+//=============================================================
+//
+//     (eta, phi) grid of an object collection
+//
+//     Built once per event on a collection (tracks, PF
+//     candidates, jets, ...) and queried by cone. A query
+//     returns the indices of the objects in the cells that
+//     overlap the cone, in increasing order, so the caller
+//     applies its own deltaR cut and sums in the same order
+//     as a loop on the full collection.
+//
+//=============================================================
+
+class etaPhiGrid {
+public:
+  etaPhiGrid(float cellSize = 0.1, float maxEta = 3.0) : cellSize_(cellSize), maxEta_(maxEta) {
+    nEta_ = int(std::ceil(2 * maxEta_ / cellSize_));
+    // the phi cells cover exactly 2 pi, so that the wrapping falls on a cell edge
+    nPhi_ = std::max(1, int(std::floor(2 * M_PI / cellSize_)));
+    phiCellSize_ = 2 * M_PI / nPhi_;
+  }
+  ~etaPhiGrid() {}
+
+  // fill the grid with the objects of coll, objects beyond maxEta go to the edge cells
+  template <class Collection>
+  void fill(const Collection& coll) {
+    size_ = coll.size();
+    cell_.resize(size_);
+    offset_.assign(nEta_ * nPhi_ + 1, 0);
+    for (unsigned int i = 0; i < size_; i++) {
+      cell_[i] = cellOf(coll[i].eta(), coll[i].phi());
+      offset_[cell_[i] + 1]++;
+    }
+    for (unsigned int c = 0; c < offset_.size() - 1; c++)
+      offset_[c + 1] += offset_[c];
+    // counting sort, the indices stay ordered inside each cell
+    index_.resize(size_);
+    std::vector<unsigned int> pos(offset_.begin(), offset_.end() - 1);
+    for (unsigned int i = 0; i < size_; i++)
+      index_[pos[cell_[i]]++] = i;
+  }
+
+  void clear() {
+    size_ = 0;
+    cell_.clear();
+    index_.clear();
+    offset_.clear();
+  }
+
+  unsigned int size() const { return size_; }
+
+  // indices of the objects which can be within dRmax of (eta, phi), in increasing order
+  void query(float eta, float phi, float dRmax, std::vector<unsigned int>& out) const {
+    out.clear();
+    if (size_ == 0)
+      return;
+    if (!std::isfinite(eta) || !std::isfinite(phi)) {
+      for (unsigned int i = 0; i < size_; i++)
+        out.push_back(i);
+      return;
+    }
+    // small margin so that rounding never drops an object at the edge of the cone
+    float dR = dRmax + 1e-4;
+    int etaLow = etaBin(eta - dR);
+    int etaHigh = etaBin(eta + dR);
+    int phiLow = int(std::floor((phi - dR + M_PI) / phiCellSize_));
+    int nPhiBins = std::min(nPhi_, int(std::floor((phi + dR + M_PI) / phiCellSize_)) - phiLow + 1);
+    for (int ie = etaLow; ie <= etaHigh; ie++) {
+      for (int k = 0; k < nPhiBins; k++) {
+        int ip = ((phiLow + k) % nPhi_ + nPhi_) % nPhi_;
+        unsigned int c = ie * nPhi_ + ip;
+        out.insert(out.end(), index_.begin() + offset_[c], index_.begin() + offset_[c + 1]);
+      }
+    }
+    std::sort(out.begin(), out.end());
+  }
+
+private:
+  int etaBin(float eta) const {
+    return std::min(nEta_ - 1, std::max(0, int(std::floor((eta + maxEta_) / cellSize_))));
+  }
+
+  unsigned int cellOf(float eta, float phi) const {
+    // non finite directions can't be in any cone, they are kept in the first cell
+    if (!std::isfinite(eta) || !std::isfinite(phi))
+      return 0;
+    int ip = int(std::floor((phi + M_PI) / phiCellSize_));
+    ip = ((ip % nPhi_) + nPhi_) % nPhi_;
+    return etaBin(eta) * nPhi_ + ip;
+  }
+
+  float cellSize_;
+  double phiCellSize_;
+  float maxEta_;
+  int nEta_;
+  int nPhi_;
+  unsigned int size_ = 0;
+  std::vector<unsigned int> cell_;
+  std::vector<unsigned int> index_;
+  std::vector<unsigned int> offset_;
+};
+
+#endif
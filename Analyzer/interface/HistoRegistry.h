@@ -0,0 +1,164 @@
+#ifndef SUSYBSMAnalysis_Analyzer_HistoRegistry_h
+#define SUSYBSMAnalysis_Analyzer_HistoRegistry_h
+
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+
+#include "TArrayC.h"
+#include "TArrayD.h"
+#include "TArrayF.h"
+#include "TArrayI.h"
+#include "TArrayS.h"
+#include "TDirectory.h"
+#include "TH1.h"
+#include "CommonTools/UtilAlgos/interface/TFileService.h"
+
+//=============================================================
+//
+//     Registry of the tuple histograms
+//
+//     In book-on-fill mode the histograms are booked on their
+//     first use instead of in initializeTuple. A histogram
+//     that is never filled takes no memory and isn't written
+//     to the output. At the end of the job the registry reports
+//     the memory of the histograms of a directory per family,
+//     where the family is the name up to the first '_'.
+//
+//=============================================================
+
+class histoRegistry {
+public:
+  histoRegistry() {}
+  ~histoRegistry() {}
+
+  void setBookOnFill(bool bookOnFill) { bookOnFill_ = bookOnFill; }
+  bool bookOnFill() const { return bookOnFill_; }
+
+  void deferred() { nDeferred_++; }
+  void bookedOnFill() { nBookedOnFill_++; }
+
+  // memory of the bin contents and of the sums of squares of weights, per family
+  void report(TDirectory* dir, std::ostream& out) const {
+    std::map<std::string, family> families;
+    collect(dir, families);
+
+    family total;
+    char line[128];
+    out << "Histogram memory per family:\n";
+    for (const auto& f : families) {
+      snprintf(line, sizeof(line), "  %-32s %6u histograms %10.1f MB\n", f.first.c_str(), f.second.n, f.second.bytes / 1e6);
+      out << line;
+      total.n += f.second.n;
+      total.bytes += f.second.bytes;
+    }
+    snprintf(line, sizeof(line), "  %-32s %6u histograms %10.1f MB\n", "total", total.n, total.bytes / 1e6);
+    out << line;
+    if (bookOnFill_)
+      out << "  " << nBookedOnFill_ << " of the " << nDeferred_ << " histograms booked on fill were used, the "
+          << nDeferred_ - nBookedOnFill_ << " others are not written\n";
+  }
+
+private:
+  struct family {
+    unsigned int n = 0;
+    double bytes = 0;
+  };
+
+  static double histoBytes(const TH1* h) {
+    double bytes = h->GetSumw2N() * sizeof(double);
+    if (const TArrayF* a = dynamic_cast<const TArrayF*>(h))
+      bytes += a->GetSize() * sizeof(float);
+    else if (const TArrayD* a = dynamic_cast<const TArrayD*>(h))
+      bytes += a->GetSize() * sizeof(double);
+    else if (const TArrayI* a = dynamic_cast<const TArrayI*>(h))
+      bytes += a->GetSize() * sizeof(int);
+    else if (const TArrayS* a = dynamic_cast<const TArrayS*>(h))
+      bytes += a->GetSize() * sizeof(short);
+    else if (const TArrayC* a = dynamic_cast<const TArrayC*>(h))
+      bytes += a->GetSize() * sizeof(char);
+    return bytes;
+  }
+
+  static void collect(TDirectory* dir, std::map<std::string, family>& families) {
+    if (!dir)
+      return;
+    TIter next(dir->GetList());
+    while (TObject* obj = next()) {
+      if (TDirectory* sub = dynamic_cast<TDirectory*>(obj)) {
+        collect(sub, families);
+      } else if (const TH1* h = dynamic_cast<const TH1*>(obj)) {
+        const std::string name = h->GetName();
+        family& f = families[name.substr(0, name.find('_'))];
+        f.n++;
+        f.bytes += histoBytes(h);
+      }
+    }
+  }
+
+  bool bookOnFill_ = false;
+  unsigned int nDeferred_ = 0;
+  unsigned int nBookedOnFill_ = 0;
+};
+
+//=============================================================
+//
+//     Histogram booked on first use
+//
+//     Takes the place of a H* member of the Tuple: ->, and the
+//     conversion to H*, book the histogram in the directory
+//     given to book() if it isn't yet. Without book-on-fill
+//     the histogram is booked by book() itself, as before.
+//     A histogram read back from a file can be assigned to it
+//     directly, it is then used as a plain H*.
+//
+//=============================================================
+
+template <class H>
+class lazyHisto {
+public:
+  lazyHisto() {}
+
+  template <class... Binning>
+  void book(histoRegistry& registry, TFileDirectory& dir, const char* name, const char* title, Binning... binning) {
+    registry_ = &registry;
+    h_ = nullptr;
+    booker_ = [dir, name = std::string(name), title = std::string(title), binning...]() {
+      return dir.make<H>(name.c_str(), title.c_str(), binning...);
+    };
+    if (registry.bookOnFill())
+      registry.deferred();
+    else
+      h_ = booker_();
+  }
+
+  lazyHisto& operator=(H* h) {
+    booker_ = nullptr;
+    registry_ = nullptr;
+    h_ = h;
+    return *this;
+  }
+
+  // booking on first use doesn't change what the histogram holds, hence const
+  H* get() const {
+    if (!h_ && booker_) {
+      h_ = booker_();
+      registry_->bookedOnFill();
+    }
+    return h_;
+  }
+  H* operator->() const { return get(); }
+  H& operator*() const { return *get(); }
+  operator H*() const { return get(); }
+
+  bool booked() const { return h_ != nullptr; }
+
+private:
+  std::function<H*()> booker_;
+  histoRegistry* registry_ = nullptr;
+  mutable H* h_ = nullptr;
+};
+
+#endif
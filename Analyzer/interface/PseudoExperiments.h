@@ -0,0 +1,74 @@
+#ifndef SUSYBSMAnalysis_Analyzer_PseudoExperiments_h
+#define SUSYBSMAnalysis_Analyzer_PseudoExperiments_h
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "TAxis.h"
+#include "TH1.h"
+#include "TRandom3.h"
+
+//=============================================================
+//
+//     Pseudo-experiments on several threads
+//
+//     The input distributions are copied once into flat arrays
+//     (flatHisto) and a pseudo-experiment only works on these
+//     copies and on its own result, no ROOT histogram is
+//     created or modified. Pseudo-experiment pe draws its
+//     numbers from its own TRandom3 seeded with seed+pe, so the
+//     results do not depend on the number of threads.
+//
+//=============================================================
+
+// Flat copy of the content of a 1D or 2D histogram, under- and overflow bins included
+struct flatHisto {
+    int nx = 0;
+    int ny = 0;  // 0 for 1D histograms
+    TAxis xaxis;
+    TAxis yaxis;
+    std::vector<double> content;
+
+    flatHisto() {}
+    flatHisto(const TH1& h){
+        nx = h.GetNbinsX();
+        xaxis = *h.GetXaxis();
+        if(h.GetDimension()>1){
+            ny = h.GetNbinsY();
+            yaxis = *h.GetYaxis();
+        }
+        content.resize((nx+2)*stride());
+        for(int i=0;i<nx+2;i++){
+            if(ny==0){ content[i] = h.GetBinContent(i); continue; }
+            for(int j=0;j<ny+2;j++) content[i*stride()+j] = h.GetBinContent(i,j);
+        }
+    }
+    int stride() const { return ny>0 ? ny+2 : 1; }
+    double& operator()(int i, int j=0){ return content[i*stride()+j]; }
+    const double& operator()(int i, int j=0) const { return content[i*stride()+j]; }
+};
+
+// Run nPE pseudo-experiments on nThreads threads (0: one per core),
+// runPE(RNG, result) fills the Result of one pseudo-experiment
+template <class Result, class Function>
+std::vector<Result> runPseudoExperiments(int nPE, int nThreads, unsigned int seed, Function runPE){
+    std::vector<Result> vPE(std::max(nPE,0));
+    if(nThreads<=0) nThreads = std::max(1u,std::thread::hardware_concurrency());
+    nThreads = std::max(1,std::min(nThreads,nPE));
+    std::atomic<int> next(0);
+    auto worker = [&](){
+        for(int pe=next++;pe<nPE;pe=next++){
+            TRandom3 RNG(seed+pe);
+            runPE(RNG,vPE[pe]);
+        }
+    };
+    std::vector<std::thread> threads;
+    for(int t=1;t<nThreads;t++) threads.emplace_back(worker);
+    worker();
+    for(auto& t : threads) t.join();
+    return vPE;
+}
+
+#endif
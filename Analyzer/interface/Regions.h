@@ -2,6 +2,8 @@
 #define SUSYBSMAnalysis_Analyzer_Regions_h
 
 #include "SUSYBSMAnalysis/Analyzer/interface/CommonFunction.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/HistoRegistry.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/PseudoExperiments.h"
 #include "CommonTools/UtilAlgos/interface/TFileService.h"
 
 #include <TCanvas.h>
@@ -27,16 +29,40 @@ void scale(TH1F* h){
     h->Scale(1./h->Integral(0,h->GetNbinsX()+1));
 }
 
+//=============================================================
+//
+//     Fill buffer of a region
+//
+//     The candidates of a region are kept in flat arrays and
+//     given to the histograms by batch, one TH1::FillN call
+//     per histogram, when the buffer is full and at the end
+//     of the job. FillN does the same as a Fill per candidate,
+//     in the same order, so the histograms are unchanged.
+//
+//=============================================================
+
+struct regionFillBuffer {
+    static const unsigned int capacity = 4096;
+    std::vector<double> eta, p, pt, ih, ias, probq, m, tof, w;
+    std::vector<int> massSlice;  // ih_p_m_* histogram of the candidate, -1 if none
+
+    unsigned int size() const { return w.size(); }
+    void clear(){
+        eta.clear(); p.clear(); pt.clear(); ih.clear(); ias.clear(); probq.clear(); m.clear(); tof.clear(); w.clear();
+        massSlice.clear();
+    }
+};
+
 // class using to definite signal and control regions. 
 class Region{
     public:
         Region();
-        Region(TFileDirectory &dir,std::string suffix,int& etabins,int& ihbins,int& pbins,int& massbins,bool saveIhP);
+        Region(TFileDirectory &dir,histoRegistry &registry,std::string suffix,int& etabins,int& ihbins,int& pbins,int& massbins,bool saveIhP);
         ~Region();
         void setSuffix(std::string suffix);
-        void initHisto(TFileDirectory &dir,int etabins,int ihbins,int pbins,int massbins, bool saveIhP);
+        void initHisto(TFileDirectory &dir,histoRegistry &registry,int etabins,int ihbins,int pbins,int massbins, bool saveIhP);
         void fill(float& eta, float&p, float& pt, float& pterr, float& ih, float& ias, float& probq, float& m, float& tof, float& w, bool saveIhP);
-        void fillPredMass(const std::string&, float weight_);
+        void flush();
         void write(bool saveIhP);
 
         int np;
@@ -60,34 +86,35 @@ class Region{
         std::vector<double> VectOfBins_P_;
         std::string suffix_;
         //TH3F* ih_p_eta;
-        TH2F* eta_p;
-        TH2F* ih_eta;
-        TH2F* ih_p;
-        TH2F* ih_pt;
-        TH2F* ias_p;
-        TH2F* ias_pt;
+        lazyHisto<TH2F> eta_p;
+        lazyHisto<TH2F> ih_eta;
+        lazyHisto<TH2F> ih_p;
+        lazyHisto<TH2F> ih_pt;
+        lazyHisto<TH2F> ias_p;
+        lazyHisto<TH2F> ias_pt;
         //TH2F* ias_ih;
         TH1F* mass;
         TH1F* pred_mass;
         TH2F* eta_p_rebinned;
         //TH2F* pt_pterroverpt;
         TH1F* hTOF;
-        TH2F* ih_p_m_inf_0;
-        TH2F* ih_p_m_0_100;
-        TH2F* ih_p_m_100_200;
-        TH2F* ih_p_m_200_300;
-        TH2F* ih_p_m_300_400;
-        TH2F* ih_p_m_400_600;
-        TH2F* ih_p_m_600_800;
-        TH2F* ih_p_m_800_inf;
-        TH2F* mass_probQ;
+        lazyHisto<TH2F> ih_p_m_inf_0;
+        lazyHisto<TH2F> ih_p_m_0_100;
+        lazyHisto<TH2F> ih_p_m_100_200;
+        lazyHisto<TH2F> ih_p_m_200_300;
+        lazyHisto<TH2F> ih_p_m_300_400;
+        lazyHisto<TH2F> ih_p_m_400_600;
+        lazyHisto<TH2F> ih_p_m_600_800;
+        lazyHisto<TH2F> ih_p_m_800_inf;
+        lazyHisto<TH2F> mass_probQ;
+        regionFillBuffer buffer;
 };
 
 Region::Region(){}
 
-Region::Region(TFileDirectory &dir, std::string suffix,int& etabins,int& ihbins,int& pbins,int& massbins,bool saveIhP=false){
+Region::Region(TFileDirectory &dir, histoRegistry &registry, std::string suffix,int& etabins,int& ihbins,int& pbins,int& massbins,bool saveIhP=false){
     suffix_ = suffix;
-    initHisto(dir,etabins,ihbins,pbins,massbins,saveIhP);
+    initHisto(dir,registry,etabins,ihbins,pbins,massbins,saveIhP);
 } 
 
 Region::~Region(){
@@ -109,8 +136,9 @@ void Region::setSuffix(std::string suffix){
     suffix_ = suffix;
 }
 
-// Function which intializes the histograms with given binnings 
-void Region::initHisto(TFileDirectory &dir,int etabins,int ihbins,int pbins,int massbins,bool saveIhP=false){
+// Function which intializes the histograms with given binnings, the 2D-histograms are booked through
+// the registry, so on their first fill in book-on-fill mode (regions without candidates book none)
+void Region::initHisto(TFileDirectory &dir,histoRegistry &registry,int etabins,int ihbins,int pbins,int massbins,bool saveIhP=false){
     TH1::SetDefaultSumw2(kTRUE);
     TH2::SetDefaultSumw2(kTRUE);
     TH3::SetDefaultSumw2(kTRUE);
@@ -135,12 +163,12 @@ void Region::initHisto(TFileDirectory &dir,int etabins,int ihbins,int pbins,int
     massup = 4000;
     std::string suffix = suffix_;
     //ih_p_eta = dir.make<TH3F>(("ih_p_eta"+suffix).c_str(),";#eta;10^{-4}/p [GeV^{-1}];I_{h} [MeV/cm]",neta,etalow,etaup,np,plow,pup,nih,ihlow,ihup); 
-    eta_p = dir.make<TH2F>(("eta_p"+suffix).c_str(),";10^{-4}/p [GeV^{-1}];#eta",np,plow,pup,neta,etalow,etaup); 
-    ih_eta = dir.make<TH2F>(("ih_eta"+suffix).c_str(),";#eta;I_{h} [MeV/cm]",neta,etalow,etaup,nih,ihlow,ihup); 
-    ih_p = dir.make<TH2F>(("ih_p"+suffix).c_str(),";10^{-4}/p [GeV^{-1}];I_{h} [MeV/cm]",np,plow,pup,nih,ihlow,ihup);
-    ih_pt = dir.make<TH2F>(("ih_pt"+suffix).c_str(),";p_{T} [GeV];I_{h} [MeV/cm]",npt,plow,pup,nih,ihlow,ihup);
-    ias_p = dir.make<TH2F>(("ias_p"+suffix).c_str(),";10^{-4}/p [GeV^{-1}];G_{i}",np,plow,pup,nias,iaslow,iasup); 
-    ias_pt = dir.make<TH2F>(("ias_pt"+suffix).c_str(),";p_{T} [GeV];G_{i}",npt,ptlow,ptup,nias,iaslow,iasup);
+    eta_p.book(registry,dir,("eta_p"+suffix).c_str(),";10^{-4}/p [GeV^{-1}];#eta",np,plow,pup,neta,etalow,etaup);
+    ih_eta.book(registry,dir,("ih_eta"+suffix).c_str(),";#eta;I_{h} [MeV/cm]",neta,etalow,etaup,nih,ihlow,ihup);
+    ih_p.book(registry,dir,("ih_p"+suffix).c_str(),";10^{-4}/p [GeV^{-1}];I_{h} [MeV/cm]",np,plow,pup,nih,ihlow,ihup);
+    ih_pt.book(registry,dir,("ih_pt"+suffix).c_str(),";p_{T} [GeV];I_{h} [MeV/cm]",npt,plow,pup,nih,ihlow,ihup);
+    ias_p.book(registry,dir,("ias_p"+suffix).c_str(),";10^{-4}/p [GeV^{-1}];G_{i}",np,plow,pup,nias,iaslow,iasup);
+    ias_pt.book(registry,dir,("ias_pt"+suffix).c_str(),";p_{T} [GeV];G_{i}",npt,ptlow,ptup,nias,iaslow,iasup);
     //ias_ih = dir.make<TH2F>(("ias_ih"+suffix).c_str(),";I_{h} [MeV/cm];G_{i}",nih,ihlow,ihup,nias,iaslow,iasup);
     mass = dir.make<TH1F>(("mass"+suffix).c_str(),";Mass [GeV]",nmass,masslow,massup); 
     pred_mass = dir.make<TH1F>(("pred_mass"+suffix).c_str(),";Mass [GeV]",nmass,masslow,massup); 
@@ -148,109 +176,84 @@ void Region::initHisto(TFileDirectory &dir,int etabins,int ihbins,int pbins,int
     pred_mass->SetBinErrorOption(TH1::EBinErrorOpt::kPoisson);
     //pt_pterroverpt = dir.make<TH2F>(("pt_pterroverpt"+suffix).c_str(),";p_{T} [GeV];#frac{#sigma_{pT}}{p_{T}}",npt,ptlow,ptup,100,0,1); 
     hTOF    = dir.make<TH1F>(("hTOF_"+suffix).c_str(),";TOF",200,-10,10);
-    if(saveIhP)ih_p_m_inf_0 = dir.make<TH2F>(("ih_p_m_inf_0"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
-    if(saveIhP)ih_p_m_0_100 = dir.make<TH2F>(("ih_p_m_0_100"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
-    if(saveIhP)ih_p_m_100_200 = dir.make<TH2F>(("ih_p_m_100_200"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
-    if(saveIhP)ih_p_m_200_300 = dir.make<TH2F>(("ih_p_m_200_300"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
-    if(saveIhP)ih_p_m_300_400 = dir.make<TH2F>(("ih_p_m_300_400"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
-    if(saveIhP)ih_p_m_400_600 = dir.make<TH2F>(("ih_p_m_400_600"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
-    if(saveIhP)ih_p_m_600_800 = dir.make<TH2F>(("ih_p_m_600_800"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
-    if(saveIhP)ih_p_m_800_inf = dir.make<TH2F>(("ih_p_m_800_inf"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
-    mass_probQ = dir.make<TH2F>(("mass_probQ"+suffix).c_str(),";Mass [GeV];F_{i}^{pixel}",nmass,masslow,massup,50,0,1); 
+    if(saveIhP)ih_p_m_inf_0.book(registry,dir,("ih_p_m_inf_0"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
+    if(saveIhP)ih_p_m_0_100.book(registry,dir,("ih_p_m_0_100"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
+    if(saveIhP)ih_p_m_100_200.book(registry,dir,("ih_p_m_100_200"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
+    if(saveIhP)ih_p_m_200_300.book(registry,dir,("ih_p_m_200_300"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
+    if(saveIhP)ih_p_m_300_400.book(registry,dir,("ih_p_m_300_400"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
+    if(saveIhP)ih_p_m_400_600.book(registry,dir,("ih_p_m_400_600"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
+    if(saveIhP)ih_p_m_600_800.book(registry,dir,("ih_p_m_600_800"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
+    if(saveIhP)ih_p_m_800_inf.book(registry,dir,("ih_p_m_800_inf"+suffix).c_str(),";p [GeV];I_{h} [MeV/cm]",100,0,4000,50,0,10);
+    mass_probQ.book(registry,dir,("mass_probQ"+suffix).c_str(),";Mass [GeV];F_{i}^{pixel}",nmass,masslow,massup,50,0,1);
 }
 
-// Function which fills histograms
+// Function which fills histograms, the candidate is buffered and filled with the next flush()
 void Region::fill(float& eta, float& p, float& pt, float& pterr, float& ih, float& ias, float& probq, float& m, float& tof, float& w, bool saveIhP=false){
+   // upper edges of the ih_p_m_* mass slices: (-inf,0], (0,100], ..., (800,inf)
+   static const float massSliceEdges[7] = {0, 100, 200, 300, 400, 600, 800};
+   int massSlice = -1;
+   if(saveIhP && !std::isnan(m)) massSlice = std::lower_bound(massSliceEdges, massSliceEdges+7, m) - massSliceEdges;
+
+   buffer.eta.push_back(eta);
+   buffer.p.push_back(p);
+   buffer.pt.push_back(pt);
+   buffer.ih.push_back(ih);
+   buffer.ias.push_back(ias);
+   buffer.probq.push_back(probq);
+   buffer.m.push_back(m);
+   buffer.tof.push_back(tof);
+   buffer.w.push_back(w);
+   buffer.massSlice.push_back(massSlice);
+   if(buffer.size() >= regionFillBuffer::capacity) flush();
+}
+
+// Fill the histograms with the buffered candidates, to be called before the histograms are used or written
+void Region::flush(){
+   const int n = buffer.size();
+   if(n == 0) return;
+   const double* w = buffer.w.data();
     //ih_p_eta->Fill(eta,p,ih,w);
-   eta_p->Fill(p,eta,w);
-   ih_eta->Fill(eta,ih,w);
-   ih_p->Fill(p,ih,w);
-   ih_pt->Fill(pt,ih,w);
-   ias_p->Fill(p,ias,w);
-   ias_pt->Fill(pt,ias,w);
+   eta_p->FillN(n,buffer.p.data(),buffer.eta.data(),w);
+   ih_eta->FillN(n,buffer.eta.data(),buffer.ih.data(),w);
+   ih_p->FillN(n,buffer.p.data(),buffer.ih.data(),w);
+   ih_pt->FillN(n,buffer.pt.data(),buffer.ih.data(),w);
+   ias_p->FillN(n,buffer.p.data(),buffer.ias.data(),w);
+   ias_pt->FillN(n,buffer.pt.data(),buffer.ias.data(),w);
    //ias_ih->Fill(ih,ias,w);
-   mass->Fill(m,w);
+   mass->FillN(n,buffer.m.data(),w);
    //pt_pterroverpt->Fill(pt,pterr/pt,w);
-   hTOF->Fill(tof,w);
-   if(m<=0 && saveIhP)            ih_p_m_inf_0->Fill(1e-4/p,ih,w);
-   if(m>0 && m<=100 && saveIhP)   ih_p_m_0_100->Fill(1e-4/p,ih,w);
-   if(m>100 && m<=200 && saveIhP) ih_p_m_100_200->Fill(1e-4/p,ih,w);
-   if(m>200 && m<=300 && saveIhP) ih_p_m_200_300->Fill(1e-4/p,ih,w);
-   if(m>300 && m<=400 && saveIhP) ih_p_m_300_400->Fill(1e-4/p,ih,w);
-   if(m>400 && m<=600 && saveIhP) ih_p_m_400_600->Fill(1e-4/p,ih,w);
-   if(m>600 && m<=800 && saveIhP) ih_p_m_600_800->Fill(1e-4/p,ih,w);
-   if(m>800 && saveIhP)           ih_p_m_800_inf->Fill(1e-4/p,ih,w);
-   mass_probQ->Fill(m,probq,w);
-}
-
-// in order to compute properly the uncertainties we use the methods SetBinContent SetBinError instead of Fill
-// as several couples of bins in (p,ih) can provide the same mass estimate we need to properly sum the entries and errors
-// for a couple of bins in (p,ih) where the bin content were (N_p,N_ih) the associated quantities should be 
-// content: (N_p * N_ih) / N_total, where N_total represents the total number of events in the region (integral of p, ih & mass distributions)
-// error: content * sqrt( 1 / N_p + 1 / N_ih ) where we assume Poisson uncertainties in both distributions (independent distributions) and we neglect the uncertainty on N_total
-// While combining the input for several couples leading to the same mass: 
-// contents are added 
-// errors: the sqrt of the squared uncertainties are added
-void Region::fillPredMass(const std::string& st_sample,float weight_=-1) {
-    TH1F* eta = (TH1F*) ih_eta->ProjectionX();
-    for(int i=1;i<eta->GetNbinsX();i++)
-    {
-        TH1F* p = (TH1F*) eta_p->ProjectionX("proj_p",i,i);
-        if(VectOfBins_P_.size()>1) p = (TH1F*)p->Rebin(VectOfBins_P_.size()-1,"",VectOfBins_P_.data());
-        TH1F* ih = (TH1F*) ih_eta->ProjectionY("proj_ih",i,i);
-        scale(p); //only scale one of the two distributions ih or p --> keep the information of the normalisation 
-        for(int j=1;j<p->GetNbinsX();j++)
-        {
-            for(int k=1;k<ih->GetNbinsX();k++)
-            {
-                if(p->GetBinContent(j)<=0) continue;
-                if(ih->GetBinContent(k)<=0) continue;
-                float mom = p->GetBinCenter(j);
-                float dedx = ih->GetBinCenter(k);
-                float prob = p->GetBinContent(j) * ih->GetBinContent(k);
-                float weight = prob;
-                //if(weight_>0) weight = weight_;
-                float err_weight = weight*sqrt((1./(ih->GetBinContent(k)))+(1./(p->GetBinContent(j)*ih->Integral())));
-                float K=0, C=0;
-                if(st_sample=="data2017"){K=K_data2017;C=C_data2017;}
-                if(st_sample=="data2018"){K=K_data2018;C=C_data2018;}
-                if(st_sample=="mc2017"){K=K_mc2017;C=C_mc2017;}
-                if(st_sample=="mc2018"){K=K_mc2018;C=C_mc2018;}
-                float mass = GetMass(mom,dedx,K,C);
-                int bin_mass = pred_mass->FindBin(mass);
-                if(prob>=0)
-                {
-                    pred_mass->SetBinContent(bin_mass,pred_mass->GetBinContent(bin_mass)+weight);
-                    pred_mass->SetBinError(bin_mass,sqrt(pow(pred_mass->GetBinError(bin_mass),2)+pow(err_weight,2)));
-                }
-            }
-        }
-        delete p;
-        delete ih;
-    }
+   hTOF->FillN(n,buffer.tof.data(),w);
+   // only the mass slices with candidates are booked
+   lazyHisto<TH2F>* ih_p_m[8] = {&ih_p_m_inf_0, &ih_p_m_0_100, &ih_p_m_100_200, &ih_p_m_200_300, &ih_p_m_300_400, &ih_p_m_400_600, &ih_p_m_600_800, &ih_p_m_800_inf};
+   for(int i=0;i<n;i++){
+       if(buffer.massSlice[i] >= 0) (*ih_p_m[buffer.massSlice[i]])->Fill(1e-4/buffer.p[i],buffer.ih[i],w[i]);
+   }
+   mass_probQ->FillN(n,buffer.m.data(),buffer.probq.data(),w);
+   buffer.clear();
 }
 
+// the 2D-histograms left unbooked in book-on-fill mode are not written
 void Region::write(bool saveIhP=false){
     //ih_p_eta->Write();
-    eta_p->Write();
-    ih_eta->Write();
-    ih_p->Write();
-    ias_p->Write();
-    ias_pt->Write();
+    if(eta_p.booked()) eta_p->Write();
+    if(ih_eta.booked()) ih_eta->Write();
+    if(ih_p.booked()) ih_p->Write();
+    if(ias_p.booked()) ias_p->Write();
+    if(ias_pt.booked()) ias_pt->Write();
     //ias_ih->Write();
     mass->Write();
     pred_mass->Write();
     //pt_pterroverpt->Write();
     hTOF->Write();
-    if(saveIhP)ih_p_m_inf_0->Write();
-    if(saveIhP)ih_p_m_0_100->Write();
-    if(saveIhP)ih_p_m_100_200->Write();
-    if(saveIhP)ih_p_m_200_300->Write();
-    if(saveIhP)ih_p_m_300_400->Write();
-    if(saveIhP)ih_p_m_400_600->Write();
-    if(saveIhP)ih_p_m_600_800->Write();
-    if(saveIhP)ih_p_m_800_inf->Write();
-    mass_probQ->Write();
+    if(saveIhP && ih_p_m_inf_0.booked()) ih_p_m_inf_0->Write();
+    if(saveIhP && ih_p_m_0_100.booked()) ih_p_m_0_100->Write();
+    if(saveIhP && ih_p_m_100_200.booked()) ih_p_m_100_200->Write();
+    if(saveIhP && ih_p_m_200_300.booked()) ih_p_m_200_300->Write();
+    if(saveIhP && ih_p_m_300_400.booked()) ih_p_m_300_400->Write();
+    if(saveIhP && ih_p_m_400_600.booked()) ih_p_m_400_600->Write();
+    if(saveIhP && ih_p_m_600_800.booked()) ih_p_m_600_800->Write();
+    if(saveIhP && ih_p_m_800_inf.booked()) ih_p_m_800_inf->Write();
+    if(mass_probQ.booked()) mass_probQ->Write();
 }
 
 void loadHistograms(Region& r, TFile* f, const std::string& regionName, bool bool_rebin=true, int rebineta=1, int rebinp=1, int rebinih=1, int rebinmass=1){
@@ -489,40 +492,240 @@ TCanvas* plotting(TH1F* h1, TH1F* h2, bool ratioSimple=true, std::string dirname
     return c1;
 }
 
-void bckgEstimate(const std::string& st_sample, const std::string& dirname, const Region& B, const Region& C, const Region& BC, const Region& A, const Region& D, const std::string& st, const int& nPE=100, const int& rebinMass=1){
+//=============================================================
+//
+//     Pseudo-experiments of the background prediction
+//
+//     Run with runPseudoExperiments on flat copies of the
+//     region histograms (PseudoExperiments.h).
+//
+//=============================================================
+
+// Mass predicted in a pseudo-experiment, content and squared errors of each bin of the mass histogram
+struct predMassPE {
+    std::vector<double> content;
+    std::vector<double> err2;
+};
+
+// K & C used to compute the mass for a given sample
+void getKC(const std::string& st_sample, float& K, float& C){
+    K=0; C=0;
+    if(st_sample=="data2017"){K=K_data2017;C=C_data2017;}
+    if(st_sample=="data2018"){K=K_data2018;C=C_data2018;}
+    if(st_sample=="mc2017"){K=K_mc2017;C=C_mc2017;}
+    if(st_sample=="mc2018"){K=K_mc2018;C=C_mc2018;}
+}
+
+// Same as poissonHisto, the last overflow bin is kept as it is
+void poissonHisto(flatHisto& h, TRandom3& RNG){
+    for(int i=0;i<h.nx+1;i++){
+        if(h.ny==0){ h(i) = RNG.Poisson(h(i)); continue; }
+        for(int j=0;j<h.ny+1;j++){
+            h(i,j) = RNG.Poisson(h(i,j));
+        }
+    }
+}
+
+// Integral of a 1D (2D) flat histogram, under- and overflow bins excluded
+double integral(const flatHisto& h){
+    double sum = 0;
+    for(int i=1;i<=h.nx;i++){
+        if(h.ny==0){ sum += h(i); continue; }
+        for(int j=1;j<=h.ny;j++) sum += h(i,j);
+    }
+    return sum;
+}
+
+// Same as etaReweighingP on the flat copies, eta2 being the eta distribution of the target region
+void etaReweighingP(flatHisto& eta_p_1, const flatHisto& eta2){
+    int n = eta_p_1.ny+2;
+    std::vector<double> eta1(n,0.), w(n,0.);
+    for(int i=0;i<eta_p_1.nx+2;i++){
+        for(int j=0;j<n;j++) eta1[j] += eta_p_1(i,j);
+    }
+    double I1 = 0, I2 = 0;
+    for(int j=1;j<n-1;j++) I1 += eta1[j];
+    for(int j=1;j<=eta2.nx;j++) I2 += eta2(j);
+    for(int j=0;j<n && j<eta2.nx+2;j++){
+        double e1 = eta1[j]/I1;
+        w[j] = (e1!=0) ? (eta2(j)/I2)/e1 : 0;
+    }
+    for(int i=0;i<eta_p_1.nx+1;i++){
+        for(int j=0;j<n-1;j++) eta_p_1(i,j) = eta_p_1(i,j)*w[j];
+    }
+}
+
+// Binning of the mass prediction for a given (p, ih) binning and K & C:
+// p bin (after the optional rebinning) of each bin of the eta_p x axis
+// and mass bin of each (p, ih) bin couple, computed once
+struct predMassTable {
+    bool rebinP = false;
+    int np = 0;
+    int nih = 0;
+    int nmass = 0;
+    std::vector<int> pBin;
+    std::vector<int> massBin;  // (np+2)*(nih+2), -1 when outside of the loops on p and ih
+
+    predMassTable() {}
+    predMassTable(const flatHisto& eta_p, const flatHisto& ih_eta, const std::vector<double>& VectOfBins_P, const TAxis& massAxis, const std::string& st_sample){
+        float K=0, C=0;
+        getKC(st_sample,K,C);
+        rebinP = VectOfBins_P.size()>1;
+        TAxis pAxis = rebinP ? TAxis(VectOfBins_P.size()-1,VectOfBins_P.data()) : eta_p.xaxis;
+        np = pAxis.GetNbins();
+        nih = ih_eta.ny;
+        nmass = massAxis.GetNbins();
+        pBin.resize(eta_p.nx+2);
+        for(int j=0;j<eta_p.nx+2;j++){
+            pBin[j] = j;
+            if(rebinP && j>0 && j<=eta_p.nx) pBin[j] = pAxis.FindFixBin(eta_p.xaxis.GetBinCenter(j));
+            else if(rebinP && j>eta_p.nx) pBin[j] = np+1;
+        }
+        massBin.assign((np+2)*(nih+2),-1);
+        for(int j=1;j<np;j++){
+            for(int k=1;k<nih;k++){
+                float mom = pAxis.GetBinCenter(j);
+                float dedx = ih_eta.yaxis.GetBinCenter(k);
+                massBin[j*(nih+2)+k] = massAxis.FindFixBin(GetMass(mom,dedx,K,C));
+            }
+        }
+    }
+};
+
+// Mass prediction from eta_p (p, eta) and ih_eta (eta, ih), given as flat copies, in content and squared errors
+// in order to compute properly the uncertainties the contents and squared errors are summed instead of using Fill
+// as several couples of bins in (p,ih) can provide the same mass estimate we need to properly sum the entries and errors
+// for a couple of bins in (p,ih) where the bin content were (N_p,N_ih) the associated quantities should be 
+// content: (N_p * N_ih) / N_total, where N_total represents the total number of events in the region (integral of p, ih & mass distributions)
+// error: content * sqrt( 1 / N_p + 1 / N_ih ) where we assume Poisson uncertainties in both distributions (independent distributions) and we neglect the uncertainty on N_total
+// While combining the input for several couples leading to the same mass: 
+// contents are added 
+// errors: the sqrt of the squared uncertainties are added
+// The weights of a row of ih bins are computed in a separate loop so that it can be vectorized.
+void fillPredMass(const flatHisto& eta_p, const flatHisto& ih_eta, const predMassTable& table, predMassPE& pred){
+    const int np = table.np;
+    const int nih = table.nih;
+    std::vector<double> p(np+2), ih(nih+2);
+    std::vector<float> weight(nih+2);
+    std::vector<double> err2_weight(nih+2);
+    pred.content.assign(table.nmass+2,0.);
+    pred.err2.assign(table.nmass+2,0.);
+    for(int i=1;i<ih_eta.nx;i++)
+    {
+        std::fill(p.begin(),p.end(),0.);
+        for(int j=0;j<eta_p.nx+2;j++) p[table.pBin[j]] += eta_p(j,i);
+        for(int k=0;k<nih+2;k++) ih[k] = ih_eta(i,k);
+        //only scale one of the two distributions ih or p --> keep the information of the normalisation
+        double pNorm = 0, ihIntegral = 0;
+        for(int j=0;j<np+2;j++) pNorm += p[j];
+        for(int j=0;j<np+2;j++) p[j] *= 1./pNorm;
+        for(int k=1;k<=nih;k++) ihIntegral += ih[k];
+        for(int j=1;j<np;j++)
+        {
+            if(p[j]<=0) continue;
+            // weights of the whole ih row first, then added in the mass bins
+            const double pj = p[j], pjI = 1./(p[j]*ihIntegral);
+            for(int k=1;k<nih;k++){
+                float w = pj * ih[k];
+                float err_weight = w*sqrt((1./ih[k])+pjI);
+                weight[k] = w;
+                err2_weight[k] = (double)err_weight*err_weight;
+            }
+            const int* massBin = &table.massBin[j*(nih+2)];
+            for(int k=1;k<nih;k++)
+            {
+                if(ih[k]<=0 || !(weight[k]>=0)) continue;
+                pred.content[massBin[k]] = (float)(pred.content[massBin[k]]+weight[k]);
+                pred.err2[massBin[k]] += err2_weight[k];
+            }
+        }
+    }
+}
+
+// Same as scale followed by massNormalisation
+void normalisePredMass(predMassPE& pred, const float& normalisation){
+    double sum = 0;
+    for(unsigned int k=0;k<pred.content.size();k++) sum += pred.content[k];
+    for(unsigned int k=0;k<pred.content.size();k++){
+        double c = 1./sum;
+        if(k<pred.content.size()-1) c *= normalisation;
+        pred.content[k] = (float)(pred.content[k]*c);
+        pred.err2[k] *= c*c;
+    }
+}
+
+// Same as meanHistoPE on the results of runPseudoExperiments, h being a model of the mass histogram.
+// With a single pseudo-experiment its content and errors are returned.
+TH1F meanHistoPE(const TH1F& model, const std::vector<predMassPE>& vPE){
+    float SystError = 0.2;
+    TH1F h(model);
+    h.Reset();
+    h.SetBinErrorOption(TH1::EBinErrorOpt::kPoisson);
+    if(vPE.size()==1){
+        for(int i=0;i<h.GetNbinsX()+2;i++){
+            h.SetBinContent(i,vPE[0].content[i]);
+            h.SetBinError(i,sqrt(vPE[0].err2[i]));
+        }
+        return h;
+    }
+    float fact = 1;
+    if(vPE.size()>1) fact=vPE.size()/(vPE.size()-1);
+    for(int i=0;i<h.GetNbinsX()+1;i++){
+        // mean and standard deviation of the pseudo-experiments within the range of the temporary histogram used before
+        double n=0, sum=0, sum2=0;
+        for(unsigned int pe=0;pe<vPE.size();pe++){
+            double x = (float)vPE[pe].content[i];
+            if(x<0 || x>=1e6) continue;
+            n++; sum+=x; sum2+=x*x;
+        }
+        float mean = n>0 ? sum/n : 0;
+        float err = n>0 ? sqrt(std::max(0.,sum2/n-pow(sum/n,2))) : 0;
+        err = fact*err;
+        err = sqrt(pow(err,2)+pow(SystError*mean,2));
+        h.SetBinContent(i,mean);
+        h.SetBinError(i,err);
+    }
+    return h;
+}
+
+void bckgEstimate(const std::string& st_sample, const std::string& dirname, const Region& B, const Region& C, const Region& BC, const Region& A, const Region& D, const std::string& st, const int& nPE=100, const int& rebinMass=1, const int& nThreads=0, const unsigned int& seed=4357){
     Region bc = BC;
     Region d = D;
-    std::vector<TH1F> vPE;
-    TRandom3* RNG = new TRandom3();
-    for(int pe=0;pe<nPE;pe++){
-        Region a = A;
-        Region b = B;
-        Region c = C;
-        TH2F a_ih_eta(*a.ih_eta);
-        TH2F b_ih_eta(*b.ih_eta);
-        TH2F c_ih_eta(*c.ih_eta);
-        TH2F b_eta_p(*b.eta_p);
-        TH2F c_eta_p(*c.eta_p);
+    const flatHisto a_ih_eta0(*A.ih_eta);
+    const flatHisto b_ih_eta0(*B.ih_eta);
+    const flatHisto c_ih_eta0(*C.ih_eta);
+    const flatHisto b_eta_p0(*B.eta_p);
+    const flatHisto c_eta_p0(*C.eta_p);
+    const predMassTable table(c_eta_p0,b_ih_eta0,bc.VectOfBins_P_,*BC.pred_mass->GetXaxis(),st_sample);
+    std::vector<predMassPE> vPE = runPseudoExperiments<predMassPE>(nPE,nThreads,seed,[&](TRandom3& RNG, predMassPE& pred){
+        flatHisto a_ih_eta(a_ih_eta0);
+        flatHisto b_ih_eta(b_ih_eta0);
+        flatHisto c_ih_eta(c_ih_eta0);
+        flatHisto b_eta_p(b_eta_p0);
+        flatHisto c_eta_p(c_eta_p0);
         poissonHisto(a_ih_eta,RNG);
         poissonHisto(b_ih_eta,RNG);
         poissonHisto(c_ih_eta,RNG);
         poissonHisto(b_eta_p,RNG);
         poissonHisto(c_eta_p,RNG);
-        TH1F* b_eta = (TH1F*)b_eta_p.ProjectionY();
-        etaReweighingP(&c_eta_p,b_eta);
-        bc.eta_p = &c_eta_p;    bc.ih_eta = &b_ih_eta;
-        float A = a_ih_eta.Integral();
-        float B = b_ih_eta.Integral();
-        float C = c_ih_eta.Integral();
+        // eta distribution of region B, projection of (p, eta) on eta
+        flatHisto b_eta;
+        b_eta.nx = b_eta_p.ny;
+        b_eta.content.assign(b_eta_p.ny+2,0.);
+        for(int i=0;i<b_eta_p.nx+2;i++){
+            for(int j=0;j<b_eta_p.ny+2;j++) b_eta(j) += b_eta_p(i,j);
+        }
+        etaReweighingP(c_eta_p,b_eta);
+        float A = integral(a_ih_eta);
+        float B = integral(b_ih_eta);
+        float C = integral(c_ih_eta);
         float normalisationABC = 1.;
         if(A>0) normalisationABC = B*C/A;
-        bc.fillPredMass(st_sample);
-        scale(bc.pred_mass);
-        massNormalisation(bc.pred_mass,normalisationABC);
-        vPE.push_back(*bc.pred_mass);
-    }
-    TH1F h_temp = meanHistoPE(vPE);
-    if(nPE>1) bc.pred_mass = &h_temp;
+        fillPredMass(c_eta_p,b_ih_eta,table,pred);
+        normalisePredMass(pred,normalisationABC);
+    });
+    TH1F h_temp = meanHistoPE(*BC.pred_mass,vPE);
+    bc.pred_mass = &h_temp;
     
     saveHistoRatio(d.mass,bc.pred_mass,("mass_obs_"+st).c_str(),("mass_predBC_"+st).c_str(),("mass_predBCR_"+st).c_str());
     saveHistoRatio(d.mass,bc.pred_mass,("mass_obs_"+st).c_str(),("mass_predBC_"+st).c_str(),("mass_predBCR_"+st).c_str(),true);
@@ -535,55 +738,52 @@ void bckgEstimate(const std::string& st_sample, const std::string& dirname, cons
     
     plotting(d.mass,bc.pred_mass,false,dirname,("mass1D_regionBC_"+st+"_nPE-"+to_string(nPE)).c_str(),"Observed","Prediction")->Write();
     plotting(d.mass,bc.pred_mass,false,dirname,("mass1D_regionBC_"+st+"_nPE-"+to_string(nPE)).c_str(),"Observed","Prediction",true)->Write();
-    delete RNG;
 }
 
-void bckgEstimate_fromHistos(const std::string& st_sample, const std::string& dirname, const TH2F& mass_cutInd, const TH2F& eta_cutIndex_A, const TH2F& eta_cutIndex_B, const TH3F& ih_eta_cutIndex_B, const TH3F& eta_p_cutIndex_C, const TH1F& HA, const TH1F& HB, const TH1F& HC, int cutIndex=3, int nPE=100){
+void bckgEstimate_fromHistos(const std::string& st_sample, const std::string& dirname, const TH2F& mass_cutInd, const TH2F& eta_cutIndex_A, const TH2F& eta_cutIndex_B, const TH3F& ih_eta_cutIndex_B, const TH3F& eta_p_cutIndex_C, const TH1F& HA, const TH1F& HB, const TH1F& HC, int cutIndex=3, int nPE=100, int nThreads=0, unsigned int seed=4357){
     TH2F* mass_cutIndex = (TH2F*) mass_cutInd.Clone();
     TH1F* mass_obs = (TH1F*)mass_cutIndex->ProjectionY("_projD",cutIndex+1,cutIndex+1);
     Region rBC;
     rBC.pred_mass = (TH1F*)mass_obs->Clone();
     rBC.pred_mass->Reset();
-    std::vector<TH1F> vPE;
-    TRandom3* RNG = new TRandom3();
-    for(int pe=0;pe<nPE;pe++){
-   
-        TH2F* eta_cutIndex_regA = (TH2F*) eta_cutIndex_A.Clone();
-        TH2F* eta_cutIndex_regB = (TH2F*) eta_cutIndex_B.Clone();
-        TH3F* ih_eta_cutIndex_regB = (TH3F*) ih_eta_cutIndex_B.Clone();
-        TH3F* eta_p_cutIndex_regC = (TH3F*) eta_p_cutIndex_C.Clone();
-        TH1F* H_A = (TH1F*) HA.Clone();
-        TH1F* H_B = (TH1F*) HB.Clone();
-        TH1F* H_C = (TH1F*) HC.Clone();
-    
-        TH1F* eta_regA = (TH1F*)eta_cutIndex_regA->ProjectionY("_projA",cutIndex+1,cutIndex+1);
-        TH1F* eta_regB = (TH1F*)eta_cutIndex_regB->ProjectionY("_projB",cutIndex+1,cutIndex+1);
-        ih_eta_cutIndex_regB->GetXaxis()->SetRange(cutIndex+1,cutIndex+1);
-        TH2F* ih_eta_regB =  (TH2F*)ih_eta_cutIndex_regB->Project3D("zyB");
-        eta_p_cutIndex_regC->GetXaxis()->SetRange(cutIndex+1,cutIndex+1);
-        TH2F* eta_p_regC = (TH2F*)eta_p_cutIndex_regC->Project3D("yzC"); 
-
-        poissonHisto(*eta_regA,RNG);
-        poissonHisto(*eta_regB,RNG);
-        poissonHisto(*ih_eta_regB,RNG);
-        poissonHisto(*eta_p_regC,RNG);
-        poissonHisto(*H_A,RNG);
-        poissonHisto(*H_B,RNG);
-        poissonHisto(*H_C,RNG);
+
+    // projections on the cut index, done once
+    TH2F* eta_cutIndex_regB = (TH2F*) eta_cutIndex_B.Clone();
+    TH3F* ih_eta_cutIndex_regB = (TH3F*) ih_eta_cutIndex_B.Clone();
+    TH3F* eta_p_cutIndex_regC = (TH3F*) eta_p_cutIndex_C.Clone();
+    TH1F* eta_regB = (TH1F*)eta_cutIndex_regB->ProjectionY("_projB",cutIndex+1,cutIndex+1);
+    ih_eta_cutIndex_regB->GetXaxis()->SetRange(cutIndex+1,cutIndex+1);
+    TH2F* ih_eta_regB =  (TH2F*)ih_eta_cutIndex_regB->Project3D("zyB");
+    eta_p_cutIndex_regC->GetXaxis()->SetRange(cutIndex+1,cutIndex+1);
+    TH2F* eta_p_regC = (TH2F*)eta_p_cutIndex_regC->Project3D("yzC");
+    const flatHisto eta_regB0(*eta_regB);
+    const flatHisto ih_eta_regB0(*ih_eta_regB);
+    const flatHisto eta_p_regC0(*eta_p_regC);
+    const double A0 = HA.GetBinContent(cutIndex+1);
+    const double B0 = HB.GetBinContent(cutIndex+1);
+    const double C0 = HC.GetBinContent(cutIndex+1);
+    const predMassTable table(eta_p_regC0,ih_eta_regB0,rBC.VectOfBins_P_,*rBC.pred_mass->GetXaxis(),st_sample);
+
+    std::vector<predMassPE> vPE = runPseudoExperiments<predMassPE>(nPE,nThreads,seed,[&](TRandom3& RNG, predMassPE& pred){
+        flatHisto eta_regB(eta_regB0);
+        flatHisto ih_eta_regB(ih_eta_regB0);
+        flatHisto eta_p_regC(eta_p_regC0);
+        poissonHisto(eta_regB,RNG);
+        poissonHisto(ih_eta_regB,RNG);
+        poissonHisto(eta_p_regC,RNG);
+        float A = RNG.Poisson(A0);
+        float B = RNG.Poisson(B0);
+        float C = RNG.Poisson(C0);
         etaReweighingP(eta_p_regC, eta_regB);
-        rBC.eta_p = eta_p_regC; rBC.ih_eta = ih_eta_regB;
-        float A = H_A->Integral(cutIndex+1,cutIndex+1);
-        float B = H_B->Integral(cutIndex+1,cutIndex+1);
-        float C = H_C->Integral(cutIndex+1,cutIndex+1);
         float norm = 1;
         if(A>0) norm = B*C/A;
-        rBC.fillPredMass(st_sample);
-        scale(rBC.pred_mass);
-        massNormalisation(rBC.pred_mass,norm);
-        vPE.push_back(*rBC.pred_mass);
-    }
-    TH1F h_tmp = meanHistoPE(vPE);
-    if(nPE>1) rBC.pred_mass = &h_tmp;
+        fillPredMass(eta_p_regC,ih_eta_regB,table,pred);
+        normalisePredMass(pred,norm);
+    });
+    TH1F h_tmp = meanHistoPE(*rBC.pred_mass,vPE);
+    rBC.pred_mass = &h_tmp;
+    delete eta_cutIndex_regB; delete ih_eta_cutIndex_regB; delete eta_p_cutIndex_regC;
+    delete eta_regB; delete ih_eta_regB; delete eta_p_regC;
 
     std::string st = "cutIndex"+to_string(cutIndex);
     
@@ -595,8 +795,6 @@ void bckgEstimate_fromHistos(const std::string& st_sample, const std::string& di
     
     plotting(mass_obs,rBC.pred_mass,false,dirname,("mass1D_regionBC_"+st+"_nPE-"+to_string(nPE)).c_str(),"Observed","Prediction")->Write();
     plotting(mass_obs,rBC.pred_mass,false,dirname,("mass1D_regionBC_"+st+"_nPE-"+to_string(nPE)).c_str(),"Observed","Prediction",true)->Write();
-
-    delete RNG;
 }
 
 #endif
@@ -6,7 +6,15 @@
 //3. Solve problem of trying to calculate err_1/B in case when there are no hits
 //4. While combining DT hits, if erase outliers all segment-level TOF-related measurements are recalculated
 
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
 #include <exception>
+#include <fstream>
+#include <map>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -83,7 +91,11 @@ public:
     return true;
   }
 
-  static moduleGeom* get(unsigned int detId) { return static_geomMap[detId]; }
+  // nullptr if the module is not in the map, which is not modified so that it can be read concurrently
+  static moduleGeom* get(unsigned int detId) {
+    auto it = static_geomMap.find(detId);
+    return it == static_geomMap.end() ? nullptr : it->second;
+  }
 
   static int checkDetId(unsigned int detId) {
     //std::cout << "Checking for the detId " << detId << " in map. Map has : " << static_geomMap.size() << " elements" << std::endl;
@@ -138,10 +150,217 @@ public:
 std::unordered_map<unsigned int, moduleGeom*>
     moduleGeom::static_geomMap;  //need to define this here to reference the object
 
+//=============================================================
+//
+//     Store of the muon chamber time offsets
+//
+//     Offsets of the time offset file as a dense matrix: one
+//     row per run range (IOV, given by its first run) and one
+//     column per chamber, the chambers being sorted. A chamber
+//     without offset in a run range has 0. The column of a DT
+//     chamber or CSC id is read from a table indexed by the
+//     fields of the id, built with the matrix; other ids are
+//     found by binary search. The matrix can be written to a
+//     binary cache file, tagged with the size and date of the
+//     text file, and read back in a few reads.
+//
+//=============================================================
+
+class timeOffsetStore {
+public:
+  timeOffsetStore() {}
+  ~timeOffsetStore() {}
+
+  // text file with a "runs" line, a "chambers" line, and one "run N" line of offsets per run range
+  void loadText(std::string path) {
+    std::map<unsigned int, std::unordered_map<unsigned int, float> > t0OffsetMapPerRuns;
+    std::vector<unsigned int> chambers;
+
+    FILE* pFile = fopen(path.c_str(), "r");
+    if (pFile == nullptr){
+      printf("File NOT found: %s\n",path.c_str());
+      exit(1);
+    }
+    char line[16384];
+    while (fgets(line, 16384, pFile)) {
+      unsigned int run;
+      unsigned int chamber;
+      float correction;
+
+      char* pch = strtok(line, ",");
+
+      if (std::string(pch).find("runs") != std::string::npos) {  //get the list of runs
+        while ((pch = strtok(NULL, ","))) {
+          sscanf(pch, "%u", &run);
+          std::cout << "Adding run " << run << std::endl;
+          t0OffsetMapPerRuns[run] = std::unordered_map<unsigned int, float>();
+        }
+      } else if (std::string(pch).find("chambers") != std::string::npos) {  //get the list of chambers
+        while ((pch = strtok(NULL, ","))) {
+          sscanf(pch, "%d", &chamber);
+          //std::cout << "Adding chamber " << chamber << std::endl;
+          chambers.push_back(chamber);
+        }
+      } else if (std::string(pch).find("run") != std::string::npos) {
+        sscanf(pch, "run %u", &run);
+        std::unordered_map<unsigned int, float>& t0OffsetMap = t0OffsetMapPerRuns[run];
+        int Index = 0;
+        while ((pch = strtok(NULL, ","))) {
+          sscanf(pch, "%f", &correction);
+          //std::cout << "Adding correction " << correction << " for run " << run << std::endl;
+          t0OffsetMap[chambers[Index]] = correction;
+          Index++;
+        }
+      } else {
+        printf("Unknown type of line");
+      }
+    }
+    fclose(pFile);
+
+    runs_.clear();
+    chambers_.clear();
+    for (const auto& iov : t0OffsetMapPerRuns) {
+      runs_.push_back(iov.first);
+      for (const auto& offset : iov.second)
+        chambers_.push_back(offset.first);
+    }
+    std::sort(chambers_.begin(), chambers_.end());
+    chambers_.erase(std::unique(chambers_.begin(), chambers_.end()), chambers_.end());
+    offsets_.assign(runs_.size() * chambers_.size(), 0);
+    unsigned int iov = 0;
+    for (const auto& runOffsets : t0OffsetMapPerRuns) {
+      for (const auto& offset : runOffsets.second)
+        offsets_[iov * chambers_.size() + chamberIndex(offset.first)] = offset.second;
+      iov++;
+    }
+    buildIndex();
+  }
+
+  // false if the cache doesn't exist or was made from another version of the text file
+  bool readCache(const std::string& cachePath, const std::string& sourcePath) {
+    std::ifstream in(cachePath, std::ios::binary);
+    if (!in)
+      return false;
+    header expected = makeHeader(sourcePath), h;
+    in.read((char*)&h, sizeof(h));
+    if (!in || std::memcmp(h.magic, expected.magic, sizeof(h.magic)) != 0 || h.sourceSize != expected.sourceSize ||
+        h.sourceTime != expected.sourceTime)
+      return false;
+    runs_.resize(h.nRuns);
+    chambers_.resize(h.nChambers);
+    offsets_.resize(runs_.size() * chambers_.size());
+    in.read((char*)runs_.data(), runs_.size() * sizeof(unsigned int));
+    in.read((char*)chambers_.data(), chambers_.size() * sizeof(unsigned int));
+    in.read((char*)offsets_.data(), offsets_.size() * sizeof(float));
+    buildIndex();
+    return bool(in);
+  }
+
+  // written next to the final file and renamed, so that a concurrent job never reads a partial cache
+  void writeCache(const std::string& cachePath, const std::string& sourcePath) const {
+    header h = makeHeader(sourcePath);
+    h.nRuns = runs_.size();
+    h.nChambers = chambers_.size();
+    std::string tmpPath = cachePath + ".tmp" + std::to_string(getpid());
+    std::ofstream out(tmpPath, std::ios::binary);
+    out.write((const char*)&h, sizeof(h));
+    out.write((const char*)runs_.data(), runs_.size() * sizeof(unsigned int));
+    out.write((const char*)chambers_.data(), chambers_.size() * sizeof(unsigned int));
+    out.write((const char*)offsets_.data(), offsets_.size() * sizeof(float));
+    out.close();
+    if (!out || std::rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+      printf("Time offset cache %s can't be written\n", cachePath.c_str());
+      std::remove(tmpPath.c_str());
+    }
+  }
+
+  unsigned int nRuns() const { return runs_.size(); }
+  unsigned int nChambers() const { return chambers_.size(); }
+
+  // run range of currentRun: the last one starting at or before it, the first one for earlier runs
+  unsigned int iov(unsigned int currentRun) const {
+    auto it = std::upper_bound(runs_.begin(), runs_.end(), currentRun);
+    return it == runs_.begin() ? 0 : it - runs_.begin() - 1;
+  }
+  unsigned int firstRun(unsigned int iov) const { return runs_[iov]; }
+
+  // offsets of the run range, one per chamber
+  const float* row(unsigned int iov) const { return offsets_.data() + iov * chambers_.size(); }
+
+  float offset(const float* row, unsigned int chamber) const {
+    const int slot = denseSlot(chamber);
+    if (slot >= 0) {
+      const int column = columns_[slot];
+      return column < 0 ? 0 : row[column];
+    }
+    auto it = std::lower_bound(chambers_.begin(), chambers_.end(), chamber);
+    if (it == chambers_.end() || *it != chamber)
+      return 0;
+    return row[it - chambers_.begin()];
+  }
+
+  unsigned int chamber(unsigned int index) const { return chambers_[index]; }
+
+private:
+  struct header {
+    char magic[8];
+    long long sourceSize;
+    long long sourceTime;
+    unsigned int nRuns;
+    unsigned int nChambers;
+  };
+
+  static header makeHeader(const std::string& sourcePath) {
+    header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, "HSCPTOF1", 8);
+    struct stat info;
+    if (stat(sourcePath.c_str(), &info) == 0) {
+      h.sourceSize = info.st_size;
+      h.sourceTime = info.st_mtime;
+    }
+    return h;
+  }
+
+  unsigned int chamberIndex(unsigned int chamber) const {
+    return std::lower_bound(chambers_.begin(), chambers_.end(), chamber) - chambers_.begin();
+  }
+
+  // slots of the dense index: the wheel, sector and station bits (15-24) of a DT id without
+  // superlayer, layer and wire, then the 16 bits of a CSC id; -1 for the other ids
+  static const int nDTSlots = 1 << 10;
+  static const int nCSCSlots = 1 << 16;
+  static int denseSlot(unsigned int id) {
+    if ((id >> 28) != DetId::Muon)
+      return -1;
+    const unsigned int subdet = (id >> 25) & 0x7;
+    if (subdet == MuonSubdetId::DT)
+      return (id & 0x7FFF) ? -1 : (id >> 15) & 0x3FF;
+    if (subdet == MuonSubdetId::CSC)
+      return ((id >> 16) & 0x1FF) ? -1 : nDTSlots + (id & 0xFFFF);
+    return -1;
+  }
+
+  void buildIndex() {
+    columns_.assign(nDTSlots + nCSCSlots, -1);
+    for (unsigned int c = 0; c < chambers_.size(); c++) {
+      const int slot = denseSlot(chambers_[c]);
+      if (slot >= 0)
+        columns_[slot] = c;
+    }
+  }
+
+  std::vector<unsigned int> runs_;      // first run of each run range, increasing
+  std::vector<unsigned int> chambers_;  // increasing
+  std::vector<float> offsets_;          // runs_.size() x chambers_.size()
+  std::vector<int> columns_;            // column of each slot of the dense index, -1 if not in the file
+};
+
 class muonTimingCalculator {
 private:
-  std::unordered_map<unsigned int, float>* t0OffsetMap;
-  std::map<unsigned int, std::unordered_map<unsigned int, float> > t0OffsetMapPerRuns;
+  const float* t0Offsets = nullptr;  // offsets of the current run range
+  // shared by the copies of the calculator, which only keep their own matching and fit buffers
+  std::shared_ptr<const timeOffsetStore> t0OffsetStore = std::make_shared<timeOffsetStore>();
 
 public:
   enum TimeMeasurementType { DT = 1, CSCW = 2, CSCS = 4, CSC = 6, ECAL = 8 };
@@ -181,6 +400,11 @@ public:
   std::vector<const DTRecSegment4D*> dtSegs;
   std::vector<TimeMeasurement> tmSeq;
 
+  // chambers crossed by the muon and positions of their segments, for the segment matcher
+  std::vector<CSCDetId> cscChambers;
+  std::vector<DTChamberId> dtChambers;
+  std::vector<unsigned int> segmentOffsets;
+
   reco::MuonTimeExtra dtTOF, cscTOF, combinedTOF;
 
   //////////Global variables for Segment matcher
@@ -245,98 +469,79 @@ public:
   //all code related to t0 corrections
   ////////////////////////////////////////////
 
-  void loadTimeOffset(std::string path) {
+  void loadTimeOffset(std::string path, std::string cachePath = "") {
     std::cout << "Loading time offsets from " << path << std::endl;
-    t0OffsetMap = NULL;
-    t0OffsetMapPerRuns.clear();
-
-    std::vector<unsigned int> chambers;
-
-    FILE* pFile = fopen(path.c_str(), "r");
-    if (pFile == nullptr){
-      printf("File NOT found: %s\n",path.c_str());
-      exit(1);
-    }
-    char line[16384];
-    while (fgets(line, 16384, pFile)) {
-      unsigned int run;
-      unsigned int chamber;
-      float correction;
-
-      char* pch = strtok(line, ",");
-
-      if (std::string(pch).find("runs") != std::string::npos) {  //get the list of runs
-        while ((pch = strtok(NULL, ","))) {
-          sscanf(pch, "%u", &run);
-          std::cout << "Adding run " << run << std::endl;
-          t0OffsetMapPerRuns[run] = std::unordered_map<unsigned int, float>();
-        }
-      } else if (std::string(pch).find("chambers") != std::string::npos) {  //get the list of chambers
-        while ((pch = strtok(NULL, ","))) {
-          sscanf(pch, "%d", &chamber);
-          //std::cout << "Adding chamber " << chamber << std::endl;
-          chambers.push_back(chamber);
-        }
-      } else if (std::string(pch).find("run") != std::string::npos) {
-        sscanf(pch, "run %u", &run);
-        std::unordered_map<unsigned int, float>& t0OffsetMap = t0OffsetMapPerRuns[run];
-        int Index = 0;
-        while ((pch = strtok(NULL, ","))) {
-          sscanf(pch, "%f", &correction);
-          //std::cout << "Adding correction " << correction << " for run " << run << std::endl;
-          t0OffsetMap[chambers[Index]] = correction;
-          Index++;
-        }
-      } else {
-        printf("Unknown type of line");
-      }
+    t0Offsets = nullptr;
+    auto store = std::make_shared<timeOffsetStore>();
+    if (cachePath.empty() || !store->readCache(cachePath, path)) {
+      store->loadText(path);
+      if (!cachePath.empty())
+        store->writeCache(cachePath, path);
     }
+    t0OffsetStore = store;
     std::cout << "Successfully loaded all timing offsets" << std::endl;
-    fclose(pFile);
   }
 
-  std::map<unsigned int, std::unordered_map<unsigned int, float> > getOffsetMapPerRun() { return t0OffsetMapPerRuns; }
+  std::map<unsigned int, std::unordered_map<unsigned int, float> > getOffsetMapPerRun() {
+    std::map<unsigned int, std::unordered_map<unsigned int, float> > t0OffsetMapPerRuns;
+    for (unsigned int iov = 0; iov < t0OffsetStore->nRuns(); iov++) {
+      std::unordered_map<unsigned int, float>& t0OffsetMap = t0OffsetMapPerRuns[t0OffsetStore->firstRun(iov)];
+      for (unsigned int c = 0; c < t0OffsetStore->nChambers(); c++)
+        t0OffsetMap[t0OffsetStore->chamber(c)] = t0OffsetStore->row(iov)[c];
+    }
+    return t0OffsetMapPerRuns;
+  }
 
   void setRun(unsigned int currentRun) {
-    std::map<unsigned int, std::unordered_map<unsigned int, float> >::iterator it, itPrev = t0OffsetMapPerRuns.begin();
-    std::cout << "Starting the SetRun function, on the map with size " <<t0OffsetMapPerRuns.size() <<  std::endl;
-    for (it = t0OffsetMapPerRuns.begin(); it != t0OffsetMapPerRuns.end(); it++) {
-      //std::cout << "iterator first = " << it->first << " and current run = " << currentRun << std::endl;
-      
-      if (it->first > currentRun) {
-        t0OffsetMap = &(itPrev->second);
-        std::cout << "Setting t0OFfsetMap = " << &(itPrev->second) << " for run " << currentRun << std::endl;
-        return;
-      }  //runs are ordered, so the previous iterator correspond to our run
-      itPrev = it;
-    }
-    t0OffsetMap = &(itPrev->second);  //just in case we go beyond the list of run for which we have a correciton
+    std::cout << "Starting the SetRun function, on the map with size " << t0OffsetStore->nRuns() << std::endl;
+    //runs are ordered, the last run range starting before our run is the one to use
+    if (t0OffsetStore->nRuns() == 0)
+      return;
+    unsigned int iov = t0OffsetStore->iov(currentRun);
+    t0Offsets = t0OffsetStore->row(iov);
+    std::cout << "Setting t0OFfsetMap to the run range of run " << t0OffsetStore->firstRun(iov) << " for run "
+              << currentRun << std::endl;
   }
 
   double t0Offset(unsigned int detId, bool debug = false) {
     if (debug) {
       DetId geomDetId(detId);
       if (geomDetId.subdetId() == 1)
-        printf("dt  %i --> t0=%f\n", detId, (*t0OffsetMap)[detId & 0xFFC3FFFF]);  //dt stations
+        printf("dt  %i --> t0=%f\n", detId, t0OffsetStore->offset(t0Offsets, detId & 0xFFC3FFFF));  //dt stations
       if (geomDetId.subdetId() == 2)
-        printf("csc %i --> t0=%f\n", detId, (*t0OffsetMap)[detId & 0xFFFFFE07]);  //csc stations
+        printf("csc %i --> t0=%f\n", detId, t0OffsetStore->offset(t0Offsets, detId & 0xFFFFFE07));  //csc stations
     }
 
     DetId geomDetId(detId);
     if (geomDetId.subdetId() == 1)
-      return (*t0OffsetMap)[detId & 0xFFC3FFFF];  //dt stations
+      return t0OffsetStore->offset(t0Offsets, detId & 0xFFC3FFFF);  //dt stations
     if (geomDetId.subdetId() == 2)
-      return (*t0OffsetMap)[detId & 0xFFFFFE07];  //csc stations
+      return t0OffsetStore->offset(t0Offsets, detId & 0xFFFFFE07);  //csc stations
 
     printf("ERROR getting t0Offset for DetId=%u\n", detId);
     return 0.0;  //should never happens
   }
-  double t0OffsetChamber(unsigned int detId) { return (*t0OffsetMap)[detId]; }
+  double t0OffsetChamber(unsigned int detId) { return t0OffsetStore->offset(t0Offsets, detId); }
 
   ////////////////////////////////////////////
   //all code related to muon segment matching
   ////////////////////////////////////////////
 
+  // Positions in the collection of the segments of the given chambers, in the collection order.
+  // The segment collections are RangeMaps keyed by chamber, so each chamber is a single lookup.
+  template <class Collection, class ChamberId>
+  void segmentsInChambers(const Collection& coll, std::vector<ChamberId>& chambers, std::vector<unsigned int>& offsets) {
+    std::sort(chambers.begin(), chambers.end());
+    chambers.erase(std::unique(chambers.begin(), chambers.end()), chambers.end());
+    offsets.clear();
+    for (const auto& chamber : chambers) {
+      auto range = coll.get(chamber);
+      for (auto it = range.first; it != range.second; ++it)
+        offsets.push_back(it - coll.begin());
+    }
+    std::sort(offsets.begin(), offsets.end());
+  }
+
   //Fwlite version of the code found in https://raw.githubusercontent.com/cms-sw/cmssw/CMSSW_7_6_X/RecoMuon/TrackingTools/src/MuonSegmentMatcher.cc
   std::vector<const CSCSegment*>& matchCSC(const reco::Track& muon, const CSCSegmentCollection& CSCSegmentColl) {
     cscSegs.clear();
@@ -346,8 +551,21 @@ public:
     double CSCYCut = 0.001;
     double countMuonCSCHits = 0;
 
-    for (CSCSegmentCollection::const_iterator segmentCSC = CSCSegmentColl.begin(); segmentCSC != CSCSegmentColl.end();
-         segmentCSC++) {
+    // only the segments in the chambers crossed by the muon can be matched
+    cscChambers.clear();
+    for (trackingRecHit_iterator hitC = muon.recHitsBegin(); hitC != muon.recHitsEnd(); ++hitC) {
+      if (!(*hitC)->isValid())
+        continue;
+      if ((*hitC)->geographicalId().det() != DetId::Muon)
+        continue;
+      if ((*hitC)->geographicalId().subdetId() != MuonSubdetId::CSC)
+        continue;
+      cscChambers.push_back(CSCDetId((*hitC)->geographicalId().rawId()).chamberId());
+    }
+    segmentsInChambers(CSCSegmentColl, cscChambers, segmentOffsets);
+
+    for (unsigned int iseg : segmentOffsets) {
+      CSCSegmentCollection::const_iterator segmentCSC = CSCSegmentColl.begin() + iseg;
       double CSCcountAgreeingHits = 0;
       if (!segmentCSC->isValid())
         continue;
@@ -435,6 +653,7 @@ public:
     dtSegs.clear();
 
     std::vector<TrackingRecHit const*> dtHits;
+    dtChambers.clear();
 
     bool segments = false;
 
@@ -450,7 +669,10 @@ public:
         if ((*(*hit)->recHits().begin())->recHits().size() > 1)
           segments = true;
       dtHits.push_back(*hit);
+      dtChambers.push_back(DTChamberId((*hit)->geographicalId().rawId()));
     }
+    // only the segments in the chambers crossed by the muon can be matched
+    segmentsInChambers(DTSegmentColl, dtChambers, segmentOffsets);
 
     //  cout << "Muon DT hits found: " << dtHits.size() << " segments " << segments << endl;
 
@@ -459,8 +681,8 @@ public:
     double matchRatioZ = 0;
     double matchRatioPhi = 0;
 
-    for (DTRecSegment4DCollection::const_iterator rechit = DTSegmentColl.begin(); rechit != DTSegmentColl.end();
-         ++rechit) {
+    for (unsigned int iseg : segmentOffsets) {
+      DTRecSegment4DCollection::const_iterator rechit = DTSegmentColl.begin() + iseg;
       LocalPoint pointLocal = rechit->localPosition();
 
       if (segments) {
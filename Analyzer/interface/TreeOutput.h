@@ -0,0 +1,116 @@
+#ifndef SUSYBSMAnalysis_Analyzer_TreeOutput_h
+#define SUSYBSMAnalysis_Analyzer_TreeOutput_h
+
+#include <string>
+#include <vector>
+
+#include "Compression.h"
+#include "TBranch.h"
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TRegexp.h"
+#include "TString.h"
+#include "TTree.h"
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+//=============================================================
+//
+//     Output settings of the HscpCandidates tree
+//
+//     The tree can be moved from the TFileService file to a
+//     file of its own, under the same directory path, so the
+//     ntuple is written with its own settings and not with the
+//     ones of the histograms. The compression is set per branch
+//     by "pattern:algorithm:level" rules (wildcards allowed in
+//     the pattern, algorithm ZLIB, LZMA or LZ4, the last
+//     matching rule wins), and the cluster size by a number of
+//     entries. Branch names, types and the buffers they are
+//     bound to don't change, so the readers are the same.
+//
+//=============================================================
+
+class treeOutput {
+public:
+  treeOutput() {}
+  ~treeOutput() { close(); }
+
+  // fileName: own file of the tree, empty: the tree stays in the TFileService file
+  // autoFlush: entries per cluster, 0: ROOT default
+  void configure(TTree* tree,
+                 const std::string& fileName,
+                 const std::vector<std::string>& compression,
+                 long long autoFlush) {
+    tree_ = tree;
+    if (!tree_)
+      return;
+
+    if (!fileName.empty()) {
+      // same path as in the TFileService file, e.g. analyzer/BaseName
+      std::string path = tree_->GetDirectory() ? tree_->GetDirectory()->GetPath() : "";
+      size_t pos = path.find(":/");
+      path = pos == std::string::npos ? "" : path.substr(pos + 2);
+
+      file_ = TFile::Open(fileName.c_str(), "RECREATE");
+      if (!file_ || file_->IsZombie())
+        throw cms::Exception("treeOutput") << "Can't create the tree output file " << fileName;
+      TDirectory* dir = path.empty() ? file_ : file_->mkdir(path.c_str());
+      tree_->SetDirectory(dir);
+    }
+
+    if (autoFlush != 0)
+      tree_->SetAutoFlush(autoFlush);
+    for (const auto& rule : compression)
+      applyCompression(rule);
+  }
+
+  // writes and closes the own file of the tree, the tree is deleted with it
+  void close() {
+    if (!file_)
+      return;
+    tree_->GetDirectory()->cd();
+    tree_->Write("", TObject::kOverwrite);
+    file_->Close();
+    delete file_;
+    file_ = nullptr;
+    tree_ = nullptr;
+  }
+
+private:
+  void applyCompression(const std::string& rule) {
+    size_t first = rule.find(':');
+    size_t last = rule.rfind(':');
+    if (first == std::string::npos || first == last)
+      throw cms::Exception("treeOutput") << "Compression rule '" << rule << "' is not pattern:algorithm:level";
+
+    const TString pattern = rule.substr(0, first).c_str();
+    const std::string algorithm = rule.substr(first + 1, last - first - 1);
+    const std::string levelString = rule.substr(last + 1);
+    if (levelString.size() != 1 || levelString[0] < '0' || levelString[0] > '9')
+      throw cms::Exception("treeOutput") << "Compression level of rule '" << rule << "' is not in 0-9";
+    const int level = levelString[0] - '0';
+
+    ROOT::ECompressionAlgorithm algo;
+    if (algorithm == "ZLIB")
+      algo = ROOT::kZLIB;
+    else if (algorithm == "LZMA")
+      algo = ROOT::kLZMA;
+    else if (algorithm == "LZ4")
+      algo = ROOT::kLZ4;
+    else
+      throw cms::Exception("treeOutput") << "Unknown compression algorithm '" << algorithm << "' in rule '" << rule
+                                         << "'";
+
+    const TRegexp regexp(pattern, kTRUE);
+    TIter next(tree_->GetListOfBranches());
+    while (TBranch* branch = static_cast<TBranch*>(next())) {
+      if (TString(branch->GetName()).Index(regexp) == 0)
+        branch->SetCompressionSettings(ROOT::CompressionSettings(algo, level));
+    }
+  }
+
+  TTree* tree_ = nullptr;
+  TFile* file_ = nullptr;
+};
+
+#endif
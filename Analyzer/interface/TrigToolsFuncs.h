@@ -1,12 +1,16 @@
 #ifndef RHABERLE_TRIGTOOLSFUNCS
 #define RHABERLE_TRIGTOOLSFUNCS
 
+#include "DataFormats/HLTReco/interface/TriggerTypeDefs.h"
 #include "DataFormats/Math/interface/LorentzVector.h"
 
 #include "TLorentzVector.h"
 
-#include<vector>
+#include<deque>
 #include<string>
+#include<string_view>
+#include<unordered_map>
+#include<vector>
 
 
 namespace trigger{
@@ -26,6 +30,48 @@ namespace trigtools {
   void dumpTriggerEvent(const trigger::TriggerEvent& trigEvt);
 
   bool passedFilter(const trigger::TriggerEvent& trigEvt,const std::string& givenFilter);
+
+  //the objects passing a filter, one vector per component
+  struct triggerObjects {
+    std::vector<float> pt,eta,phi,energy,mass;
+    void clear(){pt.clear();eta.clear();phi.clear();energy.clear();mass.clear();}
+    unsigned int size()const{return pt.size();}
+  };
+
+  //index of the filters and collections of the trigger event
+  //
+  //the names are registered once per job and get an id, each event they are resolved
+  //to their index in the trigger event with a single pass on its filters and collections
+  //(the list of filters and collections changes from one event to the other), then the
+  //lookups by id give the same results as filterIndex, passedFilter and collectionTag
+  class triggerObjectIndex {
+  public:
+    //filter by name and process, as in getP4sOfObsPassingFilter
+    unsigned int addFilter(const std::string& filterName,const std::string& hltProcess="HLT");
+    //filter by label whatever the process, as in passedFilter
+    unsigned int addFilterLabel(const std::string& label);
+    //collection by encoded tag, e.g. "hltMet::HLT"
+    unsigned int addCollection(const std::string& encodedTag);
+
+    void newEvent(const trigger::TriggerEvent& trigEvt);
+
+    //index in the trigger event, sizeFilters() or sizeCollections() when it's not in the event
+    trigger::size_type filterIndex(unsigned int id)const{return filterIndex_[id];}
+    trigger::size_type filterLabelIndex(unsigned int id)const{return labelIndex_[id];}
+    trigger::size_type collectionIndex(unsigned int id)const{return collectionIndex_[id];}
+
+    bool passedFilter(unsigned int labelId)const;
+    void getObjsPassingFilter(triggerObjects& objs,unsigned int id)const;
+    void getP4sOfObsPassingFilter(std::vector<TLorentzVector>& p4s,unsigned int id)const;
+
+  private:
+    static unsigned int add(std::unordered_map<std::string_view,unsigned int>& ids,std::deque<std::string>& names,const std::string& name);
+
+    const trigger::TriggerEvent* trigEvt_=nullptr;
+    std::deque<std::string> filterNames_,labelNames_,collectionNames_; //the keys of the maps point to them
+    std::unordered_map<std::string_view,unsigned int> filterIds_,labelIds_,collectionIds_;
+    std::vector<trigger::size_type> filterIndex_,labelIndex_,collectionIndex_;
+  };
 }
   
 #endif
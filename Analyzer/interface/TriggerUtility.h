@@ -0,0 +1,142 @@
+#ifndef SUSYBSMAnalysis_Analyzer_TriggerUtility_h
+#define SUSYBSMAnalysis_Analyzer_TriggerUtility_h
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "DataFormats/Common/interface/TriggerResults.h"
+#include "FWCore/Common/interface/TriggerNames.h"
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+
+//=============================================================
+//
+//     Trigger name tables
+//
+//     The "index name" tables (trigger paths, muon HLT filters)
+//     are read once per job. The HLT menu is resolved on the
+//     slots of the table once per menu, so that the per-event
+//     decisions are a loop on precomputed indices.
+//
+//=============================================================
+
+class triggerNameTable {
+public:
+  triggerNameTable() {}
+  ~triggerNameTable() {}
+
+  // read the "index name" lines of the file, empty lines and lines starting with # are skipped
+  bool load(const std::string& fileName, unsigned int nMax) {
+    names_.assign(nMax, "");
+    std::ifstream file(edm::FileInPath(fileName.c_str()).fullPath().c_str());
+    if (!file.is_open())
+      return false;
+
+    char tmp[1024];
+    std::string line;
+    std::string name;
+    while (file >> line) {
+      if (line.empty() || line.substr(0, 1) == "#") {
+        file.getline(tmp, 1024);
+        continue;
+      }
+      unsigned int index = atoi(line.c_str());
+      file >> name;
+      if (index < nMax)
+        names_[index] = name;
+    }
+    file.close();
+    return true;
+  }
+
+  unsigned int size() const { return names_.size(); }
+  const std::string& name(unsigned int slot) const { return names_[slot]; }
+  const std::string* names() const { return names_.data(); }
+
+private:
+  std::vector<std::string> names_;
+};
+
+class triggerPathIndex {
+public:
+  triggerPathIndex() {}
+  ~triggerPathIndex() {}
+
+  // to be called at each new run, the index is rebuilt on the next event
+  void invalidate() { valid_ = false; }
+
+  // resolve the paths of the HLT menu on the table slots and on the patterns,
+  // nothing is done if the menu did not change since the last call
+  void update(const edm::TriggerNames& triggerNames,
+              const triggerNameTable& table,
+              const std::vector<std::vector<std::string>>& patterns) {
+    if (valid_ && triggerNames.parameterSetID() == menuID_)
+      return;
+    menuID_ = triggerNames.parameterSetID();
+    valid_ = true;
+
+    nSlots_ = table.size();
+    slotPaths_.clear();
+    for (unsigned int i = 0; i < triggerNames.size(); i++) {
+      const std::string& pathName = triggerNames.triggerName(i);
+      if (pathName.find("HLT_") == std::string::npos)
+        continue;
+      size_t lastUnderscorePos = pathName.find_last_of("_");
+      if (lastUnderscorePos == std::string::npos)
+        continue;
+      // the version number is not part of the names in the table
+      for (unsigned int j = 0; j < nSlots_; ++j) {
+        const std::string& slotName = table.name(j);
+        if (slotName.empty())
+          continue;
+        if (slotName.size() == lastUnderscorePos && pathName.compare(0, lastUnderscorePos, slotName) == 0)
+          slotPaths_.push_back(std::make_pair(i, j));
+      }
+    }
+
+    patternPaths_.assign(patterns.size(), std::vector<unsigned int>());
+    for (unsigned int p = 0; p < patterns.size(); p++) {
+      // as in passTriggerPatterns, the search stops on the first path when an empty pattern is reached
+      unsigned int nPatterns = 0;
+      while (nPatterns < patterns[p].size() && !patterns[p][nPatterns].empty())
+        nPatterns++;
+      unsigned int nPaths = triggerNames.size();
+      if (nPatterns < patterns[p].size() && nPaths > 1)
+        nPaths = 1;
+      for (unsigned int i = 0; i < nPaths; i++) {
+        const std::string& pathName = triggerNames.triggerName(i);
+        for (unsigned int k = 0; k < nPatterns; k++) {
+          if (pathName.find(patterns[p][k]) != std::string::npos) {
+            patternPaths_[p].push_back(i);
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // decision of each slot of the table, false if the path is not in the menu
+  void fillDecisions(const edm::TriggerResults& results, std::vector<bool>& decisions) const {
+    decisions.assign(nSlots_, false);
+    for (const auto& slotPath : slotPaths_)
+      decisions[slotPath.second] = results.accept(slotPath.first);
+  }
+
+  // true if any path matching the p-th list of patterns fired
+  bool passPatterns(const edm::TriggerResults& results, unsigned int p) const {
+    for (unsigned int i : patternPaths_[p]) {
+      if (results.accept(i))
+        return true;
+    }
+    return false;
+  }
+
+private:
+  bool valid_ = false;
+  edm::ParameterSetID menuID_;
+  unsigned int nSlots_ = 0;
+  std::vector<std::pair<unsigned int, unsigned int>> slotPaths_;  // (path index in the menu, slot in the table)
+  std::vector<std::vector<unsigned int>> patternPaths_;
+};
+
+#endif
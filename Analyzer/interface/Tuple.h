@@ -4,6 +4,7 @@
 #ifndef SUSYBSMAnalysis_Analyzer_Tuple_h
 #define SUSYBSMAnalysis_Analyzer_Tuple_h
 
+#include "SUSYBSMAnalysis/Analyzer/interface/HistoRegistry.h"
 #include "SUSYBSMAnalysis/Analyzer/interface/Regions.h"
 
 
@@ -28,13 +29,6 @@ struct Tuple {
 
 
   int Tree_npv;
-  std::vector<float> Tree_pvX;
-  std::vector<float> Tree_pvY;
-  std::vector<float> Tree_pvZ;
-  std::vector<float> Tree_pvRho;
-  std::vector<int> Tree_pvNdof;
-  std::vector<float> Tree_pvChi2;
-  std::vector<float> Tree_pvSumPt2;
 
   unsigned int Tree_Hscp;
   unsigned int Tree_nMuons;
@@ -81,9 +75,6 @@ struct Tuple {
 
   float Tree_trigObjBeta;
   float Tree_trigObjEta;
-  std::vector<float> Tree_HSCP_GenBeta;
-  std::vector<float> Tree_HSCP_trigObjBeta;
-  std::vector<float> Tree_HSCP_dRclosestTrigAndCandidate;
   float Tree_RecoCaloMET;
   float Tree_RecoCaloMET_phi;
   float Tree_RecoCaloMET_sigf;
@@ -115,251 +106,9 @@ struct Tuple {
   float Tree_muonIdSFsUpEff;
   float Tree_muonIdSFsDownEff;
   bool Tree_matchedMuonWasFound;
-  std::vector<int> Tree_gParticleId;
-  std::vector<int> Tree_gParticleStatus;
-  std::vector<float> Tree_gParticleE;
-  std::vector<float> Tree_gParticlePt;
-  std::vector<float> Tree_gParticlePz;
-  std::vector<float> Tree_gParticleEta;
-  std::vector<float> Tree_gParticlePhi;
-  std::vector<float> Tree_gParticleBeta;
-  std::vector<int> Tree_gParticleCharge;
-  std::vector<float> Tree_gParticleProdVertexX;
-  std::vector<float> Tree_gParticleProdVertexY;
-  std::vector<float> Tree_gParticleProdVertexZ;
-  std::vector<int> Tree_gParticleMotherId;
-  std::vector<int> Tree_gParticleMotherIndex;
-  std::vector<float> Tree_eleE;
-  std::vector<float> Tree_elePt;
-  std::vector<float> Tree_eleEta;
-  std::vector<float> Tree_elePhi;
-  std::vector<float> Tree_eleCharge;
-  std::vector<float> Tree_eleE_SC;
-  std::vector<float> Tree_eleEta_SC;
-  std::vector<float> Tree_elePhi_SC;
-  std::vector<float> Tree_eleSigmaIetaIeta;
-  std::vector<float> Tree_eleFull5x5SigmaIetaIeta;
-  std::vector<float> Tree_eleR9;
-  std::vector<float> Tree_ele_dEta;
-  std::vector<float> Tree_ele_dPhi;
-  std::vector<float> Tree_ele_HoverE;
-  std::vector<float> Tree_ele_d0;
-  std::vector<float> Tree_ele_dZ;
-  std::vector<float> Tree_ele_pileupIso;
-  std::vector<float> Tree_ele_chargedIso;
-  std::vector<float> Tree_ele_photonIso;
-  std::vector<float> Tree_ele_neutralHadIso;
-  std::vector<int> Tree_ele_MissHits;
-  std::vector<bool> Tree_ele_passCutBasedIDVeto;
-  std::vector<bool> Tree_ele_passCutBasedIDLoose;
-  std::vector<bool> Tree_ele_passCutBasedIDMedium;
-  std::vector<bool> Tree_ele_passCutBasedIDTight;
-  std::vector<bool> Tree_ele_passMVAIsoIDWP80;
-  std::vector<bool> Tree_ele_passMVAIsoIDWP90;
-  std::vector<bool> Tree_ele_passMVAIsoIDWPHZZ;
-  std::vector<bool> Tree_ele_passMVAIsoIDWPLoose;
-  std::vector<bool> Tree_ele_passMVANoIsoIDWP80;
-  std::vector<bool> Tree_ele_passMVANoIsoIDWP90;
-  std::vector<bool> Tree_ele_passMVANoIsoIDWPLoose;
-  std::vector<bool> Tree_ele_PassConvVeto;
-  std::vector<float> Tree_ele_OneOverEminusOneOverP;
-  std::vector<float> Tree_muonE;
-  std::vector<float> Tree_muonPt;
-  std::vector<float> Tree_globalTrackMuonPt;
-  std::vector<float> Tree_rescaledPtUpGlobalMuon;
-  std::vector<float> Tree_rescaledPtDownGlobalMuon; 
-  std::vector<float> Tree_innerTrackMuonPt;
-  std::vector<float> Tree_rescaledPtUpInnerMuon;
-  std::vector<float> Tree_rescaledPtDownInnerMuon; 
-  std::vector<float> Tree_outerTrackMuonPt;
-  std::vector<float> Tree_muonPtErr;
-  std::vector<float> Tree_muonEta;
-  std::vector<float> Tree_muonPhi;
-  std::vector<float> Tree_muonBeta;
-  std::vector<int> Tree_muonCharge;
-  std::vector<bool> Tree_muonIsLoose;
-  std::vector<bool> Tree_muonIsMedium;
-  std::vector<bool> Tree_muonIsTight;
-  std::vector<float> Tree_muon_d0;
-  std::vector<float> Tree_muon_d0Err;
-  std::vector<float> Tree_muon_dZ;
-  std::vector<float> Tree_muon_ip3d;
-  std::vector<float> Tree_muon_ip3dSignificance;
-  std::vector<unsigned int> Tree_muonType;
-  std::vector<unsigned int> Tree_muonQuality;
-  std::vector<float> Tree_muon_pileupIso;
-  std::vector<float> Tree_muon_chargedIso;
-  std::vector<float> Tree_muon_photonIso;
-  std::vector<float> Tree_muon_neutralHadIso;
-  std::vector<float> Tree_muon_validFractionTrackerHits;
-  std::vector<float> Tree_muon_normChi2;
-  std::vector<float> Tree_muon_chi2LocalPosition;
-  std::vector<float> Tree_muon_kinkFinder;
-  std::vector<float> Tree_muon_segmentCompatability;
-  std::vector<float> Tree_muon_trkIso;
-  std::vector<float> Tree_muon_tuneP_Pt;
-  std::vector<float> Tree_muon_tuneP_PtErr;
-  std::vector<float> Tree_muon_tuneP_Eta;
-  std::vector<float> Tree_muon_tuneP_Phi;
-  std::vector<int> Tree_muon_tuneP_MuonBestTrackType;
-  std::vector<bool> Tree_muon_isHighPtMuon;
-  std::vector<bool> Tree_muon_isTrackerHighPtMuon;
-  std::vector<float> Tree_jet_pt;
-  std::vector<float> Tree_jet_eta;
-  std::vector<float> Tree_jet_phi;
-  std::vector<float> Tree_jet_mass;
-  std::vector<float> Tree_jet_energy;
-  std::vector<float> Tree_jet_pdgId;
-  std::vector<float> Tree_jet_et;
-  std::vector<float> Tree_jet_chargedEmEnergyFraction;
-  std::vector<float> Tree_jet_neutralEmEnergyFraction;
-  std::vector<float> Tree_jet_chargedHadronEnergyFraction;
-  std::vector<float> Tree_jet_neutralHadronEnergyFraction;
-  std::vector<float> Tree_jet_muonEnergyFraction;
-  std::vector<int> Tree_jet_chargedMultiplicity;
-  std::vector<int> Tree_jet_neutralMultiplicity;
-  std::vector<float> Tree_jet_jetArea;
-  std::vector<float> Tree_jet_pileupE;
-
-  std::vector<float> Tree_vect_mT;
-  std::vector<bool> Tree_passCutPt55;
+
   std::vector<bool> Tree_passPreselection_noIsolation_noIh;
-  std::vector<bool> Tree_passPreselection;
-  std::vector<bool> Tree_passPreselectionSept8;
-  std::vector<bool> Tree_passPreselectionTrigSys;
-  std::vector<bool> Tree_passSelection;
-  std::vector<bool> Tree_isPFMuon;
-  std::vector<bool> Tree_PFMuonPt;
-  std::vector<float> Tree_Charge;
-  std::vector<float> Tree_Pt;
-  std::vector<float> Tree_PtErr;
-  std::vector<float> Tree_Is_StripOnly;
-  std::vector<float> Tree_Ias;
-  std::vector<float> Tree_Ias_noTIBnoTIDno3TEC;
-  std::vector<float> Tree_Ias_PixelOnly;
-  std::vector<float> Tree_Ias_StripOnly;
-  std::vector<float> Tree_Ias_PixelOnly_noL1;
-  std::vector<float> Tree_Ih;
-  std::vector<float> Tree_Ick;  //return (Ih-C)/K
-  std::vector<float> Tree_Fmip;
-  std::vector<float> Tree_ProbXY;
-  std::vector<float> Tree_ProbXY_noL1;
-  std::vector<float> Tree_ProbQ;
-  std::vector<float> Tree_ProbQ_noL1;
-  std::vector<float> Tree_Ndof;
-  std::vector<float> Tree_Chi2;
-  std::vector<int>   Tree_QualityMask;
-  std::vector<bool>  Tree_isHighPurity;
-  std::vector<float> Tree_EoverP;
   std::vector<float> Tree_muon_eta;
-  std::vector<bool> Tree_isMuon;
-  std::vector<bool> Tree_isGlobalMuon;
-  std::vector<bool> Tree_isPhoton;
-  std::vector<bool> Tree_isElectron;
-  std::vector<float> Tree_gsfFbremElectron;
-  std::vector<float> Tree_gsfMomentumElectron;
-  std::vector<float> Tree_PFMomentumElectron;
-  std::vector<bool> Tree_isChHadron;
-  std::vector<bool> Tree_isNeutHadron;
-  std::vector<bool> Tree_isPfTrack;
-  std::vector<bool> Tree_isUndefined;
-  std::vector<float> Tree_ECAL_energy;
-  std::vector<float> Tree_HCAL_energy;
-  std::vector<float> Tree_TOF;
-  std::vector<float> Tree_TOFErr;
-  std::vector<unsigned int> Tree_TOF_ndof;
-  std::vector<float> Tree_DTTOF;
-  std::vector<float> Tree_DTTOFErr;
-  std::vector<unsigned int> Tree_DTTOF_ndof;
-  std::vector<float> Tree_CSCTOF;
-  std::vector<float> Tree_CSCTOFErr;
-  std::vector<unsigned int> Tree_CSCTOF_ndof;
-  std::vector<float> Tree_Mass;
-  std::vector<float> Tree_MassErr;
-  std::vector<float> Tree_dZ;
-  std::vector<float> Tree_dXY;
-  std::vector<float> Tree_dR;
-  std::vector<float> Tree_p;
-  std::vector<float> Tree_eta;
-  std::vector<float> Tree_phi;
-  //number of (valid) track pixel+strip hits
-  std::vector<unsigned int> Tree_NOH;
-  //number of (valid) track pixel hits
-  std::vector<unsigned int> Tree_NOPH;
-  //fraction of valid track hits
-  std::vector<float> Tree_FOVH;
-  //number of missing hits from IP till last hit (excluding hits behind the last hit)
-  std::vector<unsigned int> Tree_NOMH;
-    //fraction of valid hits divided by total expected hits until the last one
-  std::vector<float> Tree_FOVHD;
-  //number of dEdx hits (= #strip+#pixel-#ClusterCleaned hits, but this depend on estimator used)
-  std::vector<unsigned int> Tree_NOM;
-  //minDeltaR bewteen triggermuon and HSCP
-  std::vector<float> Tree_matchTrigMuon_minDeltaR;
-  //pt of trigger muon with minDeltaR bewteen triggermuon and HSCP
-  std::vector<float> Tree_matchTrigMuon_pT;
-
-  std::vector<float> Tree_iso_TK;
-  std::vector<float> Tree_iso_ECAL;
-  std::vector<float> Tree_iso_HCAL;
-  std::vector<float> Tree_track_genTrackMiniIsoSumPt;
-  std::vector<float> Tree_track_genTrackAbsIsoSumPtFix;
-  std::vector<float> Tree_track_genTrackIsoSumPt_dr03;
-  std::vector<float> Tree_PFMiniIso_relative;
-  std::vector<float> Tree_PFMiniIso_wMuon_relative;
-
-  std::vector<float> Tree_track_PFIsolationR005_sumChargedHadronPt;
-  std::vector<float> Tree_track_PFIsolationR005_sumNeutralHadronPt;
-  std::vector<float> Tree_track_PFIsolationR005_sumPhotonPt;
-  std::vector<float> Tree_track_PFIsolationR005_sumPUPt;
-
-  std::vector<float> Tree_track_PFIsolationR01_sumChargedHadronPt;
-  std::vector<float> Tree_track_PFIsolationR01_sumNeutralHadronPt;
-  std::vector<float> Tree_track_PFIsolationR01_sumPhotonPt;
-  std::vector<float> Tree_track_PFIsolationR01_sumPUPt;
-
-  std::vector<float> Tree_track_PFIsolationR03_sumChargedHadronPt;
-  std::vector<float> Tree_track_PFIsolationR03_sumNeutralHadronPt;
-  std::vector<float> Tree_track_PFIsolationR03_sumPhotonPt;
-  std::vector<float> Tree_track_PFIsolationR03_sumPUPt;
-
-  std::vector<float> Tree_track_PFIsolationR05_sumChargedHadronPt;
-  std::vector<float> Tree_track_PFIsolationR05_sumNeutralHadronPt;
-  std::vector<float> Tree_track_PFIsolationR05_sumPhotonPt;
-  std::vector<float> Tree_track_PFIsolationR05_sumPUPt;
-
-  std::vector<float> Tree_muon_PFIsolationR03_sumChargedHadronPt;
-  std::vector<float> Tree_muon_PFIsolationR03_sumNeutralHadronPt;
-  std::vector<float> Tree_muon_PFIsolationR03_sumPhotonPt;
-  std::vector<float> Tree_muon_PFIsolationR03_sumPUPt;
-
-  std::vector<float> Tree_Ih_noL1;
-  std::vector<float> Tree_Ih_15drop;
-  std::vector<float> Tree_Ih_StripOnly;
-  std::vector<float> Tree_Ih_StripOnly_15drop;
-  std::vector<float> Tree_Ih_PixelOnly_noL1;
-  std::vector<float> Tree_Ih_SaturationCorrectionFromFits;
-  std::vector<std::vector<float>> Tree_clust_charge;  //dedx charge -> either strip or pixel
-  std::vector<std::vector<float>> Tree_clust_pathlength;
-  std::vector<std::vector<unsigned int>> Tree_clust_nstrip;
-  std::vector<std::vector<bool>> Tree_clust_sat254;
-  std::vector<std::vector<bool>> Tree_clust_sat255;
-  std::vector<std::vector<uint32_t>> Tree_clust_detid;
-  std::vector<std::vector<bool>> Tree_clust_isStrip;  //is it a SiStrip cluster?
-  std::vector<std::vector<bool>> Tree_clust_isPixel;  //is it a Pixel hit?
-  std::vector<float> Tree_GenId;
-  std::vector<float> Tree_GenCharge;
-  std::vector<float> Tree_GenMass;
-  std::vector<float> Tree_GenPt;
-  std::vector<float> Tree_GenEta;
-  std::vector<float> Tree_GenPhi;
-  std::vector<float> Tree_HSCP_tuneP_Pt;
-  std::vector<float> Tree_HSCP_tuneP_PtErr;
-  std::vector<float> Tree_HSCP_tuneP_Eta;
-  std::vector<float> Tree_HSCP_tuneP_Phi;
-  std::vector<int> Tree_HSCP_tuneP_MuonBestTrackType;
-  std::vector<int> Tree_HSCP_ErrorHisto_bin;
-  std::vector<int> Tree_HSCP_type;
 
   TTree* GenTree;
   unsigned int GenTree_Run;
@@ -400,15 +149,15 @@ struct Tuple {
 
   TH1F* BefPreS_RelDiffMatchedMuonPtAndTrigObjPt;
   TH1F* BefPreS_RelDiffTrigObjPtAndMatchedMuonPt;
-  TH2F* BefPreS_RelDiffTrigObjPtAndMatchedMuonPtVsPt;
+  lazyHisto<TH2F> BefPreS_RelDiffTrigObjPtAndMatchedMuonPtVsPt;
   TH1F* BefPreS_NumPassedMatchingTrigObj;
   TH1F* BefPreS_NumPassedMatchingTrigObjEtaCut;
   
   TH1F* BefPreS_TriggerMuonType;
   TH1F* BefPreS_MatchedMuonPt25Pt;
   TH1F* BefPreS_RelDiffMuonPtAndTrackPt;
-  TH2F* BefPreS_MuonPtVsTrackPt;
-  TH2F* BefPreS_MuonPtOverGenPtVsTrackPtOverGenPt;
+  lazyHisto<TH2F> BefPreS_MuonPtVsTrackPt;
+  lazyHisto<TH2F> BefPreS_MuonPtOverGenPtVsTrackPtOverGenPt;
   TH1F* BefPreS_RelDiffMuonPtAndTruthPt;
   TH1F* BefPreS_RelDiffTrackPtAndTruthPt;
   
@@ -441,18 +190,18 @@ struct Tuple {
   TH1F* N1_DrMinPfJet;
   TH1F* N1_PtErrOverPt;
   TH1F* N1_PtErrOverPt2;
-  TH2F* N1_PtErrOverPtVsPt;
-  TH2F* N1_PtErrOverPtVsPt_lowPt;
-  TH2F* N1_PtErrOverPtVsGenBeta;
-  TH2F* N1_PtErrOverPt2VsIas;
-  TH2F* N1_PtErrOverPt2VsProbQNoL1;
+  lazyHisto<TH2F> N1_PtErrOverPtVsPt;
+  lazyHisto<TH2F> N1_PtErrOverPtVsPt_lowPt;
+  lazyHisto<TH2F> N1_PtErrOverPtVsGenBeta;
+  lazyHisto<TH2F> N1_PtErrOverPt2VsIas;
+  lazyHisto<TH2F> N1_PtErrOverPt2VsProbQNoL1;
   TH1F* N1_I;
   TH1F* N1_TOF;
   TH1F* N1_Stations;
   TH1F* N1_Dxy;
   TH1F* N1_Dz;
   TH1F* N1_ProbQNoL1;
-  TH2F* N1_ProbQNoL1VsIas;
+  lazyHisto<TH2F> N1_ProbQNoL1VsIas;
   TH1F* N1_ProbXY;
   TH1F* N1_PfType;
   TH1F* N1_MiniRelIsoAll;
@@ -492,8 +241,8 @@ struct Tuple {
   TH1F* BefTrig_Ih;
   TH1F* BefTrig_ProbQNoL1;
   TH1F* BefTrig_Ias;
-  TH2F* BefTrig_TriggerMuon50VsPt_lowPt;
-  TH2F* BefTrig_TriggerMuonAllVsPt_lowPt;
+  lazyHisto<TH2F> BefTrig_TriggerMuon50VsPt_lowPt;
+  lazyHisto<TH2F> BefTrig_TriggerMuonAllVsPt_lowPt;
 
   TH1F* BefPreS_MassT;
   TH1F* BefPreS_MassT_highMassT;
@@ -580,44 +329,44 @@ struct Tuple {
 
   TH1F* BefPreS_LastHitDXY;
   TH1F* BefPreS_LastHitD3D;
-  TH2F* BefPreS_PtErrOverPtVsPtErrOverPt2;
-  TH2F* BefPreS_PtErrOverPtVsPt;
+  lazyHisto<TH2F> BefPreS_PtErrOverPtVsPtErrOverPt2;
+  lazyHisto<TH2F> BefPreS_PtErrOverPtVsPt;
 
   TH1F* BefPreS_ProbQ;
   TH1F* BefPreS_ProbXY;
   TH1F* BefPreS_ProbQNoL1;
   TH1F* BefPreS_ProbXYNoL1;
   TH1F* BefPreS_MassErr;
-  TH2F* BefPreS_ProbQVsIas;
+  lazyHisto<TH2F> BefPreS_ProbQVsIas;
 
   TH1F* BefPreS_CluProbHasFilled;
-  TH2F* BefPreS_CluProbQVsPixelLayer;
-  TH2F* BefPreS_CluProbXYVsPixelLayer;
-  TH2F* BefPreS_CluNormChargeVsPixelLayer;
-  TH2F* BefPreS_CluNormChargeVsPixelLayer_lowBetaGamma;
-  TH2F* BefPreS_CluSizeVsPixelLayer;
-  TH2F* BefPreS_CluSizeXVsPixelLayer;
-  TH2F* BefPreS_CluSizeYVsPixelLayer;
-  TH2F* BefPreS_CluSpecInCPEVsPixelLayer;
-
-  TH2F* BefPreS_CluCotBetaVsPixelLayer_lowProbXY;
-  TH2F* BefPreS_CluCotAlphaVsPixelLayer_lowProbXY;
-  TH2F* BefPreS_CluCotBetaVsPixelLayer;
-  TH2F* BefPreS_CluCotAlphaVsPixelLayer;
-
-  TH2F* BefPreS_CluNormChargeVsStripLayer_lowBetaGamma;
-  TH2F* BefPreS_CluNormChargeVsStripLayer_higherBetaGamma;
-  TH2F* BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_Stat91;
-  TH2F* BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatNot91;
-  TH2F* BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatHigherThan2;
+  lazyHisto<TH2F> BefPreS_CluProbQVsPixelLayer;
+  lazyHisto<TH2F> BefPreS_CluProbXYVsPixelLayer;
+  lazyHisto<TH2F> BefPreS_CluNormChargeVsPixelLayer;
+  lazyHisto<TH2F> BefPreS_CluNormChargeVsPixelLayer_lowBetaGamma;
+  lazyHisto<TH2F> BefPreS_CluSizeVsPixelLayer;
+  lazyHisto<TH2F> BefPreS_CluSizeXVsPixelLayer;
+  lazyHisto<TH2F> BefPreS_CluSizeYVsPixelLayer;
+  lazyHisto<TH2F> BefPreS_CluSpecInCPEVsPixelLayer;
+
+  lazyHisto<TH2F> BefPreS_CluCotBetaVsPixelLayer_lowProbXY;
+  lazyHisto<TH2F> BefPreS_CluCotAlphaVsPixelLayer_lowProbXY;
+  lazyHisto<TH2F> BefPreS_CluCotBetaVsPixelLayer;
+  lazyHisto<TH2F> BefPreS_CluCotAlphaVsPixelLayer;
+
+  lazyHisto<TH2F> BefPreS_CluNormChargeVsStripLayer_lowBetaGamma;
+  lazyHisto<TH2F> BefPreS_CluNormChargeVsStripLayer_higherBetaGamma;
+  lazyHisto<TH2F> BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_Stat91;
+  lazyHisto<TH2F> BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatNot91;
+  lazyHisto<TH2F> BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatHigherThan2;
 
   TH1F* BefPreS_dRMinPfJet;
-  TH2F* BefPreS_dRMinPfJetVsIas;
+  lazyHisto<TH2F> BefPreS_dRMinPfJetVsIas;
   TH1F* BefPreS_dRMinCaloJet;
-  TH2F* BefPreS_dRMinCaloJetVsIas;
-  TH2F* BefPreS_genGammaBetaVsProbXYNoL1;
-  TH2F* BefPreS_dRVsPtPfJet;
-  TH2F* BefPreS_dRVsdPtPfCaloJet;
+  lazyHisto<TH2F> BefPreS_dRMinCaloJetVsIas;
+  lazyHisto<TH2F> BefPreS_genGammaBetaVsProbXYNoL1;
+  lazyHisto<TH2F> BefPreS_dRVsPtPfJet;
+  lazyHisto<TH2F> BefPreS_dRVsdPtPfCaloJet;
 
   TH1F* BefPreS_P;
   TH1F* BefPreS_Pt_DT;
@@ -630,65 +379,65 @@ struct Tuple {
   TH1F* BefPreS_Ias_Cosmic;
   TH1F* BefPreS_Ih_Cosmic;
   TH1F* BefPreS_Pt_Cosmic;
-  TH2F* BefPreS_EtaVsIas;
-  TH2F* BefPreS_EtaVsIh;   //TH3F*  PostS_EtaIh;
-  TH2F* BefPreS_EtaVsP;    //TH3F*  PostS_EtaP;
-  TH2F* BefPreS_EtaVsPt;   //TH3F*  PostS_EtaPt;
-  TH2F* BefPreS_EtaVsTOF;  //TH3F*  PostS_EtaTOF;
-  TH2F* BefPreS_EtaVsDz;
+  lazyHisto<TH2F> BefPreS_EtaVsIas;
+  lazyHisto<TH2F> BefPreS_EtaVsIh;   //TH3F*  PostS_EtaIh;
+  lazyHisto<TH2F> BefPreS_EtaVsP;    //TH3F*  PostS_EtaP;
+  lazyHisto<TH2F> BefPreS_EtaVsPt;   //TH3F*  PostS_EtaPt;
+  lazyHisto<TH2F> BefPreS_EtaVsTOF;  //TH3F*  PostS_EtaTOF;
+  lazyHisto<TH2F> BefPreS_EtaVsDz;
     // number of bad hits vs Eta
-  TH2F* BefPreS_EtaVsNBH;
-
-  TH2F* BefPreS_PVsIas;
-  TH2F* BefPreS_IhVsIas;
-  TH2F* BefPreS_PVsIh;
-  TH2F* BefPreS_PtVsIas;
-  TH2F* BefPreS_PtVsIh;
-  TH2F* BefPreS_PtVsTOF;
-  TH2F* BefPreS_TOFVsIs;
-  TH2F* BefPreS_TOFVsIh;
+  lazyHisto<TH2F> BefPreS_EtaVsNBH;
+
+  lazyHisto<TH2F> BefPreS_PVsIas;
+  lazyHisto<TH2F> BefPreS_IhVsIas;
+  lazyHisto<TH2F> BefPreS_PVsIh;
+  lazyHisto<TH2F> BefPreS_PtVsIas;
+  lazyHisto<TH2F> BefPreS_PtVsIh;
+  lazyHisto<TH2F> BefPreS_PtVsTOF;
+  lazyHisto<TH2F> BefPreS_TOFVsIs;
+  lazyHisto<TH2F> BefPreS_TOFVsIh;
   TH1F* BefPreS_GenBeta;
 
   TH1F* BefPreS_NumCandidates;
   
-  TH2F* BefPreS_TriggerMuon50VsBeta;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaA;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaA_BetaUp;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaA_BetaDown;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaB;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaB_BetaUp;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaB_BetaDown;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaC;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaC_BetaUp;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaC_BetaDown;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaD;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaD_BetaUp;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaD_BetaDown;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaE;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaE_BetaUp;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaE_BetaDown;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaF;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaF_BetaUp;
-  TH2F* BefPreS_TriggerMuon50VsBeta_EtaF_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaA;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaA_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaA_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaB;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaB_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaB_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaC;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaC_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaC_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaD;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaD_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaD_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaE;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaE_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaE_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaF;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaF_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsBeta_EtaF_BetaDown;
   
-  TH2F* BefPreS_TriggerMuonAllVsBeta;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaA;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaA_BetaUp;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaA_BetaDown;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaB;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaB_BetaUp;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaB_BetaDown;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaC;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaC_BetaUp;
-  TH2F* BefPreS_TriggerMuonAllVsBeta_EtaC_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaA;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaA_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaA_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaB;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaB_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaB_BetaDown;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaC;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaC_BetaUp;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsBeta_EtaC_BetaDown;
   
-  TH2F* BefPreS_TriggerMuon50VsPt;
-  TH2F* BefPreS_TriggerMuonAllVsPt;
-  TH2F* BefPreS_TriggerMETallVsBeta;
-  TH2F* BefPreS_TriggerMETallVsMet;
-  TH2F* BefPreS_TriggerMETallVsHT;
-  TH2F* BefPreS_TriggerMETallVsMetOverHt;
-  TH3F* BefPreS_TriggerMETallVsMetVsHT;
+  lazyHisto<TH2F> BefPreS_TriggerMuon50VsPt;
+  lazyHisto<TH2F> BefPreS_TriggerMuonAllVsPt;
+  lazyHisto<TH2F> BefPreS_TriggerMETallVsBeta;
+  lazyHisto<TH2F> BefPreS_TriggerMETallVsMet;
+  lazyHisto<TH2F> BefPreS_TriggerMETallVsHT;
+  lazyHisto<TH2F> BefPreS_TriggerMETallVsMetOverHt;
+  lazyHisto<TH3F> BefPreS_TriggerMETallVsMetVsHT;
   
   TH1F* BefPreS_TriggerTimingPass;
   TH1F* BefPreS_TriggerTimingReject;
@@ -697,30 +446,30 @@ struct Tuple {
   
   TH1F* PostPreS_NumCandidates;
 
-  TH3F* Calibration_GiTemplate;
-  TH3F* Calibration_GiTemplate_PU_1;
-  TH3F* Calibration_GiTemplate_PU_2;
-  TH3F* Calibration_GiTemplate_PU_3;
-  TH3F* Calibration_GiTemplate_PU_4;
-  TH3F* Calibration_GiTemplate_PU_5;
+  lazyHisto<TH3F> Calibration_GiTemplate;
+  lazyHisto<TH3F> Calibration_GiTemplate_PU_1;
+  lazyHisto<TH3F> Calibration_GiTemplate_PU_2;
+  lazyHisto<TH3F> Calibration_GiTemplate_PU_3;
+  lazyHisto<TH3F> Calibration_GiTemplate_PU_4;
+  lazyHisto<TH3F> Calibration_GiTemplate_PU_5;
 
 
   // Post preselection plots
   TH1F* PostPreS_RelDiffMuonPtAndTrackPt;
-  TH2F* PostPreS_MuonPtVsTrackPt;
-  TH2F* PostPreS_MuonPtOverGenPtVsTrackPtOverGenPt;
+  lazyHisto<TH2F> PostPreS_MuonPtVsTrackPt;
+  lazyHisto<TH2F> PostPreS_MuonPtOverGenPtVsTrackPtOverGenPt;
   TH1F* PostPreS_RelDiffMuonPtAndTruthPt;
   TH1F* PostPreS_RelDiffTrackPtAndTruthPt;
   
   TH1F* PostPreS_TriggerType;
   TH1F* PostPreS_RecoHSCParticleType;
   TH1F* PostPreS_PfType;
-  TH2F* PostPreS_PfTypeVsIas;
+  lazyHisto<TH2F> PostPreS_PfTypeVsIas;
   TH1F* PostPreS_MassT;
   TH1F* PostPreS_MassT_highMassT;
-  TH2F* PostPreS_MassTVsIas;
+  lazyHisto<TH2F> PostPreS_MassTVsIas;
   TH1F* PostPreS_MiniRelIsoAll;
-  TH2F* PostPreS_MiniRelIsoAllVsIas;
+  lazyHisto<TH2F> PostPreS_MiniRelIsoAllVsIas;
   TH1F* PostPreS_MiniRelIsoChg;
   TH1F* PostPreS_MiniTkIso;
   TH1F* PostPreS_MiniRelTkIso;
@@ -731,25 +480,25 @@ struct Tuple {
   TH1F* PostPreS_CaloJetsNum;
 
   TH1F* PostPreS_Chi2oNdof;
-  TH2F* PostPreS_Chi2oNdofVsIas;
+  lazyHisto<TH2F> PostPreS_Chi2oNdofVsIas;
   TH1F* PostPreS_Qual;
   TH1F* PostPreS_TNOH_PUA;
   TH1F* PostPreS_TNOH_PUB;
   TH1F* PostPreS_TNOH_PUC;
   TH1F* PostPreS_TNOHFraction;
-  TH2F* PostPreS_TNOHFractionVsIas;
+  lazyHisto<TH2F> PostPreS_TNOHFractionVsIas;
   TH1F* PostPreS_TNOPH;
   TH1F* PostPreS_RatioCleanAndAllStripsClu;
-  TH2F* PostPreS_RatioCleanAndAllStripsCluVsIas;
+  lazyHisto<TH2F> PostPreS_RatioCleanAndAllStripsCluVsIas;
   TH1F* PostPreS_RatioCleanAndAllPixelClu;
-  TH2F* PostPreS_TNOPHVsIas;
+  lazyHisto<TH2F> PostPreS_TNOPHVsIas;
   TH1F* PostPreS_TNOHFractionTillLast;
   TH1F* PostPreS_TNOMHTillLast;
   TH1F* PostPreS_Eta;
-  TH2F* PostPreS_EtaVsIas;
+  lazyHisto<TH2F> PostPreS_EtaVsIas;
   TH1F* PostPreS_TNOM;
-  TH2F* PostPreS_TNOMVsIas;
-  TH2F* PostPreS_EtaVsNBH;
+  lazyHisto<TH2F> PostPreS_TNOMVsIas;
+  lazyHisto<TH2F> PostPreS_EtaVsNBH;
   TH1F* PostPreS_TNOM_PUA;
   TH1F* PostPreS_TNOM_PUB;
   TH1F* PostPreS_TNOM_PUC;
@@ -758,31 +507,31 @@ struct Tuple {
   TH1F* PostPreS_nDof;
   TH1F* PostPreS_TOFError;
   TH1F* PostPreS_PtErrOverPt;
-  TH2F* PostPreS_PtErrOverPtVsIas;
-  TH2F* PostPreS_PtErrOverPt2VsIas;
+  lazyHisto<TH2F> PostPreS_PtErrOverPtVsIas;
+  lazyHisto<TH2F> PostPreS_PtErrOverPt2VsIas;
   TH1F* PostPreS_PtErrOverPt2;
   TH1F* PostPreS_Pt;
   TH1F* PostPreS_Pt_lowPt;
-  TH2F* PostPreS_PtVsIas;
+  lazyHisto<TH2F> PostPreS_PtVsIas;
   TH1F* PostPreS_P;
-  TH2F* PostPreS_PVsIh;
-  TH2F* PostPreS_PVsIhCutSigptAndIsoMass;
-  TH2F* PostPreS_genPVsIh;
+  lazyHisto<TH2F> PostPreS_PVsIh;
+  lazyHisto<TH2F> PostPreS_PVsIhCutSigptAndIsoMass;
+  lazyHisto<TH2F> PostPreS_genPVsIh;
   
   TH1F* PostPreS_Ias_NoEventWeight;
   TH1F* PostPreS_FiStrips_NoEventWeight;
   TH1F* PostPreS_Ih;
-  TH2F* PostPreS_IhVsIas;
+  lazyHisto<TH2F> PostPreS_IhVsIas;
   TH1F* PostPreS_Ih_NoEventWeight;
   TH1F* PostPreS_MTOF;
   TH1F* PostPreS_TIsol;
-  TH2F* PostPreS_TIsolVsIas;
+  lazyHisto<TH2F> PostPreS_TIsolVsIas;
   TH1F* PostPreS_EoP;
   TH1F* PostPreS_ECalEoP;
   TH1F* PostPreS_HCalEoP;
-  TH2F* PostPreS_EoPVsIas;
+  lazyHisto<TH2F> PostPreS_EoPVsIas;
   TH1F* PostPreS_SumpTOverpT;
-  TH2F* PostPreS_SumpTOverpTVsIas;
+  lazyHisto<TH2F> PostPreS_SumpTOverpTVsIas;
   TH1F* PostPreS_dR_NVTrack;
   TH1F* PostPreS_MatchedStations;
   TH1F* PostPreS_NVertex;
@@ -790,11 +539,11 @@ struct Tuple {
   TH1F* PostPreS_PV;
   TH1F* PostPreS_PV_NoEventWeight;
   TH1F* PostPreS_Dz;
-  TH2F* PostPreS_DzVsIas;
-  TH2F* PostPreS_DzVsGenID;
+  lazyHisto<TH2F> PostPreS_DzVsIas;
+  lazyHisto<TH2F> PostPreS_DzVsGenID;
   TH1F* PostPreS_Dxy;
-  TH2F* PostPreS_DxyVsIas;
-  TH2F* PostPreS_DxyVsGenID;
+  lazyHisto<TH2F> PostPreS_DxyVsIas;
+  lazyHisto<TH2F> PostPreS_DxyVsGenID;
   TH1F* PostPreS_SegSep;
   TH1F* PostPreS_SegMinPhiSep;
   TH1F* PostPreS_SegMinEtaSep;
@@ -819,30 +568,30 @@ struct Tuple {
   TH1F* PostPreS_Dz_DT;
 
 
-  TH2F* BefPreS_RUN_vs_TOF_2017;
-  TH2F* BefPreS_RUN_vs_TOF_2018;
-  TH2F* PostPreS_RUN_vs_TOF_2017;
-  TH2F* PostPreS_RUN_vs_TOF_2018;
+  lazyHisto<TH2F> BefPreS_RUN_vs_TOF_2017;
+  lazyHisto<TH2F> BefPreS_RUN_vs_TOF_2018;
+  lazyHisto<TH2F> PostPreS_RUN_vs_TOF_2017;
+  lazyHisto<TH2F> PostPreS_RUN_vs_TOF_2018;
 
   TH1F* PostPreS_LastHitDXY;
-  TH2F* PostPreS_LastHitDXYVsEta;
+  lazyHisto<TH2F> PostPreS_LastHitDXYVsEta;
   TH1F* PostPreS_LastHitD3D;
-  TH2F* PostPreS_LastHitD3DVsEta;
-  TH2F* PostPreS_PtErrOverPtVsPtErrOverPt2;
-  TH2F* PostPreS_PtErrOverPtVsPt;
+  lazyHisto<TH2F> PostPreS_LastHitD3DVsEta;
+  lazyHisto<TH2F> PostPreS_PtErrOverPtVsPtErrOverPt2;
+  lazyHisto<TH2F> PostPreS_PtErrOverPtVsPt;
 
   TH1F* PostPreS_ProbQ;
-  TH2F* PostPreS_ProbQVsIas;
-  TH3F* PostPreS_IhVsProbQNoL1VsIas;
-  TH3F* PostPreS_MomentumVsProbQNoL1VsIas;
+  lazyHisto<TH2F> PostPreS_ProbQVsIas;
+  lazyHisto<TH3F> PostPreS_IhVsProbQNoL1VsIas;
+  lazyHisto<TH3F> PostPreS_MomentumVsProbQNoL1VsIas;
   TH1F* PostPreS_ProbXY;
   TH1F* PostPreS_ProbXY_highIas;
-  TH2F* PostPreS_ProbXYVsIas;
-  TH2F* PostPreS_ProbXYVsIas_highIas;
-  TH2F* PostPreS_ProbXYVsProbQ;
-  TH2F* PostPreS_ProbXYVsProbQ_highIas;
-  TH2F* PostPreS_MassVsIas_fail;
-  TH2F* PostPreS_MassVsIas_pass;
+  lazyHisto<TH2F> PostPreS_ProbXYVsIas;
+  lazyHisto<TH2F> PostPreS_ProbXYVsIas_highIas;
+  lazyHisto<TH2F> PostPreS_ProbXYVsProbQ;
+  lazyHisto<TH2F> PostPreS_ProbXYVsProbQ_highIas;
+  lazyHisto<TH2F> PostPreS_MassVsIas_fail;
+  lazyHisto<TH2F> PostPreS_MassVsIas_pass;
 
 
   TH1F* PostPreS_Ias_CR;
@@ -856,38 +605,38 @@ struct Tuple {
   TH1F* PostPreS_ProbQNoL1_CR;
   
 
-  TH2F* PostPreS_ProbQNoL1VsIas_CR;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR_Pileup_up;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR_Pileup_down;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_up;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_down;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR_Ias_up;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR_Ias_down;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR_Pt_up;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR_Pt_down;
-  TH2F* PostPreS_MassVsIas_fail_CR;
-  TH2F* PostPreS_MassVsIas_pass_CR;
-
-  TH2F* PostPreS_MassVsIas_fail_CR2;
-  TH2F* PostPreS_MassVsIas_pass_CR2;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR_Pileup_up;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR_Pileup_down;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_up;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_down;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR_Ias_up;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR_Ias_down;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR_Pt_up;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR_Pt_down;
+  lazyHisto<TH2F> PostPreS_MassVsIas_fail_CR;
+  lazyHisto<TH2F> PostPreS_MassVsIas_pass_CR;
+
+  lazyHisto<TH2F> PostPreS_MassVsIas_fail_CR2;
+  lazyHisto<TH2F> PostPreS_MassVsIas_pass_CR2;
   TH1F* PostPreS_Ias_CR2;
   TH1F* PostPreS_Ih_CR2;
   TH1F* PostPreS_Ih_noL1_CR2;
   TH1F* PostPreS_Pt_CR2;
   TH1F* PostPreS_ProbQNoL1_CR2;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR2;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR2;
 
-  TH2F* PostPreS_MassVsIas_fail_CR3;
-  TH2F* PostPreS_MassVsIas_pass_CR3;
+  lazyHisto<TH2F> PostPreS_MassVsIas_fail_CR3;
+  lazyHisto<TH2F> PostPreS_MassVsIas_pass_CR3;
   TH1F* PostPreS_Ias_CR3;
   TH1F* PostPreS_Ih_CR3;
   TH1F* PostPreS_Ih_noL1_CR3;
   TH1F* PostPreS_Pt_CR3;
   TH1F* PostPreS_ProbQNoL1_CR3;
-  TH2F* PostPreS_ProbQNoL1VsIas_CR3;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_CR3;
 
-  TH2F* PostPreS_MassVsIas_fail_SR2;
-  TH2F* PostPreS_MassVsIas_pass_SR2;
+  lazyHisto<TH2F> PostPreS_MassVsIas_fail_SR2;
+  lazyHisto<TH2F> PostPreS_MassVsIas_pass_SR2;
  
   TH1F* PostPreS_Ih_CR_veryLowPt;
 //  TH1F* PostPreS_Ihstrip_CR_veryLowPt;
@@ -897,151 +646,151 @@ struct Tuple {
   TH1F* PostPreS_Ih_nopixcl_CR_veryLowPt;
   TH1F* PostPreS_Pt_CR_veryLowPt; 
   TH1F* PostPreS_ProbQNoL1_CR_veryLowPt;
-  TH2F* PostPreS_CluPathLenghtVsPixLayer_CR_veryLowPt;
-  TH2F* PostPreS_CluDeDxVsPixLayer_CR_veryLowPt;
-  TH2F* PostPreS_CluDeDxVsStripsLayer_CR_veryLowPt;
+  lazyHisto<TH2F> PostPreS_CluPathLenghtVsPixLayer_CR_veryLowPt;
+  lazyHisto<TH2F> PostPreS_CluDeDxVsPixLayer_CR_veryLowPt;
+  lazyHisto<TH2F> PostPreS_CluDeDxVsStripsLayer_CR_veryLowPt;
 
   TH1F* PostS_RelativePtShift;
   TH1F* PostS_ProbQNoL1;
   TH1F* PostS_Ias;
   TH1F* PostS_FiStrips;
   TH1F* PostS_FiStripsLog;
-  TH2F* PostS_IasVsFiStrips;
-  TH2F* PostS_ProbQNoL1VsIas;
-  TH2F* PostS_ProbQNoL1VsFiStrips;
+  lazyHisto<TH2F> PostS_IasVsFiStrips;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsFiStrips;
  
   TH1F* PostS_SR2FAIL_Ias_PUA;
   TH1F* PostS_SR2FAIL_Ias_PUB;
   TH1F* PostS_SR2FAIL_Ias_PUC;
   TH1F* PostS_SR2FAIL_PV;
   
-  TH2F* PostS_SR2FAIL_PtErrOverPtVsIas;
-  TH2F* PostS_SR2FAIL_TIsolVsIas;
-  TH2F* PostS_SR2PASS_PtErrOverPtVsIas;
-  TH2F* PostS_SR2PASS_TIsolVsIas;
+  lazyHisto<TH2F> PostS_SR2FAIL_PtErrOverPtVsIas;
+  lazyHisto<TH2F> PostS_SR2FAIL_TIsolVsIas;
+  lazyHisto<TH2F> PostS_SR2PASS_PtErrOverPtVsIas;
+  lazyHisto<TH2F> PostS_SR2PASS_TIsolVsIas;
   
   TH1F* PostS_SR2FAIL_PtErrOverPt2;
   TH1F* PostS_SR2FAIL_RelDiffTrackPtAndTruthPt;
-  TH2F* PostS_SR2FAIL_RelDiffTrackPtAndTruthPtVsTruthPt;
+  lazyHisto<TH2F> PostS_SR2FAIL_RelDiffTrackPtAndTruthPtVsTruthPt;
   
   TH1F* PostS_SR2PASS_Ias_PUA;
   TH1F* PostS_SR2PASS_Ias_PUB;
   TH1F* PostS_SR2PASS_Ias_PUC;
   
-  TH2F* PostS_SR2PASS_RunVsLs;
+  lazyHisto<TH2F> PostS_SR2PASS_RunVsLs;
   TH1F* PostS_SR2PASS_Ls;
   
   TH1F* PostS_SR2PASS_PV;
   TH1F* PostS_SR2PASS_PtErrOverPt2;
   TH1F* PostS_SR2PASS_RelDiffTrackPtAndTruthPt;
-  TH2F* PostS_SR2PASS_RelDiffTrackPtAndTruthPtVsTruthPt;
+  lazyHisto<TH2F> PostS_SR2PASS_RelDiffTrackPtAndTruthPtVsTruthPt;
   
   TH1F* PostS_SR2PASS_TriggerGenBeta;
-  TH3F* PostS_ProbQNoL1VsIasVsPt;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_Pileup_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_Pileup_down;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_down;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_Ias_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_IasShift_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_Ias_down;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_IasShift_down;
-
-  TH3F* PostS_ProbQNoL1VsIasVsPt_Pt_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_Pt_down;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_Trigger_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_Trigger_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_Pileup_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_Pileup_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_Ias_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_IasShift_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_Ias_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_IasShift_down;
+
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_Pt_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_Pt_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_Trigger_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_Trigger_down;
   
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_Pileup_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_Pileup_down;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_down;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_Ias_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_Ias_down;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_Pt_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_Pt_down;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_Trigger_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsVsPt_Trigger_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_Pileup_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_Pileup_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_Ias_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_Ias_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_Pt_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_Pt_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_Trigger_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsVsPt_Trigger_down;
   
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_down;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_down;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_down;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_down;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_up;
-  TH3F* PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_down;
   
-  TH2F* PostS_ProbQNoL1VsIas_Pileup_up;
-  TH2F* PostS_ProbQNoL1VsIas_Pileup_down;
-  TH2F* PostS_ProbQNoL1VsIas_ProbQNoL1_up;
-  TH2F* PostS_ProbQNoL1VsIas_ProbQNoL1_down;
-  TH2F* PostS_ProbQNoL1VsIas_Ias_up;
-  TH2F* PostS_ProbQNoL1VsIas_Ias_down;
-  TH2F* PostS_ProbQNoL1VsIas_Pt_up;
-  TH2F* PostS_ProbQNoL1VsIas_Pt_down;
-  TH2F* PostS_ProbQNoL1VsIas_Trigger_up;
-  TH2F* PostS_ProbQNoL1VsIas_Trigger_down;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_Pileup_up;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_Pileup_down;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_ProbQNoL1_up;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_ProbQNoL1_down;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_Ias_up;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_Ias_down;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_Pt_up;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_Pt_down;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_Trigger_up;
+  lazyHisto<TH2F> PostS_ProbQNoL1VsIas_Trigger_down;
   
-  TH3F* PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_down;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_MuonIDSF_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_MuonIDSF_down;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_up;
-  TH3F* PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_MuonIDSF_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_MuonIDSF_down;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_up;
+  lazyHisto<TH3F> PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_down;
   
   TH1F* PostS_SR1_ProbQNoL1;
   TH1F* PostS_SR1_Ias;
-  TH2F* PostS_SR1_ProbQNoL1VsIas;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_Pileup_up;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_Pileup_down;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_up;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_down;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_Ias_up;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_Ias_down;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_Pt_up;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_Pt_down;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_Trigger_up;
-  TH2F* PostS_SR1_ProbQNoL1VsIas_Trigger_down;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_Pileup_up;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_Pileup_down;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_up;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_down;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_Ias_up;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_Ias_down;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_Pt_up;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_Pt_down;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_Trigger_up;
+  lazyHisto<TH2F> PostS_SR1_ProbQNoL1VsIas_Trigger_down;
   
   TH1F* PostS_SR2_ProbQNoL1;
   TH1F* PostS_SR2_Ias;
-  TH2F* PostS_SR2_ProbQNoL1VsIas;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_Pileup_up;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_Pileup_down;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_up;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_down;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_Ias_up;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_IasShift_up;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_Pileup_up;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_Pileup_down;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_up;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_down;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_Ias_up;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_IasShift_up;
   
-  TH2F* PostS_SR2_ProbQNoL1VsIas_Ias_down;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_IasShift_down;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_Ias_down;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_IasShift_down;
 
 
-  TH2F* PostS_SR2_ProbQNoL1VsIas_Pt_up;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_Pt_down;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_Trigger_up;
-  TH2F* PostS_SR2_ProbQNoL1VsIas_Trigger_down;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_Pt_up;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_Pt_down;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_Trigger_up;
+  lazyHisto<TH2F> PostS_SR2_ProbQNoL1VsIas_Trigger_down;
   
-  TH3F* PostS_SR2_ProbQNoL1VsIasVsMass;
+  lazyHisto<TH3F> PostS_SR2_ProbQNoL1VsIasVsMass;
   
   TH1F* PostS_SR3_ProbQNoL1;
   TH1F* PostS_SR3_Ias;
-  TH2F* PostS_SR3_ProbQNoL1VsIas;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_Pileup_up;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_Pileup_down;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_up;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_down;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_Ias_up;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_Ias_down;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_Pt_up;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_Pt_down;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_Trigger_up;
-  TH2F* PostS_SR3_ProbQNoL1VsIas_Trigger_down;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_Pileup_up;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_Pileup_down;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_up;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_down;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_Ias_up;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_Ias_down;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_Pt_up;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_Pt_down;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_Trigger_up;
+  lazyHisto<TH2F> PostS_SR3_ProbQNoL1VsIas_Trigger_down;
 
   // VR1: Ias-quantile 50-90% & pT>70 GeV
   TH1F* PostS_VR1_Mass;
@@ -1642,96 +1391,96 @@ struct Tuple {
   TH1F* PostS_SR3_Mass_C_down2;
 
   TH1F* PostPreS_ProbQNoL1;
-  TH2F* PostPreS_ProbQNoL1VsIas;
-  TH2F* PostPreS_ProbQNoL1VsFiStrips;
-  TH2F* PostPreS_ProbQNoL1VsIas_Pileup_up;
-  TH2F* PostPreS_ProbQNoL1VsIas_Pileup_down;
-  TH2F* PostPreS_ProbQNoL1VsIas_ProbQNoL1_up;
-  TH2F* PostPreS_ProbQNoL1VsIas_ProbQNoL1_down;
-  TH2F* PostPreS_ProbQNoL1VsIas_Ias_up;
-  TH2F* PostPreS_ProbQNoL1VsIas_Ias_down;
-  TH2F* PostPreS_ProbQNoL1VsIas_Pt_up;
-  TH2F* PostPreS_ProbQNoL1VsIas_Pt_down;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsFiStrips;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_Pileup_up;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_Pileup_down;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_ProbQNoL1_up;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_ProbQNoL1_down;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_Ias_up;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_Ias_down;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_Pt_up;
+  lazyHisto<TH2F> PostPreS_ProbQNoL1VsIas_Pt_down;
 
   TH1F* PostPreS_TriggerTimingPass;
   TH1F* PostPreS_TriggerTimingReject;
   TH1F* PostPreS_TriggerEtaReject;
   TH1F* PostPreS_TriggerEtaPass;
-  TH2F* PostS_MuonTightVsBeta;
-  TH2F* PostPreS_TriggerMuon50VsBeta;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaA;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaA_BetaUp;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaA_BetaDown;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaB;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaB_BetaUp;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaB_BetaDown;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaC;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaC_BetaUp;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaC_BetaDown;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaD;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaD_BetaUp;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaD_BetaDown;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaE;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaE_BetaUp;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaE_BetaDown;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaF;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaF_BetaUp;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaF_BetaDown;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL1DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL4DT;
-  TH2F* PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL4DT;
+  lazyHisto<TH2F> PostS_MuonTightVsBeta;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaA;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaA_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaA_BetaDown;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaB;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaB_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaB_BetaDown;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaC;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaC_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaC_BetaDown;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaD;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaD_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaD_BetaDown;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaE;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaE_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaE_BetaDown;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaF;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaF_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaF_BetaDown;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL1DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL4DT;
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL4DT;
   
-  TH2F* PostS_SR2PASS_TriggerMuon50VsBeta_Beta;
-  TH2F* PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownHalfSigma;
-  TH2F* PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownOneSigma;
-  TH2F* PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownTwoSigma;
-  TH2F* PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpHalfSigma;
-  TH2F* PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpOneSigma;
-  TH2F* PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpTwoSigma;
+  lazyHisto<TH2F> PostS_SR2PASS_TriggerMuon50VsBeta_Beta;
+  lazyHisto<TH2F> PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownHalfSigma;
+  lazyHisto<TH2F> PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownOneSigma;
+  lazyHisto<TH2F> PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownTwoSigma;
+  lazyHisto<TH2F> PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpHalfSigma;
+  lazyHisto<TH2F> PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpOneSigma;
+  lazyHisto<TH2F> PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpTwoSigma;
   
-  TH2F* PostPreS_TriggerMuonAllVsBeta;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaA;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaB;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaC;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp;
-  TH2F* PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown;
-
-  TH2F* PostPreS_TriggerMuon50VsPt;
-  TH2F* PostPreS_TriggerMuonAllVsPt;
-  TH2F* PostPreS_TriggerMETallVsBeta;
-  TH2F* PostPreS_TriggerMETallVsMet;
-  TH2F* PostPreS_TriggerMETallVsHT;
-  TH2F* PostPreS_TriggerMETallVsMetOverHt;
-  TH2F* PostS_TriggerMETallVsMetOverHt_Cand0;
-  TH2F* PostS_TriggerMETallVsMetOverHt_Cand1;
-  TH2F* PostS_TriggerMETallVsMetOverHt_Cand2;
-  TH3F* PostPreS_TriggerMETallVsMetVsHT;
-  TH2F* PostPreS_MetVsHT;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaA;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaB;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaC;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown;
+
+  lazyHisto<TH2F> PostPreS_TriggerMuon50VsPt;
+  lazyHisto<TH2F> PostPreS_TriggerMuonAllVsPt;
+  lazyHisto<TH2F> PostPreS_TriggerMETallVsBeta;
+  lazyHisto<TH2F> PostPreS_TriggerMETallVsMet;
+  lazyHisto<TH2F> PostPreS_TriggerMETallVsHT;
+  lazyHisto<TH2F> PostPreS_TriggerMETallVsMetOverHt;
+  lazyHisto<TH2F> PostS_TriggerMETallVsMetOverHt_Cand0;
+  lazyHisto<TH2F> PostS_TriggerMETallVsMetOverHt_Cand1;
+  lazyHisto<TH2F> PostS_TriggerMETallVsMetOverHt_Cand2;
+  lazyHisto<TH3F> PostPreS_TriggerMETallVsMetVsHT;
+  lazyHisto<TH2F> PostPreS_MetVsHT;
   TH1F* PostPreS_MetOverHt;
   TH1F* PostS_MetOverHt_Cand0;
   TH1F* PostS_MetOverHt_Cand1;
@@ -1739,119 +1488,119 @@ struct Tuple {
 
   TH1F* PostPreS_ProbXYNoL1;
   TH1F* PostPreS_ProbXYNoL1_highIas;
-  TH2F* PostPreS_ProbXYNoL1VsIas;
-  TH2F* PostPreS_ProbXYNoL1VsIas_highIas;
-  TH2F* PostPreS_ProbXYNoL1VsProbQNoL1;
-  TH2F* PostPreS_ProbXYNoL1VsProbQNoL1_highIas;
+  lazyHisto<TH2F> PostPreS_ProbXYNoL1VsIas;
+  lazyHisto<TH2F> PostPreS_ProbXYNoL1VsIas_highIas;
+  lazyHisto<TH2F> PostPreS_ProbXYNoL1VsProbQNoL1;
+  lazyHisto<TH2F> PostPreS_ProbXYNoL1VsProbQNoL1_highIas;
   TH1F* PostPreS_MassErr;
-  TH2F* PostPreS_MassErrVsIas;
+  lazyHisto<TH2F> PostPreS_MassErrVsIas;
 
 
-  TH2F* PostPreS_EtaVsGenID;
-  TH2F* PostPreS_ProbQVsGenID;
+  lazyHisto<TH2F> PostPreS_EtaVsGenID;
+  lazyHisto<TH2F> PostPreS_ProbQVsGenID;
 
   TH1F* PostPreS_IasForStatus91;
   TH1F* PostPreS_IasForStatusNot91;
 
-  TH2F* PostPreS_ProbQVsGenEnviromentID;
-  TH2F* PostPreS_ProbXYVsGenID;
-  TH2F* PostPreS_PtVsGenID;
-  TH2F* PostPreS_EoPVsGenID;
-  TH2F* PostPreS_IhVsGenID;
-  TH2F* PostPreS_IasVsGenID;
-  TH2F* PostPreS_IasVsGenEnviromentID;
-  TH2F* PostPreS_MassTVsGenID;
-  TH2F* PostPreS_MiniIsoChgVsGenID;
-  TH2F* PostPreS_MiniIsoAllVsGenID;
-  TH2F* PostPreS_MassVsGenID;
-
-  TH2F* PostPreS_EtaVsMomGenID;
-  TH2F* PostPreS_ProbQVsMomGenID;
-  TH2F* PostPreS_ProbXYVsMomGenID;
-  TH2F* PostPreS_PtVsMomGenID;
-  TH2F* PostPreS_EoPVsMomGenID;
-  TH2F* PostPreS_IhVsMomGenID;
-  TH2F* PostPreS_IasVsMomGenID;
-  TH2F* PostPreS_MassTVsMomGenID;
-  TH2F* PostPreS_MiniIsoChgVsMomGenID;
-  TH2F* PostPreS_MiniIsoAllVsMomGenID;
-  TH2F* PostPreS_MassVsMomGenID;
-
-  TH2F* PostPreS_EtaVsSiblingGenID;
-  TH2F* PostPreS_ProbQVsSiblingGenID;
-  TH2F* PostPreS_ProbXYVsSiblingGenID;
-  TH2F* PostPreS_PtVsSiblingGenID;
-  TH2F* PostPreS_EoPVsSiblingGenID;
-  TH2F* PostPreS_IhVsSiblingGenID;
-  TH2F* PostPreS_IasVsSiblingGenID;
-  TH2F* PostPreS_MassTVsSiblingGenID;
-  TH2F* PostPreS_MassVsSiblingGenID;
-
-  TH2F* PostPreS_EtaVsGenAngle;
-  TH2F* PostPreS_ProbQVsGenAngle;
-  TH2F* PostPreS_ProbXYVsGenAngle;
-  TH2F* PostPreS_PtVsGenAngle;
-  TH2F* PostPreS_EoPVsGenAngle;
-  TH2F* PostPreS_IhVsGenAngle;
-  TH2F* PostPreS_IasVsGenAngle;
-  TH2F* PostPreS_MassTVsGenAngle;
-  TH2F* PostPreS_MiniIsoChgVsGenAngle;
-  TH2F* PostPreS_MiniIsoAllVsGenAngle;
-  TH2F* PostPreS_MassVsGenAngle;
-
-  TH2F* PostPreS_EtaVsGenMomAngle;
-  TH2F* PostPreS_ProbQVsGenMomAngle;
-  TH2F* PostPreS_ProbXYVsGenMomAngle;
-  TH2F* PostPreS_PtVsGenMomAngle;
-  TH2F* PostPreS_EoPVsGenMomAngle;
-  TH2F* PostPreS_IhVsGenMomAngle;
-  TH2F* PostPreS_IasVsGenMomAngle;
-  TH2F* PostPreS_MassTVsGenMomAngle;
-  TH2F* PostPreS_MiniIsoChgVsGenMomAngle;
-  TH2F* PostPreS_MiniIsoAllVsGenMomAngle;
-  TH2F* PostPreS_MassVsGenMomAngle;
-
-  TH2F* PostPreS_EtaVsGenNumSibling;
-  TH2F* PostPreS_ProbQVsGenNumSibling;
-  TH2F* PostPreS_ProbXYVsGenNumSibling;
-  TH2F* PostPreS_PtVsGenNumSibling;
-  TH2F* PostPreS_EoPVsGenNumSibling;
-  TH2F* PostPreS_IhVsGenNumSibling;
-  TH2F* PostPreS_IasVsGenNumSibling;
-  TH2F* PostPreS_MassTVsGenNumSibling;
-  TH2F* PostPreS_MiniIsoChgVsGenNumSibling;
-  TH2F* PostPreS_MiniIsoAllVsGenNumSibling;
-  TH2F* PostPreS_EoPVsPfType;
+  lazyHisto<TH2F> PostPreS_ProbQVsGenEnviromentID;
+  lazyHisto<TH2F> PostPreS_ProbXYVsGenID;
+  lazyHisto<TH2F> PostPreS_PtVsGenID;
+  lazyHisto<TH2F> PostPreS_EoPVsGenID;
+  lazyHisto<TH2F> PostPreS_IhVsGenID;
+  lazyHisto<TH2F> PostPreS_IasVsGenID;
+  lazyHisto<TH2F> PostPreS_IasVsGenEnviromentID;
+  lazyHisto<TH2F> PostPreS_MassTVsGenID;
+  lazyHisto<TH2F> PostPreS_MiniIsoChgVsGenID;
+  lazyHisto<TH2F> PostPreS_MiniIsoAllVsGenID;
+  lazyHisto<TH2F> PostPreS_MassVsGenID;
+
+  lazyHisto<TH2F> PostPreS_EtaVsMomGenID;
+  lazyHisto<TH2F> PostPreS_ProbQVsMomGenID;
+  lazyHisto<TH2F> PostPreS_ProbXYVsMomGenID;
+  lazyHisto<TH2F> PostPreS_PtVsMomGenID;
+  lazyHisto<TH2F> PostPreS_EoPVsMomGenID;
+  lazyHisto<TH2F> PostPreS_IhVsMomGenID;
+  lazyHisto<TH2F> PostPreS_IasVsMomGenID;
+  lazyHisto<TH2F> PostPreS_MassTVsMomGenID;
+  lazyHisto<TH2F> PostPreS_MiniIsoChgVsMomGenID;
+  lazyHisto<TH2F> PostPreS_MiniIsoAllVsMomGenID;
+  lazyHisto<TH2F> PostPreS_MassVsMomGenID;
+
+  lazyHisto<TH2F> PostPreS_EtaVsSiblingGenID;
+  lazyHisto<TH2F> PostPreS_ProbQVsSiblingGenID;
+  lazyHisto<TH2F> PostPreS_ProbXYVsSiblingGenID;
+  lazyHisto<TH2F> PostPreS_PtVsSiblingGenID;
+  lazyHisto<TH2F> PostPreS_EoPVsSiblingGenID;
+  lazyHisto<TH2F> PostPreS_IhVsSiblingGenID;
+  lazyHisto<TH2F> PostPreS_IasVsSiblingGenID;
+  lazyHisto<TH2F> PostPreS_MassTVsSiblingGenID;
+  lazyHisto<TH2F> PostPreS_MassVsSiblingGenID;
+
+  lazyHisto<TH2F> PostPreS_EtaVsGenAngle;
+  lazyHisto<TH2F> PostPreS_ProbQVsGenAngle;
+  lazyHisto<TH2F> PostPreS_ProbXYVsGenAngle;
+  lazyHisto<TH2F> PostPreS_PtVsGenAngle;
+  lazyHisto<TH2F> PostPreS_EoPVsGenAngle;
+  lazyHisto<TH2F> PostPreS_IhVsGenAngle;
+  lazyHisto<TH2F> PostPreS_IasVsGenAngle;
+  lazyHisto<TH2F> PostPreS_MassTVsGenAngle;
+  lazyHisto<TH2F> PostPreS_MiniIsoChgVsGenAngle;
+  lazyHisto<TH2F> PostPreS_MiniIsoAllVsGenAngle;
+  lazyHisto<TH2F> PostPreS_MassVsGenAngle;
+
+  lazyHisto<TH2F> PostPreS_EtaVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_ProbQVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_ProbXYVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_PtVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_EoPVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_IhVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_IasVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_MassTVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_MiniIsoChgVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_MiniIsoAllVsGenMomAngle;
+  lazyHisto<TH2F> PostPreS_MassVsGenMomAngle;
+
+  lazyHisto<TH2F> PostPreS_EtaVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_ProbQVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_ProbXYVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_PtVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_EoPVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_IhVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_IasVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_MassTVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_MiniIsoChgVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_MiniIsoAllVsGenNumSibling;
+  lazyHisto<TH2F> PostPreS_EoPVsPfType;
 
 
   TH1F* PostPreS_Mass;
-  TH2F* PostPreS_MassVsPfType;
-  TH2F* PostPreS_MassVsPt;
-  TH2F* PostPreS_MassVsP;
-  TH2F* PostPreS_MassVsTNOHFraction;
-  TH2F* PostPreS_MassVsTNOPH;
-  TH2F* PostPreS_MassVsTNOM;
-  TH2F* PostPreS_MassVsProbQNoL1;
-  TH2F* PostPreS_MassVsProbXYNoL1;
-  TH2F* PostPreS_MassVsEoP;
-  TH2F* PostPreS_MassVsSumpTOverpT;
-  TH2F* PostPreS_MassVsPtErrOverPt;
-  TH2F* PostPreS_MassVsTIsol;
-  TH2F* PostPreS_MassVsIh;
-  TH2F* PostPreS_MassVsMassT;
-  TH2F* PostPreS_MassVsMiniRelIsoAll;
-  TH2F* PostPreS_MassVsMassErr;
+  lazyHisto<TH2F> PostPreS_MassVsPfType;
+  lazyHisto<TH2F> PostPreS_MassVsPt;
+  lazyHisto<TH2F> PostPreS_MassVsP;
+  lazyHisto<TH2F> PostPreS_MassVsTNOHFraction;
+  lazyHisto<TH2F> PostPreS_MassVsTNOPH;
+  lazyHisto<TH2F> PostPreS_MassVsTNOM;
+  lazyHisto<TH2F> PostPreS_MassVsProbQNoL1;
+  lazyHisto<TH2F> PostPreS_MassVsProbXYNoL1;
+  lazyHisto<TH2F> PostPreS_MassVsEoP;
+  lazyHisto<TH2F> PostPreS_MassVsSumpTOverpT;
+  lazyHisto<TH2F> PostPreS_MassVsPtErrOverPt;
+  lazyHisto<TH2F> PostPreS_MassVsTIsol;
+  lazyHisto<TH2F> PostPreS_MassVsIh;
+  lazyHisto<TH2F> PostPreS_MassVsMassT;
+  lazyHisto<TH2F> PostPreS_MassVsMiniRelIsoAll;
+  lazyHisto<TH2F> PostPreS_MassVsMassErr;
 
   TH1F* CutFlow;
   TH1F* EventCutFlow;
   TH1F* CutFlowReverse;
   
-  TH2F* CutFlowProbQ;
-  TH2F* CutFlowIas;
-  TH2F* CutFlowEta;
-  TH2F* CutFlowEoP;
-  TH2F* N1_FlowEta;
-  TH2F* CutFlowPfType;
+  lazyHisto<TH2F> CutFlowProbQ;
+  lazyHisto<TH2F> CutFlowIas;
+  lazyHisto<TH2F> CutFlowEta;
+  lazyHisto<TH2F> CutFlowEoP;
+  lazyHisto<TH2F> N1_FlowEta;
+  lazyHisto<TH2F> CutFlowPfType;
   
 
   // TODO: better deal with these
@@ -1859,60 +1608,60 @@ struct Tuple {
 //  TH3F* PostPreS_IasPixelIhVsLayer;
 //  TH3F* PostPreS_IasStripIhVsLayer;
 
-  TH2F* PostPreS_CluProbQVsPixelLayer;
-  TH2F* PostPreS_CluProbXYVsPixelLayer;
-  TH2F* PostPreS_CluSizeVsPixelLayer;
-  TH2F* PostPreS_CluSizeXVsPixelLayer;
-  TH2F* PostPreS_CluSizeYVsPixelLayer;
-  TH2F* PostPreS_CluSpecInCPEVsPixelLayer;
-  TH2F* PostPreS_CluProbQVsPixelLayer_highIas;
-  TH2F* PostPreS_CluProbXYVsPixelLayer_highIas;
-  TH2F* PostPreS_CluSizeVsPixelLayer_highIas;
-  TH2F* PostPreS_CluSizeXVsPixelLayer_highIas;
-  TH2F* PostPreS_CluSizeYVsPixelLayer_highIas;
-  TH2F* PostPreS_CluSpecInCPEVsPixelLayer_highIas;
-
-  TH2F* PostPreS_CluCotBetaVsPixelLayer_lowProbXY;
-  TH2F* PostPreS_CluCotAlphaVsPixelLayer_lowProbXY;
-  TH2F* PostPreS_CluCotBetaVsPixelLayer;
-  TH2F* PostPreS_CluCotAlphaVsPixelLayer;
-
-  TH2F* PostPreS_CluNormChargeVsStripLayer_lowBetaGamma;
-  TH2F* PostPreS_CluNormChargeVsStripLayer_higherBetaGamma;
+  lazyHisto<TH2F> PostPreS_CluProbQVsPixelLayer;
+  lazyHisto<TH2F> PostPreS_CluProbXYVsPixelLayer;
+  lazyHisto<TH2F> PostPreS_CluSizeVsPixelLayer;
+  lazyHisto<TH2F> PostPreS_CluSizeXVsPixelLayer;
+  lazyHisto<TH2F> PostPreS_CluSizeYVsPixelLayer;
+  lazyHisto<TH2F> PostPreS_CluSpecInCPEVsPixelLayer;
+  lazyHisto<TH2F> PostPreS_CluProbQVsPixelLayer_highIas;
+  lazyHisto<TH2F> PostPreS_CluProbXYVsPixelLayer_highIas;
+  lazyHisto<TH2F> PostPreS_CluSizeVsPixelLayer_highIas;
+  lazyHisto<TH2F> PostPreS_CluSizeXVsPixelLayer_highIas;
+  lazyHisto<TH2F> PostPreS_CluSizeYVsPixelLayer_highIas;
+  lazyHisto<TH2F> PostPreS_CluSpecInCPEVsPixelLayer_highIas;
+
+  lazyHisto<TH2F> PostPreS_CluCotBetaVsPixelLayer_lowProbXY;
+  lazyHisto<TH2F> PostPreS_CluCotAlphaVsPixelLayer_lowProbXY;
+  lazyHisto<TH2F> PostPreS_CluCotBetaVsPixelLayer;
+  lazyHisto<TH2F> PostPreS_CluCotAlphaVsPixelLayer;
+
+  lazyHisto<TH2F> PostPreS_CluNormChargeVsStripLayer_lowBetaGamma;
+  lazyHisto<TH2F> PostPreS_CluNormChargeVsStripLayer_higherBetaGamma;
 
   TH1F* PostPreS_dRMinPfJet;
   TH1F* PostPreS_closestPfJetMuonFraction;
   TH1F* PostPreS_closestPfJetElectronFraction;
   TH1F* PostPreS_closestPfJetPhotonFraction;
 
-  TH2F* PostPreS_dRMinPfJetVsIas;
-  TH2F* PostPreS_closestPfJetMuonFractionVsIas;
-  TH2F* PostPreS_closestPfJetElectronFractionVsIas;
-  TH2F* PostPreS_closestPfJetPhotonFractionVsIas;
+  lazyHisto<TH2F> PostPreS_dRMinPfJetVsIas;
+  lazyHisto<TH2F> PostPreS_closestPfJetMuonFractionVsIas;
+  lazyHisto<TH2F> PostPreS_closestPfJetElectronFractionVsIas;
+  lazyHisto<TH2F> PostPreS_closestPfJetPhotonFractionVsIas;
 
   TH1F* PostPreS_dRMinCaloJet;
   TH1F* PostPreS_dPhiMinPfMet;
-  TH2F* PostPreS_dRMinCaloJetVsIas;
-  TH2F* PostPreS_dPhiMinPfMetVsIas;
+  lazyHisto<TH2F> PostPreS_dRMinCaloJetVsIas;
+  lazyHisto<TH2F> PostPreS_dPhiMinPfMetVsIas;
   TH1F* PostPreS_RecoPfMet;
   TH1F* PostPreS_RecoPfMetPhi;
   TH1F* PostPreS_RecoPfJetsNum;
   TH1F* PostPreS_RecoPfHT;
 
   // Post Selection plots
-  TH2F* PostS_CutIdVsEta_RegionA;
-  TH2F* PostS_CutIdVsEta_RegionB;
-  TH2F* PostS_CutIdVsEta_RegionC;
-  TH2F* PostS_CutIdVsEta_RegionD;
-  TH2F* PostS_CutIdVsEta_RegionE;
-  TH2F* PostS_CutIdVsEta_RegionF;
-  TH2F* PostS_CutIdVsEta_RegionG;
-  TH2F* PostS_CutIdVsEta_RegionH;
-
-  TH2F* PostS_CutIdVsP;
-  TH2F* PostS_CutIdVsPt;
-  TH2F* PostS_CutIdVsIas;
-  TH2F* PostS_CutIdVsIh;
+  lazyHisto<TH2F> PostS_CutIdVsEta_RegionA;
+  lazyHisto<TH2F> PostS_CutIdVsEta_RegionB;
+  lazyHisto<TH2F> PostS_CutIdVsEta_RegionC;
+  lazyHisto<TH2F> PostS_CutIdVsEta_RegionD;
+  lazyHisto<TH2F> PostS_CutIdVsEta_RegionE;
+  lazyHisto<TH2F> PostS_CutIdVsEta_RegionF;
+  lazyHisto<TH2F> PostS_CutIdVsEta_RegionG;
+  lazyHisto<TH2F> PostS_CutIdVsEta_RegionH;
+
+  lazyHisto<TH2F> PostS_CutIdVsP;
+  lazyHisto<TH2F> PostS_CutIdVsPt;
+  lazyHisto<TH2F> PostS_CutIdVsIas;
+  lazyHisto<TH2F> PostS_CutIdVsIh;
   TH2F* PostS_CutIdVsTOF;
 
 
@@ -1953,13 +1702,13 @@ struct Tuple {
   TH1D* HCuts_Is;
   TH1D* HCuts_TOF;
 
-  TH3F* Pred_EtaP;
-  TH2F* Pred_I;
-  TH3F* Pred_EtaI;
+  lazyHisto<TH3F> Pred_EtaP;
+  lazyHisto<TH2F> Pred_I;
+  lazyHisto<TH3F> Pred_EtaI;
   TH2F* Pred_TOF;
-  TH2F* Pred_EtaB;
-  TH2F* Pred_EtaS;
-  TH2F* Pred_EtaS2;
+  lazyHisto<TH2F> Pred_EtaB;
+  lazyHisto<TH2F> Pred_EtaS;
+  lazyHisto<TH2F> Pred_EtaS2;
 
   //pz
 
@@ -1981,12 +1730,12 @@ struct Tuple {
 
   // end FIXME
 
-  TH2F* RegionD_P;
-  TH2F* RegionD_I;
-  TH2F* RegionD_Ias;
-  TH2F* RegionD_TOF;
+  lazyHisto<TH2F> RegionD_P;
+  lazyHisto<TH2F> RegionD_I;
+  lazyHisto<TH2F> RegionD_Ias;
+  lazyHisto<TH2F> RegionD_TOF;
 
-  TH2F* RegionH_Ias;
+  lazyHisto<TH2F> RegionH_Ias;
 
   TH1D* H_A_Flip;
   TH1D* H_B_Flip;
@@ -1998,74 +1747,74 @@ struct Tuple {
   TH1D* H_H_Flip;
   
   
-  TH2F* Mass;
-  TH2F* MassTOF;
-  TH2F* MassComb;
-  TH2F* MaxEventMass;
+  lazyHisto<TH2F> Mass;
+  lazyHisto<TH2F> MassTOF;
+  lazyHisto<TH2F> MassComb;
+  lazyHisto<TH2F> MaxEventMass;
   
-  TH2F* Mass_SystP;
-  TH2F* MassTOF_SystP;
-  TH2F* MassComb_SystP;
-  TH2F* MaxEventMass_SystP;
+  lazyHisto<TH2F> Mass_SystP;
+  lazyHisto<TH2F> MassTOF_SystP;
+  lazyHisto<TH2F> MassComb_SystP;
+  lazyHisto<TH2F> MaxEventMass_SystP;
   
-  TH2F* Mass_SystI;
-  TH2F* MassTOF_SystI;
-  TH2F* MassComb_SystI;
-  TH2F* MaxEventMass_SystI;
+  lazyHisto<TH2F> Mass_SystI;
+  lazyHisto<TH2F> MassTOF_SystI;
+  lazyHisto<TH2F> MassComb_SystI;
+  lazyHisto<TH2F> MaxEventMass_SystI;
   
-  TH2F* Mass_SystM;
-  TH2F* MassTOF_SystM;
-  TH2F* MassComb_SystM;
-  TH2F* MaxEventMass_SystM;
+  lazyHisto<TH2F> Mass_SystM;
+  lazyHisto<TH2F> MassTOF_SystM;
+  lazyHisto<TH2F> MassComb_SystM;
+  lazyHisto<TH2F> MaxEventMass_SystM;
   
-  TH2F* Mass_SystT;
-  TH2F* MassTOF_SystT;
-  TH2F* MassComb_SystT;
-  TH2F* MaxEventMass_SystT;
+  lazyHisto<TH2F> Mass_SystT;
+  lazyHisto<TH2F> MassTOF_SystT;
+  lazyHisto<TH2F> MassComb_SystT;
+  lazyHisto<TH2F> MaxEventMass_SystT;
   
-  TH2F* Mass_SystPU;
-  TH2F* MassTOF_SystPU;
-  TH2F* MassComb_SystPU;
-  TH2F* MaxEventMass_SystPU;
+  lazyHisto<TH2F> Mass_SystPU;
+  lazyHisto<TH2F> MassTOF_SystPU;
+  lazyHisto<TH2F> MassComb_SystPU;
+  lazyHisto<TH2F> MaxEventMass_SystPU;
   
-  TH2F* Mass_SystHUp;
-  TH2F* MassTOF_SystH;
-  TH2F* MassComb_SystHUp;
-  TH2F* MaxEventMass_SystHUp;
+  lazyHisto<TH2F> Mass_SystHUp;
+  lazyHisto<TH2F> MassTOF_SystH;
+  lazyHisto<TH2F> MassComb_SystHUp;
+  lazyHisto<TH2F> MaxEventMass_SystHUp;
   
-  TH2F* Mass_SystHDown;
-  TH2F* MassComb_SystHDown;
-  TH2F* MaxEventMass_SystHDown;
+  lazyHisto<TH2F> Mass_SystHDown;
+  lazyHisto<TH2F> MassComb_SystHDown;
+  lazyHisto<TH2F> MaxEventMass_SystHDown;
   
-  TH2F* Mass_Flip;
-  TH2F* MassTOF_Flip;
-  TH2F* MassComb_Flip;
+  lazyHisto<TH2F> Mass_Flip;
+  lazyHisto<TH2F> MassTOF_Flip;
+  lazyHisto<TH2F> MassComb_Flip;
 
   std::map<std::string, TH1D*> H_B_Binned_Flip;
   std::map<std::string, TH1D*> H_D_Binned_Flip;
   std::map<std::string, TH1D*> H_F_Binned_Flip;
   std::map<std::string, TH1D*> H_H_Binned_Flip;
 
-  TH3F* Pred_EtaP_Flip;
-  TH2F* Pred_I_Flip;
+  lazyHisto<TH3F> Pred_EtaP_Flip;
+  lazyHisto<TH2F> Pred_I_Flip;
   TH2F* Pred_TOF_Flip;
-  TH2F* Pred_EtaB_Flip;
-  TH2F* Pred_EtaS_Flip;
-  TH2F* Pred_EtaS2_Flip;
+  lazyHisto<TH2F> Pred_EtaB_Flip;
+  lazyHisto<TH2F> Pred_EtaS_Flip;
+  lazyHisto<TH2F> Pred_EtaS2_Flip;
 
-  TH2F* RegionD_P_Flip;
-  TH2F* RegionD_I_Flip;
-  TH2F* RegionD_Ias_Flip;
+  lazyHisto<TH2F> RegionD_P_Flip;
+  lazyHisto<TH2F> RegionD_I_Flip;
+  lazyHisto<TH2F> RegionD_Ias_Flip;
   TH2F* RegionD_TOF_Flip;
 
-  TH2F* RegionH_Ias_Flip;
+  lazyHisto<TH2F> RegionH_Ias_Flip;
 
-  TH2F* BefPreS_GenPtVsdRMinGen;
+  lazyHisto<TH2F> BefPreS_GenPtVsdRMinGen;
   TH1F* BefPreS_GendRMin;
-  TH2F* BefPreS_GenPtVsdRMinGenPostCut;
-  TH2F* BefPreS_GenPtVsGenMinPt;
-  TH2F* BefPreS_GenPtVsRecoPt;
-  TH2F* PostPreS_GenPtVsRecoPt;
+  lazyHisto<TH2F> BefPreS_GenPtVsdRMinGenPostCut;
+  lazyHisto<TH2F> BefPreS_GenPtVsGenMinPt;
+  lazyHisto<TH2F> BefPreS_GenPtVsRecoPt;
+  lazyHisto<TH2F> PostPreS_GenPtVsRecoPt;
   
   TH1F* PostS_RecoHSCParticleType;
   TH1F* PostS_HltMatchTrackLevel;
@@ -2130,41 +1879,41 @@ struct Tuple {
 
  // Calibration
  // Scale Factors
- TH2F* SF_HHit2DPix_loose;
- TH2F* SF_HHit2DStrip_loose;
- TH2F* SF_HHit2DPix;
- TH2F* SF_HHit2DStrip;
- TH2F* SF_HHit2DPix_nosf;
- TH2F* SF_HHit2DStrip_nosf;
- TH2F* SF_HHit2DPix_eta1;
- TH2F* SF_HHit2DStrip_eta1;
- TH2F* SF_HHit2DPix_nosf_eta1;
- TH2F* SF_HHit2DStrip_nosf_eta1;
- TH2F* SF_HHit2DPix_vs_eta;
- TH2F* SF_HHit2DStrip_vs_eta;
+ lazyHisto<TH2F> SF_HHit2DPix_loose;
+ lazyHisto<TH2F> SF_HHit2DStrip_loose;
+ lazyHisto<TH2F> SF_HHit2DPix;
+ lazyHisto<TH2F> SF_HHit2DStrip;
+ lazyHisto<TH2F> SF_HHit2DPix_nosf;
+ lazyHisto<TH2F> SF_HHit2DStrip_nosf;
+ lazyHisto<TH2F> SF_HHit2DPix_eta1;
+ lazyHisto<TH2F> SF_HHit2DStrip_eta1;
+ lazyHisto<TH2F> SF_HHit2DPix_nosf_eta1;
+ lazyHisto<TH2F> SF_HHit2DStrip_nosf_eta1;
+ lazyHisto<TH2F> SF_HHit2DPix_vs_eta;
+ lazyHisto<TH2F> SF_HHit2DStrip_vs_eta;
 
  // K and C
- TH2F* K_and_C_Ih_noL1_VsP_loose1;
- TH2F* K_and_C_Ih_noL1_VsP_loose2;
- TH2F* K_and_C_Ih_strip_VsP_loose1;
- TH2F* K_and_C_Ih_strip_VsP_loose2;
- TH2F* K_and_C_Ih_strip_VsP_eta1_loose1;
- TH2F* K_and_C_Ih_strip_VsP_eta1_loose2;
- TH2F* K_and_C_Ih_strip_VsP_eta2_loose1;
- TH2F* K_and_C_Ih_strip_VsP_eta2_loose2;
-
- TH2F* K_and_C_Ih_noL1_VsP_1;
- TH2F* K_and_C_Ih_noL1_VsP_2;
- TH2F* K_and_C_Ih_strip_VsP_1;
- TH2F* K_and_C_Ih_strip_VsP_2;
- TH2F* K_and_C_Ih_strip_VsP_eta1_1;
- TH2F* K_and_C_Ih_strip_VsP_eta1_2;
- TH2F* K_and_C_Ih_strip_VsP_eta2_1;
- TH2F* K_and_C_Ih_strip_VsP_eta2_2;
- TH2F* K_and_C_Ih_noL1_VsP_wFcut1;
- TH2F* K_and_C_Ih_noL1_VsP_wFcut2;
- TH2F* K_and_C_Ih_strip_VsP_wFcut1;
- TH2F* K_and_C_Ih_strip_VsP_wFcut2;
+ lazyHisto<TH2F> K_and_C_Ih_noL1_VsP_loose1;
+ lazyHisto<TH2F> K_and_C_Ih_noL1_VsP_loose2;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_loose1;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_loose2;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_eta1_loose1;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_eta1_loose2;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_eta2_loose1;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_eta2_loose2;
+
+ lazyHisto<TH2F> K_and_C_Ih_noL1_VsP_1;
+ lazyHisto<TH2F> K_and_C_Ih_noL1_VsP_2;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_1;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_2;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_eta1_1;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_eta1_2;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_eta2_1;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_eta2_2;
+ lazyHisto<TH2F> K_and_C_Ih_noL1_VsP_wFcut1;
+ lazyHisto<TH2F> K_and_C_Ih_noL1_VsP_wFcut2;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_wFcut1;
+ lazyHisto<TH2F> K_and_C_Ih_strip_VsP_wFcut2;
 
  TH1F* K_and_C_Ih_noL1_1d;
  TH1F* K_and_C_Ih_strip_1d;
@@ -2177,33 +1926,33 @@ struct Tuple {
  TH1F* K_and_C_FracSat;
 
  // Stability
- TH2F* Stab_RunNumVsPixCluChargeAfterSFsL1;
- TH2F* Stab_RunNumVsPixCluChargeAfterSFsL2;
- TH2F* Stab_RunNumVsPixCluChargeAfterSFsL3;
- TH2F* Stab_RunNumVsPixCluChargeAfterSFsL4;
+ lazyHisto<TH2F> Stab_RunNumVsPixCluChargeAfterSFsL1;
+ lazyHisto<TH2F> Stab_RunNumVsPixCluChargeAfterSFsL2;
+ lazyHisto<TH2F> Stab_RunNumVsPixCluChargeAfterSFsL3;
+ lazyHisto<TH2F> Stab_RunNumVsPixCluChargeAfterSFsL4;
   
- TH2F* Stab_Ih_NoL1_VsRun;
- TH2F* Stab_Ih_pixNoL1_VsRun;
- TH2F* Stab_Ih_strip_VsRun;
- TH2F* Stab_Gi_strip_VsRun;
- TH2F* Stab_Gi_NoL1_VsRun;
- TH2F* Stab_Fi_pixNoL1_VsRun;
- TH2F* Stab_invB_VsRun;
- TH2F* Stab_invB_DT_VsRun;
- TH2F* Stab_invB_CSC_VsRun;
- TH2F* Stab_CluDeDxPixLayer2_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxPixLayer3_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxPixLayer4_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer1_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer2_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer3_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer4_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer5_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer6_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer7_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer8_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer9_VsRun_CR_veryLowPt;
- TH2F* Stab_CluDeDxStripsLayer10_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_Ih_NoL1_VsRun;
+ lazyHisto<TH2F> Stab_Ih_pixNoL1_VsRun;
+ lazyHisto<TH2F> Stab_Ih_strip_VsRun;
+ lazyHisto<TH2F> Stab_Gi_strip_VsRun;
+ lazyHisto<TH2F> Stab_Gi_NoL1_VsRun;
+ lazyHisto<TH2F> Stab_Fi_pixNoL1_VsRun;
+ lazyHisto<TH2F> Stab_invB_VsRun;
+ lazyHisto<TH2F> Stab_invB_DT_VsRun;
+ lazyHisto<TH2F> Stab_invB_CSC_VsRun;
+ lazyHisto<TH2F> Stab_CluDeDxPixLayer2_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxPixLayer3_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxPixLayer4_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer1_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer2_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer3_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer4_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer5_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer6_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer7_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer8_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer9_VsRun_CR_veryLowPt;
+ lazyHisto<TH2F> Stab_CluDeDxStripsLayer10_VsRun_CR_veryLowPt;
 
  // Saturatopm
  TH1F* PostPreS_NumSat;
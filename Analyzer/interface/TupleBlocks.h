@@ -0,0 +1,553 @@
+#ifndef SUSYBSMAnalysis_Analyzer_TupleBlocks_h
+#define SUSYBSMAnalysis_Analyzer_TupleBlocks_h
+
+#include <cstdint>
+#include <vector>
+
+//=============================================================
+//
+//     Per-object tuple blocks
+//
+//     One structure of arrays per object collection. The blocks
+//     are owned by the analyzer and cleared at the start of each
+//     event, so the columns keep their capacity across events.
+//     The TTree branches are bound directly to the columns, the
+//     per-event content is never copied into the Tuple.
+//
+//=============================================================
+
+// primary vertices
+struct VertexBlock {
+  std::vector<float> X;
+  std::vector<float> Y;
+  std::vector<float> Z;
+  std::vector<float> Rho;
+  std::vector<int> Ndof;
+  std::vector<float> Chi2;
+  std::vector<float> SumPt2;
+
+  void clear() {
+    X.clear();
+    Y.clear();
+    Z.clear();
+    Rho.clear();
+    Ndof.clear();
+    Chi2.clear();
+    SumPt2.clear();
+  }
+};
+
+// generator particles
+struct GenBlock {
+  std::vector<int> Id;
+  std::vector<int> Status;
+  std::vector<float> E;
+  std::vector<float> Pt;
+  std::vector<float> Pz;
+  std::vector<float> Eta;
+  std::vector<float> Phi;
+  std::vector<float> Beta;
+  std::vector<int> Charge;
+  std::vector<float> ProdVertexX;
+  std::vector<float> ProdVertexY;
+  std::vector<float> ProdVertexZ;
+  std::vector<int> MotherId;
+  std::vector<int> MotherIndex;
+
+  void clear() {
+    Id.clear();
+    Status.clear();
+    E.clear();
+    Pt.clear();
+    Pz.clear();
+    Eta.clear();
+    Phi.clear();
+    Beta.clear();
+    Charge.clear();
+    ProdVertexX.clear();
+    ProdVertexY.clear();
+    ProdVertexZ.clear();
+    MotherId.clear();
+    MotherIndex.clear();
+  }
+};
+
+// electrons
+struct ElectronBlock {
+  std::vector<float> E;
+  std::vector<float> Pt;
+  std::vector<float> Eta;
+  std::vector<float> Phi;
+  std::vector<float> Charge;
+  std::vector<float> E_SC;
+  std::vector<float> Eta_SC;
+  std::vector<float> Phi_SC;
+  std::vector<float> SigmaIetaIeta;
+  std::vector<float> Full5x5SigmaIetaIeta;
+  std::vector<float> R9;
+  std::vector<float> dEta;
+  std::vector<float> dPhi;
+  std::vector<float> HoverE;
+  std::vector<float> d0;
+  std::vector<float> dZ;
+  std::vector<float> pileupIso;
+  std::vector<float> chargedIso;
+  std::vector<float> photonIso;
+  std::vector<float> neutralHadIso;
+  std::vector<int> MissHits;
+  std::vector<bool> passCutBasedIDVeto;
+  std::vector<bool> passCutBasedIDLoose;
+  std::vector<bool> passCutBasedIDMedium;
+  std::vector<bool> passCutBasedIDTight;
+  std::vector<bool> passMVAIsoIDWP80;
+  std::vector<bool> passMVAIsoIDWP90;
+  std::vector<bool> passMVAIsoIDWPHZZ;
+  std::vector<bool> passMVAIsoIDWPLoose;
+  std::vector<bool> passMVANoIsoIDWP80;
+  std::vector<bool> passMVANoIsoIDWP90;
+  std::vector<bool> passMVANoIsoIDWPLoose;
+  std::vector<bool> PassConvVeto;
+  std::vector<float> OneOverEminusOneOverP;
+
+  void clear() {
+    E.clear();
+    Pt.clear();
+    Eta.clear();
+    Phi.clear();
+    Charge.clear();
+    E_SC.clear();
+    Eta_SC.clear();
+    Phi_SC.clear();
+    SigmaIetaIeta.clear();
+    Full5x5SigmaIetaIeta.clear();
+    R9.clear();
+    dEta.clear();
+    dPhi.clear();
+    HoverE.clear();
+    d0.clear();
+    dZ.clear();
+    pileupIso.clear();
+    chargedIso.clear();
+    photonIso.clear();
+    neutralHadIso.clear();
+    MissHits.clear();
+    passCutBasedIDVeto.clear();
+    passCutBasedIDLoose.clear();
+    passCutBasedIDMedium.clear();
+    passCutBasedIDTight.clear();
+    passMVAIsoIDWP80.clear();
+    passMVAIsoIDWP90.clear();
+    passMVAIsoIDWPHZZ.clear();
+    passMVAIsoIDWPLoose.clear();
+    passMVANoIsoIDWP80.clear();
+    passMVANoIsoIDWP90.clear();
+    passMVANoIsoIDWPLoose.clear();
+    PassConvVeto.clear();
+    OneOverEminusOneOverP.clear();
+  }
+};
+
+// muons
+struct MuonBlock {
+  std::vector<float> E;
+  std::vector<float> Pt;
+  std::vector<float> globalTrackPt;
+  std::vector<float> rescaledPtUpGlobal;
+  std::vector<float> rescaledPtDownGlobal;
+  std::vector<float> innerTrackPt;
+  std::vector<float> rescaledPtUpInner;
+  std::vector<float> rescaledPtDownInner;
+  std::vector<float> outerTrackPt;
+  std::vector<float> PtErr;
+  std::vector<float> Eta;
+  std::vector<float> Phi;
+  std::vector<float> Beta;
+  std::vector<int> Charge;
+  std::vector<bool> IsLoose;
+  std::vector<bool> IsMedium;
+  std::vector<bool> IsTight;
+  std::vector<float> d0;
+  std::vector<float> d0Err;
+  std::vector<float> dZ;
+  std::vector<float> ip3d;
+  std::vector<float> ip3dSignificance;
+  std::vector<unsigned int> Type;
+  std::vector<unsigned int> Quality;
+  std::vector<float> pileupIso;
+  std::vector<float> chargedIso;
+  std::vector<float> photonIso;
+  std::vector<float> neutralHadIso;
+  std::vector<float> validFractionTrackerHits;
+  std::vector<float> normChi2;
+  std::vector<float> chi2LocalPosition;
+  std::vector<float> kinkFinder;
+  std::vector<float> segmentCompatability;
+  std::vector<float> trkIso;
+  std::vector<float> tuneP_Pt;
+  std::vector<float> tuneP_PtErr;
+  std::vector<float> tuneP_Eta;
+  std::vector<float> tuneP_Phi;
+  std::vector<int> tuneP_MuonBestTrackType;
+  std::vector<bool> isHighPtMuon;
+  std::vector<bool> isTrackerHighPtMuon;
+
+  void clear() {
+    E.clear();
+    Pt.clear();
+    globalTrackPt.clear();
+    rescaledPtUpGlobal.clear();
+    rescaledPtDownGlobal.clear();
+    innerTrackPt.clear();
+    rescaledPtUpInner.clear();
+    rescaledPtDownInner.clear();
+    outerTrackPt.clear();
+    PtErr.clear();
+    Eta.clear();
+    Phi.clear();
+    Beta.clear();
+    Charge.clear();
+    IsLoose.clear();
+    IsMedium.clear();
+    IsTight.clear();
+    d0.clear();
+    d0Err.clear();
+    dZ.clear();
+    ip3d.clear();
+    ip3dSignificance.clear();
+    Type.clear();
+    Quality.clear();
+    pileupIso.clear();
+    chargedIso.clear();
+    photonIso.clear();
+    neutralHadIso.clear();
+    validFractionTrackerHits.clear();
+    normChi2.clear();
+    chi2LocalPosition.clear();
+    kinkFinder.clear();
+    segmentCompatability.clear();
+    trkIso.clear();
+    tuneP_Pt.clear();
+    tuneP_PtErr.clear();
+    tuneP_Eta.clear();
+    tuneP_Phi.clear();
+    tuneP_MuonBestTrackType.clear();
+    isHighPtMuon.clear();
+    isTrackerHighPtMuon.clear();
+  }
+};
+
+// PF jets
+struct JetBlock {
+  std::vector<float> pt;
+  std::vector<float> eta;
+  std::vector<float> phi;
+  std::vector<float> mass;
+  std::vector<float> energy;
+  std::vector<float> pdgId;
+  std::vector<float> et;
+  std::vector<float> chargedEmEnergyFraction;
+  std::vector<float> neutralEmEnergyFraction;
+  std::vector<float> chargedHadronEnergyFraction;
+  std::vector<float> neutralHadronEnergyFraction;
+  std::vector<float> muonEnergyFraction;
+  std::vector<int> chargedMultiplicity;
+  std::vector<int> neutralMultiplicity;
+  std::vector<float> jetArea;
+  std::vector<float> pileupE;
+
+  void clear() {
+    pt.clear();
+    eta.clear();
+    phi.clear();
+    mass.clear();
+    energy.clear();
+    pdgId.clear();
+    et.clear();
+    chargedEmEnergyFraction.clear();
+    neutralEmEnergyFraction.clear();
+    chargedHadronEnergyFraction.clear();
+    neutralHadronEnergyFraction.clear();
+    muonEnergyFraction.clear();
+    chargedMultiplicity.clear();
+    neutralMultiplicity.clear();
+    jetArea.clear();
+    pileupE.clear();
+  }
+};
+
+// HSCP candidates
+struct HSCPBlock {
+  std::vector<float> GenBeta;
+  std::vector<float> dRclosestTrigAndCandidate;
+  std::vector<float> trigObjBeta;
+  std::vector<float> mT;
+  std::vector<bool> passCutPt55;
+  std::vector<bool> passPreselection;
+  std::vector<bool> passPreselectionSept8;
+  std::vector<bool> passPreselectionTrigSys;
+  std::vector<bool> passSelection;
+  std::vector<bool> isPFMuon;
+  std::vector<bool> PFMuonPt;
+  std::vector<float> Charge;
+  std::vector<float> Pt;
+  std::vector<float> PtErr;
+  std::vector<float> Is_StripOnly;
+  std::vector<float> Ias;
+  std::vector<float> Ias_noPix_noTIB_noTID_no3TEC;
+  std::vector<float> Ias_PixelOnly;
+  std::vector<float> Ias_StripOnly;
+  std::vector<float> Ias_PixelOnly_noL1;
+  std::vector<float> Ih;
+  std::vector<float> Ick;
+  std::vector<float> Fmip;
+  std::vector<float> ProbXY;
+  std::vector<float> ProbXY_noL1;
+  std::vector<float> ProbQ;
+  std::vector<float> ProbQ_noL1;
+  std::vector<float> Ndof;
+  std::vector<float> Chi2;
+  std::vector<int> QualityMask;
+  std::vector<bool> isHighPurity;
+  std::vector<float> EoverP;
+  std::vector<bool> isMuon;
+  std::vector<bool> isGlobalMuon;
+  std::vector<bool> isPhoton;
+  std::vector<bool> isElectron;
+  std::vector<float> gsfFbremElectron;
+  std::vector<float> gsfMomentumElectron;
+  std::vector<float> PFMomentumElectron;
+  std::vector<bool> isChHadron;
+  std::vector<bool> isNeutHadron;
+  std::vector<bool> isPfTrack;
+  std::vector<bool> isUndefined;
+  std::vector<float> ECAL_energy;
+  std::vector<float> HCAL_energy;
+  std::vector<float> TOF;
+  std::vector<float> TOFErr;
+  std::vector<unsigned int> TOF_ndof;
+  std::vector<float> DTTOF;
+  std::vector<float> DTTOFErr;
+  std::vector<unsigned int> DTTOF_ndof;
+  std::vector<float> CSCTOF;
+  std::vector<float> CSCTOFErr;
+  std::vector<unsigned int> CSCTOF_ndof;
+  std::vector<float> Mass;
+  std::vector<float> MassErr;
+  std::vector<float> dZ;
+  std::vector<float> dXY;
+  std::vector<float> dR;
+  std::vector<float> p;
+  std::vector<float> eta;
+  std::vector<float> phi;
+  std::vector<unsigned int> NOH;  //number of (valid) track pixel+strip hits
+  std::vector<unsigned int> NOPH;  //number of (valid) track pixel hits
+  std::vector<float> FOVH;  //fraction of valid track hits
+  std::vector<unsigned int> NOMH;  //number of missing hits from IP till last hit (excluding hits behind the last hit)
+  std::vector<float> FOVHD;  //fraction of valid hits divided by total expected hits until the last one
+  std::vector<unsigned int> NOM;  //number of dEdx hits (= #strip+#pixel-#ClusterCleaned hits, but this depend on estimator used)
+  std::vector<float> matchTrigMuon_minDeltaR;  //minDeltaR between triggermuon and HSCP
+  std::vector<float> matchTrigMuon_pT;  //pt of trigger muon with minDeltaR between triggermuon and HSCP
+  std::vector<float> iso_TK;
+  std::vector<float> iso_ECAL;
+  std::vector<float> iso_HCAL;
+  std::vector<float> track_genTrackMiniIsoSumPt;
+  std::vector<float> track_genTrackAbsIsoSumPtFix;
+  std::vector<float> track_genTrackIsoSumPt_dr03;
+  std::vector<float> PFMiniIso_relative;
+  std::vector<float> PFMiniIso_wMuon_relative;
+  std::vector<float> track_PFIsolationR005_sumChargedHadronPt;
+  std::vector<float> track_PFIsolationR005_sumNeutralHadronPt;
+  std::vector<float> track_PFIsolationR005_sumPhotonPt;
+  std::vector<float> track_PFIsolationR005_sumPUPt;
+  std::vector<float> track_PFIsolationR01_sumChargedHadronPt;
+  std::vector<float> track_PFIsolationR01_sumNeutralHadronPt;
+  std::vector<float> track_PFIsolationR01_sumPhotonPt;
+  std::vector<float> track_PFIsolationR01_sumPUPt;
+  std::vector<float> track_PFIsolationR03_sumChargedHadronPt;
+  std::vector<float> track_PFIsolationR03_sumNeutralHadronPt;
+  std::vector<float> track_PFIsolationR03_sumPhotonPt;
+  std::vector<float> track_PFIsolationR03_sumPUPt;
+  std::vector<float> track_PFIsolationR05_sumChargedHadronPt;
+  std::vector<float> track_PFIsolationR05_sumNeutralHadronPt;
+  std::vector<float> track_PFIsolationR05_sumPhotonPt;
+  std::vector<float> track_PFIsolationR05_sumPUPt;
+  std::vector<float> muon_PFIsolationR03_sumChargedHadronPt;
+  std::vector<float> muon_PFIsolationR03_sumNeutralHadronPt;
+  std::vector<float> muon_PFIsolationR03_sumPhotonPt;
+  std::vector<float> muon_PFIsolationR03_sumPUPt;
+  std::vector<float> Ih_noL1;
+  std::vector<float> Ih_15drop;
+  std::vector<float> Ih_StripOnly;
+  std::vector<float> Ih_StripOnly_15drop;
+  std::vector<float> Ih_PixelOnly_noL1;
+  std::vector<float> Ih_SaturationCorrectionFromFits;
+  std::vector<std::vector<float>> clust_charge;
+  std::vector<std::vector<float>> clust_pathlength;
+  std::vector<std::vector<unsigned int>> clust_nstrip;
+  std::vector<std::vector<bool>> clust_sat254;
+  std::vector<std::vector<bool>> clust_sat255;
+  std::vector<std::vector<uint32_t>> clust_detid;
+  std::vector<std::vector<bool>> clust_isStrip;
+  std::vector<std::vector<bool>> clust_isPixel;
+  std::vector<float> GenId;
+  std::vector<float> GenCharge;
+  std::vector<float> GenMass;
+  std::vector<float> GenPt;
+  std::vector<float> GenEta;
+  std::vector<float> GenPhi;
+  std::vector<float> tuneP_Pt;
+  std::vector<float> tuneP_PtErr;
+  std::vector<float> tuneP_Eta;
+  std::vector<float> tuneP_Phi;
+  std::vector<int> tuneP_MuonBestTrackType;
+  std::vector<int> ErrorHisto_bin;
+  std::vector<int> type;
+
+  void clear() {
+    GenBeta.clear();
+    dRclosestTrigAndCandidate.clear();
+    trigObjBeta.clear();
+    mT.clear();
+    passCutPt55.clear();
+    passPreselection.clear();
+    passPreselectionSept8.clear();
+    passPreselectionTrigSys.clear();
+    passSelection.clear();
+    isPFMuon.clear();
+    PFMuonPt.clear();
+    Charge.clear();
+    Pt.clear();
+    PtErr.clear();
+    Is_StripOnly.clear();
+    Ias.clear();
+    Ias_noPix_noTIB_noTID_no3TEC.clear();
+    Ias_PixelOnly.clear();
+    Ias_StripOnly.clear();
+    Ias_PixelOnly_noL1.clear();
+    Ih.clear();
+    Ick.clear();
+    Fmip.clear();
+    ProbXY.clear();
+    ProbXY_noL1.clear();
+    ProbQ.clear();
+    ProbQ_noL1.clear();
+    Ndof.clear();
+    Chi2.clear();
+    QualityMask.clear();
+    isHighPurity.clear();
+    EoverP.clear();
+    isMuon.clear();
+    isGlobalMuon.clear();
+    isPhoton.clear();
+    isElectron.clear();
+    gsfFbremElectron.clear();
+    gsfMomentumElectron.clear();
+    PFMomentumElectron.clear();
+    isChHadron.clear();
+    isNeutHadron.clear();
+    isPfTrack.clear();
+    isUndefined.clear();
+    ECAL_energy.clear();
+    HCAL_energy.clear();
+    TOF.clear();
+    TOFErr.clear();
+    TOF_ndof.clear();
+    DTTOF.clear();
+    DTTOFErr.clear();
+    DTTOF_ndof.clear();
+    CSCTOF.clear();
+    CSCTOFErr.clear();
+    CSCTOF_ndof.clear();
+    Mass.clear();
+    MassErr.clear();
+    dZ.clear();
+    dXY.clear();
+    dR.clear();
+    p.clear();
+    eta.clear();
+    phi.clear();
+    NOH.clear();
+    NOPH.clear();
+    FOVH.clear();
+    NOMH.clear();
+    FOVHD.clear();
+    NOM.clear();
+    matchTrigMuon_minDeltaR.clear();
+    matchTrigMuon_pT.clear();
+    iso_TK.clear();
+    iso_ECAL.clear();
+    iso_HCAL.clear();
+    track_genTrackMiniIsoSumPt.clear();
+    track_genTrackAbsIsoSumPtFix.clear();
+    track_genTrackIsoSumPt_dr03.clear();
+    PFMiniIso_relative.clear();
+    PFMiniIso_wMuon_relative.clear();
+    track_PFIsolationR005_sumChargedHadronPt.clear();
+    track_PFIsolationR005_sumNeutralHadronPt.clear();
+    track_PFIsolationR005_sumPhotonPt.clear();
+    track_PFIsolationR005_sumPUPt.clear();
+    track_PFIsolationR01_sumChargedHadronPt.clear();
+    track_PFIsolationR01_sumNeutralHadronPt.clear();
+    track_PFIsolationR01_sumPhotonPt.clear();
+    track_PFIsolationR01_sumPUPt.clear();
+    track_PFIsolationR03_sumChargedHadronPt.clear();
+    track_PFIsolationR03_sumNeutralHadronPt.clear();
+    track_PFIsolationR03_sumPhotonPt.clear();
+    track_PFIsolationR03_sumPUPt.clear();
+    track_PFIsolationR05_sumChargedHadronPt.clear();
+    track_PFIsolationR05_sumNeutralHadronPt.clear();
+    track_PFIsolationR05_sumPhotonPt.clear();
+    track_PFIsolationR05_sumPUPt.clear();
+    muon_PFIsolationR03_sumChargedHadronPt.clear();
+    muon_PFIsolationR03_sumNeutralHadronPt.clear();
+    muon_PFIsolationR03_sumPhotonPt.clear();
+    muon_PFIsolationR03_sumPUPt.clear();
+    Ih_noL1.clear();
+    Ih_15drop.clear();
+    Ih_StripOnly.clear();
+    Ih_StripOnly_15drop.clear();
+    Ih_PixelOnly_noL1.clear();
+    Ih_SaturationCorrectionFromFits.clear();
+    clust_charge.clear();
+    clust_pathlength.clear();
+    clust_nstrip.clear();
+    clust_sat254.clear();
+    clust_sat255.clear();
+    clust_detid.clear();
+    clust_isStrip.clear();
+    clust_isPixel.clear();
+    GenId.clear();
+    GenCharge.clear();
+    GenMass.clear();
+    GenPt.clear();
+    GenEta.clear();
+    GenPhi.clear();
+    tuneP_Pt.clear();
+    tuneP_PtErr.clear();
+    tuneP_Eta.clear();
+    tuneP_Phi.clear();
+    tuneP_MuonBestTrackType.clear();
+    ErrorHisto_bin.clear();
+    type.clear();
+  }
+};
+
+struct TupleBlocks {
+  VertexBlock vertex;
+  GenBlock gen;
+  ElectronBlock electron;
+  MuonBlock muon;
+  JetBlock jet;
+  HSCPBlock hscp;
+
+  void clear() {
+    vertex.clear();
+    gen.clear();
+    electron.clear();
+    muon.clear();
+    jet.clear();
+    hscp.clear();
+  }
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "SUSYBSMAnalysis/Analyzer/interface/Tuple.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/TupleBlocks.h"
 
 struct Tuple;
 
@@ -8,6 +9,8 @@ public:
   ~TupleMaker();
 
   void initializeTuple(Tuple *&tuple,
+                       TupleBlocks &blocks,
+                       histoRegistry &histos,
                        TFileDirectory &dir,
                        unsigned int saveTree,
                        bool calcSyst_,
@@ -33,6 +36,7 @@ public:
                        bool tapeRecallOnly_);
 
   void initializeRegions(Tuple *&tuple,
+                        histoRegistry &histos,
                         TFileDirectory &dir,
                         int etabins,
                         int ihbins,
@@ -53,13 +57,6 @@ public:
                         const std::vector<float>  &nPUmean,
                         const unsigned int &nofVertices,
                         const int &npv,
-                        const std::vector<float>  &pvX,
-                        const std::vector<float>  &pvY,
-                        const std::vector<float>  &pvZ,
-                        const std::vector<float>  &pvRho,
-                        const std::vector<int>  &pvNdof,
-                        const std::vector<float>  &pvChi2,
-                        const std::vector<float>  &pvSumPt2,
                         const unsigned int &Hscp,
                         const unsigned int &nMuons,
                         const unsigned int &njets,
@@ -72,9 +69,6 @@ public:
                         const std::vector<std::vector<float>> &triggerObjectPt,
                         const std::vector<std::vector<float>> &triggerObjectEta,
                         const std::vector<std::vector<float>> &triggerObjectPhi,
-                        const std::vector<float> &HSCP_GenBeta,
-                        const std::vector<float> &HSCP_dRclosestTrigAndCandidate,
-                        const std::vector<float> &HSCP_trigObjBeta,
                         const float &trigObjBeta,
                         const float& trigObjEta,
                         const bool &L1_SingleMu22,
@@ -128,63 +122,6 @@ public:
                         const float &HLTPFMHT_phi,
                         const float &HLTPFMHT_sigf,
                         const bool &matchedMuonWasFound,
-                        const std::vector<int> &gParticleId,
-                        const std::vector<int> &gParticleStatus,
-                        const std::vector<float> &gParticleE,
-                        const std::vector<float> &gParticlePt,
-                        const std::vector<float> &gParticlePz,
-                        const std::vector<float> &gParticleEta,
-                        const std::vector<float> &gParticlePhi,
-                        const std::vector<float> &gParticleBeta,
-                        const std::vector<int> &gParticleCharge,
-                        const std::vector<float> &gParticleProdVertexX,
-                        const std::vector<float> &gParticleProdVertexY,
-                        const std::vector<float> &gParticleProdVertexZ,
-                        const std::vector<int> &gParticleMotherId,
-                        const std::vector<int> &gParticleMotherIndex,
-                        const std::vector<float> &eleE,
-                        const std::vector<float> &elePt,
-                        const std::vector<float> &eleEta,
-                        const std::vector<float> &elePhi,
-                        const std::vector<float> &eleCharge,
-                        const std::vector<float> &eleE_SC,
-                        const std::vector<float> &eleEta_SC,
-                        const std::vector<float> &elePhi_SC,
-                        const std::vector<float> &eleSigmaIetaIeta,
-                        const std::vector<float> &eleFull5x5SigmaIetaIeta,
-                        const std::vector<float> &eleR9,
-                        const std::vector<float> &ele_dEta,
-                        const std::vector<float> &ele_dPhi,
-                        const std::vector<float> &ele_HoverE,
-                        const std::vector<float> &ele_d0,
-                        const std::vector<float> &ele_dZ,
-                        const std::vector<float> &ele_pileupIso,
-                        const std::vector<float> &ele_chargedIso,
-                        const std::vector<float> &ele_photonIso,
-                        const std::vector<float> &ele_neutralHadIso,
-                        const std::vector<int> &ele_MissHits,
-                        const std::vector<bool> &ele_passCutBasedIDVeto,
-                        const std::vector<bool> &ele_passCutBasedIDLoose,
-                        const std::vector<bool> &ele_passCutBasedIDMedium,
-                        const std::vector<bool> &ele_passCutBasedIDTight,
-                        const std::vector<bool> &ele_passMVAIsoIDWP80,
-                        const std::vector<bool> &ele_passMVAIsoIDWP90,
-                        const std::vector<bool> &ele_passMVAIsoIDWPHZZ,
-                        const std::vector<bool> &ele_passMVAIsoIDWPLoose,
-                        const std::vector<bool> &ele_passMVANoIsoIDWP80,
-                        const std::vector<bool> &ele_passMVANoIsoIDWP90,
-                        const std::vector<bool> &ele_passMVANoIsoIDWPLoose,
-                        const std::vector<bool> &ele_PassConvVeto,
-                        const std::vector<float> &ele_OneOverEminusOneOverP,
-                        const std::vector<float> &muonE,
-                        const std::vector<float> &muonPt,
-                        const std::vector<float> &globalTrackMuonPt,
-                        const std::vector<float> &rescaledPtUpGlobalMuon,
-                        const std::vector<float> &rescaledPtDownGlobalMuon,
-                        const std::vector<float> &innerTrackMuonPt,
-                        const std::vector<float> &rescaledPtUpInnerMuon,
-                        const std::vector<float> &rescaledPtDownInnerMuon,
-                        const std::vector<float> &outerTrackMuonPt,
                         const float &triggerSystFactorUp, 
                         const float &triggerSystFactorDown, 
                         const float &muonTriggerSFsUpEff,
@@ -192,177 +129,7 @@ public:
                         const float &muonRecoSFsUpEff,
                         const float &muonRecoSFsDownEff,
                         const float &muonIdSFsUpEff,
-                        const float &muonIdSFsDownEff,
-                        const std::vector<float> &muonPtErr,
-                        const std::vector<float> &muonEta,
-                        const std::vector<float> &muonPhi,
-                        const std::vector<float> &muonBeta,
-                        const std::vector<int> &muonCharge,
-                        const std::vector<bool> &muonIsLoose,
-                        const std::vector<bool> &muonIsMedium,
-                        const std::vector<bool> &muonIsTight,
-                        const std::vector<float> &muon_d0,
-                        const std::vector<float> &muon_d0Err,
-                        const std::vector<float> &muon_dZ,
-                        const std::vector<float> &muon_ip3d,
-                        const std::vector<float> &muon_ip3dSignificance,
-                        const std::vector<unsigned int> &muonType,
-                        const std::vector<unsigned int> &muonQuality,
-                        const std::vector<float> &muon_pileupIso,
-                        const std::vector<float> &muon_chargedIso,
-                        const std::vector<float> &muon_photonIso,
-                        const std::vector<float> &muon_neutralHadIso,
-                        const std::vector<float> &muon_validFractionTrackerHits,
-                        const std::vector<float> &muon_normChi2,
-                        const std::vector<float> &muon_chi2LocalPosition,
-                        const std::vector<float> &muon_kinkFinder,
-                        const std::vector<float> &muon_segmentCompatability,
-                        const std::vector<float> &muon_trkIso,
-                        const std::vector<float> &muon_tuneP_Pt,
-                        const std::vector<float> &muon_tuneP_PtErr,
-                        const std::vector<float> &muon_tuneP_Eta,
-                        const std::vector<float> &muon_tuneP_Phi,
-                        const std::vector<int> &muon_tuneP_MuonBestTrackType,
-                        const std::vector<bool> &muon_isHighPtMuon,
-                        const std::vector<bool> &muon_isTrackerHighPtMuon,
-                        const std::vector<float> &vect_jet_pt,
-                        const std::vector<float> &vect_jet_eta,
-                        const std::vector<float> &vect_jet_phi,
-                        const std::vector<float> &vect_jet_mass,
-                        const std::vector<float> &vect_jet_energy,
-                        const std::vector<float> &vect_jet_pdgId,
-                        const std::vector<float> &vect_jet_et,
-                        const std::vector<float> &vect_jet_chargedEmEnergyFraction,
-                        const std::vector<float> &vect_jet_neutralEmEnergyFraction,
-                        const std::vector<float> &vect_jet_chargedHadronEnergyFraction,
-                        const std::vector<float> &vect_jet_neutralHadronEnergyFraction,
-                        const std::vector<float> &vect_jet_muonEnergyFraction,
-                        const std::vector<int> &vect_jet_chargedMultiplicity,
-                        const std::vector<int> &vect_jet_neutralMultiplicity,
-                        const std::vector<float> &vect_jet_jetArea,
-                        const std::vector<float> &vect_jet_pileupE,
-                        const std::vector<float> &vect_mT,
-                        const std::vector<bool> &passCutPt55,
-                        const std::vector<bool> &passPreselection,
-                        const std::vector<bool> &passPreselectionSept8,
-                        const std::vector<bool> &passPreselectionTrigSys,
-                        const std::vector<bool> &passSelection,
-                        const std::vector<bool> &isPFMuon,
-                        const std::vector<bool> &PFMuonPt,
-                        const std::vector<float> &Charge,
-                        const std::vector<float> &Pt,
-                        const std::vector<float> &PtErr,
-                        const std::vector<float> &Is_StripOnly,
-                        const std::vector<float> &Ias,
-                        const std::vector<float> &Ias_noTIBnoTIDno3TEC,
-                        const std::vector<float> &Ias_PixelOnly,
-                        const std::vector<float> &Ias_StripOnly,
-                        const std::vector<float> &Ias_PixelOnly_noL1,
-                        const std::vector<float> &Ih,
-                        const std::vector<float> &Ick,
-                        const std::vector<float> &Fmip,
-                        const std::vector<float> &ProbXY,
-                        const std::vector<float> &ProbXY_noL1,
-                        const std::vector<float> &ProbQ,
-                        const std::vector<float> &ProbQ_noL1,
-                        const std::vector<float> &Ndof,
-                        const std::vector<float> &Chi2,
-                        const std::vector<int>   &QualityMask,
-                        const std::vector<bool>  &isHighPurity,
-                        const std::vector<float>  &EoverP,
-                        const std::vector<bool>  &isMuon,
-                        const std::vector<bool>  &isGlobalMuon,
-                        const std::vector<bool>  &isPhoton,
-                        const std::vector<bool>  &isElectron,
-                        const std::vector<float>  &gsfFbremElectron,
-                        const std::vector<float>  &gsfMomentumElectron,
-                        const std::vector<float>  &PFMomentumElectron,
-                        const std::vector<bool>  &isChHadron,
-                        const std::vector<bool>  &isNeutHadron,
-                        const std::vector<bool>  &isPfTrack,
-                        const std::vector<bool>  &isUndefined,
-                        const std::vector<float> &ECAL_energy,
-                        const std::vector<float> &HCAL_energy,
-                        const std::vector<float> &TOF,
-                        const std::vector<float> &TOFErr,
-                        const std::vector<unsigned int> &TOF_ndof,
-                        const std::vector<float> &DTTOF,
-                        const std::vector<float> &DTTOFErr,
-                        const std::vector<unsigned int> &DTTOF_ndof,
-                        const std::vector<float> &CSCTOF,
-                        const std::vector<float> &CSCTOFErr,
-                        const std::vector<unsigned int> &CSCTOF_ndof,
-                        const std::vector<float> &Mass,
-                        const std::vector<float> &MassErr,
-                        const std::vector<float> &dZ,
-                        const std::vector<float> &dXY,
-                        const std::vector<float> &dR,
-                        const std::vector<float> &p,
-                        const std::vector<float> &eta,
-                        const std::vector<float> &phi,
-                        const std::vector<unsigned int> &noh,
-                        const std::vector<unsigned int> &noph,
-                        const std::vector<float> &fovh,
-                        const std::vector<unsigned int> &nomh,
-                        const std::vector<float> &fovhd,
-                        const std::vector<unsigned int> &nom,
-                        const std::vector<float> &matchTrigMuon_minDeltaR,
-                        const std::vector<float> &matchTrigMuon_pT,
-                        const std::vector<float> &iso_TK,
-                        const std::vector<float> &iso_ECAL,
-                        const std::vector<float> &iso_HCAL,
-                        const std::vector<float> &track_genTrackMiniIsoSumPt,
-                        const std::vector<float> &track_genTrackAbsIsoSumPtFix,
-                        const std::vector<float> &track_genTrackIsoSumPt_dr03,
-                        const std::vector<float> &PFMiniIso_relative,
-                        const std::vector<float> &PFMiniIso_wMuon_relative,
-                        const std::vector<float> &track_PFIsolationR005_sumChargedHadronPt,
-                        const std::vector<float> &track_PFIsolationR005_sumNeutralHadronPt,
-                        const std::vector<float> &track_PFIsolationR005_sumPhotonPt,
-                        const std::vector<float> &track_PFIsolationR005_sumPUPt,
-                        const std::vector<float> &track_PFIsolationR01_sumChargedHadronPt,
-                        const std::vector<float> &track_PFIsolationR01_sumNeutralHadronPt,
-                        const std::vector<float> &track_PFIsolationR01_sumPhotonPt,
-                        const std::vector<float> &track_PFIsolationR01_sumPUPt,
-                        const std::vector<float> &track_PFIsolationR03_sumChargedHadronPt,
-                        const std::vector<float> &track_PFIsolationR03_sumNeutralHadronPt,
-                        const std::vector<float> &track_PFIsolationR03_sumPhotonPt,
-                        const std::vector<float> &track_PFIsolationR03_sumPUPt,
-                        const std::vector<float> &track_PFIsolationR05_sumChargedHadronPt,
-                        const std::vector<float> &track_PFIsolationR05_sumNeutralHadronPt,
-                        const std::vector<float> &track_PFIsolationR05_sumPhotonPt,
-                        const std::vector<float> &track_PFIsolationR05_sumPUPt,
-                        const std::vector<float> &muon_PFIsolationR03_sumChargedHadronPt,
-                        const std::vector<float> &muon_PFIsolationR03_sumNeutralHadronPt,
-                        const std::vector<float> &muon_PFIsolationR03_sumPhotonPt,
-                        const std::vector<float> &muon_PFIsolationR03_sumPUPt,
-                        const std::vector<float> &Ih_noL1,
-                        const std::vector<float> &Ih_15drop,
-                        const std::vector<float> &Ih_StripOnly,
-                        const std::vector<float> &Ih_StripOnly_15drop,
-                        const std::vector<float> &Ih_PixelOnly_noL1,
-                        const std::vector<float> &Ih_SaturationCorrectionFromFits,
-                        const std::vector<std::vector<float>> &clust_charge,
-                        const std::vector<std::vector<float>> &clust_pathlength,
-                        const std::vector<std::vector<unsigned int>> &clust_nstrip,
-                        const std::vector<std::vector<bool>> &clust_sat254,
-                        const std::vector<std::vector<bool>> &clust_sat255,
-                        const std::vector<std::vector<uint32_t>> &clust_detid,
-                        const std::vector<std::vector<bool>> &clust_isStrip,
-                        const std::vector<std::vector<bool>> &clust_isPixel,
-                        const std::vector<float> &genid,
-                        const std::vector<float> &gencharge,
-                        const std::vector<float> &genmass,
-                        const std::vector<float> &genpt,
-                        const std::vector<float> &geneta,
-                        const std::vector<float> &genphi,
-                        const std::vector<float> &HSCP_tuneP_Pt,
-                        const std::vector<float> &HSCP_tuneP_PtErr,
-                        const std::vector<float> &HSCP_tuneP_Eta,
-                        const std::vector<float> &HSCP_tuneP_Phi,
-                        const std::vector<int> &HSCP_tuneP_MuonBestTrackType,
-                        const std::vector<int> &HSCP_ErrorHisto_bin,
-                        const std::vector<int> &HSCP_type);
+                        const float &muonIdSFsDownEff);
 
 
   void fillGenTreeBranches(Tuple *&tuple,
@@ -414,6 +181,8 @@ public:
                    float w,
                    bool allRegions);
 
+  void flushRegions(Tuple *&tuple);
+
   void writeRegions(Tuple *&tuple,
                     TFileDirectory &dir);
 };
@@ -425,6 +194,8 @@ public:
 //=============================================================
 
 void TupleMaker::initializeTuple(Tuple *&tuple,
+                                 TupleBlocks &blocks,
+                                 histoRegistry &histos,
                                  TFileDirectory &dir,
                                  unsigned int saveTree,
                                  bool calcSyst_,
@@ -558,7 +329,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   tuple->CutFlowReverse->GetXaxis()->SetBinLabel(14,"p_{T}");
   tuple->CutFlowReverse->GetXaxis()->SetBinLabel(15,"Trigger");
   
-  tuple->CutFlowProbQ =  dir.make<TH2F>("CutFlowProbQ", ";F_{i}^{pixels};",10, 0., 1.,17, -0.5, 16.5);
+  tuple->CutFlowProbQ.book(histos, dir, "CutFlowProbQ", ";F_{i}^{pixels};",10, 0., 1.,17, -0.5, 16.5);
   tuple->CutFlowProbQ->GetYaxis()->SetBinLabel(1,"Trigger");
   tuple->CutFlowProbQ->GetYaxis()->SetBinLabel(2,"p_{T}");
   tuple->CutFlowProbQ->GetYaxis()->SetBinLabel(3,"#eta");
@@ -575,7 +346,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   tuple->CutFlowProbQ->GetYaxis()->SetBinLabel(14,"#sigma_{p_{T}} / p_{T}^{2}");
   tuple->CutFlowProbQ->GetYaxis()->SetBinLabel(15,"F_{i}");
 
-  tuple->CutFlowIas = dir.make<TH2F>("CutFlowIas", ";G_{i}^{strips};", 10, 0., 1., 17, -0.5, 16.5);
+  tuple->CutFlowIas.book(histos, dir, "CutFlowIas", ";G_{i}^{strips};", 10, 0., 1., 17, -0.5, 16.5);
   tuple->CutFlowIas->GetYaxis()->SetBinLabel(1,"Trigger");
   tuple->CutFlowIas->GetYaxis()->SetBinLabel(2,"p_{T}");
   tuple->CutFlowIas->GetYaxis()->SetBinLabel(3,"#eta");
@@ -592,7 +363,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   tuple->CutFlowIas->GetYaxis()->SetBinLabel(14,"#sigma_{p_{T}} / p_{T}^{2}");
   tuple->CutFlowIas->GetYaxis()->SetBinLabel(15,"F_{i}");
   
-  tuple->CutFlowEta = dir.make<TH2F>("CutFlowEta", ";#eta;", 50, -2.6, 2.6, 17, -0.5, 16.5);
+  tuple->CutFlowEta.book(histos, dir, "CutFlowEta", ";#eta;", 50, -2.6, 2.6, 17, -0.5, 16.5);
   tuple->CutFlowEta->GetYaxis()->SetBinLabel(1,"Trigger");
   tuple->CutFlowEta->GetYaxis()->SetBinLabel(2,"p_{T}");
   tuple->CutFlowEta->GetYaxis()->SetBinLabel(3,"#eta");
@@ -609,7 +380,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   tuple->CutFlowEta->GetYaxis()->SetBinLabel(14,"#sigma_{p_{T}} / p_{T}^{2}");
   tuple->CutFlowEta->GetYaxis()->SetBinLabel(15,"F_{i}");
   
-  tuple->CutFlowEoP = dir.make<TH2F>("CutFlowEoP", ";PF calo energy / momentum;", 25, 0, 1.5, 17, -0.5, 16.5);
+  tuple->CutFlowEoP.book(histos, dir, "CutFlowEoP", ";PF calo energy / momentum;", 25, 0, 1.5, 17, -0.5, 16.5);
   tuple->CutFlowEoP->GetYaxis()->SetBinLabel(1,"Trigger");
   tuple->CutFlowEoP->GetYaxis()->SetBinLabel(2,"p_{T}");
   tuple->CutFlowEoP->GetYaxis()->SetBinLabel(3,"#eta");
@@ -626,7 +397,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   tuple->CutFlowEoP->GetYaxis()->SetBinLabel(14,"#sigma_{p_{T}} / p_{T}^{2}");
   tuple->CutFlowEoP->GetYaxis()->SetBinLabel(15,"F_{i}");
 
-  tuple->CutFlowPfType = dir.make<TH2F>("CutFlowPfType", ";;", 9, -0.5, 8.5, 17, -0.5, 16.5);
+  tuple->CutFlowPfType.book(histos, dir, "CutFlowPfType", ";;", 9, -0.5, 8.5, 17, -0.5, 16.5);
   tuple->CutFlowPfType->GetYaxis()->SetBinLabel(1,"Trigger");
   tuple->CutFlowPfType->GetYaxis()->SetBinLabel(2,"p_{T}");
   tuple->CutFlowPfType->GetYaxis()->SetBinLabel(3,"#eta");
@@ -653,7 +424,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   tuple->CutFlowPfType->GetXaxis()->SetBinLabel(8,"isUndefined");
   tuple->CutFlowPfType->GetXaxis()->SetBinLabel(9,"notPFtrack");
   
-  tuple->N1_FlowEta = dir.make<TH2F>("N1_FlowEta", ";#eta;", 50, -2.6, 2.6, 17, -0.5, 16.5);
+  tuple->N1_FlowEta.book(histos, dir, "N1_FlowEta", ";#eta;", 50, -2.6, 2.6, 17, -0.5, 16.5);
   tuple->N1_FlowEta->GetYaxis()->SetBinLabel(1,"Trigger");
   tuple->N1_FlowEta->GetYaxis()->SetBinLabel(2,"p_{T}");
   tuple->N1_FlowEta->GetYaxis()->SetBinLabel(3,"#eta");
@@ -699,14 +470,14 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
 
   tuple->N1_PtErrOverPt = dir.make<TH1F>("N1_PtErrOverPt", ";#sigma_{p_{T}}/p_{T};Tracks / 0.05", 40, 0., 2.);
   tuple->N1_PtErrOverPt2 = dir.make<TH1F>("N1_PtErrOverPt2", ";#sigma_{p_{T}}/p_{T}^{2};Tracks / 7.5e-5 ", 40, 0, 0.003);
-  tuple->N1_PtErrOverPtVsPt = dir.make<TH2F>("N1_PtErrOverPtVsPt", ";#sigma_{p_{T}}/p_{T};p_{T} [GeV]",  40, 0., 1., 40, 0., 4000.);
-  tuple->N1_PtErrOverPtVsPt_lowPt = dir.make<TH2F>("N1_PtErrOverPtVsPt_lowPt", ";#sigma_{p_{T}}/p_{T};p_{T} [GeV]",  40, 0., 1., 50, 0., 1000.);
-  tuple->N1_PtErrOverPtVsGenBeta = dir.make<TH2F>("N1_PtErrOverPtVsGenBeta", ";#sigma_{p_{T}}/p_{T};Gen #beta",  40, 0., 1., 100, 0., 1.);
-  tuple->N1_PtErrOverPt2VsIas =  dir.make<TH2F>("N1_PtErrOverPt2VsIas", ";#sigma_{p_{T}}/p_{T}^{2};G_{i}^{strips};Tracks", 40, 0., 0.003, 20, 0.,1.);
-  tuple->N1_PtErrOverPt2VsProbQNoL1 =  dir.make<TH2F>("N1_PtErrOverPt2VsProbQNoL1", ";#sigma_{p_{T}}/p_{T}^{2};prob_{Q} (pixels);Tracks", 40, 0., 0.003, 20, 0.,1.);
+  tuple->N1_PtErrOverPtVsPt.book(histos, dir, "N1_PtErrOverPtVsPt", ";#sigma_{p_{T}}/p_{T};p_{T} [GeV]",  40, 0., 1., 40, 0., 4000.);
+  tuple->N1_PtErrOverPtVsPt_lowPt.book(histos, dir, "N1_PtErrOverPtVsPt_lowPt", ";#sigma_{p_{T}}/p_{T};p_{T} [GeV]",  40, 0., 1., 50, 0., 1000.);
+  tuple->N1_PtErrOverPtVsGenBeta.book(histos, dir, "N1_PtErrOverPtVsGenBeta", ";#sigma_{p_{T}}/p_{T};Gen #beta",  40, 0., 1., 100, 0., 1.);
+  tuple->N1_PtErrOverPt2VsIas.book(histos, dir, "N1_PtErrOverPt2VsIas", ";#sigma_{p_{T}}/p_{T}^{2};G_{i}^{strips};Tracks", 40, 0., 0.003, 20, 0.,1.);
+  tuple->N1_PtErrOverPt2VsProbQNoL1.book(histos, dir, "N1_PtErrOverPt2VsProbQNoL1", ";#sigma_{p_{T}}/p_{T}^{2};prob_{Q} (pixels);Tracks", 40, 0., 0.003, 20, 0.,1.);
 
   tuple->N1_ProbQNoL1 = dir.make<TH1F>("N1_ProbQNoL1", ";F_{i}^{pixels};Tracks / 0.01", 40, 0., 1.);
-  tuple->N1_ProbQNoL1VsIas = dir.make<TH2F>("N1_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips}", 100, 0.0, 1.0, 100, 0.0, 1.0);
+  tuple->N1_ProbQNoL1VsIas.book(histos, dir, "N1_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips}", 100, 0.0, 1.0, 100, 0.0, 1.0);
   tuple->N1_ProbXY = dir.make<TH1F>("N1_ProbXY", ";ProbXY;Tracks / 0.01", 100, 0, 1);
   tuple->N1_MiniRelIsoAll = dir.make<TH1F>("N1_MiniRelIsoAll", ";MiniRelIsoAll;Tracks / 0.01",  150, 0.0, 1.5);
   tuple->N1_MiniRelIsoAll_lowMiniRelIso = dir.make<TH1F>("N1_MiniRelIsoAll_lowMiniRelIso", ";MiniRelIsoAll;Tracks / 0.0001",  100, 0.0, 0.1);
@@ -746,8 +517,8 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->BefTrig_ProbQNoL1 = dir.make<TH1F>("BefTrig_ProbQNoL1", ";F_{i}^{pixels};Tracks / 0.1", 10, 0., 1.);
     tuple->BefTrig_Ih = dir.make<TH1F>("BefTrig_Ih", ";I_{h} [MeV/cm]", 200, 0, dEdxM_UpLim);
     tuple->BefTrig_Ias = dir.make<TH1F>("BefTrig_Ias", ";G_{i}^{strips};Tracks / 0.05", 20, 0., 1.);
-    tuple->BefTrig_TriggerMuon50VsPt_lowPt = dir.make<TH2F>("BefTrig_TriggerMuon50VsPt_lowPt", ";Muon50 triggered;Track p_{T};Tracks / bin",2,-.5,1.5,40,-0.05,200.05);
-    tuple->BefTrig_TriggerMuonAllVsPt_lowPt = dir.make<TH2F>("BefTrig_TriggerMuonAllVsPt_lowPt", ";Muon50 triggered;Track p_{T};Tracks / bin",2,-.5,1.5,40,-0.05,200.05);
+    tuple->BefTrig_TriggerMuon50VsPt_lowPt.book(histos, dir, "BefTrig_TriggerMuon50VsPt_lowPt", ";Muon50 triggered;Track p_{T};Tracks / bin",2,-.5,1.5,40,-0.05,200.05);
+    tuple->BefTrig_TriggerMuonAllVsPt_lowPt.book(histos, dir, "BefTrig_TriggerMuonAllVsPt_lowPt", ";Muon50 triggered;Track p_{T};Tracks / bin",2,-.5,1.5,40,-0.05,200.05);
   }
   if (doBefPreSplots_) {
     tuple->BefPreS_TriggerMuonType = dir.make<TH1F>("BefPreS_TriggerMuonType", ";;Events / bin", 4,0.5,4.5);
@@ -759,14 +530,14 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->BefPreS_MatchedMuonPt25Pt = dir.make<TH1F>("BefPreS_MatchedMuonPt25Pt", ";p_{T}^{reco}_{#mu} [GeV] (p_{T} > 25);Events / 5 GeV", 40,-0.05,200.05);
     tuple->BefPreS_RelDiffMatchedMuonPtAndTrigObjPt = dir.make<TH1F>("BefPreS_RelDiffMatchedMuonPtAndTrigObjPt", ";( p_{T}^{reco}_{#mu} - p_{T}^{HLT}) / p_{T}^{HLT};Tracks / bin", 60,-1.0,2.0);
     tuple->BefPreS_RelDiffTrigObjPtAndMatchedMuonPt = dir.make<TH1F>("BefPreS_RelDiffTrigObjPtAndMatchedMuonPt", ";(p_{T}^{HLT} - p_{T}^{reco}_{#mu} ) /  p_{T}^{reco}_{#mu};Tracks / bin", 60,-1.0,2.0);
-    tuple->BefPreS_RelDiffTrigObjPtAndMatchedMuonPtVsPt = dir.make<TH2F>("BefPreS_RelDiffTrigObjPtAndMatchedMuonPtVsPt", ";(p_{T}^{HLT} - p_{T}^{reco}_{#mu} ) /  p_{T}^{reco}_{#mu};p_{T}^{reco}_{#mu}", 60,-1.0,2.0,40, 0., PtHistoUpperBound);
+    tuple->BefPreS_RelDiffTrigObjPtAndMatchedMuonPtVsPt.book(histos, dir, "BefPreS_RelDiffTrigObjPtAndMatchedMuonPtVsPt", ";(p_{T}^{HLT} - p_{T}^{reco}_{#mu} ) /  p_{T}^{reco}_{#mu};p_{T}^{reco}_{#mu}", 60,-1.0,2.0,40, 0., PtHistoUpperBound);
     tuple->BefPreS_NumPassedMatchingTrigObj = dir.make<TH1F>("BefPreS_NumPassedMatchingTrigObj", ";Trigger objects passing matching;Events / 1", 5, -0.5, 4.5);
     tuple->BefPreS_NumPassedMatchingTrigObjEtaCut = dir.make<TH1F>("BefPreS_NumPassedMatchingTrigObjEtaCut", ";Trigger objects passing matching and #eta < 1;Events / 1", 5, -0.5, 4.5);
     
     
     tuple->BefPreS_RelDiffMuonPtAndTrackPt = dir.make<TH1F>("BefPreS_RelDiffMuonPtAndTrackPt", ";(TuneP muon p_{T} - general track p_{T}) / general track p_{T};Tracks / bin", 60,-1.0,2.0);
-    tuple->BefPreS_MuonPtVsTrackPt = dir.make<TH2F>("BefPreS_MuonPtVsTrackPt", ";TuneP muon p_{T};general track p_{T};", 100, 0.0, 4000.0, 100, 0.0, 4000.0);
-    tuple->BefPreS_MuonPtOverGenPtVsTrackPtOverGenPt = dir.make<TH2F>("BefPreS_MuonPtOverGenPtVsTrackPtOverGenPt", ";TuneP muon p_{T}^{reco} / p_{T}^{gen};general track p_{T}^{reco} / p_{T}^{gen};", 20, 0.0, 3.0, 20, 0.0, 3.0);
+    tuple->BefPreS_MuonPtVsTrackPt.book(histos, dir, "BefPreS_MuonPtVsTrackPt", ";TuneP muon p_{T};general track p_{T};", 100, 0.0, 4000.0, 100, 0.0, 4000.0);
+    tuple->BefPreS_MuonPtOverGenPtVsTrackPtOverGenPt.book(histos, dir, "BefPreS_MuonPtOverGenPtVsTrackPtOverGenPt", ";TuneP muon p_{T}^{reco} / p_{T}^{gen};general track p_{T}^{reco} / p_{T}^{gen};", 20, 0.0, 3.0, 20, 0.0, 3.0);
     tuple->BefPreS_RelDiffMuonPtAndTruthPt = dir.make<TH1F>("BefPreS_RelDiffMuonPtAndTruthPt", ";(TuneP muon p_{T}^{reco} - p_{T}^{gen}) / p_{T}^{gen};", 60,-1.0,2.0);
     tuple->BefPreS_RelDiffTrackPtAndTruthPt = dir.make<TH1F>("BefPreS_RelDiffTrackPtAndTruthPt", ";(general track p_{T}^{reco} - p_{T}^{gen}) / p_{T}^{gen};", 60,-1.0,2.0);
     
@@ -810,11 +581,11 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->BefPreS_RecoHSCParticleType->GetXaxis()->SetBinLabel(5,"innerTrack");
     tuple->BefPreS_RecoHSCParticleType->GetXaxis()->SetBinLabel(6,"unknown");
 
-    tuple->BefPreS_GenPtVsdRMinGen = dir.make<TH2F>("BefPreS_GenPtVsdRMinGen", ";GenPt;dRMinGen", 40, 0., PtHistoUpperBound, 100, 0., 1.);
+    tuple->BefPreS_GenPtVsdRMinGen.book(histos, dir, "BefPreS_GenPtVsdRMinGen", ";GenPt;dRMinGen", 40, 0., PtHistoUpperBound, 100, 0., 1.);
     tuple->BefPreS_GendRMin = dir.make<TH1F>("BefPreS_GendRMin", ";dR_min;Gen candidate / 0.032",100,0.,3.2);
-    tuple->BefPreS_GenPtVsdRMinGenPostCut = dir.make<TH2F>("BefPreS_GenPtVsdRMinGenPostCut", ";GenPt [GeV];dRMinGen (after cut)", 40, 0., PtHistoUpperBound, 50, 0., 0.05);
-    tuple->BefPreS_GenPtVsGenMinPt = dir.make<TH2F>("BefPreS_GenPtVsGenMinPt", ";GenPtVsGenMinPt", 40, 0., PtHistoUpperBound, 100, 0, 1.);
-    tuple->BefPreS_GenPtVsRecoPt = dir.make<TH2F>("BefPreS_GenPtVsRecoPt", ";Generator p_{T} [GeV];Reco p_{T} [GeV]", 40, 0., PtHistoUpperBound, 40, 0., PtHistoUpperBound);
+    tuple->BefPreS_GenPtVsdRMinGenPostCut.book(histos, dir, "BefPreS_GenPtVsdRMinGenPostCut", ";GenPt [GeV];dRMinGen (after cut)", 40, 0., PtHistoUpperBound, 50, 0., 0.05);
+    tuple->BefPreS_GenPtVsGenMinPt.book(histos, dir, "BefPreS_GenPtVsGenMinPt", ";GenPtVsGenMinPt", 40, 0., PtHistoUpperBound, 100, 0, 1.);
+    tuple->BefPreS_GenPtVsRecoPt.book(histos, dir, "BefPreS_GenPtVsRecoPt", ";Generator p_{T} [GeV];Reco p_{T} [GeV]", 40, 0., PtHistoUpperBound, 40, 0., PtHistoUpperBound);
     
     tuple->BefPreS_RatioCleanAndAllStripsClu = dir.make<TH1F>("BefPreS_RatioCleanAndAllStripsClu",";Clean / all strips clu;Tracks / 0.05",20,-0.05,1.05);
     tuple->BefPreS_RatioCleanAndAllPixelClu = dir.make<TH1F>("BefPreS_RatioCleanAndAllPixelClu",";Clean / all pixel clu;Tracks / 0.05",20,-0.05,1.05);
@@ -931,113 +702,113 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->BefPreS_TOF_FailDz = dir.make<TH1F>("BefPreS_TOF_FailDz", ";TOF (FailDz;Tracks / 0.05", 120, -1, 5);
     tuple->BefPreS_TOF_FailDz_DT = dir.make<TH1F>("BefPreS_TOF_FailDz_DT", ";TOF (FailDz_DT;Tracks / 0.05", 120, -1, 5);
     tuple->BefPreS_TOF_FailDz_CSC = dir.make<TH1F>("BefPreS_TOF_FailDz_CSC", ";TOF (FailDz_CSC;Tracks / 0.05", 120, -1, 5);
-    tuple->BefPreS_GenPtVsRecoPt = dir.make<TH2F>("BefPreS_GenPtVsRecoPt", ";GenPt;RecoPt;Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 40, 0., PtHistoUpperBound);
-    tuple->BefPreS_PtErrOverPtVsPt = dir.make<TH2F>("BefPreS_PtErrOverPtVsPt",  ";#sigma_{p_{T}}/p_{T};p_{T};Tracks / bin",  40, 0., 1., 40, 0., 4000);
-    tuple->BefPreS_PtErrOverPtVsPtErrOverPt2 = dir.make<TH2F>("BefPreS_PtErrOverPtVsPtErrOverPt2",  ";#sigma_{p_{T}}/p_{T};p_{T}^{2};Tracks / bin",  40, 0., 1., 40, 0., 0.003);
+    tuple->BefPreS_GenPtVsRecoPt.book(histos, dir, "BefPreS_GenPtVsRecoPt", ";GenPt;RecoPt;Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 40, 0., PtHistoUpperBound);
+    tuple->BefPreS_PtErrOverPtVsPt.book(histos, dir, "BefPreS_PtErrOverPtVsPt",  ";#sigma_{p_{T}}/p_{T};p_{T};Tracks / bin",  40, 0., 1., 40, 0., 4000);
+    tuple->BefPreS_PtErrOverPtVsPtErrOverPt2.book(histos, dir, "BefPreS_PtErrOverPtVsPtErrOverPt2",  ";#sigma_{p_{T}}/p_{T};p_{T}^{2};Tracks / bin",  40, 0., 1., 40, 0., 0.003);
 
     tuple->BefPreS_ProbQ = dir.make<TH1F>("BefPreS_ProbQ", ";F_{i}^{pixels};Tracks / bin", 100, 0, 1);
     tuple->BefPreS_ProbXY = dir.make<TH1F>("BefPreS_ProbXY", ";Prob_{XY} (pixels);Tracks / bin", 100, 0, 1);
     tuple->BefPreS_ProbQNoL1 = dir.make<TH1F>("BefPreS_ProbQNoL1", ";F_{i}^{pixels};Tracks / bin", 100, 0, 1);
     tuple->BefPreS_ProbXYNoL1 = dir.make<TH1F>("BefPreS_ProbXYNoL1", ";Prob_{XY} (pixels, no-L1);Tracks / bin", 100, 0, 1);
     tuple->BefPreS_MassErr = dir.make<TH1F>("BefPreS_MassErr", ";MassErr/Mass;Tracks / bin", 50, 0., 10.);
-    tuple->BefPreS_ProbQVsIas = dir.make<TH2F>("BefPreS_ProbQVsIas", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin", 100, 0.0, 1.0, 100, 0.0, 1.0);
-
-    tuple->BefPreS_EtaVsIas = dir.make<TH2F>("BefPreS_EtaVsIas", ";#eta;G_{i}^{strips};Tracks / bin", 50, -3, 3, 10, 0., 1.);
-    tuple->BefPreS_EtaVsIh = dir.make<TH2F>("BefPreS_EtaVsIh", ";#eta;I_{h} [MeV/cm];Tracks / bin", 50, -3, 3, 100, 0, dEdxM_UpLim);
-    tuple->BefPreS_EtaVsP = dir.make<TH2F>("BefPreS_EtaVsP", ";#eta;P [GeV];Tracks / bin", 50, -3, 3, 40, 0., PtHistoUpperBound);
-    tuple->BefPreS_EtaVsPt = dir.make<TH2F>("BefPreS_EtaVsPt", ";#eta;p_{T} [GeV];Tracks / bin", 50, -3, 3, 40, 0., PtHistoUpperBound);
-    tuple->BefPreS_EtaVsTOF = dir.make<TH2F>("BefPreS_EtaVsTOF", ";#eta;TOF;Tracks / bin", 50, -3, 3, 50, 0., 3);
-    tuple->BefPreS_EtaVsNBH = dir.make<TH2F>("BefPreS_EtaVsNBH", ";#eta;Number of bad hits;Tracks / bin", 60, -3., 3., 24, 0., 24.);
-    tuple->BefPreS_EtaVsDz = dir.make<TH2F>("BefPreS_EtaVsDz", ";#eta;D_{z} [cm];Tracks / bin", 50, -3, 3, 50, -IPbound, IPbound);
-    tuple->BefPreS_PVsIas = dir.make<TH2F>("BefPreS_PVsIas", ";P;G_{i}^{strips};Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 100, 0, dEdxS_UpLim);
-    tuple->BefPreS_IhVsIas = dir.make<TH2F>("BefPreS_IhVsIas", ";I_{h} [MeV/cm];G_{i}^{strips};Tracks / bin", 50, 0., dEdxM_UpLim, 20, 0, dEdxS_UpLim);
-    tuple->BefPreS_PVsIh = dir.make<TH2F>("BefPreS_PVsIh", ";P;I_{h} [MeV/cm];Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 50, 0., dEdxM_UpLim);
-
-    tuple->PostPreS_PVsIh = dir.make<TH2F>("PostPreS_PVsIh", ";P;I_{h} [MeV/cm];Tracks / 80 GeV", 800, 0., PtHistoUpperBound, 1000, 0., dEdxM_UpLim);
-    tuple->PostPreS_PVsIhCutSigptAndIsoMass = dir.make<TH2F>("PostPreS_PVsIhCutSigptAndIsoMass", ";P;I_{h} [MeV/cm];Tracks / 80 GeV", 800, 0., PtHistoUpperBound, 1000, 0., dEdxM_UpLim);
-    tuple->PostPreS_genPVsIh = dir.make<TH2F>("PostPreS_genPVsIh", ";gen P;I_{h} [MeV/cm];Tracks / 80 GeV", 800, 0., PtHistoUpperBound, 1000, 0., dEdxM_UpLim);
-
-    tuple->BefPreS_PtVsIas = dir.make<TH2F>("BefPreS_PtVsIas", ";p_{T} [GeV];G_{i}^{strips};Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 10, 0., 1.);
-    tuple->BefPreS_PtVsIh = dir.make<TH2F>("BefPreS_PtVsIh", ";p_{T} [GeV];I_{h} [MeV/cm];Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 100, 0, dEdxM_UpLim);
-    tuple->BefPreS_PtVsTOF = dir.make<TH2F>("BefPreS_PtVsTOF", ";Pt;TOF;Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 50, 0., 5);
+    tuple->BefPreS_ProbQVsIas.book(histos, dir, "BefPreS_ProbQVsIas", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin", 100, 0.0, 1.0, 100, 0.0, 1.0);
+
+    tuple->BefPreS_EtaVsIas.book(histos, dir, "BefPreS_EtaVsIas", ";#eta;G_{i}^{strips};Tracks / bin", 50, -3, 3, 10, 0., 1.);
+    tuple->BefPreS_EtaVsIh.book(histos, dir, "BefPreS_EtaVsIh", ";#eta;I_{h} [MeV/cm];Tracks / bin", 50, -3, 3, 100, 0, dEdxM_UpLim);
+    tuple->BefPreS_EtaVsP.book(histos, dir, "BefPreS_EtaVsP", ";#eta;P [GeV];Tracks / bin", 50, -3, 3, 40, 0., PtHistoUpperBound);
+    tuple->BefPreS_EtaVsPt.book(histos, dir, "BefPreS_EtaVsPt", ";#eta;p_{T} [GeV];Tracks / bin", 50, -3, 3, 40, 0., PtHistoUpperBound);
+    tuple->BefPreS_EtaVsTOF.book(histos, dir, "BefPreS_EtaVsTOF", ";#eta;TOF;Tracks / bin", 50, -3, 3, 50, 0., 3);
+    tuple->BefPreS_EtaVsNBH.book(histos, dir, "BefPreS_EtaVsNBH", ";#eta;Number of bad hits;Tracks / bin", 60, -3., 3., 24, 0., 24.);
+    tuple->BefPreS_EtaVsDz.book(histos, dir, "BefPreS_EtaVsDz", ";#eta;D_{z} [cm];Tracks / bin", 50, -3, 3, 50, -IPbound, IPbound);
+    tuple->BefPreS_PVsIas.book(histos, dir, "BefPreS_PVsIas", ";P;G_{i}^{strips};Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 100, 0, dEdxS_UpLim);
+    tuple->BefPreS_IhVsIas.book(histos, dir, "BefPreS_IhVsIas", ";I_{h} [MeV/cm];G_{i}^{strips};Tracks / bin", 50, 0., dEdxM_UpLim, 20, 0, dEdxS_UpLim);
+    tuple->BefPreS_PVsIh.book(histos, dir, "BefPreS_PVsIh", ";P;I_{h} [MeV/cm];Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 50, 0., dEdxM_UpLim);
+
+    tuple->PostPreS_PVsIh.book(histos, dir, "PostPreS_PVsIh", ";P;I_{h} [MeV/cm];Tracks / 80 GeV", 800, 0., PtHistoUpperBound, 1000, 0., dEdxM_UpLim);
+    tuple->PostPreS_PVsIhCutSigptAndIsoMass.book(histos, dir, "PostPreS_PVsIhCutSigptAndIsoMass", ";P;I_{h} [MeV/cm];Tracks / 80 GeV", 800, 0., PtHistoUpperBound, 1000, 0., dEdxM_UpLim);
+    tuple->PostPreS_genPVsIh.book(histos, dir, "PostPreS_genPVsIh", ";gen P;I_{h} [MeV/cm];Tracks / 80 GeV", 800, 0., PtHistoUpperBound, 1000, 0., dEdxM_UpLim);
+
+    tuple->BefPreS_PtVsIas.book(histos, dir, "BefPreS_PtVsIas", ";p_{T} [GeV];G_{i}^{strips};Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 10, 0., 1.);
+    tuple->BefPreS_PtVsIh.book(histos, dir, "BefPreS_PtVsIh", ";p_{T} [GeV];I_{h} [MeV/cm];Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 100, 0, dEdxM_UpLim);
+    tuple->BefPreS_PtVsTOF.book(histos, dir, "BefPreS_PtVsTOF", ";Pt;TOF;Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 50, 0., 5);
       //tuple->BefPreS_TOFIs = dir.make<TH2F>("BefPreS_TOFIs", ";TOFIs", 100, 1, 5, 100, 0, dEdxS_UpLim);
-    tuple->BefPreS_TOFVsIs = dir.make<TH2F>("BefPreS_TOFVsIs", ";TOF;G_{i}^{strips};Tracks / bin", 50, 0., 5, 10, 0., 1.);
+    tuple->BefPreS_TOFVsIs.book(histos, dir, "BefPreS_TOFVsIs", ";TOF;G_{i}^{strips};Tracks / bin", 50, 0., 5, 10, 0., 1.);
       //tuple->BefPreS_TOFIm = dir.make<TH2F>("BefPreS_TOFIh", ";TOFIh", 100, 1, 5, 100, 0, dEdxM_UpLim);
-    tuple->BefPreS_TOFVsIh = dir.make<TH2F>("BefPreS_TOFVsIh", ";TOF;I_{h} [MeV/cm];Tracks / bin", 50, 0., 5, 100, 0, dEdxM_UpLim);
+    tuple->BefPreS_TOFVsIh.book(histos, dir, "BefPreS_TOFVsIh", ";TOF;I_{h} [MeV/cm];Tracks / bin", 50, 0., 5, 100, 0, dEdxM_UpLim);
 
     tuple->BefPreS_CluProbHasFilled = dir.make<TH1F>("BefPreS_CluProbHasFilled", ";;Clusters / category", 2, -0.5, 1.5);
     tuple->BefPreS_CluProbHasFilled->GetXaxis()->SetBinLabel(1,"ProbHasFailed");
     tuple->BefPreS_CluProbHasFilled->GetXaxis()->SetBinLabel(2,"ProbHasFilled");
 
-    tuple->BefPreS_CluProbQVsPixelLayer = dir.make<TH2F>("BefPreS_CluProbQVsPixelLayer", ";Cluster Prob_{Q} (pixels);Layer",20,0.,1.,4,0.,4.);
-    tuple->BefPreS_CluProbXYVsPixelLayer = dir.make<TH2F>("BefPreS_CluProbXYVsPixelLayer", ";Cluster Prob_{XZ} (pixels);Layer",100,0.,1.,4,0.,4.);
-    tuple->BefPreS_CluNormChargeVsPixelLayer = dir.make<TH2F>("BefPreS_CluNormChargeVsPixelLayer", ";CluNormCharge (e/um);Layer",100,0.,600.,4,0.,4.);
-    tuple->BefPreS_CluNormChargeVsPixelLayer_lowBetaGamma = dir.make<TH2F>("BefPreS_CluNormChargeVsPixelLayer_lowBetaGamma", ";CluNormCharge (e/um);Layer",100,0.,600.,4,0.,4.);
-    tuple->BefPreS_CluSizeVsPixelLayer = dir.make<TH2F>("BefPreS_CluSizeVsPixelLayer", ";CluSize;Layer",10,0.,10.,4,0.,4.);
-    tuple->BefPreS_CluSizeXVsPixelLayer = dir.make<TH2F>("BefPreS_CluSizeXVsPixelLayer", ";CluSizeX;Layer",10,0.,10.,4,0.,4.);
-    tuple->BefPreS_CluSizeYVsPixelLayer = dir.make<TH2F>("BefPreS_CluSizeYVsPixelLayer", ";CluSizeY;Layer",10,0.,10.,4,0.,4.);
-    tuple->BefPreS_CluSpecInCPEVsPixelLayer = dir.make<TH2F>("BefPreS_CluSpecInCPEVsPixelLayer", ";CluSpecInCPE;Layer",4,0.,4.,4,0.,4.);
-
-    tuple->BefPreS_CluCotBetaVsPixelLayer_lowProbXY = dir.make<TH2F>("BefPreS_CluCotBetaVsPixelLayer_lowProbXY", ";CotBeta;Layer",200,-10.,10.,4,0.,4.);
-    tuple->BefPreS_CluCotAlphaVsPixelLayer_lowProbXY = dir.make<TH2F>("BefPreS_CluCotAlphaVsPixelLayer_lowProbXY", ";CotAlpha;Layer",100,-1.,1.,4,0.,4.);
-    tuple->BefPreS_CluCotBetaVsPixelLayer = dir.make<TH2F>("BefPreS_CluCotBetaVsPixelLayer", ";CotBeta;Layer",200,-10.,10.,4,0.,4.);
-    tuple->BefPreS_CluCotAlphaVsPixelLayer = dir.make<TH2F>("BefPreS_CluCotAlphaVsPixelLayer", ";CotAlpha;Layer",100,-1.,1.,4,0.,4.);
-
-    tuple->BefPreS_CluNormChargeVsStripLayer_lowBetaGamma = dir.make<TH2F>("BefPreS_CluNormChargeVsStripLayer_lowBetaGamma", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
-    tuple->BefPreS_CluNormChargeVsStripLayer_higherBetaGamma = dir.make<TH2F>("BefPreS_CluNormChargeVsStripLayer_higherBetaGamma", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
-    tuple->BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_Stat91 = dir.make<TH2F>("BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_Stat91", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
-    tuple->BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatNot91 = dir.make<TH2F>("BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatNot91", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
-    tuple->BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatHigherThan2 = dir.make<TH2F>("BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatHigherThan2", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
+    tuple->BefPreS_CluProbQVsPixelLayer.book(histos, dir, "BefPreS_CluProbQVsPixelLayer", ";Cluster Prob_{Q} (pixels);Layer",20,0.,1.,4,0.,4.);
+    tuple->BefPreS_CluProbXYVsPixelLayer.book(histos, dir, "BefPreS_CluProbXYVsPixelLayer", ";Cluster Prob_{XZ} (pixels);Layer",100,0.,1.,4,0.,4.);
+    tuple->BefPreS_CluNormChargeVsPixelLayer.book(histos, dir, "BefPreS_CluNormChargeVsPixelLayer", ";CluNormCharge (e/um);Layer",100,0.,600.,4,0.,4.);
+    tuple->BefPreS_CluNormChargeVsPixelLayer_lowBetaGamma.book(histos, dir, "BefPreS_CluNormChargeVsPixelLayer_lowBetaGamma", ";CluNormCharge (e/um);Layer",100,0.,600.,4,0.,4.);
+    tuple->BefPreS_CluSizeVsPixelLayer.book(histos, dir, "BefPreS_CluSizeVsPixelLayer", ";CluSize;Layer",10,0.,10.,4,0.,4.);
+    tuple->BefPreS_CluSizeXVsPixelLayer.book(histos, dir, "BefPreS_CluSizeXVsPixelLayer", ";CluSizeX;Layer",10,0.,10.,4,0.,4.);
+    tuple->BefPreS_CluSizeYVsPixelLayer.book(histos, dir, "BefPreS_CluSizeYVsPixelLayer", ";CluSizeY;Layer",10,0.,10.,4,0.,4.);
+    tuple->BefPreS_CluSpecInCPEVsPixelLayer.book(histos, dir, "BefPreS_CluSpecInCPEVsPixelLayer", ";CluSpecInCPE;Layer",4,0.,4.,4,0.,4.);
+
+    tuple->BefPreS_CluCotBetaVsPixelLayer_lowProbXY.book(histos, dir, "BefPreS_CluCotBetaVsPixelLayer_lowProbXY", ";CotBeta;Layer",200,-10.,10.,4,0.,4.);
+    tuple->BefPreS_CluCotAlphaVsPixelLayer_lowProbXY.book(histos, dir, "BefPreS_CluCotAlphaVsPixelLayer_lowProbXY", ";CotAlpha;Layer",100,-1.,1.,4,0.,4.);
+    tuple->BefPreS_CluCotBetaVsPixelLayer.book(histos, dir, "BefPreS_CluCotBetaVsPixelLayer", ";CotBeta;Layer",200,-10.,10.,4,0.,4.);
+    tuple->BefPreS_CluCotAlphaVsPixelLayer.book(histos, dir, "BefPreS_CluCotAlphaVsPixelLayer", ";CotAlpha;Layer",100,-1.,1.,4,0.,4.);
+
+    tuple->BefPreS_CluNormChargeVsStripLayer_lowBetaGamma.book(histos, dir, "BefPreS_CluNormChargeVsStripLayer_lowBetaGamma", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
+    tuple->BefPreS_CluNormChargeVsStripLayer_higherBetaGamma.book(histos, dir, "BefPreS_CluNormChargeVsStripLayer_higherBetaGamma", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
+    tuple->BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_Stat91.book(histos, dir, "BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_Stat91", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
+    tuple->BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatNot91.book(histos, dir, "BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatNot91", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
+    tuple->BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatHigherThan2.book(histos, dir, "BefPreS_CluNormChargeVsStripLayer_higherBetaGamma_StatHigherThan2", ";CluNormCharge;Layer",600,0.,600.,24,-0.5,23.5);
 
     tuple->BefPreS_dRMinPfJet = dir.make<TH1F>("BefPreS_dRMinPfJet", ";dRMinPfJet;Tracks / bin",100,0.,5.0);
-    tuple->BefPreS_dRMinPfJetVsIas =  dir.make<TH2F>("BefPreS_dRMinPfJetVsIas", ";dRMinPfJet;G_{i}^{strips};Tracks / bin",100,0.,5.0,10,0.,1.);
+    tuple->BefPreS_dRMinPfJetVsIas.book(histos, dir, "BefPreS_dRMinPfJetVsIas", ";dRMinPfJet;G_{i}^{strips};Tracks / bin",100,0.,5.0,10,0.,1.);
     tuple->BefPreS_dRMinCaloJet= dir.make<TH1F>("BefPreS_dRMinCaloJet", ";dRMinCaloJet;Tracks / bin",100,0.,5.0);
-    tuple->BefPreS_dRMinCaloJetVsIas =  dir.make<TH2F>("BefPreS_dRMinCaloJetVsIas", ";dRMinCaloJet;G_{i}^{strips};Tracks / bin",100,0.,5.0,10,0.,1.);
-    tuple->BefPreS_genGammaBetaVsProbXYNoL1 =  dir.make<TH2F>("BefPreS_genGammaBetaVsProbXYNoL1", ";#gamma #beta;ProbXYNoL1",10,0.,1.3,20,0.,1.);
-    tuple->BefPreS_dRVsPtPfJet = dir.make<TH2F>("BefPreS_dRVsPtPfJet", ";dR(cand,jet);p_{T} [GeV]",100,0.,1.5,100,0.,1000.);
-    tuple->BefPreS_dRVsdPtPfCaloJet = dir.make<TH2F>("BefPreS_dRVsdPtPfCaloJet", ";dRmin;dPtPfCaloJet",100,0.,1.5,20,0.,100.);
+    tuple->BefPreS_dRMinCaloJetVsIas.book(histos, dir, "BefPreS_dRMinCaloJetVsIas", ";dRMinCaloJet;G_{i}^{strips};Tracks / bin",100,0.,5.0,10,0.,1.);
+    tuple->BefPreS_genGammaBetaVsProbXYNoL1.book(histos, dir, "BefPreS_genGammaBetaVsProbXYNoL1", ";#gamma #beta;ProbXYNoL1",10,0.,1.3,20,0.,1.);
+    tuple->BefPreS_dRVsPtPfJet.book(histos, dir, "BefPreS_dRVsPtPfJet", ";dR(cand,jet);p_{T} [GeV]",100,0.,1.5,100,0.,1000.);
+    tuple->BefPreS_dRVsdPtPfCaloJet.book(histos, dir, "BefPreS_dRVsdPtPfCaloJet", ";dRmin;dPtPfCaloJet",100,0.,1.5,20,0.,100.);
     tuple->BefPreS_GenBeta = dir.make<TH1F>("BefPreS_GenBeta", ";#beta;Tracks / bin", 20, 0., 1.);
     tuple->BefPreS_NumCandidates = dir.make<TH1F>("BefPreS_NumCandidates", ";Number of HSCP candidates;Events / bin", 11, -0.5, 10.5);
     
-    tuple->BefPreS_TriggerMuon50VsBeta = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaA = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaA", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaA_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaA_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaA_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaA_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaB = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaB", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaB_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaB_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaB_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaB_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaC = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaC", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaC_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaC_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaC_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaC_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaD = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaD", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaD_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaD_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaD_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaD_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaE = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaE", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaE_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaE_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaE_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaE_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaF = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaF", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaF_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaF_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuon50VsBeta_EtaF_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuon50VsBeta_EtaF_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta.book(histos, dir, "BefPreS_TriggerMuon50VsBeta", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaA.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaA", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaA_BetaUp.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaA_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaA_BetaDown.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaA_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaB.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaB", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaB_BetaUp.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaB_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaB_BetaDown.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaB_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaC.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaC", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaC_BetaUp.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaC_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaC_BetaDown.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaC_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaD.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaD", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaD_BetaUp.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaD_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaD_BetaDown.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaD_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaE.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaE", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaE_BetaUp.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaE_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaE_BetaDown.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaE_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaF.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaF", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaF_BetaUp.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaF_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuon50VsBeta_EtaF_BetaDown.book(histos, dir, "BefPreS_TriggerMuon50VsBeta_EtaF_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
-    tuple->BefPreS_TriggerMuonAllVsBeta = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaA = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaA", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaA_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaA_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaA_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaA_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaB = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaB", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaB_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaB_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaB_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaB_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaC = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaC", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaC_BetaUp = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaC_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMuonAllVsBeta_EtaC_BetaDown = dir.make<TH2F>("BefPreS_TriggerMuonAllVsBeta_EtaC_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaA.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaA", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaA_BetaUp.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaA_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaA_BetaDown.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaA_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaB.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaB", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaB_BetaUp.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaB_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaB_BetaDown.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaB_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaC.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaC", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaC_BetaUp.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaC_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMuonAllVsBeta_EtaC_BetaDown.book(histos, dir, "BefPreS_TriggerMuonAllVsBeta_EtaC_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
-    tuple->BefPreS_TriggerMuon50VsPt = dir.make<TH2F>("BefPreS_TriggerMuon50VsPt", ";Muon50 triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
-    tuple->BefPreS_TriggerMuonAllVsPt = dir.make<TH2F>("BefPreS_TriggerMuonAllVsPt", ";MuonAll triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
-
-    tuple->BefPreS_TriggerMETallVsBeta = dir.make<TH2F>("BefPreS_TriggerMETallVsBeta", ";OR of MET triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->BefPreS_TriggerMETallVsMet = dir.make<TH2F>("BefPreS_TriggerMETallVsMet", ";OR of MET triggered;MET [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05);
-    tuple->BefPreS_TriggerMETallVsHT = dir.make<TH2F>("BefPreS_TriggerMETallVsHT", ";OR of MET triggered;H_{T} [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05);
-    tuple->BefPreS_TriggerMETallVsMetOverHt = dir.make<TH2F>("BefPreS_TriggerMETallVsMetOverHt", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
-    tuple->BefPreS_TriggerMETallVsMetVsHT = dir.make<TH3F>("BefPreS_TriggerMETallVsMetVsHT", ";OR of MET triggered;MET [GeV];H_{T} [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05,50,-0.05,2000.05);
+    tuple->BefPreS_TriggerMuon50VsPt.book(histos, dir, "BefPreS_TriggerMuon50VsPt", ";Muon50 triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
+    tuple->BefPreS_TriggerMuonAllVsPt.book(histos, dir, "BefPreS_TriggerMuonAllVsPt", ";MuonAll triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
+
+    tuple->BefPreS_TriggerMETallVsBeta.book(histos, dir, "BefPreS_TriggerMETallVsBeta", ";OR of MET triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->BefPreS_TriggerMETallVsMet.book(histos, dir, "BefPreS_TriggerMETallVsMet", ";OR of MET triggered;MET [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05);
+    tuple->BefPreS_TriggerMETallVsHT.book(histos, dir, "BefPreS_TriggerMETallVsHT", ";OR of MET triggered;H_{T} [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05);
+    tuple->BefPreS_TriggerMETallVsMetOverHt.book(histos, dir, "BefPreS_TriggerMETallVsMetOverHt", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
+    tuple->BefPreS_TriggerMETallVsMetVsHT.book(histos, dir, "BefPreS_TriggerMETallVsMetVsHT", ";OR of MET triggered;MET [GeV];H_{T} [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05,50,-0.05,2000.05);
     tuple->BefPreS_TriggerTimingPass = dir.make<TH1F>("BefPreS_TriggerTimingPass", ";#Delta t_{PV,DT L2} [ns] (trigger passed);Tracks / bin", 100, 0.0, 100);
     tuple->BefPreS_TriggerTimingReject = dir.make<TH1F>("BefPreS_TriggerTimingReject", ";#Delta t_{PV,DT L2} [ns] (trigger rejected);Tracks / bin", 100, 0.0, 100);
     
@@ -1046,7 +817,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   } // end condition on bef pre plots
   
   if (createGiTemplates_ && sampleType_ < 2) {
-    tuple->Calibration_GiTemplate =  dir.make<TH3F>("Calibration_GiTemplate", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
+    tuple->Calibration_GiTemplate.book(histos, dir, "Calibration_GiTemplate", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
     tuple->Calibration_GiTemplate->GetXaxis()->SetBinLabel(1,"IB1");
     tuple->Calibration_GiTemplate->GetXaxis()->SetBinLabel(2,"IB2");
     tuple->Calibration_GiTemplate->GetXaxis()->SetBinLabel(3,"OB1");
@@ -1063,7 +834,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->Calibration_GiTemplate->GetXaxis()->SetBinLabel(14,"W7");
     tuple->Calibration_GiTemplate->GetXaxis()->SetBinLabel(15,"Pixels");
 
-    tuple->Calibration_GiTemplate_PU_1 =  dir.make<TH3F>("Calibration_GiTemplate_PU_1", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
+    tuple->Calibration_GiTemplate_PU_1.book(histos, dir, "Calibration_GiTemplate_PU_1", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
     tuple->Calibration_GiTemplate_PU_1->GetXaxis()->SetBinLabel(1,"IB1");
     tuple->Calibration_GiTemplate_PU_1->GetXaxis()->SetBinLabel(2,"IB2");
     tuple->Calibration_GiTemplate_PU_1->GetXaxis()->SetBinLabel(3,"OB1");
@@ -1079,7 +850,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->Calibration_GiTemplate_PU_1->GetXaxis()->SetBinLabel(13,"W6");
     tuple->Calibration_GiTemplate_PU_1->GetXaxis()->SetBinLabel(14,"W7");
     tuple->Calibration_GiTemplate_PU_1->GetXaxis()->SetBinLabel(15,"Pixels");
-    tuple->Calibration_GiTemplate_PU_2 =  dir.make<TH3F>("Calibration_GiTemplate_PU_2", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
+    tuple->Calibration_GiTemplate_PU_2.book(histos, dir, "Calibration_GiTemplate_PU_2", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
     tuple->Calibration_GiTemplate_PU_2->GetXaxis()->SetBinLabel(1,"IB1");
     tuple->Calibration_GiTemplate_PU_2->GetXaxis()->SetBinLabel(2,"IB2");
     tuple->Calibration_GiTemplate_PU_2->GetXaxis()->SetBinLabel(3,"OB1");
@@ -1095,7 +866,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->Calibration_GiTemplate_PU_2->GetXaxis()->SetBinLabel(13,"W6");
     tuple->Calibration_GiTemplate_PU_2->GetXaxis()->SetBinLabel(14,"W7");
     tuple->Calibration_GiTemplate_PU_2->GetXaxis()->SetBinLabel(15,"Pixels");
-    tuple->Calibration_GiTemplate_PU_3 =  dir.make<TH3F>("Calibration_GiTemplate_PU_3", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
+    tuple->Calibration_GiTemplate_PU_3.book(histos, dir, "Calibration_GiTemplate_PU_3", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
     tuple->Calibration_GiTemplate_PU_3->GetXaxis()->SetBinLabel(1,"IB1");
     tuple->Calibration_GiTemplate_PU_3->GetXaxis()->SetBinLabel(2,"IB2");
     tuple->Calibration_GiTemplate_PU_3->GetXaxis()->SetBinLabel(3,"OB1");
@@ -1111,7 +882,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->Calibration_GiTemplate_PU_3->GetXaxis()->SetBinLabel(13,"W6");
     tuple->Calibration_GiTemplate_PU_3->GetXaxis()->SetBinLabel(14,"W7");
     tuple->Calibration_GiTemplate_PU_3->GetXaxis()->SetBinLabel(15,"Pixels");
-    tuple->Calibration_GiTemplate_PU_4 =  dir.make<TH3F>("Calibration_GiTemplate_PU_4", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
+    tuple->Calibration_GiTemplate_PU_4.book(histos, dir, "Calibration_GiTemplate_PU_4", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
     tuple->Calibration_GiTemplate_PU_4->GetXaxis()->SetBinLabel(1,"IB1");
     tuple->Calibration_GiTemplate_PU_4->GetXaxis()->SetBinLabel(2,"IB2");
     tuple->Calibration_GiTemplate_PU_4->GetXaxis()->SetBinLabel(3,"OB1");
@@ -1127,7 +898,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->Calibration_GiTemplate_PU_4->GetXaxis()->SetBinLabel(13,"W6");
     tuple->Calibration_GiTemplate_PU_4->GetXaxis()->SetBinLabel(14,"W7");
     tuple->Calibration_GiTemplate_PU_4->GetXaxis()->SetBinLabel(15,"Pixels");
-    tuple->Calibration_GiTemplate_PU_5 =  dir.make<TH3F>("Calibration_GiTemplate_PU_5", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
+    tuple->Calibration_GiTemplate_PU_5.book(histos, dir, "Calibration_GiTemplate_PU_5", ";Module geometry;Path lenght (mm);Path normalised charge (ke / cm)", 15, 1.0, 16.0, 42, 0.2, 1.6, 500, 0.0, 5000.0);
     tuple->Calibration_GiTemplate_PU_5->GetXaxis()->SetBinLabel(1,"IB1");
     tuple->Calibration_GiTemplate_PU_5->GetXaxis()->SetBinLabel(2,"IB2");
     tuple->Calibration_GiTemplate_PU_5->GetXaxis()->SetBinLabel(3,"OB1");
@@ -1148,8 +919,8 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   if (doPostPreSplots_) {
     tuple->PostPreS_NumCandidates = dir.make<TH1F>("PostPreS_NumCandidates", ";Number of HSCP candidates;Events / bin", 11, -0.5, 10.5);
     tuple->PostPreS_RelDiffMuonPtAndTrackPt = dir.make<TH1F>("PostPreS_RelDiffMuonPtAndTrackPt", ";(TuneP muon p_{T} - general track p_{T}) / general track p_{T};Tracks / bin", 60,-1.0,2.0);
-    tuple->PostPreS_MuonPtVsTrackPt = dir.make<TH2F>("PostPreS_MuonPtVsTrackPt", ";TuneP muon p_{T};general track p_{T};", 100, 0.0, 4000.0, 100, 0.0, 4000.0);
-    tuple->PostPreS_MuonPtOverGenPtVsTrackPtOverGenPt = dir.make<TH2F>("PostPreS_MuonPtOverGenPtVsTrackPtOverGenPt", ";TuneP muon p_{T} / p_{T}^{gen};general track p_{T} / p_{T}^{gen};", 20, 0.0, 3.0, 20, 0.0, 3.0);
+    tuple->PostPreS_MuonPtVsTrackPt.book(histos, dir, "PostPreS_MuonPtVsTrackPt", ";TuneP muon p_{T};general track p_{T};", 100, 0.0, 4000.0, 100, 0.0, 4000.0);
+    tuple->PostPreS_MuonPtOverGenPtVsTrackPtOverGenPt.book(histos, dir, "PostPreS_MuonPtOverGenPtVsTrackPtOverGenPt", ";TuneP muon p_{T} / p_{T}^{gen};general track p_{T} / p_{T}^{gen};", 20, 0.0, 3.0, 20, 0.0, 3.0);
     
     tuple->PostPreS_RelDiffMuonPtAndTruthPt = dir.make<TH1F>("PostPreS_RelDiffMuonPtAndTruthPt", ";(TuneP muon p_{T} - p_{T}^{gen}) / p_{T}^{gen};Tracks / bin", 60,-1.0,2.0);
     tuple->PostPreS_RelDiffTrackPtAndTruthPt = dir.make<TH1F>("PostPreS_RelDiffTrackPtAndTruthPt", ";(general track p_{T} - p_{T}^{gen}) / p_{T}^{gen};Tracks / bin", 60,-1.0,2.0);
@@ -1180,7 +951,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_PfType->GetXaxis()->SetBinLabel(8,"isUndefined");
     tuple->PostPreS_PfType->GetXaxis()->SetBinLabel(9,"notPFtrack");
 
-    tuple->PostPreS_PfTypeVsIas = dir.make<TH2F>("PostPreS_PfTypeVsIas", ";;G_{i}^{strips}", 9, -0.5, 8.5,20,0.,1.);
+    tuple->PostPreS_PfTypeVsIas.book(histos, dir, "PostPreS_PfTypeVsIas", ";;G_{i}^{strips}", 9, -0.5, 8.5,20,0.,1.);
     tuple->PostPreS_PfType->GetXaxis()->SetBinLabel(1,"AllTracks");
     tuple->PostPreS_PfType->GetXaxis()->SetBinLabel(2,"PFtracks");
     tuple->PostPreS_PfType->GetXaxis()->SetBinLabel(3,"isElectron");
@@ -1193,10 +964,10 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
 
     tuple->PostPreS_MassT = dir.make<TH1F>("PostPreS_MassT", ";m_{T} [GeV];Tracks / 5 GeV", 50, 0.0, 250.0);
     tuple->PostPreS_MassT_highMassT = dir.make<TH1F>("PostPreS_MassT_highMassT", ";m_{T} [GeV];Tracks / 10 GeV", 250, 0.0, 2500.0);
-    tuple->PostPreS_MassTVsIas = dir.make<TH2F>("PostPreS_MassTVsIas", ";m_{T} [GeV];G_{i}^{strips}",50, 0.0, 250.0, 20, 0., 1.);
+    tuple->PostPreS_MassTVsIas.book(histos, dir, "PostPreS_MassTVsIas", ";m_{T} [GeV];G_{i}^{strips}",50, 0.0, 250.0, 20, 0., 1.);
 
     tuple->PostPreS_MiniRelIsoAll = dir.make<TH1F>("PostPreS_MiniRelIsoAll", ";MiniRelIsoAll;Tracks / 0.001", 100, 0.0, 0.1);
-    tuple->PostPreS_MiniRelIsoAllVsIas =  dir.make<TH2F>("PostPreS_MiniRelIsoAllVsIas",";MiniRelIsoAll;G_{i}^{strips}", 100, 0.0, 0.1, 10, 0.,1.);
+    tuple->PostPreS_MiniRelIsoAllVsIas.book(histos, dir, "PostPreS_MiniRelIsoAllVsIas",";MiniRelIsoAll;G_{i}^{strips}", 100, 0.0, 0.1, 10, 0.,1.);
     tuple->PostPreS_MiniRelIsoChg = dir.make<TH1F>("PostPreS_MiniRelIsoChg", ";MiniRelIsoChg;Tracks / 0.01",  150, 0.0, 1.5);
     tuple->PostPreS_MiniTkIso = dir.make<TH1F>("PostPreS_MiniTkIso", ";MiniTkIso [GeV];Tracks / 0.05", 100, 0.0, 50.);
     tuple->PostPreS_MiniRelTkIso = dir.make<TH1F>("PostPreS_MiniRelTkIso", ";MiniRelTkIso;Tracks / 0.01", 150, 0.0, 1.5);
@@ -1205,7 +976,7 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_RecoPFHT = dir.make<TH1F>("PostPreS_RecoPFHT", ";RecoPFHT [GeV];Tracks / 10 GeV",  200, 0.0, 2000.0);
     tuple->PostPreS_CaloJetsNum = dir.make<TH1F>("PostPreS_CaloJetsNum", ";Number of calo jets;Tracks / 1",  16, -0.5, 15.5);
     tuple->PostPreS_Chi2oNdof = dir.make<TH1F>("PostPreS_Chi2oNdof", ";#chi^{2}/N_{dof};Tracks / 1", 20, 0, 20);
-    tuple->PostPreS_Chi2oNdofVsIas = dir.make<TH2F>("PostPreS_Chi2oNdofVsIas", ";#chi^{2}/Ndof;G_{i}^{strips}",20, 0, 20,10,0.,1.);
+    tuple->PostPreS_Chi2oNdofVsIas.book(histos, dir, "PostPreS_Chi2oNdofVsIas", ";#chi^{2}/Ndof;G_{i}^{strips}",20, 0, 20,10,0.,1.);
     tuple->PostPreS_Qual = dir.make<TH1F>("PostPreS_Qual", ";;Tracks / category", 2, -0.5, 1.5);
     tuple->PostPreS_Qual->GetXaxis()->SetBinLabel(1,"Not-HighPurity");
     tuple->PostPreS_Qual->GetXaxis()->SetBinLabel(2,"HighPurity");
@@ -1214,40 +985,40 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_TNOH_PUB = dir.make<TH1F>("PostPreS_TNOH_PUB", ";Number of hits (mid PU);Tracks / 1", 40, -0.5, 39.5);
     tuple->PostPreS_TNOH_PUC = dir.make<TH1F>("PostPreS_TNOH_PUC", ";Number of hits (high PU);Tracks / 1", 40, -0.5, 39.5);
     tuple->PostPreS_TNOHFraction = dir.make<TH1F>("PostPreS_TNOHFraction", ";Number of valid hit fraction;Tracks / 0.05", 20, 0, 1);
-    tuple->PostPreS_TNOHFractionVsIas = dir.make<TH2F>("PostPreS_TNOHFractionVsIas",";TNOHFraction;Ias;Tracks",20, 0., 1.,10,0.,1.);
+    tuple->PostPreS_TNOHFractionVsIas.book(histos, dir, "PostPreS_TNOHFractionVsIas",";TNOHFraction;Ias;Tracks",20, 0., 1.,10,0.,1.);
     tuple->PostPreS_TNOPH = dir.make<TH1F>( "PostPreS_TNOPH", ";Number of pixel hits;Tracks / 1", 8, -0.5, 7.5);
     tuple->PostPreS_RatioCleanAndAllStripsClu = dir.make<TH1F>("PostPreS_RatioCleanAndAllStripsClu",";Clean / all strips clu;Tracks / 0.05",20,-0.05,1.05);
-    tuple->PostPreS_RatioCleanAndAllStripsCluVsIas = dir.make<TH2F>("PostPreS_RatioCleanAndAllStripsCluVsIas",";Clean / all strips clu;G_{i}^{strips};Tracks / 0.05",20,-0.05,1.05,20,0.,1.);
+    tuple->PostPreS_RatioCleanAndAllStripsCluVsIas.book(histos, dir, "PostPreS_RatioCleanAndAllStripsCluVsIas",";Clean / all strips clu;G_{i}^{strips};Tracks / 0.05",20,-0.05,1.05,20,0.,1.);
     tuple->PostPreS_RatioCleanAndAllPixelClu = dir.make<TH1F>("PostPreS_RatioCleanAndAllPixelClu",";Clean / all pixel clu;Tracks / 0.05",20,-0.05,1.05);
     
-    tuple->PostPreS_TNOPHVsIas = dir.make<TH2F>("PostPreS_TNOPHVsIas", ";_TNOPH;G_{i}^{strips}", 8,-0.5, 7.5, 20, 0., 1.);
+    tuple->PostPreS_TNOPHVsIas.book(histos, dir, "PostPreS_TNOPHVsIas", ";_TNOPH;G_{i}^{strips}", 8,-0.5, 7.5, 20, 0., 1.);
     tuple->PostPreS_TNOHFractionTillLast = dir.make<TH1F>("PostPreS_TNOHFractionTillLast", ";TNOHFractionTillLast;Tracks / 0.05", 20, 0., 1.);
     tuple->PostPreS_TNOMHTillLast = dir.make<TH1F>("PostPreS_TNOMHTillLast", ";TNOMHTillLast;Tracks / 1", 20, -0.5, 19.5);
     tuple->PostPreS_Eta = dir.make<TH1F>("PostPreS_Eta", ";#eta;Tracks / 0.05", 52, -2.6, 2.6);
-    tuple->PostPreS_EtaVsIas =  dir.make<TH2F>("PostPreS_EtaVsIas", ";#eta;G_{i}^{strips};Tracks / 0.05", 52, -2.6, 2.6, 20,0.,1.);
+    tuple->PostPreS_EtaVsIas.book(histos, dir, "PostPreS_EtaVsIas", ";#eta;G_{i}^{strips};Tracks / 0.05", 52, -2.6, 2.6, 20,0.,1.);
     tuple->PostPreS_TNOM = dir.make<TH1F>("PostPreS_TNOM", ";Number of measurement;Tracks / 1", 40, -0.5, 39.5);
-    tuple->PostPreS_TNOMVsIas = dir.make<TH2F>("PostPreS_TNOMVsIas", ";Number of measurement;G_{i}^{strips}",  40, -0.5, 39.5, 20, 0., 1.);
-    tuple->PostPreS_EtaVsNBH = dir.make<TH2F>("PostPreS_EtaVsNBH", ";#eta;Number of bad hits;Tracks / bin", 60, -3., 3., 24, 0., 24.);
+    tuple->PostPreS_TNOMVsIas.book(histos, dir, "PostPreS_TNOMVsIas", ";Number of measurement;G_{i}^{strips}",  40, -0.5, 39.5, 20, 0., 1.);
+    tuple->PostPreS_EtaVsNBH.book(histos, dir, "PostPreS_EtaVsNBH", ";#eta;Number of bad hits;Tracks / bin", 60, -3., 3., 24, 0., 24.);
     tuple->PostPreS_TNOM_PUA = dir.make<TH1F>("PostPreS_TNOM_PUA",  ";Number of measurement (low PU);Tracks / 1", 40, -0.5, 39.5);
     tuple->PostPreS_TNOM_PUB = dir.make<TH1F>("PostPreS_TNOM_PUB",  ";Number of measurement (mid PU);Tracks / 1",  40, -0.5, 39.5);
     tuple->PostPreS_TNOM_PUC = dir.make<TH1F>("PostPreS_TNOM_PUB",  ";Number of measurement (high PU);Tracks / 1",  40, -0.5, 39.5);
     tuple->PostPreS_nDof = dir.make<TH1F>("PostPreS_nDof", ";nDof;Tracks / 1",  40, -0.5, 39.5);
     tuple->PostPreS_TOFError = dir.make<TH1F>("PostPreS_TOFError", ";TOFError;Tracks / 0.01", 25, 0, 0.25);
     tuple->PostPreS_PtErrOverPt = dir.make<TH1F>("PostPreS_PtErrOverPt", ";#sigma_{p_{T}}/p_{T};Tracks / 0.05", 40, 0., 2.);
-    tuple->PostPreS_PtErrOverPtVsIas =  dir.make<TH2F>("PostPreS_PtErrOverPtVsIas", ";#sigma_{p_{T}}/p_{T};G_{i}^{strips};Tracks / bin", 40, 0, 1, 20, 0.,1.);
-    tuple->PostPreS_PtErrOverPt2VsIas =  dir.make<TH2F>("PostPreS_PtErrOverPt2VsIas", ";#sigma_{p_{T}}/p_{T}^{2};G_{i}^{strips};Tracks / bin", 40, 0., 0.003, 20, 0.,1.);
+    tuple->PostPreS_PtErrOverPtVsIas.book(histos, dir, "PostPreS_PtErrOverPtVsIas", ";#sigma_{p_{T}}/p_{T};G_{i}^{strips};Tracks / bin", 40, 0, 1, 20, 0.,1.);
+    tuple->PostPreS_PtErrOverPt2VsIas.book(histos, dir, "PostPreS_PtErrOverPt2VsIas", ";#sigma_{p_{T}}/p_{T}^{2};G_{i}^{strips};Tracks / bin", 40, 0., 0.003, 20, 0.,1.);
     tuple->PostPreS_PtErrOverPt2 = dir.make<TH1F>("PostPreS_PtErrOverPt2", ";#sigma_{p_{T}}/p_{T}^{2};Tracks / bin", 40, 0, 0.003);
     tuple->PostPreS_Pt = dir.make<TH1F>("PostPreS_Pt", ";p_{T} [GeV];Tracks / 100 GeV", 40, 0., PtHistoUpperBound);
     tuple->PostPreS_Pt_lowPt = dir.make<TH1F>("PostPreS_Pt_lowPt", ";p_{T} [GeV];Tracks / 10 GeV", 50, 0., 500.);
-    tuple->PostPreS_PtVsIas = dir.make<TH2F>("PostPreS_PtVsIas",";p_{T};G_{i}^{strips};Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 20, 0., 1.);
+    tuple->PostPreS_PtVsIas.book(histos, dir, "PostPreS_PtVsIas",";p_{T};G_{i}^{strips};Tracks / 80 GeV", 40, 0., PtHistoUpperBound, 20, 0., 1.);
     tuple->PostPreS_Ias_CR = dir.make<TH1F>("PostPreS_Ias_CR", ";G_{i}^{strips};Tracks / 0.1", 10, 0, dEdxS_UpLim);
     tuple->PostPreS_Ih_CR= dir.make<TH1F>("PostPreS_Ih_CR", ";I_{h} [MeV/cm]", 200, 0, dEdxM_UpLim);
 //    tuple->PostPreS_Ihstrip_CR= dir.make<TH1F>("PostPreS_Ihstrip_CR", ";I_{h} (strip only) [MeV/cm]", 200, 0, dEdxM_UpLim);
     tuple->PostPreS_Ih_noL1_CR= dir.make<TH1F>("PostPreS_Ih_noL1_CR", ";I_{h} (no L1) [MeV/cm]", 200, 0, dEdxM_UpLim);
     tuple->PostPreS_Ih_nopixcl_CR= dir.make<TH1F>("PostPreS_Ih_nopixcl_CR", ";I_{h}(no pix cleaning) [MeV/cm]", 200, 0, dEdxM_UpLim);
     tuple->PostPreS_Pt_lowPt_CR = dir.make<TH1F>("PostPreS_Pt_lowPt_CR", ";p_{T} [GeV];Tracks / 10 GeV", 50, 0., 500.);
-    tuple->PostPreS_MassVsIas_fail_CR= dir.make<TH2F>("PostPreS_MassVsIas_fail_CR", ";G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 400.);
-    tuple->PostPreS_MassVsIas_pass_CR= dir.make<TH2F>("PostPreS_MassVsIas_pass_CR", ";G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 400.);
+    tuple->PostPreS_MassVsIas_fail_CR.book(histos, dir, "PostPreS_MassVsIas_fail_CR", ";G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 400.);
+    tuple->PostPreS_MassVsIas_pass_CR.book(histos, dir, "PostPreS_MassVsIas_pass_CR", ";G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 400.);
 
 
     tuple->PostPreS_Ias_CR_veryLowPt = dir.make<TH1F>("PostPreS_Ias_CR_veryLowPt", ";G_{i}^{strips};Tracks / 0.1", 10, 0, dEdxS_UpLim);
@@ -1256,21 +1027,21 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_Ias_NoEventWeight = dir.make<TH1F>("PostPreS_Ias_NoEventWeight", ";G_{i}^{strips} (NoEventWeight);Tracks / 0.1", 10, 0, dEdxS_UpLim);
     tuple->PostPreS_FiStrips_NoEventWeight = dir.make<TH1F>("PostPreS_FiStrips_NoEventWeight", ";F_{i}^{strips} (NoEventWeight);Tracks / 0.05", 20, 0., 1.);
     tuple->PostPreS_Ih = dir.make<TH1F>("PostPreS_Ih", ";I_{h} [MeV/cm]", 200, 0, dEdxM_UpLim);
-    tuple->PostPreS_IhVsIas = dir.make<TH2F>("PostPreS_IhVsIas",";I_{h} [MeV/cm];G_{i}^{strips}",200, 0, dEdxM_UpLim, 20, 0.,1.);
+    tuple->PostPreS_IhVsIas.book(histos, dir, "PostPreS_IhVsIas",";I_{h} [MeV/cm];G_{i}^{strips}",200, 0, dEdxM_UpLim, 20, 0.,1.);
     tuple->PostPreS_Ih_NoEventWeight = dir.make<TH1F>("PostPreS_Ih_NoEventWeight", ";I_{h} (NoEventWeight) [MeV/cm];Tracks / bin", 200, 0, dEdxM_UpLim);
     tuple->PostPreS_MTOF = dir.make<TH1F>("PostPreS_MTOF", ";MTOF;Tracks / bin", 50, -2, 5);
     tuple->PostPreS_TIsol = dir.make<TH1F>("PostPreS_TIsol", ";#Sigma_{R<0.3} p_{T} - p_{T,cand} [GeV];Tracks / 4 GeV", 25, 0, 100);
-    tuple->PostPreS_TIsolVsIas = dir.make<TH2F>("PostPreS_TIsolVsIas","TIsol;Cluster G_{i}^{strips};Tracks / bin",25, 0, 100, 10, 0., 1.);
+    tuple->PostPreS_TIsolVsIas.book(histos, dir, "PostPreS_TIsolVsIas","TIsol;Cluster G_{i}^{strips};Tracks / bin",25, 0, 100, 10, 0., 1.);
     tuple->PostPreS_EoP = dir.make<TH1F>("PostPreS_EoP", ";PF calo energy / momentum; Tracks / 0.06", 25, 0, 1.5);
     tuple->PostPreS_ECalEoP = dir.make<TH1F>("PostPreS_ECalEoP", ";PF ECal energy / momentum; Tracks / 0.06", 25, 0, 1.5);
     tuple->PostPreS_HCalEoP = dir.make<TH1F>("PostPreS_HCalEoP", ";PF HCal energy / momentum; Tracks / 0.06", 25, 0, 1.5);
-    tuple->PostPreS_EoPVsIas = dir.make<TH2F>("PostPreS_EoPVsIas","PostPreS_EoPVsIas;PF E/p;G_{i}^{strips}",25, 0, 1.5, 20, 0.,1.);
+    tuple->PostPreS_EoPVsIas.book(histos, dir, "PostPreS_EoPVsIas","PostPreS_EoPVsIas;PF E/p;G_{i}^{strips}",25, 0, 1.5, 20, 0.,1.);
     tuple->PostPreS_SumpTOverpT = dir.make<TH1F>("PostPreS_SumpTOverpT", ";SumpTOverpT", 80, 0.0, 2.0);
-    tuple->PostPreS_SumpTOverpTVsIas = dir.make<TH2F>("PostPreS_SumpTOverpTVsIas",";SumpTOverpT;G_{i}^{strips}", 80, 0.0, 2.0, 20, 0.,1.);
+    tuple->PostPreS_SumpTOverpTVsIas.book(histos, dir, "PostPreS_SumpTOverpTVsIas",";SumpTOverpT;G_{i}^{strips}", 80, 0.0, 2.0, 20, 0.,1.);
     tuple->PostPreS_LastHitDXY = dir.make<TH1F>("PostPreS_LastHitDXY", ";LastHitDXY;Tracks / bin", 75, 0, 150);
-    tuple->PostPreS_LastHitDXYVsEta  = dir.make<TH2F>("PostPreS_LastHitDXYVsEta","PostPreS_LastHitDXYVsEta;LastHitDXY;#eta", 75, 0, 150, 20, 0.,1.);
+    tuple->PostPreS_LastHitDXYVsEta.book(histos, dir, "PostPreS_LastHitDXYVsEta","PostPreS_LastHitDXYVsEta;LastHitDXY;#eta", 75, 0, 150, 20, 0.,1.);
     tuple->PostPreS_LastHitD3D = dir.make<TH1F>("PostPreS_LastHitD3D", ";LastHitD3D", 175, 0, 350);
-    tuple->PostPreS_LastHitD3DVsEta = dir.make<TH2F>("PostPreS_LastHitD3DVsEta","PostPreS_LastHitD3DVsEta;LastHitD3D;#eta", 175, 0, 350, 20, 0.,1.);
+    tuple->PostPreS_LastHitD3DVsEta.book(histos, dir, "PostPreS_LastHitD3DVsEta","PostPreS_LastHitD3DVsEta;LastHitD3D;#eta", 175, 0, 350, 20, 0.,1.);
     tuple->PostPreS_P = dir.make<TH1F>("PostPreS_P", ";Momentum [GeV];Tracks / 100 GeV", 40, 0., PtHistoUpperBound);
     tuple->PostPreS_dR_NVTrack = dir.make<TH1F>("PostPreS_dR_NVTrack", ";dR_NVTrack;Tracks / 0.025", 40, 0, 1);
     tuple->PostPreS_MatchedStations = dir.make<TH1F>("PostPreS_MatchedStations", ";MatchedStations",8, -0.5, 7.5);
@@ -1287,11 +1058,11 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_NOMoNOH = dir.make<TH1F>("PostPreS_NOMoNOH", ";Num of measurment / num of hits;Tracks / bin",10,0.,1.0);
     tuple->PostPreS_NOMoNOHvsPV = dir.make<TProfile>("PostPreS_NOMoNOHvsPV", ";NOMoNOHvsPV", 60, 0, 60);
     tuple->PostPreS_Dz = dir.make<TH1F>( "PostPreS_Dz", ";d_{z} [cm];Tracks / 0.003 cm", 200, -0.3, 0.3);
-    tuple->PostPreS_DzVsIas = dir.make<TH2F>( "PostPreS_DzVsIas", ";d_{z} [cm];G_{i}^{strips};Tracks", 200, -0.3, 0.3, 20, 0.0, 1.0);
-    tuple->PostPreS_DzVsGenID = dir.make<TH2F>( "PostPreS_DzVsGenID", ";d_{z} [cm];GenID;Tracks", 200, -0.3, 0.3, 4000, 0.0, 4000.0);
+    tuple->PostPreS_DzVsIas.book(histos, dir, "PostPreS_DzVsIas", ";d_{z} [cm];G_{i}^{strips};Tracks", 200, -0.3, 0.3, 20, 0.0, 1.0);
+    tuple->PostPreS_DzVsGenID.book(histos, dir, "PostPreS_DzVsGenID", ";d_{z} [cm];GenID;Tracks", 200, -0.3, 0.3, 4000, 0.0, 4000.0);
     tuple->PostPreS_Dxy = dir.make<TH1F>("PostPreS_Dxy", ";d_{xy} [cm];Tracks / 0.001 cm", 200, -0.1, 0.1);
-    tuple->PostPreS_DxyVsIas = dir.make<TH2F>("PostPreS_DxyVsIas", ";d_{xy} [cm];G_{i}^{strips};Tracks", 200, -0.1, 0.1, 20, 0.0, 1.0);
-    tuple->PostPreS_DxyVsGenID = dir.make<TH2F>("PostPreS_DxyVsGenID", ";d_{xy} [cm];GenID;Tracks", 200, -0.1, 0.1, 4000, 0.0, 4000.0);
+    tuple->PostPreS_DxyVsIas.book(histos, dir, "PostPreS_DxyVsIas", ";d_{xy} [cm];G_{i}^{strips};Tracks", 200, -0.1, 0.1, 20, 0.0, 1.0);
+    tuple->PostPreS_DxyVsGenID.book(histos, dir, "PostPreS_DxyVsGenID", ";d_{xy} [cm];GenID;Tracks", 200, -0.1, 0.1, 4000, 0.0, 4000.0);
 
     tuple->PostPreS_SegSep = dir.make<TH1F>("PostPreS_SegSep", ";SegSep;Tracks / bin", 50, 0., 2.5);
     tuple->PostPreS_SegMinEtaSep = dir.make<TH1F>("PostPreS_SegMinEtaSep", ";SegMinEtaSep;Tracks / bin", 50, -1., 1.);
@@ -1305,10 +1076,10 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_Dz_CSC = dir.make<TH1F>("PostPreS_Dz_CSC", ";Dz_CSC;Tracks / bin", 150, -IPbound, IPbound);
     tuple->PostPreS_Dz_DT = dir.make<TH1F>("PostPreS_Dz_DT", ";Dz_DT;Tracks / bin", 150, -IPbound, IPbound);
 
-    tuple->BefPreS_RUN_vs_TOF_2017 = dir.make<TH2F>("BefPreS_RUN_vs_TOF_2017", ";RUN;TOF", 10500, 296000.5, 306500.5,40,0.5,1.5);
-    tuple->BefPreS_RUN_vs_TOF_2018 = dir.make<TH2F>("BefPreS_RUN_vs_TOF_2018", ";RUN;TOF", 11000, 315000.5, 326000.5,40,0.5,1.5);
-    tuple->PostPreS_RUN_vs_TOF_2017 = dir.make<TH2F>("PostPreS_RUN_vs_TOF_2017", ";RUN;TOF", 10500, 296000.5, 306500.5,40,0.5,1.5);
-    tuple->PostPreS_RUN_vs_TOF_2018 = dir.make<TH2F>("PostPreS_RUN_vs_TOF_2018", ";RUN;TOF", 11000, 315000.5, 326000.5,40,0.5,1.5);
+    tuple->BefPreS_RUN_vs_TOF_2017.book(histos, dir, "BefPreS_RUN_vs_TOF_2017", ";RUN;TOF", 10500, 296000.5, 306500.5,40,0.5,1.5);
+    tuple->BefPreS_RUN_vs_TOF_2018.book(histos, dir, "BefPreS_RUN_vs_TOF_2018", ";RUN;TOF", 11000, 315000.5, 326000.5,40,0.5,1.5);
+    tuple->PostPreS_RUN_vs_TOF_2017.book(histos, dir, "PostPreS_RUN_vs_TOF_2017", ";RUN;TOF", 10500, 296000.5, 306500.5,40,0.5,1.5);
+    tuple->PostPreS_RUN_vs_TOF_2018.book(histos, dir, "PostPreS_RUN_vs_TOF_2018", ";RUN;TOF", 11000, 315000.5, 326000.5,40,0.5,1.5);
 
 
 
@@ -1318,29 +1089,29 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_TOF_FailDz = dir.make<TH1F>("PostPreS_TOF_FailDz", ";TOF (FailDz;Tracks / 0.05", 120, -1, 5);
     tuple->PostPreS_TOF_FailDz_DT = dir.make<TH1F>("PostPreS_TOF_FailDz_DT", ";TOF (FailDz_DT;Tracks / 0.05", 120, -1, 5);
     tuple->PostPreS_TOF_FailDz_CSC = dir.make<TH1F>("PostPreS_TOF_FailDz_CSC", ";TOF (FailDz_CSC;Tracks / 0.05", 120, -1, 5);
-    tuple->PostPreS_PtErrOverPtVsPtErrOverPt2 = dir.make<TH2F>("PostPreS_PtErrOverPtVsPtErrOverPt2",  ";#sigma_{p_{T}}/p_{T};p_{T}^{2}",  40, 0., 1., 40, 0., 0.003);
-    tuple->PostPreS_PtErrOverPtVsPt = dir.make<TH2F>("PostPreS_PtErrOverPtVsPt",  ";#sigma_{p_{T}}/p_{T};p_{T}",  40, 0., 1., 40, 0., 4000);
-    tuple->PostPreS_GenPtVsRecoPt = dir.make<TH2F>("PostPreS_GenPtVsRecoPt", ";p_{T}^{gen} [GeV];p_{T}^{reco} [GeV]", 40, 0., PtHistoUpperBound, 40, 0., PtHistoUpperBound);
+    tuple->PostPreS_PtErrOverPtVsPtErrOverPt2.book(histos, dir, "PostPreS_PtErrOverPtVsPtErrOverPt2",  ";#sigma_{p_{T}}/p_{T};p_{T}^{2}",  40, 0., 1., 40, 0., 0.003);
+    tuple->PostPreS_PtErrOverPtVsPt.book(histos, dir, "PostPreS_PtErrOverPtVsPt",  ";#sigma_{p_{T}}/p_{T};p_{T}",  40, 0., 1., 40, 0., 4000);
+    tuple->PostPreS_GenPtVsRecoPt.book(histos, dir, "PostPreS_GenPtVsRecoPt", ";p_{T}^{gen} [GeV];p_{T}^{reco} [GeV]", 40, 0., PtHistoUpperBound, 40, 0., PtHistoUpperBound);
 
     tuple->PostPreS_ProbQ = dir.make<TH1F>("PostPreS_ProbQ", ";F_{i}^{pixels};Tracks / 0.01", 100, 0., 1.);
-    tuple->PostPreS_ProbQVsIas = dir.make<TH2F>("PostPreS_ProbQVsIas", ";F_{i}^{pixels};G_{i}^{strips}", 100, 0., 1., 100, 0., 1.);
-    tuple->PostPreS_IhVsProbQNoL1VsIas = dir.make<TH3F>("PostPreS_IhVsProbQVsIas", ";I_{h} [MeV/cm];F_{i}^{pixels};G_{i}^{strips}",200, 0, dEdxM_UpLim, 100, 0.0, 1.0, 100, 0.0, 1.0);
-    tuple->PostPreS_MomentumVsProbQNoL1VsIas = dir.make<TH3F>("PostPreS_MomentumVsProbQVsIas", ";p [GeV];F_{i}^{pixels};G_{i}^{strips}", 40, 0., PtHistoUpperBound, 100, 0.0, 1.0, 100, 0.0, 1.0);
+    tuple->PostPreS_ProbQVsIas.book(histos, dir, "PostPreS_ProbQVsIas", ";F_{i}^{pixels};G_{i}^{strips}", 100, 0., 1., 100, 0., 1.);
+    tuple->PostPreS_IhVsProbQNoL1VsIas.book(histos, dir, "PostPreS_IhVsProbQVsIas", ";I_{h} [MeV/cm];F_{i}^{pixels};G_{i}^{strips}",200, 0, dEdxM_UpLim, 100, 0.0, 1.0, 100, 0.0, 1.0);
+    tuple->PostPreS_MomentumVsProbQNoL1VsIas.book(histos, dir, "PostPreS_MomentumVsProbQVsIas", ";p [GeV];F_{i}^{pixels};G_{i}^{strips}", 40, 0., PtHistoUpperBound, 100, 0.0, 1.0, 100, 0.0, 1.0);
     tuple->PostPreS_ProbXY = dir.make<TH1F>("PostPreS_ProbXY", ";Prob_{XY} (pixels);Tracks / bin", 100, 0, 1);
     tuple->PostPreS_ProbXY_highIas = dir.make<TH1F>("PostPreS_ProbXY_highIas", ";ProbXY (G_{i}^{strips} > 0.6);Tracks / bin", 100, 0, 1);
-    tuple->PostPreS_ProbXYVsIas = dir.make<TH2F>("PostPreS_ProbXYVsIas", ";ProbXY;G_{i}^{strips};Tracks / bin",  100, 0, 1, 10, 0., 1.);
-    tuple->PostPreS_ProbXYVsIas_highIas = dir.make<TH2F>("PostPreS_ProbXYVsIas_highIas", ";ProbXY (G_{i}^{strips} > 0.6);G_{i}^{strips} (G_{i}^{strips} > 0.6);Tracks / bin",  100, 0, 1, 10, 0., 1.);
-    tuple->PostPreS_ProbXYVsProbQ = dir.make<TH2F>("PostPreS_ProbXYVsProbQ", ";Prob_{XY} (pixels);F_{i}^{pixels};Tracks / bin",  100, 0., 1., 10, 0., 1.);
-    tuple->PostPreS_ProbXYVsProbQ_highIas = dir.make<TH2F>("PostPreS_ProbXYVsProbQ_highIas", ";ProbXY (G_{i}^{strips} > 0.6);ProbQ (G_{i}^{strips} > 0.6);Tracks / bin",  100, 0., 1., 10, 0., 1.);
-
-    tuple->PostPreS_MassVsIas_fail= dir.make<TH2F>("PostPreS_MassVsIas_fail", "TO BLIND ! ;G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 4000.);
-    tuple->PostPreS_MassVsIas_pass= dir.make<TH2F>("PostPreS_MassVsIas_pass", "TO BLIND ! ;G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 4000.);
-    tuple->PostPreS_MassVsIas_fail_CR2= dir.make<TH2F>("PostPreS_MassVsIas_fail_CR2", ";G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 1000.);
-    tuple->PostPreS_MassVsIas_pass_CR2= dir.make<TH2F>("PostPreS_MassVsIas_pass_CR2", ";G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 1000.);
-    tuple->PostPreS_MassVsIas_fail_CR3= dir.make<TH2F>("PostPreS_MassVsIas_fail_CR3", ";G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 1000.);
-    tuple->PostPreS_MassVsIas_pass_CR3= dir.make<TH2F>("PostPreS_MassVsIas_pass_CR3", ";G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 1000.);
-    tuple->PostPreS_MassVsIas_fail_SR2= dir.make<TH2F>("PostPreS_MassVsIas_fail_SR2", "TO BLIND ! ;G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 4000.);
-    tuple->PostPreS_MassVsIas_pass_SR2= dir.make<TH2F>("PostPreS_MassVsIas_pass_SR2", "TO BLIND ! ;G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 4000.);
+    tuple->PostPreS_ProbXYVsIas.book(histos, dir, "PostPreS_ProbXYVsIas", ";ProbXY;G_{i}^{strips};Tracks / bin",  100, 0, 1, 10, 0., 1.);
+    tuple->PostPreS_ProbXYVsIas_highIas.book(histos, dir, "PostPreS_ProbXYVsIas_highIas", ";ProbXY (G_{i}^{strips} > 0.6);G_{i}^{strips} (G_{i}^{strips} > 0.6);Tracks / bin",  100, 0, 1, 10, 0., 1.);
+    tuple->PostPreS_ProbXYVsProbQ.book(histos, dir, "PostPreS_ProbXYVsProbQ", ";Prob_{XY} (pixels);F_{i}^{pixels};Tracks / bin",  100, 0., 1., 10, 0., 1.);
+    tuple->PostPreS_ProbXYVsProbQ_highIas.book(histos, dir, "PostPreS_ProbXYVsProbQ_highIas", ";ProbXY (G_{i}^{strips} > 0.6);ProbQ (G_{i}^{strips} > 0.6);Tracks / bin",  100, 0., 1., 10, 0., 1.);
+
+    tuple->PostPreS_MassVsIas_fail.book(histos, dir, "PostPreS_MassVsIas_fail", "TO BLIND ! ;G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 4000.);
+    tuple->PostPreS_MassVsIas_pass.book(histos, dir, "PostPreS_MassVsIas_pass", "TO BLIND ! ;G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 4000.);
+    tuple->PostPreS_MassVsIas_fail_CR2.book(histos, dir, "PostPreS_MassVsIas_fail_CR2", ";G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 1000.);
+    tuple->PostPreS_MassVsIas_pass_CR2.book(histos, dir, "PostPreS_MassVsIas_pass_CR2", ";G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 1000.);
+    tuple->PostPreS_MassVsIas_fail_CR3.book(histos, dir, "PostPreS_MassVsIas_fail_CR3", ";G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 1000.);
+    tuple->PostPreS_MassVsIas_pass_CR3.book(histos, dir, "PostPreS_MassVsIas_pass_CR3", ";G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 1000.);
+    tuple->PostPreS_MassVsIas_fail_SR2.book(histos, dir, "PostPreS_MassVsIas_fail_SR2", "TO BLIND ! ;G_{i}^{strips} in Fail ;Mass[GeV]", 20,0., 1., 80, 0., 4000.);
+    tuple->PostPreS_MassVsIas_pass_SR2.book(histos, dir, "PostPreS_MassVsIas_pass_SR2", "TO BLIND ! ;G_{i}^{strips} in Pass ;Mass[GeV]", 20,0., 1., 80, 0., 4000.);
     
 
     tuple->PostPreS_Ias_CR2 = dir.make<TH1F>("PostPreS_Ias_CR2", ";G_{i}^{strips};Tracks / 0.1", 10, 0, dEdxS_UpLim);
@@ -1348,13 +1119,13 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_Ih_noL1_CR2= dir.make<TH1F>("PostPreS_Ih_noL1_CR2", ";I_{h} (no L1) [MeV/cm]", 200, 0, dEdxM_UpLim);
     tuple->PostPreS_Pt_CR2 = dir.make<TH1F>("PostPreS_Pt_CR2", ";p_{T} [GeV];Tracks / 10 GeV", 50, 0., 500.);
     tuple->PostPreS_ProbQNoL1_CR2 = dir.make<TH1F>("PostPreS_ProbQNoL1_CR2", ";F_{i}^{pixels};Tracks / 0.05", 20, 0., 1.);
-    tuple->PostPreS_ProbQNoL1VsIas_CR2 = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR2", ";F_{i}^{pixels};G_{i}^{strips}",20, 0., 1., 20, 0., 1.);
+    tuple->PostPreS_ProbQNoL1VsIas_CR2.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR2", ";F_{i}^{pixels};G_{i}^{strips}",20, 0., 1., 20, 0., 1.);
     tuple->PostPreS_Ias_CR3 = dir.make<TH1F>("PostPreS_Ias_CR3", ";G_{i}^{strips};Tracks / 0.1", 10, 0, dEdxS_UpLim);
     tuple->PostPreS_Ih_CR3= dir.make<TH1F>("PostPreS_Ih_CR3", ";I_{h} [MeV/cm]", 200, 0, dEdxM_UpLim);
     tuple->PostPreS_Ih_noL1_CR3= dir.make<TH1F>("PostPreS_Ih_noL1_CR3", ";I_{h} (no L1) [MeV/cm]", 200, 0, dEdxM_UpLim);
     tuple->PostPreS_Pt_CR3 = dir.make<TH1F>("PostPreS_Pt_CR3", ";p_{T} [GeV];Tracks / 10 GeV", 50, 0., 500.);
     tuple->PostPreS_ProbQNoL1_CR3 = dir.make<TH1F>("PostPreS_ProbQNoL1_CR3", ";F_{i}^{pixels};Tracks / 0.05", 20, 0., 1.);
-    tuple->PostPreS_ProbQNoL1VsIas_CR3 = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR3", ";F_{i}^{pixels};G_{i}^{strips}",20, 0., 1., 20, 0., 1.);
+    tuple->PostPreS_ProbQNoL1VsIas_CR3.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR3", ";F_{i}^{pixels};G_{i}^{strips}",20, 0., 1., 20, 0., 1.);
 
 
 
@@ -1362,30 +1133,30 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
    
     
  
-    tuple->PostPreS_ProbQNoL1VsIas_CR = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR", ";F_{i}^{pixels};G_{i}^{strips}",20, 0., 1., 20, 0., 1.);
+    tuple->PostPreS_ProbQNoL1VsIas_CR.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR", ";F_{i}^{pixels};G_{i}^{strips}",20, 0., 1., 20, 0., 1.);
     if (doSystsPlots_) {
-      tuple->PostPreS_ProbQNoL1VsIas_CR_Pileup_up = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_CR_Pileup_down = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_up = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_down = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_CR_Ias_up = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_CR_Ias_down = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_CR_Pt_up = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_CR_Pt_down = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_CR_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_CR_Pileup_up.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_CR_Pileup_down.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_up.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_down.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_CR_Ias_up.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_CR_Ias_down.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_CR_Pt_up.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_CR_Pt_down.book(histos, dir, "PostPreS_ProbQNoL1VsIas_CR_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
     }
     
     tuple->PostPreS_ProbQNoL1 = dir.make<TH1F>("PostPreS_ProbQNoL1", ";F_{i}^{pixels};Tracks / bin", 20, 0., 1.);
-    tuple->PostPreS_ProbQNoL1VsIas = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-    tuple->PostPreS_ProbQNoL1VsFiStrips = dir.make<TH2F>("PostPreS_ProbQNoL1VsFiStrips", ";F_{i}^{pixels};F_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+    tuple->PostPreS_ProbQNoL1VsIas.book(histos, dir, "PostPreS_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+    tuple->PostPreS_ProbQNoL1VsFiStrips.book(histos, dir, "PostPreS_ProbQNoL1VsFiStrips", ";F_{i}^{pixels};F_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
     if (doSystsPlots_) {
-      tuple->PostPreS_ProbQNoL1VsIas_Pileup_up = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_Pileup_down = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_ProbQNoL1_up = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_ProbQNoL1_down = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_Pt_up = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_Pt_down = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_Ias_up = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
-      tuple->PostPreS_ProbQNoL1VsIas_Ias_down = dir.make<TH2F>("PostPreS_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_Pileup_up.book(histos, dir, "PostPreS_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_Pileup_down.book(histos, dir, "PostPreS_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_ProbQNoL1_up.book(histos, dir, "PostPreS_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_ProbQNoL1_down.book(histos, dir, "PostPreS_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_Pt_up.book(histos, dir, "PostPreS_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_Pt_down.book(histos, dir, "PostPreS_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_Ias_up.book(histos, dir, "PostPreS_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
+      tuple->PostPreS_ProbQNoL1VsIas_Ias_down.book(histos, dir, "PostPreS_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Tracks / bin",20, 0., 1., 20, 0., 1.);
     }
     
     tuple->PostPreS_TriggerTimingPass = dir.make<TH1F>("PostPreS_TriggerTimingPass", ";#Delta t_{PV,DT L2} [ns] (trigger passed);Tracks / bin", 100, 0.0, 100);
@@ -1394,102 +1165,102 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostPreS_TriggerEtaPass = dir.make<TH1F>("PostPreS_TriggerEtaPass", ";Trigger object #eta (trigger passed);Tracks / bin", 25, 0.0, 2.5);
     tuple->PostPreS_TriggerEtaReject = dir.make<TH1F>("PostPreS_TriggerEtaReject", ";Trigger object #eta (trigger rejected);Tracks / bin", 25, 0.0, 2.5);
     
-    tuple->PostS_MuonTightVsBeta = dir.make<TH2F>("PostS_MuonTightVsBeta", ";Tight ID mu;Gen #beta",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaA = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaA", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaA_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaA_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostS_MuonTightVsBeta.book(histos, dir, "PostS_MuonTightVsBeta", ";Tight ID mu;Gen #beta",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta.book(histos, dir, "PostPreS_TriggerMuon50VsBeta", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaA.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaA", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaUp.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaA_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaDown.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaA_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaA_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaA_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaB = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaB", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaB_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaB_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaB.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaB", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaUp.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaB_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaDown.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaB_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaB_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaB_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaC = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaC", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaC_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaC_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaC.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaC", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaUp.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaC_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaDown.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaC_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaC_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaC_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaD = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaD", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaD_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaD_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaD.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaD", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaUp.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaD_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaDown.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaD_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaD_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaD_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
     
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaE = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaE", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaE_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaE_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaE.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaE", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaUp.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaE_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaDown.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaE_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaE_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaE_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaF = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaF", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaF_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaF_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL1DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL4DT = dir.make<TH2F>("PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaF.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaF", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaUp.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaF_BetaUp", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaDown.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaF_BetaDown", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL1DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL1DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaF_BetaUpAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL4DT.book(histos, dir, "PostPreS_TriggerMuon50VsBeta_EtaF_BetaDownAtL4DT", ";Muon50 triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
     
     tuple->PostS_SR2PASS_TriggerGenBeta = dir.make<TH1F>("PostS_SR2PASS_TriggerGenBeta", ";#beta^{HLT};Tracks / 0.05", 20, 0., 1.);
-    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_Beta = dir.make<TH2F>("PostS_SR2PASS_TriggerMuon50VsBeta_Beta", ";Muon50 triggered (SR2 region);Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownHalfSigma = dir.make<TH2F>("PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownHalfSigma", ";Muon50 triggered (SR2 region);Gen #beta (down half sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownOneSigma = dir.make<TH2F>("PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownOneSigma", ";Muon50 triggered (SR2 region);Gen #beta (down one sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownTwoSigma = dir.make<TH2F>("PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownTwoSigma", ";Muon50 triggered (SR2 region);Gen #beta (down two sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpHalfSigma = dir.make<TH2F>("PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpHalfSigma", ";Muon50 triggered (SR2 region);Gen #beta (up half sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpOneSigma = dir.make<TH2F>("PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpOneSigma", ";Muon50 triggered (SR2 region);Gen #beta (up one sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpTwoSigma = dir.make<TH2F>("PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpTwoSigma", ";Muon50 triggered (SR2 region);Gen #beta (up two sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_Beta.book(histos, dir, "PostS_SR2PASS_TriggerMuon50VsBeta_Beta", ";Muon50 triggered (SR2 region);Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownHalfSigma.book(histos, dir, "PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownHalfSigma", ";Muon50 triggered (SR2 region);Gen #beta (down half sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownOneSigma.book(histos, dir, "PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownOneSigma", ";Muon50 triggered (SR2 region);Gen #beta (down one sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownTwoSigma.book(histos, dir, "PostS_SR2PASS_TriggerMuon50VsBeta_BetaDownTwoSigma", ";Muon50 triggered (SR2 region);Gen #beta (down two sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpHalfSigma.book(histos, dir, "PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpHalfSigma", ";Muon50 triggered (SR2 region);Gen #beta (up half sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpOneSigma.book(histos, dir, "PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpOneSigma", ";Muon50 triggered (SR2 region);Gen #beta (up one sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpTwoSigma.book(histos, dir, "PostS_SR2PASS_TriggerMuon50VsBeta_BetaUpTwoSigma", ";Muon50 triggered (SR2 region);Gen #beta (up two sigma);Tracks / bin",2,-.5,1.5,20,0.,1.);
         
-    tuple->PostPreS_TriggerMuonAllVsBeta = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaA", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaB", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaC", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-
-    tuple->PostPreS_TriggerMuon50VsPt = dir.make<TH2F>("PostPreS_TriggerMuon50VsPt", ";Muon50 triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
-    tuple->PostPreS_TriggerMuonAllVsPt = dir.make<TH2F>("PostPreS_TriggerMuonAllVsPt", ";MuonAll triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
+    tuple->PostPreS_TriggerMuonAllVsBeta.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaA", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaB", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaC", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+
+    tuple->PostPreS_TriggerMuon50VsPt.book(histos, dir, "PostPreS_TriggerMuon50VsPt", ";Muon50 triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
+    tuple->PostPreS_TriggerMuonAllVsPt.book(histos, dir, "PostPreS_TriggerMuonAllVsPt", ";MuonAll triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
     
-    tuple->PostPreS_TriggerMuonAllVsBeta = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaA", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaB", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaC", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown = dir.make<TH2F>("PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaA", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaA_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaA_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaB", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaB_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaB_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaC", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaC_BetaUp", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown.book(histos, dir, "PostPreS_TriggerMuonAllVsBeta_EtaC_BetaDown", ";MuonAll triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
     
-    tuple->PostPreS_TriggerMuonAllVsPt = dir.make<TH2F>("PostPreS_TriggerMuonAllVsPt", ";MuonAll triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
+    tuple->PostPreS_TriggerMuonAllVsPt.book(histos, dir, "PostPreS_TriggerMuonAllVsPt", ";MuonAll triggered;Track p_{T};Tracks / bin",2,-.5,1.5,50,-0.05,1000.05);
     
-    tuple->PostPreS_TriggerMETallVsBeta = dir.make<TH2F>("PostPreS_TriggerMETallVsBeta", ";OR of MET triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
-    tuple->PostPreS_TriggerMETallVsMet = dir.make<TH2F>("PostPreS_TriggerMETallVsMet", ";OR of MET triggered;MET [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05);
-    tuple->PostPreS_TriggerMETallVsHT = dir.make<TH2F>("PostPreS_TriggerMETallVsHT", ";OR of MET triggered;H_{T} [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05);
-    tuple->PostPreS_TriggerMETallVsMetOverHt = dir.make<TH2F>("PostPreS_TriggerMETallVsMetOverHt", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
+    tuple->PostPreS_TriggerMETallVsBeta.book(histos, dir, "PostPreS_TriggerMETallVsBeta", ";OR of MET triggered;Gen #beta;Tracks / bin",2,-.5,1.5,20,0.,1.);
+    tuple->PostPreS_TriggerMETallVsMet.book(histos, dir, "PostPreS_TriggerMETallVsMet", ";OR of MET triggered;MET [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05);
+    tuple->PostPreS_TriggerMETallVsHT.book(histos, dir, "PostPreS_TriggerMETallVsHT", ";OR of MET triggered;H_{T} [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05);
+    tuple->PostPreS_TriggerMETallVsMetOverHt.book(histos, dir, "PostPreS_TriggerMETallVsMetOverHt", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
     
-    tuple->PostS_TriggerMETallVsMetOverHt_Cand0 = dir.make<TH2F>("PostS_TriggerMETallVsMetOverHt_Cand0", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
-    tuple->PostS_TriggerMETallVsMetOverHt_Cand1 = dir.make<TH2F>("PostS_TriggerMETallVsMetOverHt_Cand1", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
-    tuple->PostS_TriggerMETallVsMetOverHt_Cand2 = dir.make<TH2F>("PostS_TriggerMETallVsMetOverHt_Cand2", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
+    tuple->PostS_TriggerMETallVsMetOverHt_Cand0.book(histos, dir, "PostS_TriggerMETallVsMetOverHt_Cand0", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
+    tuple->PostS_TriggerMETallVsMetOverHt_Cand1.book(histos, dir, "PostS_TriggerMETallVsMetOverHt_Cand1", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
+    tuple->PostS_TriggerMETallVsMetOverHt_Cand2.book(histos, dir, "PostS_TriggerMETallVsMetOverHt_Cand2", ";OR of MET triggered;MET / H_{T};Tracks / bin",2,-.5,1.5,30,-0.05,2.95);
     
     
     tuple->PostPreS_MetOverHt = dir.make<TH1F>("PostPreS_MetOverHt", ";MET / H_{T};Tracks / bin",30,-0.05,2.95);
@@ -1498,114 +1269,114 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostS_MetOverHt_Cand2 = dir.make<TH1F>("PostS_MetOverHt_Cand2", ";MET / H_{T};Events / bin",30,-0.05,2.95);
     
     
-    tuple->PostPreS_MetVsHT = dir.make<TH2F>("PostPreS_MetVsHT", ";MET [GeV];H_{T} [GeV];Tracks / bin",25,-0.05,2000.05,25,-0.05,2000.05);
-    tuple->PostPreS_TriggerMETallVsMetVsHT = dir.make<TH3F>("PostPreS_TriggerMETallVsMetVsHT", ";OR of MET triggered;MET [GeV];H_{T} [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05,50,-0.05,2000.05);
+    tuple->PostPreS_MetVsHT.book(histos, dir, "PostPreS_MetVsHT", ";MET [GeV];H_{T} [GeV];Tracks / bin",25,-0.05,2000.05,25,-0.05,2000.05);
+    tuple->PostPreS_TriggerMETallVsMetVsHT.book(histos, dir, "PostPreS_TriggerMETallVsMetVsHT", ";OR of MET triggered;MET [GeV];H_{T} [GeV];Tracks / bin",2,-.5,1.5,50,-0.05,2000.05,50,-0.05,2000.05);
 
     tuple->PostPreS_ProbXYNoL1 = dir.make<TH1F>("PostPreS_ProbXYNoL1", ";ProbXYNoL1;Tracks / bin", 100, 0, 1);
     tuple->PostPreS_ProbXYNoL1_highIas = dir.make<TH1F>("PostPreS_ProbXYNoL1_highIas", ";ProbXYNoL1 for (G_{i}^{strips} > 0.6);Tracks / bin", 100, 0, 1);
-    tuple->PostPreS_ProbXYNoL1VsIas = dir.make<TH2F>("PostPreS_ProbXYNoL1VsIas", ";ProbXYNoL1;G_{i}^{strips};Tracks / bin", 100, 0., 1., 20, 0.,1.);
-    tuple->PostPreS_ProbXYNoL1VsIas_highIas = dir.make<TH2F>("PostPreS_ProbXYNoL1VsIas_highIas", ";ProbXYNoL1;G_{i}^{strips} (G_{i}^{strips} > 0.6);Tracks / bin", 100, 0., 1., 20, 0.,1.);
-    tuple->PostPreS_ProbXYNoL1VsProbQNoL1  = dir.make<TH2F>("PostPreS_ProbXYNoL1VsProbQNoL1", ";ProbXYNoL1;F_{i}^{pixels};Tracks / bin", 100, 0., 1., 20,0.,1.);
-    tuple->PostPreS_ProbXYNoL1VsProbQNoL1_highIas  = dir.make<TH2F>("PostPreS_ProbXYNoL1VsProbQNoL1_highIas", ";ProbXYNoL1 (G_{i}^{strips} > 0.6);ProbQNoL1 (G_{i}^{strips} > 0.6)", 100, 0., 1., 20,0.,1.);
+    tuple->PostPreS_ProbXYNoL1VsIas.book(histos, dir, "PostPreS_ProbXYNoL1VsIas", ";ProbXYNoL1;G_{i}^{strips};Tracks / bin", 100, 0., 1., 20, 0.,1.);
+    tuple->PostPreS_ProbXYNoL1VsIas_highIas.book(histos, dir, "PostPreS_ProbXYNoL1VsIas_highIas", ";ProbXYNoL1;G_{i}^{strips} (G_{i}^{strips} > 0.6);Tracks / bin", 100, 0., 1., 20, 0.,1.);
+    tuple->PostPreS_ProbXYNoL1VsProbQNoL1.book(histos, dir, "PostPreS_ProbXYNoL1VsProbQNoL1", ";ProbXYNoL1;F_{i}^{pixels};Tracks / bin", 100, 0., 1., 20,0.,1.);
+    tuple->PostPreS_ProbXYNoL1VsProbQNoL1_highIas.book(histos, dir, "PostPreS_ProbXYNoL1VsProbQNoL1_highIas", ";ProbXYNoL1 (G_{i}^{strips} > 0.6);ProbQNoL1 (G_{i}^{strips} > 0.6)", 100, 0., 1., 20,0.,1.);
 
     tuple->PostPreS_MassErr = dir.make<TH1F>("PostPreS_MassErr", ";MassErr/Mass;Tracks / bin", 50, 0., 10.);
-    tuple->PostPreS_MassErrVsIas = dir.make<TH2F>("PostPreS_MassErrVsIas", ";MassErr/Mass;G_{i}^{strips};Tracks / bin",50, 0., 10.,10,0.,1.);
+    tuple->PostPreS_MassErrVsIas.book(histos, dir, "PostPreS_MassErrVsIas", ";MassErr/Mass;G_{i}^{strips};Tracks / bin",50, 0., 10.,10,0.,1.);
 
-    tuple->PostPreS_EtaVsGenID = dir.make<TH2F>("PostPreS_EtaVsGenID", ";#eta;GenID",  50, -2.6, 2.6, 4000, 0.0, 4000.0);
-    tuple->PostPreS_ProbQVsGenID = dir.make<TH2F>("PostPreS_ProbQVsGenID", ";F_{i}^{pixels};GenID", 100, 0.0, 1.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_EtaVsGenID.book(histos, dir, "PostPreS_EtaVsGenID", ";#eta;GenID",  50, -2.6, 2.6, 4000, 0.0, 4000.0);
+    tuple->PostPreS_ProbQVsGenID.book(histos, dir, "PostPreS_ProbQVsGenID", ";F_{i}^{pixels};GenID", 100, 0.0, 1.0, 4000, 0.0, 4000.0);
 
     tuple->PostPreS_IasForStatus91 = dir.make<TH1F>("PostPreS_IasForStatus91", ";G_{i}^{strips} when status=91;Tracks / bin", 10, 0., 1.);
     tuple->PostPreS_IasForStatusNot91 = dir.make<TH1F>("PostPreS_IasForStatusNot91", ";G_{i}^{strips} when status!=91;Tracks / bin", 10, 0., 1.);
 
-    tuple->PostPreS_ProbQVsGenEnviromentID = dir.make<TH2F>("PostPreS_ProbQVsGenEnviromentID", ";F_{i}^{pixels};GenEnviromentID",20, 0.0, 1.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_ProbXYVsGenID = dir.make<TH2F>("PostPreS_ProbXYVsGenID", ";ProbXY;GenID", 100, 0.0, 1.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_PtVsGenID = dir.make<TH2F>("PostPreS_PtVsGenID", ";p_{T} [GeV];GenID", 40, 0., PtHistoUpperBound, 4000, 0.0, 4000.0);
-    tuple->PostPreS_EoPVsGenID = dir.make<TH2F>("PostPreS_EoPVsGenID", ";EoPVsGenID", 25, 0, 1.5, 4000, 0.0, 4000.0);
-    tuple->PostPreS_IhVsGenID = dir.make<TH2F>("PostPreS_IhVsGenID", ";I_{h} [MeV/cm];GenID", 200, 0, dEdxM_UpLim, 4000, 0.0, 4000.0);
-    tuple->PostPreS_IasVsGenID = dir.make<TH2F>("PostPreS_IasVsGenID", ";G_{i}^{strips};GenID", 10, 0., 1., 4000, 0.0, 4000.0);
-    tuple->PostPreS_IasVsGenEnviromentID = dir.make<TH2F>("PostPreS_IasVsGenEnviromentID", ";G_{i}^{strips};GenEnviromentID", 10, 0., 1., 4000, 0.0, 4000.0);
-    tuple->PostPreS_MassTVsGenID = dir.make<TH2F>("PostPreS_massTVsGenID", ";m_{T} [GeV];GenID", 50, 0.0, 250.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_MiniIsoChgVsGenID = dir.make<TH2F>("PostPreS_MiniIsoChgVsGenID", ";miniIsoChg;GenID", 20, 0.0, 0.1, 4000, 0.0, 4000.0);
-    tuple->PostPreS_MiniIsoAllVsGenID = dir.make<TH2F>("PostPreS_MiniIsoAllVsGenID", ";miniIsoAll;GenID", 20, 0.0, 0.1, 4000, 0.0, 4000.0);
-    tuple->PostPreS_MassVsGenID = dir.make<TH2F>("PostPreS_MassVsGenID", ";Mass [GeV];GenID",80,0.,4000.,4000, 0.0, 4000.0);
-
-    tuple->PostPreS_EtaVsMomGenID = dir.make<TH2F>("PostPreS_EtaVsMomGenID", ";#eta;MomGenID",  50, -2.6, 2.6, 4000, 0.0, 4000.0);
-    tuple->PostPreS_ProbQVsMomGenID = dir.make<TH2F>("PostPreS_ProbQVsMomGenID", ";F_{i}^{pixels};MomGenID", 20, 0.0, 1.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_ProbXYVsMomGenID = dir.make<TH2F>("PostPreS_ProbXYVsMomGenID", ";ProbXY;MomGenID", 20, 0.0, 1.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_PtVsMomGenID = dir.make<TH2F>("PostPreS_PtVsMomGenID", ";p_{T} [GeV];MomGenID", 40, 0., PtHistoUpperBound, 4000, 0.0, 4000.0);
-    tuple->PostPreS_EoPVsMomGenID = dir.make<TH2F>("PostPreS_EoPVsMomGenID", ";EoP;MomGenID", 25, 0, 1.5, 4000, 0.0, 4000.0);
-    tuple->PostPreS_IhVsMomGenID = dir.make<TH2F>("PostPreS_IhVsMomGenID", ";I_{h} [MeV/cm];MomGenID", 200, 0, dEdxM_UpLim, 4000, 0.0, 4000.0);
-    tuple->PostPreS_IasVsMomGenID = dir.make<TH2F>("PostPreS_IasVsMomGenID", ";G_{i}^{strips};MomGenID", 10, 0., 1., 4000, 0.0, 4000.0);
-    tuple->PostPreS_MassTVsMomGenID = dir.make<TH2F>("PostPreS_massTVsMomGenID", ";m_{T} [GeV];MomGenID", 50, 0.0, 250.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_MiniIsoChgVsMomGenID = dir.make<TH2F>("PostPreS_MiniIsoChgVsMomGenID", ";miniIsoChg;MomGenID", 20, 0.0, 0.1, 4000, 0.0, 4000.0);
-    tuple->PostPreS_MiniIsoAllVsMomGenID = dir.make<TH2F>("PostPreS_MiniIsoAllVsMomGenID", ";miniIsoAll;MomGenID", 20, 0.0, 0.1, 4000, 0.0, 4000.0);
-    tuple->PostPreS_MassVsMomGenID = dir.make<TH2F>("PostPreS_MassVsMomGenID",";Mass [GeV];MomGenID",80,0.,4000.,4000, 0.0, 4000.0);
-
-    tuple->PostPreS_EtaVsSiblingGenID = dir.make<TH2F>("PostPreS_EtaVsSiblingGenID", ";#eta;SiblingGenID",  50, -2.6, 2.6, 4000, 0.0, 4000.0);
-    tuple->PostPreS_ProbQVsSiblingGenID = dir.make<TH2F>("PostPreS_ProbQVsSiblingGenID", ";F_{i}^{pixels};SiblingGenID", 20, 0.0, 1.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_ProbXYVsSiblingGenID = dir.make<TH2F>("PostPreS_ProbXYVsSiblingGenID", ";ProbXY;SiblingGenID", 20, 0.0, 1.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_PtVsSiblingGenID = dir.make<TH2F>("PostPreS_PtVsSiblingGenID", ";p_{T} [GeV];SiblingGenID", 40, 0., PtHistoUpperBound, 4000, 0.0, 4000.0);
-    tuple->PostPreS_EoPVsSiblingGenID = dir.make<TH2F>("PostPreS_EoPVsSiblingGenID", ";EoPVsSiblingGenID", 25, 0, 1.5, 4000, 0.0, 4000.0);
-    tuple->PostPreS_IhVsSiblingGenID = dir.make<TH2F>("PostPreS_IhVsSiblingGenID", ";I_{h} [MeV/cm];SiblingGenID", 200, 0, dEdxM_UpLim, 4000, 0.0, 4000.0);
-    tuple->PostPreS_IasVsSiblingGenID = dir.make<TH2F>("PostPreS_IasVsSiblingGenID", ";G_{i}^{strips};SiblingGenID", 10, 0., 1., 4000, 0.0, 4000.0);
-    tuple->PostPreS_MassTVsSiblingGenID = dir.make<TH2F>("PostPreS_massTVsSiblingGenID", ";massT;SiblingGenID", 50, 0.0, 250.0, 4000, 0.0, 4000.0);
-    tuple->PostPreS_MassVsSiblingGenID = dir.make<TH2F>("PostPreS_MassVsSiblingGenID", ";Mass;SiblingGenID",80, 0.0, 4000.0, 4000, 0.0, 4000.0);
-
-    tuple->PostPreS_EtaVsGenAngle = dir.make<TH2F>("PostPreS_EtaVsGenAngle", ";#eta;GenAngle",  50, -2.6, 2.6, 100, 0.0, 1.0);
-    tuple->PostPreS_ProbQVsGenAngle = dir.make<TH2F>("PostPreS_ProbQVsGenAngle", ";F_{i}^{pixels};GenAngle", 20, 0.0, 1.0, 100, 0.0,1.0);
-    tuple->PostPreS_ProbXYVsGenAngle = dir.make<TH2F>("PostPreS_ProbXYVsGenAngle", ";ProbXY;GenAngle", 20, 0.0, 1.0, 100, 0.0, 1.0);
-    tuple->PostPreS_PtVsGenAngle = dir.make<TH2F>("PostPreS_PtVsGenAngle", ";p_{T} [GeV];GenAngle", 40, 0., PtHistoUpperBound, 100, 0.0, 1.0);
-    tuple->PostPreS_EoPVsGenAngle = dir.make<TH2F>("PostPreS_EoPVsGenAngle", ";EoPVsGenAngle", 25, 0, 1.5, 100, 0.0, 1.0);
-    tuple->PostPreS_IhVsGenAngle = dir.make<TH2F>("PostPreS_IhVsGenAngle", ";I_{h} [MeV/cm];GenAngle", 200, 0, dEdxM_UpLim, 100, 0.0, 1.0);
-    tuple->PostPreS_IasVsGenAngle = dir.make<TH2F>("PostPreS_IasVsGenAngle", ";G_{i}^{strips};GenAngle", 10, 0., 1., 100, 0.0, 1.0);
-    tuple->PostPreS_MassTVsGenAngle = dir.make<TH2F>("PostPreS_massTVsGenAngle", ";m_{T} [GeV];GenAngle", 50, 0.0, 250.0, 100, 0.0, 1.0);
-    tuple->PostPreS_MiniIsoChgVsGenAngle = dir.make<TH2F>("PostPreS_MiniIsoChgVsGenAngle", ";miniIsoChg;GenAngle", 20, 0.0, 0.1, 100, 0.0, 1.0);
-    tuple->PostPreS_MiniIsoAllVsGenAngle = dir.make<TH2F>("PostPreS_MiniIsoAllVsGenAngle", ";miniIsoAll;GenAngle", 20, 0.0, 0.1, 100, 0.0, 1.0);
-    tuple->PostPreS_MassVsGenAngle = dir.make<TH2F>("PostPreS_MassVsGenAngle", ";Mass;GenAngle",80, 0.0,4000.0,  100, 0.0, 1.0);
-
-    tuple->PostPreS_EtaVsGenMomAngle = dir.make<TH2F>("PostPreS_EtaVsGenMomAngle", ";#eta;GenMomAngle",  50, -2.6, 2.6, 100, 0.0, 1.0);
-    tuple->PostPreS_ProbQVsGenMomAngle = dir.make<TH2F>("PostPreS_ProbQVsGenMomAngle", ";F_{i}^{pixels};GenMomAngle", 20, 0.0, 1.0, 100, 0.0,1.0);
-    tuple->PostPreS_ProbXYVsGenMomAngle = dir.make<TH2F>("PostPreS_ProbXYVsGenMomAngle", ";ProbXY;GenMomAngle", 20, 0.0, 1.0, 100, 0.0, 1.0);
-    tuple->PostPreS_PtVsGenMomAngle = dir.make<TH2F>("PostPreS_PtVsGenMomAngle", ";p_{T} [GeV];GenMomAngle", 40, 0., PtHistoUpperBound, 100, 0.0, 1.0);
-    tuple->PostPreS_EoPVsGenMomAngle = dir.make<TH2F>("PostPreS_EoPVsGenMomAngle", ";EoPVsGenMomAngle", 25, 0, 1.5, 100, 0.0, 1.0);
-    tuple->PostPreS_IhVsGenMomAngle = dir.make<TH2F>("PostPreS_IhVsGenMomAngle", ";I_{h} [MeV/cm];GenMomAngle", 100, 0, dEdxM_UpLim, 100, 0.0, 1.0);
-    tuple->PostPreS_IasVsGenMomAngle = dir.make<TH2F>("PostPreS_IasVsGenMomAngle", ";G_{i}^{strips};GenMomAngle", 10, 0., 1., 100, 0.0, 1.0);
-    tuple->PostPreS_MassTVsGenMomAngle = dir.make<TH2F>("PostPreS_massTVsGenMomAngle", ";m_{T} [GeV];GenMomAngle", 50, 0.0, 250.0, 100, 0.0, 1.0);
-    tuple->PostPreS_MiniIsoChgVsGenMomAngle = dir.make<TH2F>("PostPreS_MiniIsoChgVsGenMomAngle", ";miniIsoChg;GenMomAngle", 20, 0.0, 0.1, 100, 0.0, 1.0);
-    tuple->PostPreS_MiniIsoAllVsGenMomAngle = dir.make<TH2F>("PostPreS_MiniIsoAllVsGenMomAngle", ";miniIsoAll;GenMomAngle", 20, 0.0, 0.1, 100, 0.0, 1.0);
-    tuple->PostPreS_MassVsGenMomAngle = dir.make<TH2F>("PostPreS_MassVsGenMomAngle", ";Mass;GenMomAngle",80,0.,4000., 100, 0.0, 1.0);
-
-    tuple->PostPreS_ProbQVsIas = dir.make<TH2F>("PostPreS_ProbQVsIas", ";F_{i}^{pixels};G_{i}^{strips}", 20, 0., 1., 20, 0., 1.);
-
-    tuple->PostPreS_EtaVsGenNumSibling = dir.make<TH2F>("PostPreS_EtaVsGenNumSibling", ";#eta;GenNumSibling",  50, -2.6, 2.6, 100, 0.0, 10.0);
-    tuple->PostPreS_ProbQVsGenNumSibling = dir.make<TH2F>("PostPreS_ProbQVsGenNumSibling", ";F_{i}^{pixels};GenNumSibling", 20, 0., 1., 10, 0.0,10.);
-    tuple->PostPreS_ProbXYVsGenNumSibling = dir.make<TH2F>("PostPreS_ProbXYVsGenNumSibling", ";ProbXY;GenNumSibling", 20, 0.0, 1.0, 10, 0.0, 10.0);
-    tuple->PostPreS_PtVsGenNumSibling = dir.make<TH2F>("PostPreS_PtVsGenNumSibling", ";p_{T} [GeV];GenNumSibling", 40, 0., PtHistoUpperBound, 100, 0.0, 10.0);
-    tuple->PostPreS_EoPVsGenNumSibling = dir.make<TH2F>("PostPreS_EoPVsGenNumSibling", ";EoPVsGenNumSibling", 25, 0, 1.5, 100, 0.0, 10.0);
-    tuple->PostPreS_IhVsGenNumSibling = dir.make<TH2F>("PostPreS_IhVsGenNumSibling", ";I_{h} [MeV/cm];GenNumSibling", 200, 0, dEdxM_UpLim, 100, 0.0, 10.0);
-    tuple->PostPreS_IasVsGenNumSibling = dir.make<TH2F>("PostPreS_IasVsGenNumSibling", ";G_{i}^{strips};GenNumSibling", 10, 0., 1., 100, 0.0, 10.0);
-    tuple->PostPreS_MassTVsGenNumSibling = dir.make<TH2F>("PostPreS_massTVsGenNumSibling", ";m_{T} [GeV];GenNumSibling", 50, 0.0, 250.0, 100, 0.0, 10.0);
-    tuple->PostPreS_MiniIsoChgVsGenNumSibling = dir.make<TH2F>("PostPreS_MiniIsoChgVsGenNumSibling", ";miniIsoChg;GenNumSibling", 20, 0.0, 0.1, 100, 0.0, 10.0);
-    tuple->PostPreS_MiniIsoAllVsGenNumSibling = dir.make<TH2F>("PostPreS_MiniIsoAllVsGenNumSibling", ";miniIsoAll;GenNumSibling", 20, 0.0, 1.0, 100, 0.0, 10.0);
-
-    tuple->PostPreS_EoPVsPfType = dir.make<TH2F>("PostPreS_EoPVsPfType", ";EoP;PfType", 25, 0.0, 1.5, 9, 0.0, 9.0);
+    tuple->PostPreS_ProbQVsGenEnviromentID.book(histos, dir, "PostPreS_ProbQVsGenEnviromentID", ";F_{i}^{pixels};GenEnviromentID",20, 0.0, 1.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_ProbXYVsGenID.book(histos, dir, "PostPreS_ProbXYVsGenID", ";ProbXY;GenID", 100, 0.0, 1.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_PtVsGenID.book(histos, dir, "PostPreS_PtVsGenID", ";p_{T} [GeV];GenID", 40, 0., PtHistoUpperBound, 4000, 0.0, 4000.0);
+    tuple->PostPreS_EoPVsGenID.book(histos, dir, "PostPreS_EoPVsGenID", ";EoPVsGenID", 25, 0, 1.5, 4000, 0.0, 4000.0);
+    tuple->PostPreS_IhVsGenID.book(histos, dir, "PostPreS_IhVsGenID", ";I_{h} [MeV/cm];GenID", 200, 0, dEdxM_UpLim, 4000, 0.0, 4000.0);
+    tuple->PostPreS_IasVsGenID.book(histos, dir, "PostPreS_IasVsGenID", ";G_{i}^{strips};GenID", 10, 0., 1., 4000, 0.0, 4000.0);
+    tuple->PostPreS_IasVsGenEnviromentID.book(histos, dir, "PostPreS_IasVsGenEnviromentID", ";G_{i}^{strips};GenEnviromentID", 10, 0., 1., 4000, 0.0, 4000.0);
+    tuple->PostPreS_MassTVsGenID.book(histos, dir, "PostPreS_massTVsGenID", ";m_{T} [GeV];GenID", 50, 0.0, 250.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_MiniIsoChgVsGenID.book(histos, dir, "PostPreS_MiniIsoChgVsGenID", ";miniIsoChg;GenID", 20, 0.0, 0.1, 4000, 0.0, 4000.0);
+    tuple->PostPreS_MiniIsoAllVsGenID.book(histos, dir, "PostPreS_MiniIsoAllVsGenID", ";miniIsoAll;GenID", 20, 0.0, 0.1, 4000, 0.0, 4000.0);
+    tuple->PostPreS_MassVsGenID.book(histos, dir, "PostPreS_MassVsGenID", ";Mass [GeV];GenID",80,0.,4000.,4000, 0.0, 4000.0);
+
+    tuple->PostPreS_EtaVsMomGenID.book(histos, dir, "PostPreS_EtaVsMomGenID", ";#eta;MomGenID",  50, -2.6, 2.6, 4000, 0.0, 4000.0);
+    tuple->PostPreS_ProbQVsMomGenID.book(histos, dir, "PostPreS_ProbQVsMomGenID", ";F_{i}^{pixels};MomGenID", 20, 0.0, 1.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_ProbXYVsMomGenID.book(histos, dir, "PostPreS_ProbXYVsMomGenID", ";ProbXY;MomGenID", 20, 0.0, 1.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_PtVsMomGenID.book(histos, dir, "PostPreS_PtVsMomGenID", ";p_{T} [GeV];MomGenID", 40, 0., PtHistoUpperBound, 4000, 0.0, 4000.0);
+    tuple->PostPreS_EoPVsMomGenID.book(histos, dir, "PostPreS_EoPVsMomGenID", ";EoP;MomGenID", 25, 0, 1.5, 4000, 0.0, 4000.0);
+    tuple->PostPreS_IhVsMomGenID.book(histos, dir, "PostPreS_IhVsMomGenID", ";I_{h} [MeV/cm];MomGenID", 200, 0, dEdxM_UpLim, 4000, 0.0, 4000.0);
+    tuple->PostPreS_IasVsMomGenID.book(histos, dir, "PostPreS_IasVsMomGenID", ";G_{i}^{strips};MomGenID", 10, 0., 1., 4000, 0.0, 4000.0);
+    tuple->PostPreS_MassTVsMomGenID.book(histos, dir, "PostPreS_massTVsMomGenID", ";m_{T} [GeV];MomGenID", 50, 0.0, 250.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_MiniIsoChgVsMomGenID.book(histos, dir, "PostPreS_MiniIsoChgVsMomGenID", ";miniIsoChg;MomGenID", 20, 0.0, 0.1, 4000, 0.0, 4000.0);
+    tuple->PostPreS_MiniIsoAllVsMomGenID.book(histos, dir, "PostPreS_MiniIsoAllVsMomGenID", ";miniIsoAll;MomGenID", 20, 0.0, 0.1, 4000, 0.0, 4000.0);
+    tuple->PostPreS_MassVsMomGenID.book(histos, dir, "PostPreS_MassVsMomGenID",";Mass [GeV];MomGenID",80,0.,4000.,4000, 0.0, 4000.0);
+
+    tuple->PostPreS_EtaVsSiblingGenID.book(histos, dir, "PostPreS_EtaVsSiblingGenID", ";#eta;SiblingGenID",  50, -2.6, 2.6, 4000, 0.0, 4000.0);
+    tuple->PostPreS_ProbQVsSiblingGenID.book(histos, dir, "PostPreS_ProbQVsSiblingGenID", ";F_{i}^{pixels};SiblingGenID", 20, 0.0, 1.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_ProbXYVsSiblingGenID.book(histos, dir, "PostPreS_ProbXYVsSiblingGenID", ";ProbXY;SiblingGenID", 20, 0.0, 1.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_PtVsSiblingGenID.book(histos, dir, "PostPreS_PtVsSiblingGenID", ";p_{T} [GeV];SiblingGenID", 40, 0., PtHistoUpperBound, 4000, 0.0, 4000.0);
+    tuple->PostPreS_EoPVsSiblingGenID.book(histos, dir, "PostPreS_EoPVsSiblingGenID", ";EoPVsSiblingGenID", 25, 0, 1.5, 4000, 0.0, 4000.0);
+    tuple->PostPreS_IhVsSiblingGenID.book(histos, dir, "PostPreS_IhVsSiblingGenID", ";I_{h} [MeV/cm];SiblingGenID", 200, 0, dEdxM_UpLim, 4000, 0.0, 4000.0);
+    tuple->PostPreS_IasVsSiblingGenID.book(histos, dir, "PostPreS_IasVsSiblingGenID", ";G_{i}^{strips};SiblingGenID", 10, 0., 1., 4000, 0.0, 4000.0);
+    tuple->PostPreS_MassTVsSiblingGenID.book(histos, dir, "PostPreS_massTVsSiblingGenID", ";massT;SiblingGenID", 50, 0.0, 250.0, 4000, 0.0, 4000.0);
+    tuple->PostPreS_MassVsSiblingGenID.book(histos, dir, "PostPreS_MassVsSiblingGenID", ";Mass;SiblingGenID",80, 0.0, 4000.0, 4000, 0.0, 4000.0);
+
+    tuple->PostPreS_EtaVsGenAngle.book(histos, dir, "PostPreS_EtaVsGenAngle", ";#eta;GenAngle",  50, -2.6, 2.6, 100, 0.0, 1.0);
+    tuple->PostPreS_ProbQVsGenAngle.book(histos, dir, "PostPreS_ProbQVsGenAngle", ";F_{i}^{pixels};GenAngle", 20, 0.0, 1.0, 100, 0.0,1.0);
+    tuple->PostPreS_ProbXYVsGenAngle.book(histos, dir, "PostPreS_ProbXYVsGenAngle", ";ProbXY;GenAngle", 20, 0.0, 1.0, 100, 0.0, 1.0);
+    tuple->PostPreS_PtVsGenAngle.book(histos, dir, "PostPreS_PtVsGenAngle", ";p_{T} [GeV];GenAngle", 40, 0., PtHistoUpperBound, 100, 0.0, 1.0);
+    tuple->PostPreS_EoPVsGenAngle.book(histos, dir, "PostPreS_EoPVsGenAngle", ";EoPVsGenAngle", 25, 0, 1.5, 100, 0.0, 1.0);
+    tuple->PostPreS_IhVsGenAngle.book(histos, dir, "PostPreS_IhVsGenAngle", ";I_{h} [MeV/cm];GenAngle", 200, 0, dEdxM_UpLim, 100, 0.0, 1.0);
+    tuple->PostPreS_IasVsGenAngle.book(histos, dir, "PostPreS_IasVsGenAngle", ";G_{i}^{strips};GenAngle", 10, 0., 1., 100, 0.0, 1.0);
+    tuple->PostPreS_MassTVsGenAngle.book(histos, dir, "PostPreS_massTVsGenAngle", ";m_{T} [GeV];GenAngle", 50, 0.0, 250.0, 100, 0.0, 1.0);
+    tuple->PostPreS_MiniIsoChgVsGenAngle.book(histos, dir, "PostPreS_MiniIsoChgVsGenAngle", ";miniIsoChg;GenAngle", 20, 0.0, 0.1, 100, 0.0, 1.0);
+    tuple->PostPreS_MiniIsoAllVsGenAngle.book(histos, dir, "PostPreS_MiniIsoAllVsGenAngle", ";miniIsoAll;GenAngle", 20, 0.0, 0.1, 100, 0.0, 1.0);
+    tuple->PostPreS_MassVsGenAngle.book(histos, dir, "PostPreS_MassVsGenAngle", ";Mass;GenAngle",80, 0.0,4000.0,  100, 0.0, 1.0);
+
+    tuple->PostPreS_EtaVsGenMomAngle.book(histos, dir, "PostPreS_EtaVsGenMomAngle", ";#eta;GenMomAngle",  50, -2.6, 2.6, 100, 0.0, 1.0);
+    tuple->PostPreS_ProbQVsGenMomAngle.book(histos, dir, "PostPreS_ProbQVsGenMomAngle", ";F_{i}^{pixels};GenMomAngle", 20, 0.0, 1.0, 100, 0.0,1.0);
+    tuple->PostPreS_ProbXYVsGenMomAngle.book(histos, dir, "PostPreS_ProbXYVsGenMomAngle", ";ProbXY;GenMomAngle", 20, 0.0, 1.0, 100, 0.0, 1.0);
+    tuple->PostPreS_PtVsGenMomAngle.book(histos, dir, "PostPreS_PtVsGenMomAngle", ";p_{T} [GeV];GenMomAngle", 40, 0., PtHistoUpperBound, 100, 0.0, 1.0);
+    tuple->PostPreS_EoPVsGenMomAngle.book(histos, dir, "PostPreS_EoPVsGenMomAngle", ";EoPVsGenMomAngle", 25, 0, 1.5, 100, 0.0, 1.0);
+    tuple->PostPreS_IhVsGenMomAngle.book(histos, dir, "PostPreS_IhVsGenMomAngle", ";I_{h} [MeV/cm];GenMomAngle", 100, 0, dEdxM_UpLim, 100, 0.0, 1.0);
+    tuple->PostPreS_IasVsGenMomAngle.book(histos, dir, "PostPreS_IasVsGenMomAngle", ";G_{i}^{strips};GenMomAngle", 10, 0., 1., 100, 0.0, 1.0);
+    tuple->PostPreS_MassTVsGenMomAngle.book(histos, dir, "PostPreS_massTVsGenMomAngle", ";m_{T} [GeV];GenMomAngle", 50, 0.0, 250.0, 100, 0.0, 1.0);
+    tuple->PostPreS_MiniIsoChgVsGenMomAngle.book(histos, dir, "PostPreS_MiniIsoChgVsGenMomAngle", ";miniIsoChg;GenMomAngle", 20, 0.0, 0.1, 100, 0.0, 1.0);
+    tuple->PostPreS_MiniIsoAllVsGenMomAngle.book(histos, dir, "PostPreS_MiniIsoAllVsGenMomAngle", ";miniIsoAll;GenMomAngle", 20, 0.0, 0.1, 100, 0.0, 1.0);
+    tuple->PostPreS_MassVsGenMomAngle.book(histos, dir, "PostPreS_MassVsGenMomAngle", ";Mass;GenMomAngle",80,0.,4000., 100, 0.0, 1.0);
+
+    tuple->PostPreS_ProbQVsIas.book(histos, dir, "PostPreS_ProbQVsIas", ";F_{i}^{pixels};G_{i}^{strips}", 20, 0., 1., 20, 0., 1.);
+
+    tuple->PostPreS_EtaVsGenNumSibling.book(histos, dir, "PostPreS_EtaVsGenNumSibling", ";#eta;GenNumSibling",  50, -2.6, 2.6, 100, 0.0, 10.0);
+    tuple->PostPreS_ProbQVsGenNumSibling.book(histos, dir, "PostPreS_ProbQVsGenNumSibling", ";F_{i}^{pixels};GenNumSibling", 20, 0., 1., 10, 0.0,10.);
+    tuple->PostPreS_ProbXYVsGenNumSibling.book(histos, dir, "PostPreS_ProbXYVsGenNumSibling", ";ProbXY;GenNumSibling", 20, 0.0, 1.0, 10, 0.0, 10.0);
+    tuple->PostPreS_PtVsGenNumSibling.book(histos, dir, "PostPreS_PtVsGenNumSibling", ";p_{T} [GeV];GenNumSibling", 40, 0., PtHistoUpperBound, 100, 0.0, 10.0);
+    tuple->PostPreS_EoPVsGenNumSibling.book(histos, dir, "PostPreS_EoPVsGenNumSibling", ";EoPVsGenNumSibling", 25, 0, 1.5, 100, 0.0, 10.0);
+    tuple->PostPreS_IhVsGenNumSibling.book(histos, dir, "PostPreS_IhVsGenNumSibling", ";I_{h} [MeV/cm];GenNumSibling", 200, 0, dEdxM_UpLim, 100, 0.0, 10.0);
+    tuple->PostPreS_IasVsGenNumSibling.book(histos, dir, "PostPreS_IasVsGenNumSibling", ";G_{i}^{strips};GenNumSibling", 10, 0., 1., 100, 0.0, 10.0);
+    tuple->PostPreS_MassTVsGenNumSibling.book(histos, dir, "PostPreS_massTVsGenNumSibling", ";m_{T} [GeV];GenNumSibling", 50, 0.0, 250.0, 100, 0.0, 10.0);
+    tuple->PostPreS_MiniIsoChgVsGenNumSibling.book(histos, dir, "PostPreS_MiniIsoChgVsGenNumSibling", ";miniIsoChg;GenNumSibling", 20, 0.0, 0.1, 100, 0.0, 10.0);
+    tuple->PostPreS_MiniIsoAllVsGenNumSibling.book(histos, dir, "PostPreS_MiniIsoAllVsGenNumSibling", ";miniIsoAll;GenNumSibling", 20, 0.0, 1.0, 100, 0.0, 10.0);
+
+    tuple->PostPreS_EoPVsPfType.book(histos, dir, "PostPreS_EoPVsPfType", ";EoP;PfType", 25, 0.0, 1.5, 9, 0.0, 9.0);
     tuple->PostPreS_Mass = dir.make<TH1F>("PostPreS_Mass","PostPreS_Mass;Mass [GeV];Tracks / 50 GeV", 80,0.,4000.);
-    tuple->PostPreS_MassVsPfType = dir.make<TH2F>("PostPreS_MassVsPfType",";Mass [GeV];PF ID",80,0.,4000.,9, 0.0, 9.0);
-    tuple->PostPreS_MassVsPt = dir.make<TH2F>("PostPreS_MassVsPt", ";Mass [GeV];", 80,0.,4000.,80,0.,4000.);
-    tuple->PostPreS_MassVsP = dir.make<TH2F>("PostPreS_MassVsP", ";Mass [GeV];", 80,0.,4000.,80,0.,4000.);
-    tuple->PostPreS_MassVsTNOHFraction = dir.make<TH2F>("PostPreS_MassVsTNOHFraction", ";Mass [GeV];Number of valid hit fraction", 80,0.,4000.,20, 0., 1.);
-    tuple->PostPreS_MassVsTNOPH = dir.make<TH2F>("PostPreS_MassVsTNOPH", ";Mass [GeV];TNOPH", 80,0.,4000.,8, -0.5, 7.5);
-    tuple->PostPreS_MassVsTNOM = dir.make<TH2F>("PostPreS_MassVsTNOM", ";Mass [GeV];Number of measurements;", 80,0.,4000.,40, -0.5, 39.5);
-    tuple->PostPreS_MassVsProbQNoL1 = dir.make<TH2F>("PostPreS_MassVsProbQNoL1", ";Mass [GeV];F_{i}^{pixels}", 80,0.,4000.,20,0.,1.);
-    tuple->PostPreS_MassVsProbXYNoL1 = dir.make<TH2F>("PostPreS_MassVsProbXYNoL1", ";Mass [GeV];ProbXY", 80,0.,4000.,20,0.,1.);
-    tuple->PostPreS_MassVsEoP = dir.make<TH2F>("PostPreS_MassVsEoP", ";Mass [GeV];E/p", 80,0.,4000.,30, 0, 0.3);
-    tuple->PostPreS_MassVsSumpTOverpT = dir.make<TH2F>("PostPreS_MassVsSumpTOverpT", ";Mass [GeV];SumpTOverpT", 80,0.,4000.,80, 0, 2);
-    tuple->PostPreS_MassVsPtErrOverPt = dir.make<TH2F>("PostPreS_MassVsPtErrOverPt", ";Mass [GeV];PtErrOverPt", 80,0.,4000.,40, 0., 2.);
-    tuple->PostPreS_MassVsTIsol = dir.make<TH2F>("PostPreS_MassVsTIsol", ";Mass [GeV];TIsol [GeV]", 80,0.,4000., 25, 0., 100.);
-    tuple->PostPreS_MassVsIh = dir.make<TH2F>("PostPreS_MassVsIh", ";Mass [GeV];I_{h} [MeV/cm]", 80,0.,4000.,200, 0, dEdxM_UpLim);
-    tuple->PostPreS_MassVsMassT = dir.make<TH2F>("PostPreS_MassVsMassT", ";Mass [GeV];m_{T} [GeV]", 80,0.,4000.,50, 0.0, 250.0);
-    tuple->PostPreS_MassVsMiniRelIsoAll = dir.make<TH2F>("PostPreS_MassVsMiniRelIsoAll", ";Mass [GeV];MiniRelIsoAll", 80,0.,4000.,20, 0., 0.2);
-    tuple->PostPreS_MassVsMassErr = dir.make<TH2F>("PostPreS_MassVsMassErr", ";Mass [GeV];MassErr/Mass", 80,0.,4000.,50, 0., 10.);
+    tuple->PostPreS_MassVsPfType.book(histos, dir, "PostPreS_MassVsPfType",";Mass [GeV];PF ID",80,0.,4000.,9, 0.0, 9.0);
+    tuple->PostPreS_MassVsPt.book(histos, dir, "PostPreS_MassVsPt", ";Mass [GeV];", 80,0.,4000.,80,0.,4000.);
+    tuple->PostPreS_MassVsP.book(histos, dir, "PostPreS_MassVsP", ";Mass [GeV];", 80,0.,4000.,80,0.,4000.);
+    tuple->PostPreS_MassVsTNOHFraction.book(histos, dir, "PostPreS_MassVsTNOHFraction", ";Mass [GeV];Number of valid hit fraction", 80,0.,4000.,20, 0., 1.);
+    tuple->PostPreS_MassVsTNOPH.book(histos, dir, "PostPreS_MassVsTNOPH", ";Mass [GeV];TNOPH", 80,0.,4000.,8, -0.5, 7.5);
+    tuple->PostPreS_MassVsTNOM.book(histos, dir, "PostPreS_MassVsTNOM", ";Mass [GeV];Number of measurements;", 80,0.,4000.,40, -0.5, 39.5);
+    tuple->PostPreS_MassVsProbQNoL1.book(histos, dir, "PostPreS_MassVsProbQNoL1", ";Mass [GeV];F_{i}^{pixels}", 80,0.,4000.,20,0.,1.);
+    tuple->PostPreS_MassVsProbXYNoL1.book(histos, dir, "PostPreS_MassVsProbXYNoL1", ";Mass [GeV];ProbXY", 80,0.,4000.,20,0.,1.);
+    tuple->PostPreS_MassVsEoP.book(histos, dir, "PostPreS_MassVsEoP", ";Mass [GeV];E/p", 80,0.,4000.,30, 0, 0.3);
+    tuple->PostPreS_MassVsSumpTOverpT.book(histos, dir, "PostPreS_MassVsSumpTOverpT", ";Mass [GeV];SumpTOverpT", 80,0.,4000.,80, 0, 2);
+    tuple->PostPreS_MassVsPtErrOverPt.book(histos, dir, "PostPreS_MassVsPtErrOverPt", ";Mass [GeV];PtErrOverPt", 80,0.,4000.,40, 0., 2.);
+    tuple->PostPreS_MassVsTIsol.book(histos, dir, "PostPreS_MassVsTIsol", ";Mass [GeV];TIsol [GeV]", 80,0.,4000., 25, 0., 100.);
+    tuple->PostPreS_MassVsIh.book(histos, dir, "PostPreS_MassVsIh", ";Mass [GeV];I_{h} [MeV/cm]", 80,0.,4000.,200, 0, dEdxM_UpLim);
+    tuple->PostPreS_MassVsMassT.book(histos, dir, "PostPreS_MassVsMassT", ";Mass [GeV];m_{T} [GeV]", 80,0.,4000.,50, 0.0, 250.0);
+    tuple->PostPreS_MassVsMiniRelIsoAll.book(histos, dir, "PostPreS_MassVsMiniRelIsoAll", ";Mass [GeV];MiniRelIsoAll", 80,0.,4000.,20, 0., 0.2);
+    tuple->PostPreS_MassVsMassErr.book(histos, dir, "PostPreS_MassVsMassErr", ";Mass [GeV];MassErr/Mass", 80,0.,4000.,50, 0., 10.);
 
     // Maybe we dont need these anymore
     // Have to deal with this later on, should a boolean to have them or not
@@ -1613,49 +1384,49 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   //  tuple->PostPreS_IasPixelIhVsLayer = dir.make<TH3F>("PostPreS_IasPixelIhVsLayer", ";G_{i}^{strips};I_{h} [MeV/cm];LayerIndex (pixels)", 50, 0., dEdxS_UpLim, 200, 0., dEdxM_UpLim, 10, 0.,10.);
   //  tuple->PostPreS_IasStripIhVsLayer = dir.make<TH3F>("PostPreS_IasStripIhVsLayer", ";G_{i}^{strips};I_{h} [MeV/cm];LayerIndex (strips)", 50, 0., dEdxS_UpLim, 200, 0., dEdxM_UpLim, 25, 0.,25.);
 
-    tuple->PostPreS_CluProbQVsPixelLayer = dir.make<TH2F>("PostPreS_CluProbQVsPixelLayer", ";Cluster Prob_{Q} (pixels);Pixel Layer",20,0.,1.,4,0.,4.);
-    tuple->PostPreS_CluProbXYVsPixelLayer = dir.make<TH2F>("PostPreS_CluProbXYVsPixelLayer", ";Cluster Prob_{XY} (pixels);Pixel Layer",100,0.,1.,4,0.,4.);
-    tuple->PostPreS_CluSizeVsPixelLayer = dir.make<TH2F>("PostPreS_CluSizeVsPixelLayer", ";CluSize;Pixel Layer",10,0.,10.,4,0.,4.);
-    tuple->PostPreS_CluSizeXVsPixelLayer = dir.make<TH2F>("PostPreS_CluSizeXVsPixelLayer", ";CluSizeX;Pixel Layer",10,0.,10.,4,0.,4.);
-    tuple->PostPreS_CluSizeYVsPixelLayer = dir.make<TH2F>("PostPreS_CluSizeYVsPixelLayer", ";CluSizeY;Pixel Layer",10,0.,10.,4,0.,4.);
-    tuple->PostPreS_CluSpecInCPEVsPixelLayer = dir.make<TH2F>("PostPreS_CluSpecInCPEVsPixelLayer", ";;Pixel Layer",4,-0.5,3.5,4,0.,4.);
+    tuple->PostPreS_CluProbQVsPixelLayer.book(histos, dir, "PostPreS_CluProbQVsPixelLayer", ";Cluster Prob_{Q} (pixels);Pixel Layer",20,0.,1.,4,0.,4.);
+    tuple->PostPreS_CluProbXYVsPixelLayer.book(histos, dir, "PostPreS_CluProbXYVsPixelLayer", ";Cluster Prob_{XY} (pixels);Pixel Layer",100,0.,1.,4,0.,4.);
+    tuple->PostPreS_CluSizeVsPixelLayer.book(histos, dir, "PostPreS_CluSizeVsPixelLayer", ";CluSize;Pixel Layer",10,0.,10.,4,0.,4.);
+    tuple->PostPreS_CluSizeXVsPixelLayer.book(histos, dir, "PostPreS_CluSizeXVsPixelLayer", ";CluSizeX;Pixel Layer",10,0.,10.,4,0.,4.);
+    tuple->PostPreS_CluSizeYVsPixelLayer.book(histos, dir, "PostPreS_CluSizeYVsPixelLayer", ";CluSizeY;Pixel Layer",10,0.,10.,4,0.,4.);
+    tuple->PostPreS_CluSpecInCPEVsPixelLayer.book(histos, dir, "PostPreS_CluSpecInCPEVsPixelLayer", ";;Pixel Layer",4,-0.5,3.5,4,0.,4.);
     tuple->PostPreS_CluSpecInCPEVsPixelLayer->GetXaxis()->SetBinLabel(1,"isOnEdge");
     tuple->PostPreS_CluSpecInCPEVsPixelLayer->GetXaxis()->SetBinLabel(2,"hasBadPixels");
     tuple->PostPreS_CluSpecInCPEVsPixelLayer->GetXaxis()->SetBinLabel(3,"spansTwoROCs");
 
-    tuple->PostPreS_CluProbQVsPixelLayer_highIas = dir.make<TH2F>("PostPreS_CluProbQVsPixelLayer_highIas", ";Cluster Prob_{Q} (pixels);Layer",20,0.,1.,4,0.,4.);
-    tuple->PostPreS_CluProbXYVsPixelLayer_highIas = dir.make<TH2F>("PostPreS_CluProbXYVsPixelLayer_highIas", ";Cluster Prob_{XY} (pixels);Layer",100,0.,1.,4,0.,4.);
-    tuple->PostPreS_CluSizeVsPixelLayer_highIas = dir.make<TH2F>("PostPreS_CluSizeVsPixelLayer_highIas", ";CluSize;Layer",10,0.,10.,4,0.,4.);
-    tuple->PostPreS_CluSizeXVsPixelLayer_highIas = dir.make<TH2F>("PostPreS_CluSizeXVsPixelLayer_highIas", ";CluSizeX;Layer",10,0.,10.,4,0.,4.);
-    tuple->PostPreS_CluSizeYVsPixelLayer_highIas = dir.make<TH2F>("PostPreS_CluSizeYVsPixelLayer_highIas", ";CluSizeY;Layer",10,0.,10.,4,0.,4.);
-    tuple->PostPreS_CluSpecInCPEVsPixelLayer_highIas = dir.make<TH2F>("PostPreS_CluSpecInCPEVsPixelLayer_highIas", ";;Layer",4,-0.5,3.5,4,0.,4.);
+    tuple->PostPreS_CluProbQVsPixelLayer_highIas.book(histos, dir, "PostPreS_CluProbQVsPixelLayer_highIas", ";Cluster Prob_{Q} (pixels);Layer",20,0.,1.,4,0.,4.);
+    tuple->PostPreS_CluProbXYVsPixelLayer_highIas.book(histos, dir, "PostPreS_CluProbXYVsPixelLayer_highIas", ";Cluster Prob_{XY} (pixels);Layer",100,0.,1.,4,0.,4.);
+    tuple->PostPreS_CluSizeVsPixelLayer_highIas.book(histos, dir, "PostPreS_CluSizeVsPixelLayer_highIas", ";CluSize;Layer",10,0.,10.,4,0.,4.);
+    tuple->PostPreS_CluSizeXVsPixelLayer_highIas.book(histos, dir, "PostPreS_CluSizeXVsPixelLayer_highIas", ";CluSizeX;Layer",10,0.,10.,4,0.,4.);
+    tuple->PostPreS_CluSizeYVsPixelLayer_highIas.book(histos, dir, "PostPreS_CluSizeYVsPixelLayer_highIas", ";CluSizeY;Layer",10,0.,10.,4,0.,4.);
+    tuple->PostPreS_CluSpecInCPEVsPixelLayer_highIas.book(histos, dir, "PostPreS_CluSpecInCPEVsPixelLayer_highIas", ";;Layer",4,-0.5,3.5,4,0.,4.);
     tuple->PostPreS_CluSpecInCPEVsPixelLayer_highIas->GetXaxis()->SetBinLabel(1,"isOnEdge");
     tuple->PostPreS_CluSpecInCPEVsPixelLayer_highIas->GetXaxis()->SetBinLabel(2,"hasBadPixels");
     tuple->PostPreS_CluSpecInCPEVsPixelLayer_highIas->GetXaxis()->SetBinLabel(3,"spansTwoROCs");
 
-    tuple->PostPreS_CluCotBetaVsPixelLayer_lowProbXY = dir.make<TH2F>("PostPreS_CluCotBetaVsPixelLayer_lowProbXY", ";CotBeta;Layer",200,-10.,10.,4,0.,4.);
-    tuple->PostPreS_CluCotAlphaVsPixelLayer_lowProbXY = dir.make<TH2F>("PostPreS_CluCotAlphaVsPixelLayer_lowProbXY", ";CotAlpha;Layer",100,-1.,1.,4,0.,4.);
-    tuple->PostPreS_CluCotBetaVsPixelLayer = dir.make<TH2F>("PostPreS_CluCotBetaVsPixelLayer", ";CotBeta;Layer",200,-10.,10.,4,0.,4.);
-    tuple->PostPreS_CluCotAlphaVsPixelLayer = dir.make<TH2F>("PostPreS_CluCotAlphaVsPixelLayer", ";CotAlpha;Layer",100,-1.,1.,4,0.,4.);
+    tuple->PostPreS_CluCotBetaVsPixelLayer_lowProbXY.book(histos, dir, "PostPreS_CluCotBetaVsPixelLayer_lowProbXY", ";CotBeta;Layer",200,-10.,10.,4,0.,4.);
+    tuple->PostPreS_CluCotAlphaVsPixelLayer_lowProbXY.book(histos, dir, "PostPreS_CluCotAlphaVsPixelLayer_lowProbXY", ";CotAlpha;Layer",100,-1.,1.,4,0.,4.);
+    tuple->PostPreS_CluCotBetaVsPixelLayer.book(histos, dir, "PostPreS_CluCotBetaVsPixelLayer", ";CotBeta;Layer",200,-10.,10.,4,0.,4.);
+    tuple->PostPreS_CluCotAlphaVsPixelLayer.book(histos, dir, "PostPreS_CluCotAlphaVsPixelLayer", ";CotAlpha;Layer",100,-1.,1.,4,0.,4.);
 
-    tuple->PostPreS_CluNormChargeVsStripLayer_lowBetaGamma = dir.make<TH2F>("PostPreS_CluNormChargeVsStripLayer_lowBetaGamma", ";CluNormCharge (e/um);Layer",600,0.,600.,24,-0.5,23.5);
-    tuple->PostPreS_CluNormChargeVsStripLayer_higherBetaGamma = dir.make<TH2F>("PostPreS_CluNormChargeVsStripLayer_higherBetaGamma", ";CluNormCharge (e/um);Layer",600,0.,600.,24,-0.5,23.5);
+    tuple->PostPreS_CluNormChargeVsStripLayer_lowBetaGamma.book(histos, dir, "PostPreS_CluNormChargeVsStripLayer_lowBetaGamma", ";CluNormCharge (e/um);Layer",600,0.,600.,24,-0.5,23.5);
+    tuple->PostPreS_CluNormChargeVsStripLayer_higherBetaGamma.book(histos, dir, "PostPreS_CluNormChargeVsStripLayer_higherBetaGamma", ";CluNormCharge (e/um);Layer",600,0.,600.,24,-0.5,23.5);
 
     tuple->PostPreS_dRMinPfJet = dir.make<TH1F>("PostPreS_dRMinPfJet", ";dRMinPfJet",100,0.,5.0);
     tuple->PostPreS_closestPfJetMuonFraction = dir.make<TH1F>("PostPreS_closestPfJetMuonFraction",";closestPfJetMuonFraction; Tracks / 0.05",20,0.,1.);
     tuple->PostPreS_closestPfJetElectronFraction = dir.make<TH1F>("PostPreS_closestPfJetElectronFraction", ";closestPfJetElectronFraction; Tracks / 0.05",20,0.,1.);
     tuple->PostPreS_closestPfJetPhotonFraction = dir.make<TH1F>("PostPreS_closestPfJetPhotonFraction", ";closestPfJetPhotonFraction; Tracks / 0.05",20,0.,1.);
 
-    tuple->PostPreS_closestPfJetMuonFractionVsIas = dir.make<TH2F>("PostPreS_closestPfJetMuonFractionVsIas",";closestPfJetMuonFraction;G_{i}^{strips}",20,0.,1.,20,0.,1.);
-    tuple->PostPreS_closestPfJetElectronFractionVsIas = dir.make<TH2F>("PostPreS_closestPfJetElectronFractionVsIas", ";closestPfJetElectronFraction;G_{i}^{strips}",20,0.,1.,20,0.,1.);
-    tuple->PostPreS_closestPfJetPhotonFractionVsIas = dir.make<TH2F>("PostPreS_closestPfJetPhotonFractionVsIas", ";closestPfJetPhotonFraction;G_{i}^{strips}",20,0.,1.,20,0.,1.);
+    tuple->PostPreS_closestPfJetMuonFractionVsIas.book(histos, dir, "PostPreS_closestPfJetMuonFractionVsIas",";closestPfJetMuonFraction;G_{i}^{strips}",20,0.,1.,20,0.,1.);
+    tuple->PostPreS_closestPfJetElectronFractionVsIas.book(histos, dir, "PostPreS_closestPfJetElectronFractionVsIas", ";closestPfJetElectronFraction;G_{i}^{strips}",20,0.,1.,20,0.,1.);
+    tuple->PostPreS_closestPfJetPhotonFractionVsIas.book(histos, dir, "PostPreS_closestPfJetPhotonFractionVsIas", ";closestPfJetPhotonFraction;G_{i}^{strips}",20,0.,1.,20,0.,1.);
 
-    tuple->PostPreS_dRMinPfJetVsIas = dir.make<TH2F>("PostPreS_dRMinPfJetVsIas", ";dRMinPfJet;G_{i}^{strips}",100,0.,5.0,10,0.,1.);
+    tuple->PostPreS_dRMinPfJetVsIas.book(histos, dir, "PostPreS_dRMinPfJetVsIas", ";dRMinPfJet;G_{i}^{strips}",100,0.,5.0,10,0.,1.);
     tuple->PostPreS_dRMinCaloJet = dir.make<TH1F>("PostPreS_dRMinCaloJet", ";dRMinCaloJet",100,0.,5.0);
     tuple->PostPreS_dPhiMinPfMet = dir.make<TH1F>("PostPreS_dPhiMinPfMet", ";dPhiMinPfMet",100,0.,3.2);
 
-    tuple->PostPreS_dRMinCaloJetVsIas =  dir.make<TH2F>("PostPreS_dRMinCaloJetVsIas", ";dRMinCaloJet;G_{i}^{strips}",100,0.,5.0,10,0.,1.);
-    tuple->PostPreS_dPhiMinPfMetVsIas =  dir.make<TH2F>("PostPreS_dPhiMinPfMetVsIas", ";dPhiMinPfMet;G_{i}^{strips}",100,0.,3.2,10,0.,1.);
+    tuple->PostPreS_dRMinCaloJetVsIas.book(histos, dir, "PostPreS_dRMinCaloJetVsIas", ";dRMinCaloJet;G_{i}^{strips}",100,0.,5.0,10,0.,1.);
+    tuple->PostPreS_dPhiMinPfMetVsIas.book(histos, dir, "PostPreS_dPhiMinPfMetVsIas", ";dPhiMinPfMet;G_{i}^{strips}",100,0.,3.2,10,0.,1.);
 
     tuple->PostPreS_RecoPfJetsNum = dir.make<TH1F>("PostPreS_RecoPfJetsNum", ";Number of PF jets;Tracks / 1",  15, -0.5, 15.5);
     tuple->PostPreS_RecoPfHT = dir.make<TH1F>("PostPreS_RecoPfHT", ";PfHT",100,0.,2000.);
@@ -1664,9 +1435,9 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
 
 
     // add  plots in Gitemplate region  to answer Slava's questions about charge resolution
-    tuple->PostPreS_CluPathLenghtVsPixLayer_CR_veryLowPt = dir.make<TH2F>("PostPreS_CluPathLenghtVsPixLayer_CR_veryLowPt",";Path lenght (um); Pixel layer",500, 250., 750.,10,0.,10.);
-     tuple->PostPreS_CluDeDxVsPixLayer_CR_veryLowPt = dir.make<TH2F>("PostPreS_CluDeDxVsPixLayer_CR_veryLowPt",";Cluster dEdx [MeV/cm]; Pixel layer",100,0.,10.,10,0.,10.);
-     tuple->PostPreS_CluDeDxVsStripsLayer_CR_veryLowPt = dir.make<TH2F>("PostPreS_CluDeDxVsStripsLayer_CR_veryLowPt",";Cluster dEdx [MeV/cm]; Strip layer",100,0.,10.,25,0.,25.);
+    tuple->PostPreS_CluPathLenghtVsPixLayer_CR_veryLowPt.book(histos, dir, "PostPreS_CluPathLenghtVsPixLayer_CR_veryLowPt",";Path lenght (um); Pixel layer",500, 250., 750.,10,0.,10.);
+     tuple->PostPreS_CluDeDxVsPixLayer_CR_veryLowPt.book(histos, dir, "PostPreS_CluDeDxVsPixLayer_CR_veryLowPt",";Cluster dEdx [MeV/cm]; Pixel layer",100,0.,10.,10,0.,10.);
+     tuple->PostPreS_CluDeDxVsStripsLayer_CR_veryLowPt.book(histos, dir, "PostPreS_CluDeDxVsStripsLayer_CR_veryLowPt",";Cluster dEdx [MeV/cm]; Strip layer",100,0.,10.,25,0.,25.);
      tuple->PostPreS_Ih_CR_veryLowPt = dir.make<TH1F>("PostPreS_Ih_CR_veryLowPt", ";I_{h} [MeV/cm];Tracks / bin", 200, 0, dEdxM_UpLim);
 //     tuple->PostPreS_Ihstrip_CR_veryLowPt = dir.make<TH1F>("PostPreS_Ihstrip_CR_veryLowPt", ";I_{h} (strip only) [MeV/cm];Tracks / bin", 200, 0, dEdxM_UpLim);
      tuple->PostPreS_Ih_noL1_CR_veryLowPt = dir.make<TH1F>("PostPreS_Ih_noL1_CR_veryLowPt", ";I_{h} (noL1) [MeV/cm];Tracks / bin", 200, 0, dEdxM_UpLim);
@@ -1700,23 +1471,23 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->BefPreS_TOF_Binned[std::to_string(i)] = dir.make<TH1F>("BefPreS_TOF_Binned", ";TOF (Binned) [GeV]", 150, -1, 5);
   }
 
-  tuple->PostS_CutIdVsEta_RegionA = dir.make<TH2F>("PostS_CutIdVsEta_RegionA", ";NCuts;#eta (RegionA)", NCuts, 0, NCuts, 52, -2.6, 2.6);
-  tuple->PostS_CutIdVsEta_RegionB = dir.make<TH2F>("PostS_CutIdVsEta_RegionB", ";NCuts;#eta (RegionB)", NCuts, 0, NCuts, 52, -2.6, 2.6);
-  tuple->PostS_CutIdVsEta_RegionC = dir.make<TH2F>("PostS_CutIdVsEta_RegionC", ";NCuts;#eta (RegionC)", NCuts, 0, NCuts, 52, -2.6, 2.6);
-  tuple->PostS_CutIdVsEta_RegionD = dir.make<TH2F>("PostS_CutIdVsEta_RegionD", ";NCuts;#eta (RegionD)", NCuts, 0, NCuts, 52, -2.6, 2.6);
-  tuple->PostS_CutIdVsEta_RegionE = dir.make<TH2F>("PostS_CutIdVsEta_RegionE", ";NCuts;#eta (RegionE)", NCuts, 0, NCuts, 52, -2.6, 2.6);
-  tuple->PostS_CutIdVsEta_RegionF = dir.make<TH2F>("PostS_CutIdVsEta_RegionF", ";NCuts;#eta (RegionF)", NCuts, 0, NCuts, 52, -2.6, 2.6);
-  tuple->PostS_CutIdVsEta_RegionG = dir.make<TH2F>("PostS_CutIdVsEta_RegionG", ";NCuts;#eta (RegionG)", NCuts, 0, NCuts, 52, -2.6, 2.6);
-  tuple->PostS_CutIdVsEta_RegionH = dir.make<TH2F>("PostS_CutIdVsEta_RegionH", ";NCuts;#eta (RegionH)", NCuts, 0, NCuts, 52, -2.6, 2.6);
+  tuple->PostS_CutIdVsEta_RegionA.book(histos, dir, "PostS_CutIdVsEta_RegionA", ";NCuts;#eta (RegionA)", NCuts, 0, NCuts, 52, -2.6, 2.6);
+  tuple->PostS_CutIdVsEta_RegionB.book(histos, dir, "PostS_CutIdVsEta_RegionB", ";NCuts;#eta (RegionB)", NCuts, 0, NCuts, 52, -2.6, 2.6);
+  tuple->PostS_CutIdVsEta_RegionC.book(histos, dir, "PostS_CutIdVsEta_RegionC", ";NCuts;#eta (RegionC)", NCuts, 0, NCuts, 52, -2.6, 2.6);
+  tuple->PostS_CutIdVsEta_RegionD.book(histos, dir, "PostS_CutIdVsEta_RegionD", ";NCuts;#eta (RegionD)", NCuts, 0, NCuts, 52, -2.6, 2.6);
+  tuple->PostS_CutIdVsEta_RegionE.book(histos, dir, "PostS_CutIdVsEta_RegionE", ";NCuts;#eta (RegionE)", NCuts, 0, NCuts, 52, -2.6, 2.6);
+  tuple->PostS_CutIdVsEta_RegionF.book(histos, dir, "PostS_CutIdVsEta_RegionF", ";NCuts;#eta (RegionF)", NCuts, 0, NCuts, 52, -2.6, 2.6);
+  tuple->PostS_CutIdVsEta_RegionG.book(histos, dir, "PostS_CutIdVsEta_RegionG", ";NCuts;#eta (RegionG)", NCuts, 0, NCuts, 52, -2.6, 2.6);
+  tuple->PostS_CutIdVsEta_RegionH.book(histos, dir, "PostS_CutIdVsEta_RegionH", ";NCuts;#eta (RegionH)", NCuts, 0, NCuts, 52, -2.6, 2.6);
 
 //  tuple->PostS_CutIdVsBeta_postPt = dir.make<TH2F>("PostS_CutIdVsBeta_postPt", ";NCuts;#beta (p_{T} > p_{T,cut})", NCuts, 0, NCuts, 20, 0, 1);
 //  tuple->PostS_CutIdVsBeta_postPtAndIas = dir.make<TH2F>("PostS_CutIdVsBeta_postPtAndIas", ";NCuts;#beta (p_{T} > p_{T,cut} and G_{i}^{strips} > I_{as,cut} )", NCuts, 0, NCuts, 20, 0, 1);
 //  tuple->PostS_CutIdVsBeta_postPtAndIasAndTOF = dir.make<TH2F>("PostS_CutIdVsBeta_postPtAndIasAndTOF", ";NCuts;#beta (p_{T} > p_{T,cut} and G_{i}^{strips} > I_{as,cut} and TOF > TOF_{cut} ", NCuts, 0, NCuts, 20, 0, 1);
 
-  tuple->PostS_CutIdVsP = dir.make<TH2F>("PostS_CutIdVsP", ";NCuts;p [GeV]", NCuts, 0, NCuts, 40, 0., PtHistoUpperBound);
-  tuple->PostS_CutIdVsPt = dir.make<TH2F>("PostS_CutIdVsPt", ";NCuts;p_{T} [GeV]", NCuts, 0, NCuts, 40, 0., PtHistoUpperBound);
-  tuple->PostS_CutIdVsIas = dir.make<TH2F>("PostS_CutIdVsIas", ";NCuts;G_{i}^{strips}", NCuts, 0, NCuts, 10, 0., 1.);
-  tuple->PostS_CutIdVsIh = dir.make<TH2F>("PostS_CutIdVsIh", ";NCuts;I_{h} [MeV/cm]", NCuts, 0, NCuts, 100, 0, dEdxM_UpLim);
+  tuple->PostS_CutIdVsP.book(histos, dir, "PostS_CutIdVsP", ";NCuts;p [GeV]", NCuts, 0, NCuts, 40, 0., PtHistoUpperBound);
+  tuple->PostS_CutIdVsPt.book(histos, dir, "PostS_CutIdVsPt", ";NCuts;p_{T} [GeV]", NCuts, 0, NCuts, 40, 0., PtHistoUpperBound);
+  tuple->PostS_CutIdVsIas.book(histos, dir, "PostS_CutIdVsIas", ";NCuts;G_{i}^{strips}", NCuts, 0, NCuts, 10, 0., 1.);
+  tuple->PostS_CutIdVsIh.book(histos, dir, "PostS_CutIdVsIh", ";NCuts;I_{h} [MeV/cm]", NCuts, 0, NCuts, 100, 0, dEdxM_UpLim);
 
     // not running this for a bit, they are not used currently, and being 3D histos they are quite big
 //    tuple->PostS_CutIdVsPVsIas = dir.make<TH3F>("PostS_CutIdVsPVsIas", ";NCuts;p [GeV];G_{i}^{strips}", NCuts, 0, NCuts, 40, 0., PtHistoUpperBound, 10, 0., 1.);
@@ -1734,157 +1505,157 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
   tuple->PostS_Ias = dir.make<TH1F>("PostS_Ias", ";G_{i}^{strips};Events / 0.1", 10, 0, dEdxS_UpLim);
   tuple->PostS_FiStrips = dir.make<TH1F>("PostS_FiStrips", ";F_{i}^{strips};Events / 0.1", 10, 0., 1.);
   tuple->PostS_FiStripsLog = dir.make<TH1F>("PostS_FiStripsLog", ";-log(1-F_{i}^{strips});Events / 0.05", 120, 0., 6.);
-  tuple->PostS_IasVsFiStrips = dir.make<TH2F>("PostS_IasVsFiStrips", ";G_{i}^{strips};F_{i}^{strips}", 20, 0., 1.,20, 0., 1.);
+  tuple->PostS_IasVsFiStrips.book(histos, dir, "PostS_IasVsFiStrips", ";G_{i}^{strips};F_{i}^{strips}", 20, 0., 1.,20, 0., 1.);
   tuple->PostS_ProbQNoL1 = dir.make<TH1F>("PostS_ProbQNoL1", ";F_{i}^{pixels};Events / bin", 20, 0., 1.);
-  tuple->PostS_ProbQNoL1VsIas = dir.make<TH2F>("PostS_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-  tuple->PostS_ProbQNoL1VsFiStrips = dir.make<TH2F>("PostS_ProbQNoL1VsFiStrips", ";F_{i}^{pixels};F_{i}^{strips};Events",20, 0., 1., 20, 0., 1.);
+  tuple->PostS_ProbQNoL1VsIas.book(histos, dir, "PostS_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+  tuple->PostS_ProbQNoL1VsFiStrips.book(histos, dir, "PostS_ProbQNoL1VsFiStrips", ";F_{i}^{pixels};F_{i}^{strips};Events",20, 0., 1., 20, 0., 1.);
   
   tuple->PostS_SR2FAIL_Ias_PUA = dir.make<TH1F>("PostS_SR2FAIL_Ias_PUA", ";G_{i}^{strips} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9, PU < 15);Events / 0.1", 10, 0, dEdxS_UpLim);
   tuple->PostS_SR2FAIL_Ias_PUB = dir.make<TH1F>("PostS_SR2FAIL_Ias_PUB", ";G_{i}^{strips} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9, 15 < PU < 30);Events / 0.1", 10, 0, dEdxS_UpLim);
   tuple->PostS_SR2FAIL_Ias_PUC = dir.make<TH1F>("PostS_SR2FAIL_Ias_PUC", ";G_{i}^{strips} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9, PU > 30);Events / 0.1", 10, 0, dEdxS_UpLim);
   
   tuple->PostS_SR2FAIL_PV = dir.make<TH1F>("PostS_SR2FAIL_PV", ";PV (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9, G_{i}^{strips} > 0.25);Events / 1", 60, -0.5, 59.5);
-  tuple->PostS_SR2FAIL_PtErrOverPtVsIas = dir.make<TH2F>("PostS_SR2FAIL_PtErrOverPtVsIas", ";#sigma_{p_{T}}/p_{T} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9;G_{i}^{strips};Events / bin", 40, 0., 2., 20, 0., 1.);
-  tuple->PostS_SR2FAIL_TIsolVsIas = dir.make<TH2F>("PostS_SR2FAIL_TIsolVsIas", ";#Sigma_{R<0.3} p_{T} - p_{T,cand} [GeV] (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9);G_{i}^{strips};Events / bin", 20, 0., 100., 20, 0., 1.);
+  tuple->PostS_SR2FAIL_PtErrOverPtVsIas.book(histos, dir, "PostS_SR2FAIL_PtErrOverPtVsIas", ";#sigma_{p_{T}}/p_{T} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9;G_{i}^{strips};Events / bin", 40, 0., 2., 20, 0., 1.);
+  tuple->PostS_SR2FAIL_TIsolVsIas.book(histos, dir, "PostS_SR2FAIL_TIsolVsIas", ";#Sigma_{R<0.3} p_{T} - p_{T,cand} [GeV] (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9);G_{i}^{strips};Events / bin", 20, 0., 100., 20, 0., 1.);
   tuple->PostS_SR2FAIL_PtErrOverPt2 = dir.make<TH1F>("PostS_SR2FAIL_PtErrOverPt2", ";#sigma_{p_{T}}/p_{T}^{2} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9, G_{i}^{strips} > 0.25);Events / bin", 40, 0, 0.003);
   tuple->PostS_SR2FAIL_RelDiffTrackPtAndTruthPt = dir.make<TH1F>("PostS_SR2FAIL_RelDiffTrackPtAndTruthPt", ";(track p_{T}^{reco} - p_{T}^{gen}) / p_{T}^{gen} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9, G_{i}^{strips} > 0.25);Events / bin", 60,-1.0,2.0);
-  tuple->PostS_SR2FAIL_RelDiffTrackPtAndTruthPtVsTruthPt = dir.make<TH2F>("PostS_SR2FAIL_RelDiffTrackPtAndTruthPtVsTruthPt", ";(track p_{T}^{reco} - p_{T}^{gen}) / p_{T}^{gen} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9, G_{i}^{strips} > 0.25);p_{T}^{gen}", 60,-1.0,2.0,20,0.,4000.);
+  tuple->PostS_SR2FAIL_RelDiffTrackPtAndTruthPtVsTruthPt.book(histos, dir, "PostS_SR2FAIL_RelDiffTrackPtAndTruthPtVsTruthPt", ";(track p_{T}^{reco} - p_{T}^{gen}) / p_{T}^{gen} (p_{T} > 200 GeV, F_{i}^{pixels} < 0.9, G_{i}^{strips} > 0.25);p_{T}^{gen}", 60,-1.0,2.0,20,0.,4000.);
   
-  tuple->PostS_SR2PASS_PtErrOverPtVsIas = dir.make<TH2F>("PostS_SR2PASS_PtErrOverPtVsIas", ";#sigma_{p_{T}}/p_{T} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9;G_{i}^{strips};Events / bin", 40, 0., 2., 20, 0., 1.);
-  tuple->PostS_SR2PASS_TIsolVsIas = dir.make<TH2F>("PostS_SR2PASS_TIsolVsIas", ";#Sigma_{R<0.3} p_{T} - p_{T,cand} [GeV] (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9);G_{i}^{strips};Events / bin", 20, 0., 100., 20, 0., 1.);
+  tuple->PostS_SR2PASS_PtErrOverPtVsIas.book(histos, dir, "PostS_SR2PASS_PtErrOverPtVsIas", ";#sigma_{p_{T}}/p_{T} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9;G_{i}^{strips};Events / bin", 40, 0., 2., 20, 0., 1.);
+  tuple->PostS_SR2PASS_TIsolVsIas.book(histos, dir, "PostS_SR2PASS_TIsolVsIas", ";#Sigma_{R<0.3} p_{T} - p_{T,cand} [GeV] (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9);G_{i}^{strips};Events / bin", 20, 0., 100., 20, 0., 1.);
   
   
   tuple->PostS_SR2PASS_Ias_PUA = dir.make<TH1F>("PostS_SR2PASS_Ias_PUA", ";G_{i}^{strips} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9, PU < 15);Events / 0.1", 10, 0, dEdxS_UpLim);
   tuple->PostS_SR2PASS_Ias_PUB = dir.make<TH1F>("PostS_SR2PASS_Ias_PUB", ";G_{i}^{strips} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9, 15 < PU < 30);Events / 0.1", 10, 0, dEdxS_UpLim);
   tuple->PostS_SR2PASS_Ias_PUC = dir.make<TH1F>("PostS_SR2PASS_Ias_PUC", ";G_{i}^{strips} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9, PU > 30);Events / 0.1", 10, 0, dEdxS_UpLim);
   
-  tuple->PostS_SR2PASS_RunVsLs = dir.make<TH2F>("PostS_SR2PASS_RunVsLs", ";Run number;Lumisection",  545, 271000,325500, 1500, 0.,1500.);
+  tuple->PostS_SR2PASS_RunVsLs.book(histos, dir, "PostS_SR2PASS_RunVsLs", ";Run number;Lumisection",  545, 271000,325500, 1500, 0.,1500.);
   tuple->PostS_SR2PASS_Ls = dir.make<TH1F>("PostS_SR2PASS_Ls", ";Lumisection", 1500, 0.,1500.);
   
   tuple->PostS_SR2PASS_PV = dir.make<TH1F>("PostS_SR2PASS_PV", ";PV (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9, G_{i}^{strips} > 0.25);Events / 1", 60, -0.5, 59.5);
   tuple->PostS_SR2PASS_PtErrOverPt2 = dir.make<TH1F>("PostS_SR2PASS_PtErrOverPt2", ";#sigma_{p_{T}}/p_{T}^{2} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9, G_{i}^{strips} > 0.25);Events / bin", 40, 0, 0.003);
   tuple->PostS_SR2PASS_RelDiffTrackPtAndTruthPt = dir.make<TH1F>("PostS_SR2PASS_RelDiffTrackPtAndTruthPt", ";(track p_{T}^{reco} - p_{T}^{gen}) / p_{T}^{gen} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9, G_{i}^{strips} > 0.25);Events / bin", 60,-1.0,2.0);
-  tuple->PostS_SR2PASS_RelDiffTrackPtAndTruthPtVsTruthPt = dir.make<TH2F>("PostS_SR2PASS_RelDiffTrackPtAndTruthPtVsTruthPt", ";(track p_{T}^{reco} - p_{T}^{gen}) / p_{T}^{gen} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9, G_{i}^{strips} > 0.25);p_{T}^{gen}", 60,-1.0,2.0,20,0.,4000.);
+  tuple->PostS_SR2PASS_RelDiffTrackPtAndTruthPtVsTruthPt.book(histos, dir, "PostS_SR2PASS_RelDiffTrackPtAndTruthPtVsTruthPt", ";(track p_{T}^{reco} - p_{T}^{gen}) / p_{T}^{gen} (p_{T} > 200 GeV, F_{i}^{pixels} > 0.9, G_{i}^{strips} > 0.25);p_{T}^{gen}", 60,-1.0,2.0,20,0.,4000.);
   
-  tuple->PostS_ProbQNoL1VsIasVsPt = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+  tuple->PostS_ProbQNoL1VsIasVsPt.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
   if (doSystsPlots_) {
-    tuple->PostS_ProbQNoL1VsIasVsPt_Pileup_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_Pileup_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_Ias_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_IasShift_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_IasShift_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_Ias_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_Pileup_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_Pileup_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_Ias_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_IasShift_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_IasShift_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_Ias_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
 
-    tuple->PostS_ProbQNoL1VsIasVsPt_IasShift_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_IasShift_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_IasShift_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_IasShift_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
 
 
 
-    tuple->PostS_ProbQNoL1VsIasVsPt_Pt_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_Pt_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_Trigger_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_Trigger_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_Pt_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_Pt_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_Trigger_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_Trigger_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
   }
-  tuple->PostS_ProbQNoL1VsFiStripsVsPt = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+  tuple->PostS_ProbQNoL1VsFiStripsVsPt.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
   if (doSystsPlots_) {
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Pileup_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_Pileup_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Pileup_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_Pileup_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Ias_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_Ias_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Ias_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_Ias_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Pt_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_Pt_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Pt_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_Pt_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Trigger_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_Trigger_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Trigger_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsVsPt_Trigger_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Pileup_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_Pileup_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Pileup_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_Pileup_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_ProbQNoL1_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Ias_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_Ias_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Ias_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_Ias_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Pt_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_Pt_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Pt_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_Pt_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Trigger_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_Trigger_up", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsVsPt_Trigger_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsVsPt_Trigger_down", ";F_{i}^{pixels};F_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
   }
-  tuple->PostS_ProbQNoL1VsFiStripsLogVsPt = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+  tuple->PostS_ProbQNoL1VsFiStripsLogVsPt.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
   tuple->PostS_GenBeta = dir.make<TH1F>("PostS_GenBeta", ";#beta;Gen candidate / 0.05", 20, 0., 1.);
   tuple->PostS_TriggerGenBeta = dir.make<TH1F>("PostS_TriggerGenBeta", ";#beta^{HLT};Events / 0.05", 20, 0., 1.);
 
   if (doSystsPlots_) {
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_up = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_down = dir.make<TH3F>("PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_Pileup_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_ProbQNoL1_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_Ias_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_Pt_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_up.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_up", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_down.book(histos, dir, "PostS_ProbQNoL1VsFiStripsLogVsPt_Trigger_down", ";F_{i}^{pixels};-log(1-F_{i}^{strips});p_{T} [GeV]",20, 0., 1., 120, 0., 6.,160, 0., PtHistoUpperBound);
     
-    tuple->PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_MuonIDSF_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_MuonIDSF_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_MuonIDSF_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_MuonIDSF_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_up = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
-    tuple->PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_down = dir.make<TH3F>("PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_MuonRecoSF_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_MuonIDSF_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_MuonIDSF_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_MuonIDSF_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_MuonIDSF_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_up.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_up", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
+    tuple->PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_down.book(histos, dir, "PostS_ProbQNoL1VsIasVsPt_MuonTriggerSF_down", ";F_{i}^{pixels};G_{i}^{strips};p_{T} [GeV]",20, 0., 1., 100, 0., 1.,160, 0., PtHistoUpperBound);
 
     // Inclusive 2D plots for Alphabet
-    tuple->PostS_ProbQNoL1VsIas_Pileup_up = dir.make<TH2F>("PostS_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_Pileup_down = dir.make<TH2F>("PostS_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_ProbQNoL1_up = dir.make<TH2F>("PostS_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_ProbQNoL1_down = dir.make<TH2F>("PostS_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_Pt_up = dir.make<TH2F>("PostS_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_Pt_down = dir.make<TH2F>("PostS_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_Ias_up = dir.make<TH2F>("PostS_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_Ias_down = dir.make<TH2F>("PostS_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_Trigger_up = dir.make<TH2F>("PostS_ProbQNoL1VsIas_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_ProbQNoL1VsIas_Trigger_down = dir.make<TH2F>("PostS_ProbQNoL1VsIas_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_Pileup_up.book(histos, dir, "PostS_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_Pileup_down.book(histos, dir, "PostS_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_ProbQNoL1_up.book(histos, dir, "PostS_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_ProbQNoL1_down.book(histos, dir, "PostS_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_Pt_up.book(histos, dir, "PostS_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_Pt_down.book(histos, dir, "PostS_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_Ias_up.book(histos, dir, "PostS_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_Ias_down.book(histos, dir, "PostS_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_Trigger_up.book(histos, dir, "PostS_ProbQNoL1VsIas_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_ProbQNoL1VsIas_Trigger_down.book(histos, dir, "PostS_ProbQNoL1VsIas_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
   }
   
   tuple->PostS_SR1_Ias = dir.make<TH1F>("PostS_SR1_Ias", ";G_{i}^{strips};Events / 0.1", 10, 0, dEdxS_UpLim);
   tuple->PostS_SR1_ProbQNoL1 = dir.make<TH1F>("PostS_SR1_ProbQNoL1", ";F_{i}^{pixels};Events / bin", 20, 0., 1.);
-  tuple->PostS_SR1_ProbQNoL1VsIas = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+  tuple->PostS_SR1_ProbQNoL1VsIas.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
   if (doSystsPlots_) {
-    tuple->PostS_SR1_ProbQNoL1VsIas_Pileup_up = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_Pileup_down = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_up = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_down = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_Pt_up = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_Pt_down = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_Ias_up = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_Ias_down = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_Trigger_up = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR1_ProbQNoL1VsIas_Trigger_down = dir.make<TH2F>("PostS_SR1_ProbQNoL1VsIas_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_Pileup_up.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_Pileup_down.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_up.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_down.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_Pt_up.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_Pt_down.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_Ias_up.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_Ias_down.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_Trigger_up.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR1_ProbQNoL1VsIas_Trigger_down.book(histos, dir, "PostS_SR1_ProbQNoL1VsIas_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
   }
   
   
   tuple->PostS_SR2_Ias = dir.make<TH1F>("PostS_SR2_Ias", ";G_{i}^{strips};Events / 0.1", 10, 0, dEdxS_UpLim);
   tuple->PostS_SR2_ProbQNoL1 = dir.make<TH1F>("PostS_SR2_ProbQNoL1", ";F_{i}^{pixels};Events / bin", 20, 0., 1.);
-  tuple->PostS_SR2_ProbQNoL1VsIas = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+  tuple->PostS_SR2_ProbQNoL1VsIas.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
   if (doSystsPlots_) {
-    tuple->PostS_SR2_ProbQNoL1VsIas_Pileup_up = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_Pileup_down = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_up = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_down = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_Pt_up = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_Pt_down = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_Ias_up = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_IasShift_up = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_IasShift_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_Ias_down = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_IasShift_down = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_IasShift_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_Trigger_up = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR2_ProbQNoL1VsIas_Trigger_down = dir.make<TH2F>("PostS_SR2_ProbQNoL1VsIas_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_Pileup_up.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_Pileup_down.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_up.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_down.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_Pt_up.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_Pt_down.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_Ias_up.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_IasShift_up.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_IasShift_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_Ias_down.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_IasShift_down.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_IasShift_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_Trigger_up.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR2_ProbQNoL1VsIas_Trigger_down.book(histos, dir, "PostS_SR2_ProbQNoL1VsIas_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
   }
   
-  tuple->PostS_SR2_ProbQNoL1VsIasVsMass = dir.make<TH3F>("PostS_SR2_ProbQNoL1VsIasVsMass", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.,80,0.,4000.);
+  tuple->PostS_SR2_ProbQNoL1VsIasVsMass.book(histos, dir, "PostS_SR2_ProbQNoL1VsIasVsMass", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.,80,0.,4000.);
   
   tuple->PostS_SR3_Ias = dir.make<TH1F>("PostS_SR3_Ias", ";G_{i}^{strips};Events / 0.1", 10, 0, dEdxS_UpLim);
   tuple->PostS_SR3_ProbQNoL1 = dir.make<TH1F>("PostS_SR3_ProbQNoL1", ";F_{i}^{pixels};Events / bin", 20, 0., 1.);
-  tuple->PostS_SR3_ProbQNoL1VsIas = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+  tuple->PostS_SR3_ProbQNoL1VsIas.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
   if (doSystsPlots_) {
-    tuple->PostS_SR3_ProbQNoL1VsIas_Pileup_up = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_Pileup_down = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_up = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_down = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_Pt_up = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_Pt_down = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_Ias_up = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_Ias_down = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_Trigger_up = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
-    tuple->PostS_SR3_ProbQNoL1VsIas_Trigger_down = dir.make<TH2F>("PostS_SR3_ProbQNoL1VsIas_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_Pileup_up.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_Pileup_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_Pileup_down.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_Pileup_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_up.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_down.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_ProbQNoL1_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_Pt_up.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_Pt_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_Pt_down.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_Pt_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_Ias_up.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_Ias_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_Ias_down.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_Ias_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_Trigger_up.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_Trigger_up", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
+    tuple->PostS_SR3_ProbQNoL1VsIas_Trigger_down.book(histos, dir, "PostS_SR3_ProbQNoL1VsIas_Trigger_down", ";F_{i}^{pixels};G_{i}^{strips};Events",20, 0., 1., 50, 0., 1.);
   }
 
   tuple->PostS_VR1_Mass = dir.make<TH1F>("PostS_VR1_Mass", ";Mass [GeV];Events / bin", 400, 0, 4000);
@@ -2489,12 +2260,12 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
 
     //The following are only used to create the predicted mass spectrum.  Memory intensive so don't initialize for analyses not doing mass fits
     if (TypeMode < 3) {
-      tuple->Pred_I = dir.make<TH2F>("Pred_I", ";NCuts;Pred_I", NCuts, 0, NCuts, 40, 0, dEdxM_UpLim);
-      tuple->Pred_EtaI = dir.make<TH3F>("Pred_EtaI", ";NCuts;Pred_EtaI", NCuts, 0, NCuts, EtaBins, -3., 3., 40, 0, dEdxM_UpLim);
-      tuple->Pred_EtaB = dir.make<TH2F>("Pred_EtaB", ";NCuts;Pred_EtaB", NCuts, 0, NCuts, EtaBins, -3., 3.);
-      tuple->Pred_EtaS = dir.make<TH2F>("Pred_EtaS", ";NCuts;Pred_EtaS", NCuts, 0, NCuts, EtaBins, -3., 3.);
-      tuple->Pred_EtaS2 = dir.make<TH2F>("Pred_EtaS2", ";NCuts;Pred_EtaS2", NCuts, 0, NCuts, EtaBins, -3., 3.);
-      tuple->Pred_EtaP = dir.make<TH3F>("Pred_EtaP", ";NCuts;#eta;P", NCuts, 0, NCuts, EtaBins, -3., 3., 200, GlobalMinPt, PtHistoUpperBound);
+      tuple->Pred_I.book(histos, dir, "Pred_I", ";NCuts;Pred_I", NCuts, 0, NCuts, 40, 0, dEdxM_UpLim);
+      tuple->Pred_EtaI.book(histos, dir, "Pred_EtaI", ";NCuts;Pred_EtaI", NCuts, 0, NCuts, EtaBins, -3., 3., 40, 0, dEdxM_UpLim);
+      tuple->Pred_EtaB.book(histos, dir, "Pred_EtaB", ";NCuts;Pred_EtaB", NCuts, 0, NCuts, EtaBins, -3., 3.);
+      tuple->Pred_EtaS.book(histos, dir, "Pred_EtaS", ";NCuts;Pred_EtaS", NCuts, 0, NCuts, EtaBins, -3., 3.);
+      tuple->Pred_EtaS2.book(histos, dir, "Pred_EtaS2", ";NCuts;Pred_EtaS2", NCuts, 0, NCuts, EtaBins, -3., 3.);
+      tuple->Pred_EtaP.book(histos, dir, "Pred_EtaP", ";NCuts;#eta;P", NCuts, 0, NCuts, EtaBins, -3., 3., 200, GlobalMinPt, PtHistoUpperBound);
 //      tuple->Pred_TOF = dir.make<TH2F>("Pred_TOF", ";NCuts;Pred_TOF", NCuts, 0, NCuts, 200, GlobalMinTOF, 5);
       //pz
       
@@ -2526,12 +2297,12 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
 //      }
     }
 
-    tuple->RegionD_I = dir.make<TH2F>("RegionD_I", ";NCuts;RegionD_I", NCuts, 0, NCuts, 40, 0, dEdxM_UpLim);
-    tuple->RegionD_Ias = dir.make<TH2F>("RegionD_Ias", ";NCuts;RegionD_Ias", NCuts, 0, NCuts, 100, 0, dEdxS_UpLim);
-    tuple->RegionD_P = dir.make<TH2F>("RegionD_P", ";NCuts;RegionD_P", NCuts, 0, NCuts, 200, GlobalMinPt, PtHistoUpperBound);
-    tuple->RegionD_TOF = dir.make<TH2F>("RegionD_TOF", ";NCuts;RegionD_TOF", NCuts, 0, NCuts, 200, GlobalMinTOF, 5);
+    tuple->RegionD_I.book(histos, dir, "RegionD_I", ";NCuts;RegionD_I", NCuts, 0, NCuts, 40, 0, dEdxM_UpLim);
+    tuple->RegionD_Ias.book(histos, dir, "RegionD_Ias", ";NCuts;RegionD_Ias", NCuts, 0, NCuts, 100, 0, dEdxS_UpLim);
+    tuple->RegionD_P.book(histos, dir, "RegionD_P", ";NCuts;RegionD_P", NCuts, 0, NCuts, 200, GlobalMinPt, PtHistoUpperBound);
+    tuple->RegionD_TOF.book(histos, dir, "RegionD_TOF", ";NCuts;RegionD_TOF", NCuts, 0, NCuts, 200, GlobalMinTOF, 5);
 
-    tuple->RegionH_Ias = dir.make<TH2F>("RegionH_Ias", ";NCuts;RegionH_Ias", NCuts, 0, NCuts, 100, 0, dEdxS_UpLim);
+    tuple->RegionH_Ias.book(histos, dir, "RegionH_Ias", ";NCuts;RegionH_Ias", NCuts, 0, NCuts, 100, 0, dEdxS_UpLim);
 
     tuple->H_A_Flip = dir.make<TH1D>("H_A_Flip", ";NCuts_Flip;H_A_Flip", NCuts_Flip, 0, NCuts_Flip);
     tuple->H_B_Flip = dir.make<TH1D>("H_B_Flip", ";NCuts_Flip;H_B_Flip", NCuts_Flip, 0, NCuts_Flip);
@@ -2551,8 +2322,8 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->PostS_RecoHSCParticleType->GetXaxis()->SetBinLabel(6,"unknown");
     
     tuple->HSCPE = dir.make<TH1F>("HSCPE", ";NCuts;HSCPE", NCuts, 0, NCuts);
-    tuple->Mass = dir.make<TH2F>("Mass", ";NCuts;Mass", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-    tuple->MaxEventMass = dir.make<TH2F>("MaxEventMass", ";NCuts;MaxEventMass", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+    tuple->Mass.book(histos, dir, "Mass", ";NCuts;Mass", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+    tuple->MaxEventMass.book(histos, dir, "MaxEventMass", ";NCuts;MaxEventMass", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
     if (calcSyst_) {
       tuple->HSCPE_SystP = dir.make<TH1F>("HSCPE_SystP", ";NCuts;HSCPE_SystP", NCuts, 0, NCuts);
       tuple->HSCPE_SystI = dir.make<TH1F>("HSCPE_SystI", ";NCuts;HSCPE_SystI", NCuts, 0, NCuts);
@@ -2561,43 +2332,43 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
       tuple->HSCPE_SystHUp = dir.make<TH1F>("HSCPE_SystHUp", ";NCuts;HSCPE_SystHUp", NCuts, 0, NCuts);
       tuple->HSCPE_SystHDown = dir.make<TH1F>("HSCPE_SystHDown", ";NCuts;HSCPE_SystHDown", NCuts, 0, NCuts);
 
-      tuple->Mass_SystP = dir.make<TH2F>("Mass_SystP", ";NCuts;Mass_SystP", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MaxEventMass_SystP = dir.make<TH2F>("MaxEventMass_SystP", ";NCuts;MaxEventMass_SystP", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->Mass_SystI = dir.make<TH2F>("Mass_SystI", ";NCuts;Mass_SystI", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MaxEventMass_SystI = dir.make<TH2F>("MaxEventMass_SystI", ";NCuts;MaxEventMass_SystI", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->Mass_SystM = dir.make<TH2F>("Mass_SystM", ";NCuts;Mass_SystM", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MaxEventMass_SystM = dir.make<TH2F>("MaxEventMass_SystM", ";NCuts;MaxEventMass_SystM", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->Mass_SystPU = dir.make<TH2F>("Mass_SystPU", ";NCuts;Mass_SystPU", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MaxEventMass_SystPU = dir.make<TH2F>("MaxEventMass_SystPU", ";NCuts;MaxEventMass_SystPU", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->Mass_SystHUp = dir.make<TH2F>("Mass_SystHUp", ";NCuts;Mass_SystHUp", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MaxEventMass_SystHUp = dir.make<TH2F>("MaxEventMass_SystHUp", ";NCuts;MaxEventMass_SystHUp", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->Mass_SystHDown = dir.make<TH2F>("Mass_SystHDown", ";NCuts;Mass_SystHDown", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MaxEventMass_SystHDown = dir.make<TH2F>("MaxEventMass_SystHDown", ";NCuts;MaxEventMass_SystHDown", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->Mass_SystP.book(histos, dir, "Mass_SystP", ";NCuts;Mass_SystP", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MaxEventMass_SystP.book(histos, dir, "MaxEventMass_SystP", ";NCuts;MaxEventMass_SystP", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->Mass_SystI.book(histos, dir, "Mass_SystI", ";NCuts;Mass_SystI", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MaxEventMass_SystI.book(histos, dir, "MaxEventMass_SystI", ";NCuts;MaxEventMass_SystI", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->Mass_SystM.book(histos, dir, "Mass_SystM", ";NCuts;Mass_SystM", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MaxEventMass_SystM.book(histos, dir, "MaxEventMass_SystM", ";NCuts;MaxEventMass_SystM", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->Mass_SystPU.book(histos, dir, "Mass_SystPU", ";NCuts;Mass_SystPU", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MaxEventMass_SystPU.book(histos, dir, "MaxEventMass_SystPU", ";NCuts;MaxEventMass_SystPU", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->Mass_SystHUp.book(histos, dir, "Mass_SystHUp", ";NCuts;Mass_SystHUp", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MaxEventMass_SystHUp.book(histos, dir, "MaxEventMass_SystHUp", ";NCuts;MaxEventMass_SystHUp", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->Mass_SystHDown.book(histos, dir, "Mass_SystHDown", ";NCuts;Mass_SystHDown", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MaxEventMass_SystHDown.book(histos, dir, "MaxEventMass_SystHDown", ";NCuts;MaxEventMass_SystHDown", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
     }
-    tuple->Mass_Flip = dir.make<TH2F>("Mass_Flip", ";NCuts;Mass_Flip", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+    tuple->Mass_Flip.book(histos, dir, "Mass_Flip", ";NCuts;Mass_Flip", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
     
     if (TypeMode > 1) {
       tuple->HSCPE_SystT = dir.make<TH1F>("HSCPE_SystT", ";NCuts;HSCPE_SystT", NCuts, 0, NCuts);
       
-      tuple->MassComb_Flip = dir.make<TH2F>("MassComb_Flip", ";NCuts;MassComb_Flip", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassTOF_SystH = dir.make<TH2F>("MassTOF_SystH", ";NCuts;MassTOF_SystH", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassComb_SystHUp = dir.make<TH2F>("MassComb_SystHUp", ";NCuts;MassComb_SystHUp", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassComb_SystPU = dir.make<TH2F>("MassComb_SystPU", ";NCuts;MassComb_SystPU", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->Mass_SystT = dir.make<TH2F>("Mass_SystT", ";NCuts;Mass_SystT", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassTOF_SystT = dir.make<TH2F>("MassTOF_SystT", ";NCuts;MassTOF_SystT", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassComb_SystT = dir.make<TH2F>("MassComb_SystT", ";NCuts;MassComb_SystT", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MaxEventMass_SystT = dir.make<TH2F>("MaxEventMass_SystT", ";NCuts;MaxEventMass_SystT", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassComb_SystI = dir.make<TH2F>("MassComb_SystI", ";NCuts;MassComb_SystI", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassTOF_SystM = dir.make<TH2F>("MassTOF_SystM", ";NCuts;MassTOF_SystM", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassComb_SystM = dir.make<TH2F>("MassComb_SystM", ";NCuts;MassComb_SystM", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassComb = dir.make<TH2F>("MassComb", ";NCuts;MassComb", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassTOF_SystP = dir.make<TH2F>("MassTOF_SystP", ";NCuts;MassTOF_SystP", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassComb_SystP = dir.make<TH2F>("MassComb_SystP", ";NCuts;MassComb_SystP", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassTOF = dir.make<TH2F>("MassTOF", ";NCuts;MassTOF", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassComb_SystHDown = dir.make<TH2F>("MassComb_SystHDown", ";NCuts;MassComb_SystHDown", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassTOF_Flip = dir.make<TH2F>("MassTOF_Flip", ";NCuts;MassTOF_Flip", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassTOF_SystI = dir.make<TH2F>("MassTOF_SystI", ";NCuts;MassTOF_SystI", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
-      tuple->MassTOF_SystPU = dir.make<TH2F>("MassTOF_SystPU", ";NCuts;MassTOF_SystPU", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb_Flip.book(histos, dir, "MassComb_Flip", ";NCuts;MassComb_Flip", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassTOF_SystH.book(histos, dir, "MassTOF_SystH", ";NCuts;MassTOF_SystH", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb_SystHUp.book(histos, dir, "MassComb_SystHUp", ";NCuts;MassComb_SystHUp", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb_SystPU.book(histos, dir, "MassComb_SystPU", ";NCuts;MassComb_SystPU", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->Mass_SystT.book(histos, dir, "Mass_SystT", ";NCuts;Mass_SystT", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassTOF_SystT.book(histos, dir, "MassTOF_SystT", ";NCuts;MassTOF_SystT", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb_SystT.book(histos, dir, "MassComb_SystT", ";NCuts;MassComb_SystT", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MaxEventMass_SystT.book(histos, dir, "MaxEventMass_SystT", ";NCuts;MaxEventMass_SystT", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb_SystI.book(histos, dir, "MassComb_SystI", ";NCuts;MassComb_SystI", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassTOF_SystM.book(histos, dir, "MassTOF_SystM", ";NCuts;MassTOF_SystM", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb_SystM.book(histos, dir, "MassComb_SystM", ";NCuts;MassComb_SystM", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb.book(histos, dir, "MassComb", ";NCuts;MassComb", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassTOF_SystP.book(histos, dir, "MassTOF_SystP", ";NCuts;MassTOF_SystP", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb_SystP.book(histos, dir, "MassComb_SystP", ";NCuts;MassComb_SystP", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassTOF.book(histos, dir, "MassTOF", ";NCuts;MassTOF", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassComb_SystHDown.book(histos, dir, "MassComb_SystHDown", ";NCuts;MassComb_SystHDown", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassTOF_Flip.book(histos, dir, "MassTOF_Flip", ";NCuts;MassTOF_Flip", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassTOF_SystI.book(histos, dir, "MassTOF_SystI", ";NCuts;MassTOF_SystI", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
+      tuple->MassTOF_SystPU.book(histos, dir, "MassTOF_SystPU", ";NCuts;MassTOF_SystPU", NCuts, 0, NCuts, MassNBins, 0, MassHistoUpperBound);
     }
 
 
@@ -2620,23 +2391,20 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
 
     //The following are only used to create the predicted mass spectrum.  Memory intensive so don't initialize for analyses not doing mass fits
     if (TypeMode < 3) {
-      tuple->Pred_I_Flip = dir.make<TH2F>("Pred_I_Flip", ";NCuts_Flip;Pred_I_Flip", NCuts_Flip, 0, NCuts_Flip, 40, 0, dEdxM_UpLim);
-      tuple->Pred_EtaB_Flip = dir.make<TH2F>("Pred_EtaB_Flip", ";NCuts_Flip;Pred_EtaB_Flip", NCuts_Flip, 0, NCuts_Flip, EtaBins, -3., 3.);
-      tuple->Pred_EtaS_Flip = dir.make<TH2F>("Pred_EtaS_Flip", ";NCuts_Flip;Pred_EtaS_Flip", NCuts_Flip, 0, NCuts_Flip, EtaBins, -3., 3.);
-      tuple->Pred_EtaS2_Flip = dir.make<TH2F>("Pred_EtaS2_Flip", ";NCuts_Flip;Pred_EtaS2_Flip", NCuts_Flip, 0, NCuts_Flip, EtaBins, -3., 3.);
-      tuple->Pred_EtaP_Flip = dir.make<TH3F>("Pred_EtaP_Flip", ";NCuts_Flip;Pred_EtaP_Flip", NCuts_Flip, 0, NCuts_Flip, EtaBins, -3., 3., 200, GlobalMinPt, PtHistoUpperBound);
+      tuple->Pred_I_Flip.book(histos, dir, "Pred_I_Flip", ";NCuts_Flip;Pred_I_Flip", NCuts_Flip, 0, NCuts_Flip, 40, 0, dEdxM_UpLim);
+      tuple->Pred_EtaB_Flip.book(histos, dir, "Pred_EtaB_Flip", ";NCuts_Flip;Pred_EtaB_Flip", NCuts_Flip, 0, NCuts_Flip, EtaBins, -3., 3.);
+      tuple->Pred_EtaS_Flip.book(histos, dir, "Pred_EtaS_Flip", ";NCuts_Flip;Pred_EtaS_Flip", NCuts_Flip, 0, NCuts_Flip, EtaBins, -3., 3.);
+      tuple->Pred_EtaS2_Flip.book(histos, dir, "Pred_EtaS2_Flip", ";NCuts_Flip;Pred_EtaS2_Flip", NCuts_Flip, 0, NCuts_Flip, EtaBins, -3., 3.);
+      tuple->Pred_EtaP_Flip.book(histos, dir, "Pred_EtaP_Flip", ";NCuts_Flip;Pred_EtaP_Flip", NCuts_Flip, 0, NCuts_Flip, EtaBins, -3., 3., 200, GlobalMinPt, PtHistoUpperBound);
 //      tuple->Pred_TOF_Flip = dir.make<TH2F>("Pred_TOF_Flip", ";NCuts_Flip;Pred_TOF_Flip", NCuts_Flip, 0, NCuts_Flip, 200, GlobalMinTOF, 5);
     }
 
 
-    tuple->RegionD_I_Flip = dir.make<TH2F>("RegionD_I_Flip", ";NCuts_Flip;RegionD_I_Flip", NCuts_Flip, 0, NCuts_Flip, 40, 0, dEdxM_UpLim);
-    tuple->RegionD_Ias_Flip =
-        dir.make<TH2F>("RegionD_Ias_Flip", ";NCuts_Flip;RegionD_Ias_Flip", NCuts_Flip, 0, NCuts_Flip, 100, 0, dEdxS_UpLim);
-    tuple->RegionD_P_Flip =
-        dir.make<TH2F>("RegionD_P_Flip", ";NCuts_Flip;RegionD_P_Flip", NCuts_Flip, 0, NCuts_Flip, 200, GlobalMinPt, PtHistoUpperBound);
+    tuple->RegionD_I_Flip.book(histos, dir, "RegionD_I_Flip", ";NCuts_Flip;RegionD_I_Flip", NCuts_Flip, 0, NCuts_Flip, 40, 0, dEdxM_UpLim);
+    tuple->RegionD_Ias_Flip.book(histos, dir, "RegionD_Ias_Flip", ";NCuts_Flip;RegionD_Ias_Flip", NCuts_Flip, 0, NCuts_Flip, 100, 0, dEdxS_UpLim);
+    tuple->RegionD_P_Flip.book(histos, dir, "RegionD_P_Flip", ";NCuts_Flip;RegionD_P_Flip", NCuts_Flip, 0, NCuts_Flip, 200, GlobalMinPt, PtHistoUpperBound);
 //    tuple->RegionD_TOF_Flip = dir.make<TH2F>("RegionD_TOF_Flip", ";NCuts_Flip;RegionD_TOF_Flip", NCuts_Flip, 0, NCuts_Flip, 200, -3, 1);
-    tuple->RegionH_Ias_Flip =
-        dir.make<TH2F>("RegionH_Ias_Flip", ";NCuts_Flip;RegionH_Ias_Flip", NCuts_Flip, 0, NCuts_Flip, 100, 0, dEdxS_UpLim);
+    tuple->RegionH_Ias_Flip.book(histos, dir, "RegionH_Ias_Flip", ";NCuts_Flip;RegionH_Ias_Flip", NCuts_Flip, 0, NCuts_Flip, 100, 0, dEdxS_UpLim);
 
       //  I think this is not use, let's remove it if nobody complains
 //    tuple->CtrlPt_S1_Is = dir.make<TH1D>("CtrlPt_S1_Is", "CtrlPt_S1_Is", 200, 0, dEdxS_UpLim);
@@ -2683,41 +2451,41 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
 
    // Calibration
    // Scale Factors
-    tuple->SF_HHit2DPix_loose   =  dir.make<TH2F>("SF_HHit2DPix_loose", ";SF_HHit2DPix_loose",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DStrip_loose =  dir.make<TH2F>("SF_HHit2DStrip_loose", ";SF_HHit2DStrip_loose",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DPix   =  dir.make<TH2F>("SF_HHit2DPix", ";SF_HHit2DPix",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DStrip =  dir.make<TH2F>("SF_HHit2DStrip", ";SF_HHit2DStrip",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DPix_nosf   =  dir.make<TH2F>("SF_HHit2DPix_nosf", ";SF_HHit2DPix_nosf",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DStrip_nosf =  dir.make<TH2F>("SF_HHit2DStrip_nosf", ";SF_HHit2DStrip_nosf",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DPix_eta1   =  dir.make<TH2F>("SF_HHit2DPix_eta1", ";SF_HHit2DPix_eta1",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DStrip_eta1 =  dir.make<TH2F>("SF_HHit2DStrip_eta1", ";SF_HHit2DStrip_eta1",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DPix_nosf_eta1  =  dir.make<TH2F>("SF_HHit2DPix_nosf_eta1", ";SF_HHit2DPix_nosf_eta1",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DStrip_nosf_eta1 =  dir.make<TH2F>("SF_HHit2DStrip_nosf_eta1", ";SF_HHit2DStrip_nosf_eta1",  50, 0., 100., 200, 0., 20.);
-    tuple->SF_HHit2DPix_vs_eta  =  dir.make<TH2F>("SF_HHit2DPix_vs_eta", ";SF_HHit2DPix_vs_eta",  42, -2.1, 2.1, 200, 0., 20.);
-    tuple->SF_HHit2DStrip_vs_eta =  dir.make<TH2F>("SF_HHit2DStrip_vs_eta", ";SF_HHit2DStrip_vs_eta",  42, -2.1, 2.1, 200, 0., 20.);
+    tuple->SF_HHit2DPix_loose.book(histos, dir, "SF_HHit2DPix_loose", ";SF_HHit2DPix_loose",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DStrip_loose.book(histos, dir, "SF_HHit2DStrip_loose", ";SF_HHit2DStrip_loose",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DPix.book(histos, dir, "SF_HHit2DPix", ";SF_HHit2DPix",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DStrip.book(histos, dir, "SF_HHit2DStrip", ";SF_HHit2DStrip",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DPix_nosf.book(histos, dir, "SF_HHit2DPix_nosf", ";SF_HHit2DPix_nosf",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DStrip_nosf.book(histos, dir, "SF_HHit2DStrip_nosf", ";SF_HHit2DStrip_nosf",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DPix_eta1.book(histos, dir, "SF_HHit2DPix_eta1", ";SF_HHit2DPix_eta1",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DStrip_eta1.book(histos, dir, "SF_HHit2DStrip_eta1", ";SF_HHit2DStrip_eta1",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DPix_nosf_eta1.book(histos, dir, "SF_HHit2DPix_nosf_eta1", ";SF_HHit2DPix_nosf_eta1",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DStrip_nosf_eta1.book(histos, dir, "SF_HHit2DStrip_nosf_eta1", ";SF_HHit2DStrip_nosf_eta1",  50, 0., 100., 200, 0., 20.);
+    tuple->SF_HHit2DPix_vs_eta.book(histos, dir, "SF_HHit2DPix_vs_eta", ";SF_HHit2DPix_vs_eta",  42, -2.1, 2.1, 200, 0., 20.);
+    tuple->SF_HHit2DStrip_vs_eta.book(histos, dir, "SF_HHit2DStrip_vs_eta", ";SF_HHit2DStrip_vs_eta",  42, -2.1, 2.1, 200, 0., 20.);
 
     // K and C
-    tuple->K_and_C_Ih_noL1_VsP_loose1 = dir.make<TH2F>("K_and_C_Ih_noL1_VsP_loose1",";P_loose1;Ih_noL1", 50,0,5, 240, 2.,14.);
-    tuple->K_and_C_Ih_noL1_VsP_loose2 = dir.make<TH2F>("K_and_C_Ih_noL1_VsP_loose2",";P_loose2;Ih_noL1", 250,0,50, 240, 2.,14.);
-    tuple->K_and_C_Ih_strip_VsP_loose1 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_loose1",";P_loose1;Ih_strip", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_loose2 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_loose2",";P_loose2;Ih_strip", 250,0,50, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_eta1_loose1 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_eta1_loose1",";eta1_loose1;Ih_strip", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_eta1_loose2 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_eta1_loose2",";eta1_loose2;Ih_strip", 250,0,50, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_eta2_loose1 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_eta2_loose1",";P_eta2_loose1;Ih_strip", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_eta2_loose2 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_eta2_loose2",";P_eta2_loose2;Ih_strip", 250,0,50, 240, 2., 14.);
-
-    tuple->K_and_C_Ih_noL1_VsP_1 = dir.make<TH2F>("K_and_C_Ih_noL1_VsP_1",";Ih_noL1_VsP_1", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_noL1_VsP_2 = dir.make<TH2F>("K_and_C_Ih_noL1_VsP_2",";Ih_noL1_VsP_2", 250,0,50, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_1 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_1",";Ih_strip_VsP_1", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_2 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_2",";Ih_strip_VsP_2", 250,0,50, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_eta1_1 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_eta1_1",";Ih_strip_VsP_eta1_1", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_eta1_2 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_eta1_2",";Ih_strip_VsP_eta1_2", 250,0,50, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_eta2_1 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_eta2_1",";Ih_strip_VsP_eta2_1", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_eta2_2 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_eta2_2",";Ih_strip_VsP_eta2_2", 250,0,50, 240, 2., 14.);
-    tuple->K_and_C_Ih_noL1_VsP_wFcut1 = dir.make<TH2F>("K_and_C_Ih_noL1_VsP_wFcut1",";Ih_noL1_VsP_wFcut1", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_noL1_VsP_wFcut2 = dir.make<TH2F>("K_and_C_Ih_noL1_VsP_wFcut2",";Ih_noL1_VsP_wFcut2", 250,0,50, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_wFcut1 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_wFcut1",";Ih_strip_VsP_wFcut1", 50,0,5, 240, 2., 14.);
-    tuple->K_and_C_Ih_strip_VsP_wFcut2 = dir.make<TH2F>("K_and_C_Ih_strip_VsP_wFcut2",";Ih_strip_VsP_wFcut2", 250,0,50, 240, 2., 14.);
+    tuple->K_and_C_Ih_noL1_VsP_loose1.book(histos, dir, "K_and_C_Ih_noL1_VsP_loose1",";P_loose1;Ih_noL1", 50,0,5, 240, 2.,14.);
+    tuple->K_and_C_Ih_noL1_VsP_loose2.book(histos, dir, "K_and_C_Ih_noL1_VsP_loose2",";P_loose2;Ih_noL1", 250,0,50, 240, 2.,14.);
+    tuple->K_and_C_Ih_strip_VsP_loose1.book(histos, dir, "K_and_C_Ih_strip_VsP_loose1",";P_loose1;Ih_strip", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_loose2.book(histos, dir, "K_and_C_Ih_strip_VsP_loose2",";P_loose2;Ih_strip", 250,0,50, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_eta1_loose1.book(histos, dir, "K_and_C_Ih_strip_VsP_eta1_loose1",";eta1_loose1;Ih_strip", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_eta1_loose2.book(histos, dir, "K_and_C_Ih_strip_VsP_eta1_loose2",";eta1_loose2;Ih_strip", 250,0,50, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_eta2_loose1.book(histos, dir, "K_and_C_Ih_strip_VsP_eta2_loose1",";P_eta2_loose1;Ih_strip", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_eta2_loose2.book(histos, dir, "K_and_C_Ih_strip_VsP_eta2_loose2",";P_eta2_loose2;Ih_strip", 250,0,50, 240, 2., 14.);
+
+    tuple->K_and_C_Ih_noL1_VsP_1.book(histos, dir, "K_and_C_Ih_noL1_VsP_1",";Ih_noL1_VsP_1", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_noL1_VsP_2.book(histos, dir, "K_and_C_Ih_noL1_VsP_2",";Ih_noL1_VsP_2", 250,0,50, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_1.book(histos, dir, "K_and_C_Ih_strip_VsP_1",";Ih_strip_VsP_1", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_2.book(histos, dir, "K_and_C_Ih_strip_VsP_2",";Ih_strip_VsP_2", 250,0,50, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_eta1_1.book(histos, dir, "K_and_C_Ih_strip_VsP_eta1_1",";Ih_strip_VsP_eta1_1", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_eta1_2.book(histos, dir, "K_and_C_Ih_strip_VsP_eta1_2",";Ih_strip_VsP_eta1_2", 250,0,50, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_eta2_1.book(histos, dir, "K_and_C_Ih_strip_VsP_eta2_1",";Ih_strip_VsP_eta2_1", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_eta2_2.book(histos, dir, "K_and_C_Ih_strip_VsP_eta2_2",";Ih_strip_VsP_eta2_2", 250,0,50, 240, 2., 14.);
+    tuple->K_and_C_Ih_noL1_VsP_wFcut1.book(histos, dir, "K_and_C_Ih_noL1_VsP_wFcut1",";Ih_noL1_VsP_wFcut1", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_noL1_VsP_wFcut2.book(histos, dir, "K_and_C_Ih_noL1_VsP_wFcut2",";Ih_noL1_VsP_wFcut2", 250,0,50, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_wFcut1.book(histos, dir, "K_and_C_Ih_strip_VsP_wFcut1",";Ih_strip_VsP_wFcut1", 50,0,5, 240, 2., 14.);
+    tuple->K_and_C_Ih_strip_VsP_wFcut2.book(histos, dir, "K_and_C_Ih_strip_VsP_wFcut2",";Ih_strip_VsP_wFcut2", 250,0,50, 240, 2., 14.);
 
     tuple->K_and_C_Ih_noL1_1d = dir.make<TH1F>("K_and_C_Ih_noL1_1d",";Ih_noL1 (for 3<p<5)",170,2.5,4.2);
     tuple->K_and_C_Ih_strip_1d = dir.make<TH1F>("K_and_C_Ih_strip_1d",";Ih_noL1 (for 3<p<5)",170,2.5,4.2);
@@ -2730,32 +2498,32 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->K_and_C_FracSat = dir.make<TH1F>("K_and_C_FracSat",";Fraction of saturated measurements;Tracks / 0.05", 20, 0., 1.);
 
   // Stability
-    tuple->Stab_RunNumVsPixCluChargeAfterSFsL1 = dir.make<TH2F>("Stab_RunNumVsPixCluChargeAfterSFsL1",";Run;Norm pixel cluster charge after SFs on L1", 545, 271000,325500, 150, 0.,300.);
-    tuple->Stab_RunNumVsPixCluChargeAfterSFsL2 = dir.make<TH2F>("Stab_RunNumVsPixCluChargeAfterSFsL2",";Run;Norm pixel cluster charge after SFs on L2", 545, 271000,325500, 150, 0.,300.);
-    tuple->Stab_RunNumVsPixCluChargeAfterSFsL3 = dir.make<TH2F>("Stab_RunNumVsPixCluChargeAfterSFsL3",";Run;Norm pixel cluster charge after SFs on L4", 545, 271000,325500, 150, 0.,300.);
-    tuple->Stab_RunNumVsPixCluChargeAfterSFsL4 = dir.make<TH2F>("Stab_RunNumVsPixCluChargeAfterSFsL4",";Run;Norm pixel cluster charge after SFs on L4", 545, 271000,325500, 150, 0.,300.);
-    tuple->Stab_Ih_NoL1_VsRun    = dir.make<TH2F>("Stab_Ih_NoL1_VsRun",";Run;I_{h,NoL1}", 545, 271000,325500, 60, 0.,15.);
-    tuple->Stab_Ih_pixNoL1_VsRun = dir.make<TH2F>("Stab_Ih_pixNoL1_VsRun",";Run;I_{h,NoPixL1}", 545, 271000,325500, 60, 0.,15.);
-    tuple->Stab_Ih_strip_VsRun   = dir.make<TH2F>("Stab_Ih_strip_VsRun",";Run;dEdX(strip)", 545, 271000,325500, 60, 0.,15.);
-    tuple->Stab_Gi_strip_VsRun   = dir.make<TH2F>("Stab_Gi_strip_VsRun",";Run;G_{i}^{Strip}", 545, 271000,325500, 80, 0.,1.);
-    tuple->Stab_Gi_NoL1_VsRun    = dir.make<TH2F>("Stab_Gi_NoL1_VsRun", ";Run;G_{i}^{NoL1}", 545, 271000,325500, 80, 0.,1.);
-    tuple->Stab_Fi_pixNoL1_VsRun = dir.make<TH2F>("Stab_Fi_pixNoL1_VsRun", ";Run;F_{i}^{Pixels}", 545, 271000,325500, 81, 0.,1.0125);
-    tuple->Stab_invB_VsRun       = dir.make<TH2F>("Stab_invB_VsRun",";Run;invBeta", 545, 271000,325500, 90,-1.,2.);
-    tuple->Stab_invB_DT_VsRun    = dir.make<TH2F>("Stab_invB_DT_VsRun",";Run;invBeta(DT)", 545, 271000,325500, 90,-1.,2.);
-    tuple->Stab_invB_CSC_VsRun   = dir.make<TH2F>("Stab_invB_CSC_VsRun",";Run;invBeta(CSC)", 545, 271000,325500, 90,-1.,2.);
-    tuple->Stab_CluDeDxPixLayer2_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxPixLayer2_VsRun_CR_veryLowPt",";Run;BPIXL2 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxPixLayer3_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxPixLayer3_VsRun_CR_veryLowPt",";Run;BPIXL3 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxPixLayer4_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxPixLayer4_VsRun_CR_veryLowPt",";Run;BPIXL4 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer1_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer1_VsRun_CR_veryLowPt",";Run;TIB1 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer2_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer2_VsRun_CR_veryLowPt",";Run;TIB2 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer3_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer3_VsRun_CR_veryLowPt",";Run;TIB3 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer4_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer4_VsRun_CR_veryLowPt",";Run;TIB4 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer5_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer5_VsRun_CR_veryLowPt",";Run;TOB1 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer6_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer6_VsRun_CR_veryLowPt",";Run;TOB2 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer7_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer7_VsRun_CR_veryLowPt",";Run;TOB3 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer8_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer8_VsRun_CR_veryLowPt",";Run;TOB4 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer9_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer9_VsRun_CR_veryLowPt",";Run;TOB5 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
-    tuple->Stab_CluDeDxStripsLayer10_VsRun_CR_veryLowPt = dir.make<TH2F>("Stab_CluDeDxStripsLayer10_VsRun_CR_veryLowPt",";Run;TOB6 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_RunNumVsPixCluChargeAfterSFsL1.book(histos, dir, "Stab_RunNumVsPixCluChargeAfterSFsL1",";Run;Norm pixel cluster charge after SFs on L1", 545, 271000,325500, 150, 0.,300.);
+    tuple->Stab_RunNumVsPixCluChargeAfterSFsL2.book(histos, dir, "Stab_RunNumVsPixCluChargeAfterSFsL2",";Run;Norm pixel cluster charge after SFs on L2", 545, 271000,325500, 150, 0.,300.);
+    tuple->Stab_RunNumVsPixCluChargeAfterSFsL3.book(histos, dir, "Stab_RunNumVsPixCluChargeAfterSFsL3",";Run;Norm pixel cluster charge after SFs on L4", 545, 271000,325500, 150, 0.,300.);
+    tuple->Stab_RunNumVsPixCluChargeAfterSFsL4.book(histos, dir, "Stab_RunNumVsPixCluChargeAfterSFsL4",";Run;Norm pixel cluster charge after SFs on L4", 545, 271000,325500, 150, 0.,300.);
+    tuple->Stab_Ih_NoL1_VsRun.book(histos, dir, "Stab_Ih_NoL1_VsRun",";Run;I_{h,NoL1}", 545, 271000,325500, 60, 0.,15.);
+    tuple->Stab_Ih_pixNoL1_VsRun.book(histos, dir, "Stab_Ih_pixNoL1_VsRun",";Run;I_{h,NoPixL1}", 545, 271000,325500, 60, 0.,15.);
+    tuple->Stab_Ih_strip_VsRun.book(histos, dir, "Stab_Ih_strip_VsRun",";Run;dEdX(strip)", 545, 271000,325500, 60, 0.,15.);
+    tuple->Stab_Gi_strip_VsRun.book(histos, dir, "Stab_Gi_strip_VsRun",";Run;G_{i}^{Strip}", 545, 271000,325500, 80, 0.,1.);
+    tuple->Stab_Gi_NoL1_VsRun.book(histos, dir, "Stab_Gi_NoL1_VsRun", ";Run;G_{i}^{NoL1}", 545, 271000,325500, 80, 0.,1.);
+    tuple->Stab_Fi_pixNoL1_VsRun.book(histos, dir, "Stab_Fi_pixNoL1_VsRun", ";Run;F_{i}^{Pixels}", 545, 271000,325500, 81, 0.,1.0125);
+    tuple->Stab_invB_VsRun.book(histos, dir, "Stab_invB_VsRun",";Run;invBeta", 545, 271000,325500, 90,-1.,2.);
+    tuple->Stab_invB_DT_VsRun.book(histos, dir, "Stab_invB_DT_VsRun",";Run;invBeta(DT)", 545, 271000,325500, 90,-1.,2.);
+    tuple->Stab_invB_CSC_VsRun.book(histos, dir, "Stab_invB_CSC_VsRun",";Run;invBeta(CSC)", 545, 271000,325500, 90,-1.,2.);
+    tuple->Stab_CluDeDxPixLayer2_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxPixLayer2_VsRun_CR_veryLowPt",";Run;BPIXL2 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxPixLayer3_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxPixLayer3_VsRun_CR_veryLowPt",";Run;BPIXL3 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxPixLayer4_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxPixLayer4_VsRun_CR_veryLowPt",";Run;BPIXL4 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer1_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer1_VsRun_CR_veryLowPt",";Run;TIB1 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer2_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer2_VsRun_CR_veryLowPt",";Run;TIB2 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer3_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer3_VsRun_CR_veryLowPt",";Run;TIB3 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer4_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer4_VsRun_CR_veryLowPt",";Run;TIB4 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer5_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer5_VsRun_CR_veryLowPt",";Run;TOB1 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer6_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer6_VsRun_CR_veryLowPt",";Run;TOB2 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer7_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer7_VsRun_CR_veryLowPt",";Run;TOB3 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer8_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer8_VsRun_CR_veryLowPt",";Run;TOB4 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer9_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer9_VsRun_CR_veryLowPt",";Run;TOB5 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
+    tuple->Stab_CluDeDxStripsLayer10_VsRun_CR_veryLowPt.book(histos, dir, "Stab_CluDeDxStripsLayer10_VsRun_CR_veryLowPt",";Run;TOB6 Cluster dEdx [MeV/cm]", 545, 271000,325500, 100,0.,10.);
 
 
   // saturation
@@ -2785,13 +2553,13 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->Tree->Branch("nofVtx", &tuple->Tree_nofVertices, "nofVtx/i");
     tuple->Tree->Branch("npv", &tuple->Tree_npv, "npv/I");
 
-    tuple->Tree->Branch("pvX", &tuple->Tree_pvX);
-    tuple->Tree->Branch("pvY", &tuple->Tree_pvY);
-    tuple->Tree->Branch("pvZ", &tuple->Tree_pvZ);
-    tuple->Tree->Branch("pvRho", &tuple->Tree_pvRho);
-    tuple->Tree->Branch("pvNdof", &tuple->Tree_pvNdof);
-    tuple->Tree->Branch("pvChi2", &tuple->Tree_pvChi2);
-    tuple->Tree->Branch("pvSumPt2", &tuple->Tree_pvSumPt2);
+    tuple->Tree->Branch("pvX", &blocks.vertex.X);
+    tuple->Tree->Branch("pvY", &blocks.vertex.Y);
+    tuple->Tree->Branch("pvZ", &blocks.vertex.Z);
+    tuple->Tree->Branch("pvRho", &blocks.vertex.Rho);
+    tuple->Tree->Branch("pvNdof", &blocks.vertex.Ndof);
+    tuple->Tree->Branch("pvChi2", &blocks.vertex.Chi2);
+    tuple->Tree->Branch("pvSumPt2", &blocks.vertex.SumPt2);
 
     tuple->Tree->Branch("Hscp", &tuple->Tree_Hscp, "Hscp/i");
     tuple->Tree->Branch("nMuons", &tuple->Tree_nMuons, "nMuons/i");
@@ -2807,9 +2575,9 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->Tree->Branch("triggerObjectEta", &tuple->Tree_triggerObjectEta);
     tuple->Tree->Branch("triggerObjectPhi", &tuple->Tree_triggerObjectPhi);
 
-    tuple->Tree->Branch("HSCP_GenBeta", &tuple->Tree_HSCP_GenBeta);
-    tuple->Tree->Branch("HSCP_dRclosestTrigAndCandidate", &tuple->Tree_HSCP_dRclosestTrigAndCandidate);
-    tuple->Tree->Branch("HSCP_trigObjBeta", &tuple->Tree_HSCP_trigObjBeta);
+    tuple->Tree->Branch("HSCP_GenBeta", &blocks.hscp.GenBeta);
+    tuple->Tree->Branch("HSCP_dRclosestTrigAndCandidate", &blocks.hscp.dRclosestTrigAndCandidate);
+    tuple->Tree->Branch("HSCP_trigObjBeta", &blocks.hscp.trigObjBeta);
 
     tuple->Tree->Branch("trigObjBeta", &tuple->Tree_trigObjBeta, "trigObjBeta/F");
     tuple->Tree->Branch("trigObjEta", &tuple->Tree_trigObjEta, "trigObjEta/F");
@@ -2889,258 +2657,258 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
     tuple->Tree->Branch("muonIdSFsDownEff", &tuple->Tree_muonIdSFsDownEff, "muonIdSFsDownEff/F");
 
     tuple->Tree->Branch("matchedMuonWasFound", &tuple->Tree_matchedMuonWasFound, "matchedMuonWasFound/O");
-    tuple->Tree->Branch("gParticleId", &tuple->Tree_gParticleId);
-    tuple->Tree->Branch("gParticleStatus", &tuple->Tree_gParticleStatus);
-    tuple->Tree->Branch("gParticleE", &tuple->Tree_gParticleE);
-    tuple->Tree->Branch("gParticlePt", &tuple->Tree_gParticlePt);
-    tuple->Tree->Branch("gParticlePz", &tuple->Tree_gParticlePz);
-    tuple->Tree->Branch("gParticleEta", &tuple->Tree_gParticleEta);
-    tuple->Tree->Branch("gParticlePhi", &tuple->Tree_gParticlePhi);
-    tuple->Tree->Branch("gParticleBeta", &tuple->Tree_gParticleBeta);
-    tuple->Tree->Branch("gParticleCharge", &tuple->Tree_gParticleCharge);
-    tuple->Tree->Branch("gParticleProdVertexX", &tuple->Tree_gParticleProdVertexX);
-    tuple->Tree->Branch("gParticleProdVertexY", &tuple->Tree_gParticleProdVertexY);
-    tuple->Tree->Branch("gParticleProdVertexZ", &tuple->Tree_gParticleProdVertexZ);
-    tuple->Tree->Branch("gParticleMotherId", &tuple->Tree_gParticleMotherId);
-    tuple->Tree->Branch("gParticleMotherIndex", &tuple->Tree_gParticleMotherIndex);
-
-    tuple->Tree->Branch("eleE", &tuple->Tree_eleE);
-    tuple->Tree->Branch("elePt", &tuple->Tree_elePt);
-    tuple->Tree->Branch("eleEta", &tuple->Tree_eleEta);
-    tuple->Tree->Branch("elePhi", &tuple->Tree_elePhi);
-    tuple->Tree->Branch("eleCharge", &tuple->Tree_eleCharge);
-    tuple->Tree->Branch("eleE_SC", &tuple->Tree_eleE_SC);
-    tuple->Tree->Branch("eleEta_SC", &tuple->Tree_eleEta_SC);
-    tuple->Tree->Branch("elePhi_SC", &tuple->Tree_elePhi_SC);
-    tuple->Tree->Branch("eleSigmaIetaIeta", &tuple->Tree_eleSigmaIetaIeta);
-    tuple->Tree->Branch("eleFull5x5SigmaIetaIeta", &tuple->Tree_eleFull5x5SigmaIetaIeta);
-    tuple->Tree->Branch("eleR9", &tuple->Tree_eleR9);
-    tuple->Tree->Branch("ele_dEta", &tuple->Tree_ele_dEta);
-    tuple->Tree->Branch("ele_dPhi", &tuple->Tree_ele_dPhi);
-    tuple->Tree->Branch("ele_HoverE", &tuple->Tree_ele_HoverE);
-    tuple->Tree->Branch("ele_d0", &tuple->Tree_ele_d0);
-    tuple->Tree->Branch("ele_dZ", &tuple->Tree_ele_dZ);
-    tuple->Tree->Branch("ele_pileupIso", &tuple->Tree_ele_pileupIso);
-    tuple->Tree->Branch("ele_chargedIso", &tuple->Tree_ele_chargedIso);
-    tuple->Tree->Branch("ele_photonIso", &tuple->Tree_ele_photonIso);
-    tuple->Tree->Branch("ele_neutralHadIso", &tuple->Tree_ele_neutralHadIso);
-    tuple->Tree->Branch("ele_MissHits", &tuple->Tree_ele_MissHits);
-    tuple->Tree->Branch("ele_passCutBasedIDVeto", &tuple->Tree_ele_passCutBasedIDVeto);
-    tuple->Tree->Branch("ele_passCutBasedIDLoose", &tuple->Tree_ele_passCutBasedIDLoose);
-    tuple->Tree->Branch("ele_passCutBasedIDMedium", &tuple->Tree_ele_passCutBasedIDMedium);
-    tuple->Tree->Branch("ele_passCutBasedIDTight", &tuple->Tree_ele_passCutBasedIDTight);
-    tuple->Tree->Branch("ele_passMVAIsoIDWP80", &tuple->Tree_ele_passMVAIsoIDWP80);
-    tuple->Tree->Branch("ele_passMVAIsoIDWP90", &tuple->Tree_ele_passMVAIsoIDWP90);
-    tuple->Tree->Branch("ele_passMVAIsoIDWPHZZ", &tuple->Tree_ele_passMVAIsoIDWPHZZ);
-    tuple->Tree->Branch("ele_passMVAIsoIDWPLoose", &tuple->Tree_ele_passMVAIsoIDWPLoose);
-    tuple->Tree->Branch("ele_passMVANoIsoIDWP80", &tuple->Tree_ele_passMVANoIsoIDWP80);
-    tuple->Tree->Branch("ele_passMVANoIsoIDWP90", &tuple->Tree_ele_passMVANoIsoIDWP90);
-    tuple->Tree->Branch("ele_passMVANoIsoIDWPLoose", &tuple->Tree_ele_passMVANoIsoIDWPLoose);
-    tuple->Tree->Branch("ele_PassConvVeto", &tuple->Tree_ele_PassConvVeto);
-    tuple->Tree->Branch("ele_OneOverEminusOneOverP", &tuple->Tree_ele_OneOverEminusOneOverP);
-
-
-    tuple->Tree->Branch("muonE", &tuple->Tree_muonE);
-    tuple->Tree->Branch("muonPt", &tuple->Tree_muonPt);
-    tuple->Tree->Branch("globalTrackMuonPt", &tuple->Tree_globalTrackMuonPt);
-    tuple->Tree->Branch("rescaledPtUpGlobalMuon", &tuple->Tree_rescaledPtUpGlobalMuon);
-    tuple->Tree->Branch("rescaledPtDownGlobalMuon", &tuple->Tree_rescaledPtDownGlobalMuon);
-    tuple->Tree->Branch("innerTrackMuonPt", &tuple->Tree_innerTrackMuonPt);
-    tuple->Tree->Branch("rescaledPtUpInnerMuon", &tuple->Tree_rescaledPtUpInnerMuon);
-    tuple->Tree->Branch("rescaledPtDownInnerMuon", &tuple->Tree_rescaledPtDownInnerMuon);
-
-    tuple->Tree->Branch("outerTrackMuonPt", &tuple->Tree_outerTrackMuonPt);
-    tuple->Tree->Branch("muonPtErr", &tuple->Tree_muonPtErr);
-    tuple->Tree->Branch("muonEta", &tuple->Tree_muonEta);
-    tuple->Tree->Branch("muonPhi", &tuple->Tree_muonPhi);
-    tuple->Tree->Branch("muonBeta", &tuple->Tree_muonBeta);
+    tuple->Tree->Branch("gParticleId", &blocks.gen.Id);
+    tuple->Tree->Branch("gParticleStatus", &blocks.gen.Status);
+    tuple->Tree->Branch("gParticleE", &blocks.gen.E);
+    tuple->Tree->Branch("gParticlePt", &blocks.gen.Pt);
+    tuple->Tree->Branch("gParticlePz", &blocks.gen.Pz);
+    tuple->Tree->Branch("gParticleEta", &blocks.gen.Eta);
+    tuple->Tree->Branch("gParticlePhi", &blocks.gen.Phi);
+    tuple->Tree->Branch("gParticleBeta", &blocks.gen.Beta);
+    tuple->Tree->Branch("gParticleCharge", &blocks.gen.Charge);
+    tuple->Tree->Branch("gParticleProdVertexX", &blocks.gen.ProdVertexX);
+    tuple->Tree->Branch("gParticleProdVertexY", &blocks.gen.ProdVertexY);
+    tuple->Tree->Branch("gParticleProdVertexZ", &blocks.gen.ProdVertexZ);
+    tuple->Tree->Branch("gParticleMotherId", &blocks.gen.MotherId);
+    tuple->Tree->Branch("gParticleMotherIndex", &blocks.gen.MotherIndex);
+
+    tuple->Tree->Branch("eleE", &blocks.electron.E);
+    tuple->Tree->Branch("elePt", &blocks.electron.Pt);
+    tuple->Tree->Branch("eleEta", &blocks.electron.Eta);
+    tuple->Tree->Branch("elePhi", &blocks.electron.Phi);
+    tuple->Tree->Branch("eleCharge", &blocks.electron.Charge);
+    tuple->Tree->Branch("eleE_SC", &blocks.electron.E_SC);
+    tuple->Tree->Branch("eleEta_SC", &blocks.electron.Eta_SC);
+    tuple->Tree->Branch("elePhi_SC", &blocks.electron.Phi_SC);
+    tuple->Tree->Branch("eleSigmaIetaIeta", &blocks.electron.SigmaIetaIeta);
+    tuple->Tree->Branch("eleFull5x5SigmaIetaIeta", &blocks.electron.Full5x5SigmaIetaIeta);
+    tuple->Tree->Branch("eleR9", &blocks.electron.R9);
+    tuple->Tree->Branch("ele_dEta", &blocks.electron.dEta);
+    tuple->Tree->Branch("ele_dPhi", &blocks.electron.dPhi);
+    tuple->Tree->Branch("ele_HoverE", &blocks.electron.HoverE);
+    tuple->Tree->Branch("ele_d0", &blocks.electron.d0);
+    tuple->Tree->Branch("ele_dZ", &blocks.electron.dZ);
+    tuple->Tree->Branch("ele_pileupIso", &blocks.electron.pileupIso);
+    tuple->Tree->Branch("ele_chargedIso", &blocks.electron.chargedIso);
+    tuple->Tree->Branch("ele_photonIso", &blocks.electron.photonIso);
+    tuple->Tree->Branch("ele_neutralHadIso", &blocks.electron.neutralHadIso);
+    tuple->Tree->Branch("ele_MissHits", &blocks.electron.MissHits);
+    tuple->Tree->Branch("ele_passCutBasedIDVeto", &blocks.electron.passCutBasedIDVeto);
+    tuple->Tree->Branch("ele_passCutBasedIDLoose", &blocks.electron.passCutBasedIDLoose);
+    tuple->Tree->Branch("ele_passCutBasedIDMedium", &blocks.electron.passCutBasedIDMedium);
+    tuple->Tree->Branch("ele_passCutBasedIDTight", &blocks.electron.passCutBasedIDTight);
+    tuple->Tree->Branch("ele_passMVAIsoIDWP80", &blocks.electron.passMVAIsoIDWP80);
+    tuple->Tree->Branch("ele_passMVAIsoIDWP90", &blocks.electron.passMVAIsoIDWP90);
+    tuple->Tree->Branch("ele_passMVAIsoIDWPHZZ", &blocks.electron.passMVAIsoIDWPHZZ);
+    tuple->Tree->Branch("ele_passMVAIsoIDWPLoose", &blocks.electron.passMVAIsoIDWPLoose);
+    tuple->Tree->Branch("ele_passMVANoIsoIDWP80", &blocks.electron.passMVANoIsoIDWP80);
+    tuple->Tree->Branch("ele_passMVANoIsoIDWP90", &blocks.electron.passMVANoIsoIDWP90);
+    tuple->Tree->Branch("ele_passMVANoIsoIDWPLoose", &blocks.electron.passMVANoIsoIDWPLoose);
+    tuple->Tree->Branch("ele_PassConvVeto", &blocks.electron.PassConvVeto);
+    tuple->Tree->Branch("ele_OneOverEminusOneOverP", &blocks.electron.OneOverEminusOneOverP);
+
+
+    tuple->Tree->Branch("muonE", &blocks.muon.E);
+    tuple->Tree->Branch("muonPt", &blocks.muon.Pt);
+    tuple->Tree->Branch("globalTrackMuonPt", &blocks.muon.globalTrackPt);
+    tuple->Tree->Branch("rescaledPtUpGlobalMuon", &blocks.muon.rescaledPtUpGlobal);
+    tuple->Tree->Branch("rescaledPtDownGlobalMuon", &blocks.muon.rescaledPtDownGlobal);
+    tuple->Tree->Branch("innerTrackMuonPt", &blocks.muon.innerTrackPt);
+    tuple->Tree->Branch("rescaledPtUpInnerMuon", &blocks.muon.rescaledPtUpInner);
+    tuple->Tree->Branch("rescaledPtDownInnerMuon", &blocks.muon.rescaledPtDownInner);
+
+    tuple->Tree->Branch("outerTrackMuonPt", &blocks.muon.outerTrackPt);
+    tuple->Tree->Branch("muonPtErr", &blocks.muon.PtErr);
+    tuple->Tree->Branch("muonEta", &blocks.muon.Eta);
+    tuple->Tree->Branch("muonPhi", &blocks.muon.Phi);
+    tuple->Tree->Branch("muonBeta", &blocks.muon.Beta);
     
-    tuple->Tree->Branch("muonCharge", &tuple->Tree_muonCharge);
-    tuple->Tree->Branch("muonIsLoose", &tuple->Tree_muonIsLoose);
-    tuple->Tree->Branch("muonIsMedium", &tuple->Tree_muonIsMedium);
-    tuple->Tree->Branch("muonIsTight", &tuple->Tree_muonIsTight);
-    tuple->Tree->Branch("muon_d0", &tuple->Tree_muon_d0);
-    tuple->Tree->Branch("muon_d0Err", &tuple->Tree_muon_d0Err);
-    tuple->Tree->Branch("muon_dZ", &tuple->Tree_muon_dZ);
-    tuple->Tree->Branch("muon_ip3d", &tuple->Tree_muon_ip3d);
-    tuple->Tree->Branch("muon_ip3dSignificance", &tuple->Tree_muon_ip3dSignificance);
-    tuple->Tree->Branch("muonType", &tuple->Tree_muonType);
-    tuple->Tree->Branch("muonQuality", &tuple->Tree_muonQuality);
-    tuple->Tree->Branch("muon_pileupIso", &tuple->Tree_muon_pileupIso);
-    tuple->Tree->Branch("muon_chargedIso", &tuple->Tree_muon_chargedIso);
-    tuple->Tree->Branch("muon_photonIso", &tuple->Tree_muon_photonIso);
-    tuple->Tree->Branch("muon_neutralHadIso", &tuple->Tree_muon_neutralHadIso);
-    tuple->Tree->Branch("muon_validFractionTrackerHits", &tuple->Tree_muon_validFractionTrackerHits);
-    tuple->Tree->Branch("muTree_muon_normChi2onE", &tuple->Tree_muon_normChi2);
-    tuple->Tree->Branch("muon_chi2LocalPosition", &tuple->Tree_muon_chi2LocalPosition);
-    tuple->Tree->Branch("muon_kinkFinder", &tuple->Tree_muon_kinkFinder);
-    tuple->Tree->Branch("muon_segmentCompatability", &tuple->Tree_muon_segmentCompatability);
-
-    tuple->Tree->Branch("muon_trkIso", &tuple->Tree_muon_trkIso);
-    tuple->Tree->Branch("muon_tuneP_Pt", &tuple->Tree_muon_tuneP_Pt);
-    tuple->Tree->Branch("muon_tuneP_PtErr", &tuple->Tree_muon_tuneP_PtErr);
-    tuple->Tree->Branch("muon_tuneP_Eta", &tuple->Tree_muon_tuneP_Eta);
-    tuple->Tree->Branch("muon_tuneP_Phi", &tuple->Tree_muon_tuneP_Phi);
-    tuple->Tree->Branch("muon_tuneP_MuonBestTrackType", &tuple->Tree_muon_tuneP_MuonBestTrackType);
-    tuple->Tree->Branch("muon_isHighPtMuon", &tuple->Tree_muon_isHighPtMuon);
-    tuple->Tree->Branch("muon_isTrackerHighPtMuon", &tuple->Tree_muon_isTrackerHighPtMuon);
+    tuple->Tree->Branch("muonCharge", &blocks.muon.Charge);
+    tuple->Tree->Branch("muonIsLoose", &blocks.muon.IsLoose);
+    tuple->Tree->Branch("muonIsMedium", &blocks.muon.IsMedium);
+    tuple->Tree->Branch("muonIsTight", &blocks.muon.IsTight);
+    tuple->Tree->Branch("muon_d0", &blocks.muon.d0);
+    tuple->Tree->Branch("muon_d0Err", &blocks.muon.d0Err);
+    tuple->Tree->Branch("muon_dZ", &blocks.muon.dZ);
+    tuple->Tree->Branch("muon_ip3d", &blocks.muon.ip3d);
+    tuple->Tree->Branch("muon_ip3dSignificance", &blocks.muon.ip3dSignificance);
+    tuple->Tree->Branch("muonType", &blocks.muon.Type);
+    tuple->Tree->Branch("muonQuality", &blocks.muon.Quality);
+    tuple->Tree->Branch("muon_pileupIso", &blocks.muon.pileupIso);
+    tuple->Tree->Branch("muon_chargedIso", &blocks.muon.chargedIso);
+    tuple->Tree->Branch("muon_photonIso", &blocks.muon.photonIso);
+    tuple->Tree->Branch("muon_neutralHadIso", &blocks.muon.neutralHadIso);
+    tuple->Tree->Branch("muon_validFractionTrackerHits", &blocks.muon.validFractionTrackerHits);
+    tuple->Tree->Branch("muTree_muon_normChi2onE", &blocks.muon.normChi2);
+    tuple->Tree->Branch("muon_chi2LocalPosition", &blocks.muon.chi2LocalPosition);
+    tuple->Tree->Branch("muon_kinkFinder", &blocks.muon.kinkFinder);
+    tuple->Tree->Branch("muon_segmentCompatability", &blocks.muon.segmentCompatability);
+
+    tuple->Tree->Branch("muon_trkIso", &blocks.muon.trkIso);
+    tuple->Tree->Branch("muon_tuneP_Pt", &blocks.muon.tuneP_Pt);
+    tuple->Tree->Branch("muon_tuneP_PtErr", &blocks.muon.tuneP_PtErr);
+    tuple->Tree->Branch("muon_tuneP_Eta", &blocks.muon.tuneP_Eta);
+    tuple->Tree->Branch("muon_tuneP_Phi", &blocks.muon.tuneP_Phi);
+    tuple->Tree->Branch("muon_tuneP_MuonBestTrackType", &blocks.muon.tuneP_MuonBestTrackType);
+    tuple->Tree->Branch("muon_isHighPtMuon", &blocks.muon.isHighPtMuon);
+    tuple->Tree->Branch("muon_isTrackerHighPtMuon", &blocks.muon.isTrackerHighPtMuon);
 
 
     if (saveTree > 3) {
-      tuple->Tree->Branch("Jet_pt", &tuple->Tree_jet_pt);
-      tuple->Tree->Branch("Jet_eta", &tuple->Tree_jet_eta);
-      tuple->Tree->Branch("Jet_phi", &tuple->Tree_jet_phi);
-      tuple->Tree->Branch("Jet_mass", &tuple->Tree_jet_mass);
-      tuple->Tree->Branch("Jet_energy", &tuple->Tree_jet_energy);
-      tuple->Tree->Branch("Jet_pdgId", &tuple->Tree_jet_pdgId);
-      tuple->Tree->Branch("Jet_et", &tuple->Tree_jet_et);
-      tuple->Tree->Branch("Jet_chargedEmEnergyFraction", &tuple->Tree_jet_chargedEmEnergyFraction);
-      tuple->Tree->Branch("Jet_neutralEmEnergyFraction", &tuple->Tree_jet_neutralEmEnergyFraction);
-
-      tuple->Tree->Branch("Jet_chargedHadronEnergyFraction", &tuple->Tree_jet_chargedHadronEnergyFraction);
-      tuple->Tree->Branch("Jet_neutralHadronEnergyFraction", &tuple->Tree_jet_neutralHadronEnergyFraction);
-      tuple->Tree->Branch("Jet_muonEnergyFraction", &tuple->Tree_jet_muonEnergyFraction);
-      tuple->Tree->Branch("Jet_chargedMultiplicity", &tuple->Tree_jet_chargedMultiplicity);
-      tuple->Tree->Branch("Jet_neutralMultiplicity", &tuple->Tree_jet_neutralMultiplicity);
-      tuple->Tree->Branch("Jet_jetArea", &tuple->Tree_jet_jetArea);
-      tuple->Tree->Branch("Jet_pileupE", &tuple->Tree_jet_pileupE);
+      tuple->Tree->Branch("Jet_pt", &blocks.jet.pt);
+      tuple->Tree->Branch("Jet_eta", &blocks.jet.eta);
+      tuple->Tree->Branch("Jet_phi", &blocks.jet.phi);
+      tuple->Tree->Branch("Jet_mass", &blocks.jet.mass);
+      tuple->Tree->Branch("Jet_energy", &blocks.jet.energy);
+      tuple->Tree->Branch("Jet_pdgId", &blocks.jet.pdgId);
+      tuple->Tree->Branch("Jet_et", &blocks.jet.et);
+      tuple->Tree->Branch("Jet_chargedEmEnergyFraction", &blocks.jet.chargedEmEnergyFraction);
+      tuple->Tree->Branch("Jet_neutralEmEnergyFraction", &blocks.jet.neutralEmEnergyFraction);
+
+      tuple->Tree->Branch("Jet_chargedHadronEnergyFraction", &blocks.jet.chargedHadronEnergyFraction);
+      tuple->Tree->Branch("Jet_neutralHadronEnergyFraction", &blocks.jet.neutralHadronEnergyFraction);
+      tuple->Tree->Branch("Jet_muonEnergyFraction", &blocks.jet.muonEnergyFraction);
+      tuple->Tree->Branch("Jet_chargedMultiplicity", &blocks.jet.chargedMultiplicity);
+      tuple->Tree->Branch("Jet_neutralMultiplicity", &blocks.jet.neutralMultiplicity);
+      tuple->Tree->Branch("Jet_jetArea", &blocks.jet.jetArea);
+      tuple->Tree->Branch("Jet_pileupE", &blocks.jet.pileupE);
 
     }
 
-    tuple->Tree->Branch("mT", &tuple->Tree_vect_mT);
+    tuple->Tree->Branch("mT", &blocks.hscp.mT);
     if (saveTree > 1) {
-      tuple->Tree->Branch("passCutPt55", &tuple->Tree_passCutPt55);
-      tuple->Tree->Branch("passPreselection", &tuple->Tree_passPreselection);
-      tuple->Tree->Branch("passPreselectionSept8", &tuple->Tree_passPreselectionSept8);
-      tuple->Tree->Branch("passPreselectionTrigSys", &tuple->Tree_passPreselectionTrigSys);
-      tuple->Tree->Branch("passSelection", &tuple->Tree_passSelection);
+      tuple->Tree->Branch("passCutPt55", &blocks.hscp.passCutPt55);
+      tuple->Tree->Branch("passPreselection", &blocks.hscp.passPreselection);
+      tuple->Tree->Branch("passPreselectionSept8", &blocks.hscp.passPreselectionSept8);
+      tuple->Tree->Branch("passPreselectionTrigSys", &blocks.hscp.passPreselectionTrigSys);
+      tuple->Tree->Branch("passSelection", &blocks.hscp.passSelection);
     }
-    tuple->Tree->Branch("isPFMuon", &tuple->Tree_isPFMuon);
-    tuple->Tree->Branch("PFMuonPt", &tuple->Tree_PFMuonPt);
-    tuple->Tree->Branch("Charge", &tuple->Tree_Charge);
-    tuple->Tree->Branch("Pt", &tuple->Tree_Pt);
-    tuple->Tree->Branch("PtErr", &tuple->Tree_PtErr);
-    tuple->Tree->Branch("Is_StripOnly", &tuple->Tree_Is_StripOnly);
-    tuple->Tree->Branch("Ias", &tuple->Tree_Ias);
-    tuple->Tree->Branch("Ias_noTIBnoTIDno3TEC", &tuple->Tree_Ias_noTIBnoTIDno3TEC);
-    tuple->Tree->Branch("Ias_PixelOnly", &tuple->Tree_Ias_PixelOnly);
-    tuple->Tree->Branch("Ias_StripOnly", &tuple->Tree_Ias_StripOnly);
-    tuple->Tree->Branch("Ias_PixelOnly_noL1", &tuple->Tree_Ias_PixelOnly_noL1);
-    tuple->Tree->Branch("Ih", &tuple->Tree_Ih);
-    tuple->Tree->Branch("Ick", &tuple->Tree_Ick);
-    tuple->Tree->Branch("Fmip", &tuple->Tree_Fmip);
-    tuple->Tree->Branch("ProbXY", &tuple->Tree_ProbXY);
-    tuple->Tree->Branch("ProbXY_noL1", &tuple->Tree_ProbXY_noL1);
-    tuple->Tree->Branch("ProbQ", &tuple->Tree_ProbQ);
-    tuple->Tree->Branch("ProbQ_noL1", &tuple->Tree_ProbQ_noL1);
-    tuple->Tree->Branch("Ndof", &tuple->Tree_Ndof);
-    tuple->Tree->Branch("Chi2", &tuple->Tree_Chi2);
-    tuple->Tree->Branch("QualityMask", &tuple->Tree_QualityMask);
-    tuple->Tree->Branch("isHighPurity", &tuple->Tree_isHighPurity);
-    tuple->Tree->Branch("EoverP", &tuple->Tree_EoverP);
-    tuple->Tree->Branch("isMuon", &tuple->Tree_isMuon);
-    tuple->Tree->Branch("isGlobalMuon", &tuple->Tree_isGlobalMuon);
-    tuple->Tree->Branch("isPhoton", &tuple->Tree_isPhoton);
-    tuple->Tree->Branch("isElectron", &tuple->Tree_isElectron);
+    tuple->Tree->Branch("isPFMuon", &blocks.hscp.isPFMuon);
+    tuple->Tree->Branch("PFMuonPt", &blocks.hscp.PFMuonPt);
+    tuple->Tree->Branch("Charge", &blocks.hscp.Charge);
+    tuple->Tree->Branch("Pt", &blocks.hscp.Pt);
+    tuple->Tree->Branch("PtErr", &blocks.hscp.PtErr);
+    tuple->Tree->Branch("Is_StripOnly", &blocks.hscp.Is_StripOnly);
+    tuple->Tree->Branch("Ias", &blocks.hscp.Ias);
+    tuple->Tree->Branch("Ias_noTIBnoTIDno3TEC", &blocks.hscp.Ias_noPix_noTIB_noTID_no3TEC);
+    tuple->Tree->Branch("Ias_PixelOnly", &blocks.hscp.Ias_PixelOnly);
+    tuple->Tree->Branch("Ias_StripOnly", &blocks.hscp.Ias_StripOnly);
+    tuple->Tree->Branch("Ias_PixelOnly_noL1", &blocks.hscp.Ias_PixelOnly_noL1);
+    tuple->Tree->Branch("Ih", &blocks.hscp.Ih);
+    tuple->Tree->Branch("Ick", &blocks.hscp.Ick);
+    tuple->Tree->Branch("Fmip", &blocks.hscp.Fmip);
+    tuple->Tree->Branch("ProbXY", &blocks.hscp.ProbXY);
+    tuple->Tree->Branch("ProbXY_noL1", &blocks.hscp.ProbXY_noL1);
+    tuple->Tree->Branch("ProbQ", &blocks.hscp.ProbQ);
+    tuple->Tree->Branch("ProbQ_noL1", &blocks.hscp.ProbQ_noL1);
+    tuple->Tree->Branch("Ndof", &blocks.hscp.Ndof);
+    tuple->Tree->Branch("Chi2", &blocks.hscp.Chi2);
+    tuple->Tree->Branch("QualityMask", &blocks.hscp.QualityMask);
+    tuple->Tree->Branch("isHighPurity", &blocks.hscp.isHighPurity);
+    tuple->Tree->Branch("EoverP", &blocks.hscp.EoverP);
+    tuple->Tree->Branch("isMuon", &blocks.hscp.isMuon);
+    tuple->Tree->Branch("isGlobalMuon", &blocks.hscp.isGlobalMuon);
+    tuple->Tree->Branch("isPhoton", &blocks.hscp.isPhoton);
+    tuple->Tree->Branch("isElectron", &blocks.hscp.isElectron);
 
    
-    tuple->Tree->Branch("gsfFbremElectron", &tuple->Tree_gsfFbremElectron);
-    tuple->Tree->Branch("gsfMomentumElectron", &tuple->Tree_gsfMomentumElectron);
-    tuple->Tree->Branch("PFMomentumElectron", &tuple->Tree_PFMomentumElectron);
+    tuple->Tree->Branch("gsfFbremElectron", &blocks.hscp.gsfFbremElectron);
+    tuple->Tree->Branch("gsfMomentumElectron", &blocks.hscp.gsfMomentumElectron);
+    tuple->Tree->Branch("PFMomentumElectron", &blocks.hscp.PFMomentumElectron);
    
-    tuple->Tree->Branch("isChHadron", &tuple->Tree_isChHadron);
-    tuple->Tree->Branch("isNeutHadron", &tuple->Tree_isNeutHadron);
-    tuple->Tree->Branch("isPfTrack", &tuple->Tree_isPfTrack);
-    tuple->Tree->Branch("isUndefined", &tuple->Tree_isUndefined);
-    tuple->Tree->Branch("ECAL_energy", &tuple->Tree_ECAL_energy);
-    tuple->Tree->Branch("HCAL_energy", &tuple->Tree_HCAL_energy);
-    tuple->Tree->Branch("TOF", &tuple->Tree_TOF);
-    tuple->Tree->Branch("TOFErr", &tuple->Tree_TOFErr);
-    tuple->Tree->Branch("TOF_ndof", &tuple->Tree_TOF_ndof);
-    tuple->Tree->Branch("DTTOF", &tuple->Tree_DTTOF);
-    tuple->Tree->Branch("DTTOFErr", &tuple->Tree_DTTOFErr);
-    tuple->Tree->Branch("DTTOF_ndof", &tuple->Tree_DTTOF_ndof);
-    tuple->Tree->Branch("CSCTOF", &tuple->Tree_CSCTOF);
-    tuple->Tree->Branch("CSCTOFErr", &tuple->Tree_CSCTOFErr);
-    tuple->Tree->Branch("CSCTOF_ndof", &tuple->Tree_CSCTOF_ndof);
-    tuple->Tree->Branch("Mass", &tuple->Tree_Mass);
-    tuple->Tree->Branch("MassErr", &tuple->Tree_MassErr);
-    tuple->Tree->Branch("dZ", &tuple->Tree_dZ);
-    tuple->Tree->Branch("dXY", &tuple->Tree_dXY);
-    tuple->Tree->Branch("dR", &tuple->Tree_dR);
-    tuple->Tree->Branch("p", &tuple->Tree_p);
-    tuple->Tree->Branch("eta", &tuple->Tree_eta);
-    tuple->Tree->Branch("phi", &tuple->Tree_phi);
-    tuple->Tree->Branch("NOH", &tuple->Tree_NOH);
-    tuple->Tree->Branch("NOPH", &tuple->Tree_NOPH);
-    tuple->Tree->Branch("FOVH", &tuple->Tree_FOVH);
-    tuple->Tree->Branch("NOMH", &tuple->Tree_NOMH);
-    tuple->Tree->Branch("FOVHD", &tuple->Tree_FOVHD);
-    tuple->Tree->Branch("NOM", &tuple->Tree_NOM);
-    tuple->Tree->Branch("matchTrigMuon_minDeltaR", &tuple->Tree_matchTrigMuon_minDeltaR);
-    tuple->Tree->Branch("matchTrigMuon_pT", &tuple->Tree_matchTrigMuon_pT);
-    tuple->Tree->Branch("iso_TK", &tuple->Tree_iso_TK);
-    tuple->Tree->Branch("iso_ECAL", &tuple->Tree_iso_ECAL);
-    tuple->Tree->Branch("iso_HCAL", &tuple->Tree_iso_HCAL);
-    tuple->Tree->Branch("track_genTrackMiniIsoSumPt", &tuple->Tree_track_genTrackMiniIsoSumPt);
-    tuple->Tree->Branch("track_genTrackAbsIsoSumPtFix", &tuple->Tree_track_genTrackAbsIsoSumPtFix);
-    tuple->Tree->Branch("track_genTrackIsoSumPt_dr03", &tuple->Tree_track_genTrackIsoSumPt_dr03);
-    tuple->Tree->Branch("HSCP_tuneP_Pt", &tuple->Tree_HSCP_tuneP_Pt);
-    tuple->Tree->Branch("HSCP_tuneP_PtErr", &tuple->Tree_HSCP_tuneP_PtErr);
-    tuple->Tree->Branch("HSCP_tuneP_Eta", &tuple->Tree_HSCP_tuneP_Eta);
-    tuple->Tree->Branch("HSCP_tuneP_Phi", &tuple->Tree_HSCP_tuneP_Phi);
-    tuple->Tree->Branch("HSCP_tuneP_MuonBestTrackType", &tuple->Tree_HSCP_tuneP_MuonBestTrackType);
-    tuple->Tree->Branch("HSCP_ErrorHisto_bin", &tuple->Tree_HSCP_ErrorHisto_bin);
-    tuple->Tree->Branch("HSCP_type", &tuple->Tree_HSCP_type);
+    tuple->Tree->Branch("isChHadron", &blocks.hscp.isChHadron);
+    tuple->Tree->Branch("isNeutHadron", &blocks.hscp.isNeutHadron);
+    tuple->Tree->Branch("isPfTrack", &blocks.hscp.isPfTrack);
+    tuple->Tree->Branch("isUndefined", &blocks.hscp.isUndefined);
+    tuple->Tree->Branch("ECAL_energy", &blocks.hscp.ECAL_energy);
+    tuple->Tree->Branch("HCAL_energy", &blocks.hscp.HCAL_energy);
+    tuple->Tree->Branch("TOF", &blocks.hscp.TOF);
+    tuple->Tree->Branch("TOFErr", &blocks.hscp.TOFErr);
+    tuple->Tree->Branch("TOF_ndof", &blocks.hscp.TOF_ndof);
+    tuple->Tree->Branch("DTTOF", &blocks.hscp.DTTOF);
+    tuple->Tree->Branch("DTTOFErr", &blocks.hscp.DTTOFErr);
+    tuple->Tree->Branch("DTTOF_ndof", &blocks.hscp.DTTOF_ndof);
+    tuple->Tree->Branch("CSCTOF", &blocks.hscp.CSCTOF);
+    tuple->Tree->Branch("CSCTOFErr", &blocks.hscp.CSCTOFErr);
+    tuple->Tree->Branch("CSCTOF_ndof", &blocks.hscp.CSCTOF_ndof);
+    tuple->Tree->Branch("Mass", &blocks.hscp.Mass);
+    tuple->Tree->Branch("MassErr", &blocks.hscp.MassErr);
+    tuple->Tree->Branch("dZ", &blocks.hscp.dZ);
+    tuple->Tree->Branch("dXY", &blocks.hscp.dXY);
+    tuple->Tree->Branch("dR", &blocks.hscp.dR);
+    tuple->Tree->Branch("p", &blocks.hscp.p);
+    tuple->Tree->Branch("eta", &blocks.hscp.eta);
+    tuple->Tree->Branch("phi", &blocks.hscp.phi);
+    tuple->Tree->Branch("NOH", &blocks.hscp.NOH);
+    tuple->Tree->Branch("NOPH", &blocks.hscp.NOPH);
+    tuple->Tree->Branch("FOVH", &blocks.hscp.FOVH);
+    tuple->Tree->Branch("NOMH", &blocks.hscp.NOMH);
+    tuple->Tree->Branch("FOVHD", &blocks.hscp.FOVHD);
+    tuple->Tree->Branch("NOM", &blocks.hscp.NOM);
+    tuple->Tree->Branch("matchTrigMuon_minDeltaR", &blocks.hscp.matchTrigMuon_minDeltaR);
+    tuple->Tree->Branch("matchTrigMuon_pT", &blocks.hscp.matchTrigMuon_pT);
+    tuple->Tree->Branch("iso_TK", &blocks.hscp.iso_TK);
+    tuple->Tree->Branch("iso_ECAL", &blocks.hscp.iso_ECAL);
+    tuple->Tree->Branch("iso_HCAL", &blocks.hscp.iso_HCAL);
+    tuple->Tree->Branch("track_genTrackMiniIsoSumPt", &blocks.hscp.track_genTrackMiniIsoSumPt);
+    tuple->Tree->Branch("track_genTrackAbsIsoSumPtFix", &blocks.hscp.track_genTrackAbsIsoSumPtFix);
+    tuple->Tree->Branch("track_genTrackIsoSumPt_dr03", &blocks.hscp.track_genTrackIsoSumPt_dr03);
+    tuple->Tree->Branch("HSCP_tuneP_Pt", &blocks.hscp.tuneP_Pt);
+    tuple->Tree->Branch("HSCP_tuneP_PtErr", &blocks.hscp.tuneP_PtErr);
+    tuple->Tree->Branch("HSCP_tuneP_Eta", &blocks.hscp.tuneP_Eta);
+    tuple->Tree->Branch("HSCP_tuneP_Phi", &blocks.hscp.tuneP_Phi);
+    tuple->Tree->Branch("HSCP_tuneP_MuonBestTrackType", &blocks.hscp.tuneP_MuonBestTrackType);
+    tuple->Tree->Branch("HSCP_ErrorHisto_bin", &blocks.hscp.ErrorHisto_bin);
+    tuple->Tree->Branch("HSCP_type", &blocks.hscp.type);
 
 
     if (saveTree > 1) {
-      tuple->Tree->Branch("PFMiniIso_relative", &tuple->Tree_PFMiniIso_relative);
-      tuple->Tree->Branch("PFMiniIso_wMuon_relative", &tuple->Tree_PFMiniIso_wMuon_relative);
-      tuple->Tree->Branch("TrackPFIsolationR005_sumChargedHadronPt", &tuple->Tree_track_PFIsolationR005_sumChargedHadronPt);
-      tuple->Tree->Branch("TrackPFIsolationR005_sumNeutralHadronPt", &tuple->Tree_track_PFIsolationR005_sumNeutralHadronPt);
-      tuple->Tree->Branch("TrackPFIsolationR005_sumPhotonPt", &tuple->Tree_track_PFIsolationR005_sumPhotonPt);
-      tuple->Tree->Branch("TrackPFIsolationR005_sumPUPt", &tuple->Tree_track_PFIsolationR005_sumPUPt);
-      tuple->Tree->Branch("TrackPFIsolationR01_sumChargedHadronPt", &tuple->Tree_track_PFIsolationR01_sumChargedHadronPt);
-      tuple->Tree->Branch("TrackPFIsolationR01_sumNeutralHadronPt", &tuple->Tree_track_PFIsolationR01_sumNeutralHadronPt);
-      tuple->Tree->Branch("TrackPFIsolationR01_sumPhotonPt", &tuple->Tree_track_PFIsolationR01_sumPhotonPt);
-      tuple->Tree->Branch("TrackPFIsolationR01_sumPUPt", &tuple->Tree_track_PFIsolationR01_sumPUPt);
-      tuple->Tree->Branch("TrackPFIsolationR03_sumChargedHadronPt", &tuple->Tree_track_PFIsolationR03_sumChargedHadronPt);
-      tuple->Tree->Branch("TrackPFIsolationR03_sumNeutralHadronPt", &tuple->Tree_track_PFIsolationR03_sumNeutralHadronPt);
-      tuple->Tree->Branch("TrackPFIsolationR03_sumPhotonPt", &tuple->Tree_track_PFIsolationR03_sumPhotonPt);
-      tuple->Tree->Branch("TrackPFIsolationR03_sumPUPt", &tuple->Tree_track_PFIsolationR03_sumPUPt);
-      tuple->Tree->Branch("TrackPFIsolationR05_sumChargedHadronPt", &tuple->Tree_track_PFIsolationR05_sumChargedHadronPt);
-      tuple->Tree->Branch("TrackPFIsolationR05_sumNeutralHadronPt", &tuple->Tree_track_PFIsolationR05_sumNeutralHadronPt);
-      tuple->Tree->Branch("TrackPFIsolationR05_sumPhotonPt", &tuple->Tree_track_PFIsolationR05_sumPhotonPt);
-      tuple->Tree->Branch("TrackPFIsolationR05_sumPUPt", &tuple->Tree_track_PFIsolationR05_sumPUPt);
-      tuple->Tree->Branch("MuonPFIsolationR03_sumChargedHadronPt", &tuple->Tree_muon_PFIsolationR03_sumChargedHadronPt);
-      tuple->Tree->Branch("MuonPFIsolationR03_sumNeutralHadronPt", &tuple->Tree_muon_PFIsolationR03_sumNeutralHadronPt);
-      tuple->Tree->Branch("MuonPFIsolationR03_sumPhotonPt", &tuple->Tree_muon_PFIsolationR03_sumPhotonPt);
-      tuple->Tree->Branch("MuonPFIsolationR03_sumPUPt", &tuple->Tree_muon_PFIsolationR03_sumPUPt);
-      tuple->Tree->Branch("Ih_noL1", &tuple->Tree_Ih_noL1);
-      tuple->Tree->Branch("Ih_15drop", &tuple->Tree_Ih_15drop);
-      tuple->Tree->Branch("Ih_StripOnly", &tuple->Tree_Ih_StripOnly);
-      tuple->Tree->Branch("Ih_StripOnly_15drop", &tuple->Tree_Ih_StripOnly_15drop);
-      tuple->Tree->Branch("Ih_PixelOnly_noL1", &tuple->Tree_Ih_PixelOnly_noL1);
-      tuple->Tree->Branch("Ih_SaturationCorrectionFromFits", &tuple->Tree_Ih_SaturationCorrectionFromFits);
+      tuple->Tree->Branch("PFMiniIso_relative", &blocks.hscp.PFMiniIso_relative);
+      tuple->Tree->Branch("PFMiniIso_wMuon_relative", &blocks.hscp.PFMiniIso_wMuon_relative);
+      tuple->Tree->Branch("TrackPFIsolationR005_sumChargedHadronPt", &blocks.hscp.track_PFIsolationR005_sumChargedHadronPt);
+      tuple->Tree->Branch("TrackPFIsolationR005_sumNeutralHadronPt", &blocks.hscp.track_PFIsolationR005_sumNeutralHadronPt);
+      tuple->Tree->Branch("TrackPFIsolationR005_sumPhotonPt", &blocks.hscp.track_PFIsolationR005_sumPhotonPt);
+      tuple->Tree->Branch("TrackPFIsolationR005_sumPUPt", &blocks.hscp.track_PFIsolationR005_sumPUPt);
+      tuple->Tree->Branch("TrackPFIsolationR01_sumChargedHadronPt", &blocks.hscp.track_PFIsolationR01_sumChargedHadronPt);
+      tuple->Tree->Branch("TrackPFIsolationR01_sumNeutralHadronPt", &blocks.hscp.track_PFIsolationR01_sumNeutralHadronPt);
+      tuple->Tree->Branch("TrackPFIsolationR01_sumPhotonPt", &blocks.hscp.track_PFIsolationR01_sumPhotonPt);
+      tuple->Tree->Branch("TrackPFIsolationR01_sumPUPt", &blocks.hscp.track_PFIsolationR01_sumPUPt);
+      tuple->Tree->Branch("TrackPFIsolationR03_sumChargedHadronPt", &blocks.hscp.track_PFIsolationR03_sumChargedHadronPt);
+      tuple->Tree->Branch("TrackPFIsolationR03_sumNeutralHadronPt", &blocks.hscp.track_PFIsolationR03_sumNeutralHadronPt);
+      tuple->Tree->Branch("TrackPFIsolationR03_sumPhotonPt", &blocks.hscp.track_PFIsolationR03_sumPhotonPt);
+      tuple->Tree->Branch("TrackPFIsolationR03_sumPUPt", &blocks.hscp.track_PFIsolationR03_sumPUPt);
+      tuple->Tree->Branch("TrackPFIsolationR05_sumChargedHadronPt", &blocks.hscp.track_PFIsolationR05_sumChargedHadronPt);
+      tuple->Tree->Branch("TrackPFIsolationR05_sumNeutralHadronPt", &blocks.hscp.track_PFIsolationR05_sumNeutralHadronPt);
+      tuple->Tree->Branch("TrackPFIsolationR05_sumPhotonPt", &blocks.hscp.track_PFIsolationR05_sumPhotonPt);
+      tuple->Tree->Branch("TrackPFIsolationR05_sumPUPt", &blocks.hscp.track_PFIsolationR05_sumPUPt);
+      tuple->Tree->Branch("MuonPFIsolationR03_sumChargedHadronPt", &blocks.hscp.muon_PFIsolationR03_sumChargedHadronPt);
+      tuple->Tree->Branch("MuonPFIsolationR03_sumNeutralHadronPt", &blocks.hscp.muon_PFIsolationR03_sumNeutralHadronPt);
+      tuple->Tree->Branch("MuonPFIsolationR03_sumPhotonPt", &blocks.hscp.muon_PFIsolationR03_sumPhotonPt);
+      tuple->Tree->Branch("MuonPFIsolationR03_sumPUPt", &blocks.hscp.muon_PFIsolationR03_sumPUPt);
+      tuple->Tree->Branch("Ih_noL1", &blocks.hscp.Ih_noL1);
+      tuple->Tree->Branch("Ih_15drop", &blocks.hscp.Ih_15drop);
+      tuple->Tree->Branch("Ih_StripOnly", &blocks.hscp.Ih_StripOnly);
+      tuple->Tree->Branch("Ih_StripOnly_15drop", &blocks.hscp.Ih_StripOnly_15drop);
+      tuple->Tree->Branch("Ih_PixelOnly_noL1", &blocks.hscp.Ih_PixelOnly_noL1);
+      tuple->Tree->Branch("Ih_SaturationCorrectionFromFits", &blocks.hscp.Ih_SaturationCorrectionFromFits);
     }
     if (saveTree > 2) {
-      tuple->Tree->Branch("clust_charge", &tuple->Tree_clust_charge);
-      tuple->Tree->Branch("clust_pathlength", &tuple->Tree_clust_pathlength);
-      tuple->Tree->Branch("clust_nstrip", &tuple->Tree_clust_nstrip);
-      tuple->Tree->Branch("clust_sat254", &tuple->Tree_clust_sat254);
-      tuple->Tree->Branch("clust_sat255", &tuple->Tree_clust_sat255);
-      tuple->Tree->Branch("clust_detid", &tuple->Tree_clust_detid);
-      tuple->Tree->Branch("clust_isStrip", &tuple->Tree_clust_isStrip);
-      tuple->Tree->Branch("clust_isPixel", &tuple->Tree_clust_isPixel);
+      tuple->Tree->Branch("clust_charge", &blocks.hscp.clust_charge);
+      tuple->Tree->Branch("clust_pathlength", &blocks.hscp.clust_pathlength);
+      tuple->Tree->Branch("clust_nstrip", &blocks.hscp.clust_nstrip);
+      tuple->Tree->Branch("clust_sat254", &blocks.hscp.clust_sat254);
+      tuple->Tree->Branch("clust_sat255", &blocks.hscp.clust_sat255);
+      tuple->Tree->Branch("clust_detid", &blocks.hscp.clust_detid);
+      tuple->Tree->Branch("clust_isStrip", &blocks.hscp.clust_isStrip);
+      tuple->Tree->Branch("clust_isPixel", &blocks.hscp.clust_isPixel);
     }
     if (saveTree > 4) {
-      tuple->Tree->Branch("GenId", &tuple->Tree_GenId);
-      tuple->Tree->Branch("GenCharge", &tuple->Tree_GenCharge);
-      tuple->Tree->Branch("GenMass", &tuple->Tree_GenMass);
-      tuple->Tree->Branch("GenPt", &tuple->Tree_GenPt);
-      tuple->Tree->Branch("GenEta", &tuple->Tree_GenEta);
-      tuple->Tree->Branch("GenPhi", &tuple->Tree_GenPhi);
+      tuple->Tree->Branch("GenId", &blocks.hscp.GenId);
+      tuple->Tree->Branch("GenCharge", &blocks.hscp.GenCharge);
+      tuple->Tree->Branch("GenMass", &blocks.hscp.GenMass);
+      tuple->Tree->Branch("GenPt", &blocks.hscp.GenPt);
+      tuple->Tree->Branch("GenEta", &blocks.hscp.GenEta);
+      tuple->Tree->Branch("GenPhi", &blocks.hscp.GenPhi);
     }
   }
 } // end initializeTuple
@@ -3152,34 +2920,35 @@ void TupleMaker::initializeTuple(Tuple *&tuple,
 //=============================================================
 
 void TupleMaker::initializeRegions(Tuple *&tuple,
+                                histoRegistry &histos,
                                 TFileDirectory &dir,
                                 int etabins,
                                 int ihbins,
                                 int pbins,
                                 int massbins,
                                 bool allRegions=true) {
-    tuple->rA_ias50.setSuffix("_regionA_ias50"); tuple->rA_ias50.initHisto(dir, etabins, ihbins, pbins, massbins);
-    tuple->rC_ias50.setSuffix("_regionC_ias50"); tuple->rC_ias50.initHisto(dir, etabins, ihbins, pbins, massbins);
-    if(allRegions){tuple->rB_50ias60.setSuffix("_regionB_50ias60"); tuple->rB_50ias60.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rB_60ias70.setSuffix("_regionB_60ias70"); tuple->rB_60ias70.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rB_70ias80.setSuffix("_regionB_70ias80"); tuple->rB_70ias80.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rB_80ias90.setSuffix("_regionB_80ias90"); tuple->rB_80ias90.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    tuple->rB_50ias90.setSuffix("_regionB_50ias90"); tuple->rB_50ias90.initHisto(dir, etabins, ihbins, pbins, massbins);
-    if(allRegions){tuple->rB_50ias99.setSuffix("_regionB_50ias99"); tuple->rB_50ias99.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rB_50ias999.setSuffix("_regionB_50ias999"); tuple->rB_50ias999.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rB_90ias100.setSuffix("_regionB_90ias100"); tuple->rB_90ias100.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rB_99ias100.setSuffix("_regionB_99ias100"); tuple->rB_99ias100.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rB_999ias100.setSuffix("_regionB_999ias100"); tuple->rB_999ias100.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rD_50ias60.setSuffix("_regionD_50ias60"); tuple->rD_50ias60.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rD_60ias70.setSuffix("_regionD_60ias70"); tuple->rD_60ias70.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rD_70ias80.setSuffix("_regionD_70ias80"); tuple->rD_70ias80.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rD_80ias90.setSuffix("_regionD_80ias90"); tuple->rD_80ias90.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    tuple->rD_50ias90.setSuffix("_regionD_50ias90"); tuple->rD_50ias90.initHisto(dir, etabins, ihbins, pbins, massbins);
-    if(allRegions){tuple->rD_50ias99.setSuffix("_regionD_50ias99"); tuple->rD_50ias99.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rD_50ias999.setSuffix("_regionD_50ias999"); tuple->rD_50ias999.initHisto(dir, etabins, ihbins, pbins, massbins);}
-    if(allRegions){tuple->rD_90ias100.setSuffix("_regionD_90ias100"); tuple->rD_90ias100.initHisto(dir, etabins, ihbins, pbins, massbins,true);}
-    if(allRegions){tuple->rD_99ias100.setSuffix("_regionD_99ias100"); tuple->rD_99ias100.initHisto(dir, etabins, ihbins, pbins, massbins,true);}
-    if(allRegions){tuple->rD_999ias100.setSuffix("_regionD_999ias100"); tuple->rD_999ias100.initHisto(dir, etabins, ihbins, pbins, massbins,true);}
+    tuple->rA_ias50.setSuffix("_regionA_ias50"); tuple->rA_ias50.initHisto(dir, histos, etabins, ihbins, pbins, massbins);
+    tuple->rC_ias50.setSuffix("_regionC_ias50"); tuple->rC_ias50.initHisto(dir, histos, etabins, ihbins, pbins, massbins);
+    if(allRegions){tuple->rB_50ias60.setSuffix("_regionB_50ias60"); tuple->rB_50ias60.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rB_60ias70.setSuffix("_regionB_60ias70"); tuple->rB_60ias70.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rB_70ias80.setSuffix("_regionB_70ias80"); tuple->rB_70ias80.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rB_80ias90.setSuffix("_regionB_80ias90"); tuple->rB_80ias90.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    tuple->rB_50ias90.setSuffix("_regionB_50ias90"); tuple->rB_50ias90.initHisto(dir, histos, etabins, ihbins, pbins, massbins);
+    if(allRegions){tuple->rB_50ias99.setSuffix("_regionB_50ias99"); tuple->rB_50ias99.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rB_50ias999.setSuffix("_regionB_50ias999"); tuple->rB_50ias999.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rB_90ias100.setSuffix("_regionB_90ias100"); tuple->rB_90ias100.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rB_99ias100.setSuffix("_regionB_99ias100"); tuple->rB_99ias100.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rB_999ias100.setSuffix("_regionB_999ias100"); tuple->rB_999ias100.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rD_50ias60.setSuffix("_regionD_50ias60"); tuple->rD_50ias60.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rD_60ias70.setSuffix("_regionD_60ias70"); tuple->rD_60ias70.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rD_70ias80.setSuffix("_regionD_70ias80"); tuple->rD_70ias80.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rD_80ias90.setSuffix("_regionD_80ias90"); tuple->rD_80ias90.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    tuple->rD_50ias90.setSuffix("_regionD_50ias90"); tuple->rD_50ias90.initHisto(dir, histos, etabins, ihbins, pbins, massbins);
+    if(allRegions){tuple->rD_50ias99.setSuffix("_regionD_50ias99"); tuple->rD_50ias99.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rD_50ias999.setSuffix("_regionD_50ias999"); tuple->rD_50ias999.initHisto(dir, histos, etabins, ihbins, pbins, massbins);}
+    if(allRegions){tuple->rD_90ias100.setSuffix("_regionD_90ias100"); tuple->rD_90ias100.initHisto(dir, histos, etabins, ihbins, pbins, massbins,true);}
+    if(allRegions){tuple->rD_99ias100.setSuffix("_regionD_99ias100"); tuple->rD_99ias100.initHisto(dir, histos, etabins, ihbins, pbins, massbins,true);}
+    if(allRegions){tuple->rD_999ias100.setSuffix("_regionD_999ias100"); tuple->rD_999ias100.initHisto(dir, histos, etabins, ihbins, pbins, massbins,true);}
 }
 
 //=============================================================
@@ -3201,13 +2970,6 @@ void TupleMaker::fillTreeBranches(Tuple *&tuple,
                                   const std::vector<float>  &nPUmean,
                                   const unsigned int &nofVertices,
                                   const int &npv,
-                                  const std::vector<float>  &pvX,
-                                  const std::vector<float>  &pvY,
-                                  const std::vector<float>  &pvZ,
-                                  const std::vector<float>  &pvRho,
-                                  const std::vector<int>  &pvNdof,
-                                  const std::vector<float>  &pvChi2,
-                                  const std::vector<float>  &pvSumPt2,
                                   const unsigned int &Hscp,
                                   const unsigned int &nMuons,
                                   const unsigned int &njets,
@@ -3220,9 +2982,6 @@ void TupleMaker::fillTreeBranches(Tuple *&tuple,
                                   const std::vector<std::vector<float>> &triggerObjectPt,
                                   const std::vector<std::vector<float>> &triggerObjectEta,
                                   const std::vector<std::vector<float>> &triggerObjectPhi,
-                                  const std::vector<float> &HSCP_GenBeta, 
-                                  const std::vector<float> &HSCP_dRclosestTrigAndCandidate, 
-                                  const std::vector<float> &HSCP_trigObjBeta, 
                                   const float& trigObjBeta,
                                   const float& trigObjEta,
                                   const bool &L1_SingleMu22,
@@ -3276,63 +3035,6 @@ void TupleMaker::fillTreeBranches(Tuple *&tuple,
                                   const float &HLTPFMHT_phi,
                                   const float &HLTPFMHT_sigf,
                                   const bool &matchedMuonWasFound,
-                                  const std::vector<int> &gParticleId,
-                                  const std::vector<int> &gParticleStatus,
-                                  const std::vector<float> &gParticleE,
-                                  const std::vector<float> &gParticlePt,
-                                  const std::vector<float> &gParticlePz,
-                                  const std::vector<float> &gParticleEta,
-                                  const std::vector<float> &gParticlePhi,
-                                  const std::vector<float> &gParticleBeta,
-                                  const std::vector<int> &gParticleCharge,
-                                  const std::vector<float> &gParticleProdVertexX,
-                                  const std::vector<float> &gParticleProdVertexY,
-                                  const std::vector<float> &gParticleProdVertexZ,
-                                  const std::vector<int> &gParticleMotherId,
-                                  const std::vector<int> &gParticleMotherIndex,
-                                  const std::vector<float> &eleE,
-                                  const std::vector<float> &elePt,
-                                  const std::vector<float> &eleEta,
-                                  const std::vector<float> &elePhi,
-                                  const std::vector<float> &eleCharge,
-                                  const std::vector<float> &eleE_SC,
-                                  const std::vector<float> &eleEta_SC,
-                                  const std::vector<float> &elePhi_SC,
-                                  const std::vector<float> &eleSigmaIetaIeta,
-                                  const std::vector<float> &eleFull5x5SigmaIetaIeta,
-                                  const std::vector<float> &eleR9,
-                                  const std::vector<float> &ele_dEta,
-                                  const std::vector<float> &ele_dPhi,
-                                  const std::vector<float> &ele_HoverE,
-                                  const std::vector<float> &ele_d0,
-                                  const std::vector<float> &ele_dZ,
-                                  const std::vector<float> &ele_pileupIso,
-                                  const std::vector<float> &ele_chargedIso,
-                                  const std::vector<float> &ele_photonIso,
-                                  const std::vector<float> &ele_neutralHadIso,
-                                  const std::vector<int> &ele_MissHits,
-                                  const std::vector<bool> &ele_passCutBasedIDVeto,
-                                  const std::vector<bool> &ele_passCutBasedIDLoose,
-                                  const std::vector<bool> &ele_passCutBasedIDMedium,
-                                  const std::vector<bool> &ele_passCutBasedIDTight,
-                                  const std::vector<bool> &ele_passMVAIsoIDWP80,
-                                  const std::vector<bool> &ele_passMVAIsoIDWP90,
-                                  const std::vector<bool> &ele_passMVAIsoIDWPHZZ,
-                                  const std::vector<bool> &ele_passMVAIsoIDWPLoose,
-                                  const std::vector<bool> &ele_passMVANoIsoIDWP80,
-                                  const std::vector<bool> &ele_passMVANoIsoIDWP90,
-                                  const std::vector<bool> &ele_passMVANoIsoIDWPLoose,
-                                  const std::vector<bool> &ele_PassConvVeto,
-                                  const std::vector<float> &ele_OneOverEminusOneOverP,
-                                  const std::vector<float> &muonE,
-                                  const std::vector<float> &muonPt,
-                                  const std::vector<float> &globalTrackMuonPt,
-                                  const std::vector<float> &rescaledPtUpGlobalMuon,
-                                  const std::vector<float> &rescaledPtDownGlobalMuon,
-                                  const std::vector<float> &innerTrackMuonPt,
-                                  const std::vector<float> &rescaledPtUpInnerMuon,
-                                  const std::vector<float> &rescaledPtDownInnerMuon,
-                                  const std::vector<float> &outerTrackMuonPt,
                                   const float &triggerSystFactorUp, 
                                   const float &triggerSystFactorDown, 
                                   const float &muonTriggerSFsUpEff,
@@ -3340,178 +3042,7 @@ void TupleMaker::fillTreeBranches(Tuple *&tuple,
                                   const float &muonRecoSFsUpEff,
                                   const float &muonRecoSFsDownEff,
                                   const float &muonIdSFsUpEff,
-                                  const float &muonIdSFsDownEff,
-                                  const std::vector<float> &muonPtErr,
-                                  const std::vector<float> &muonEta,
-                                  const std::vector<float> &muonPhi,
-                                  const std::vector<float> &muonBeta,
-                                  const std::vector<int> &muonCharge,
-                                  const std::vector<bool> &muonIsLoose,
-                                  const std::vector<bool> &muonIsMedium,
-                                  const std::vector<bool> &muonIsTight,
-                                  const std::vector<float> &muon_d0,
-                                  const std::vector<float> &muon_d0Err,
-                                  const std::vector<float> &muon_dZ,
-                                  const std::vector<float> &muon_ip3d,
-                                  const std::vector<float> &muon_ip3dSignificance,
-                                  const std::vector<unsigned int> &muonType,
-                                  const std::vector<unsigned int> &muonQuality,
-                                  const std::vector<float> &muon_pileupIso,
-                                  const std::vector<float> &muon_chargedIso,
-                                  const std::vector<float> &muon_photonIso,
-                                  const std::vector<float> &muon_neutralHadIso,
-                                  const std::vector<float> &muon_validFractionTrackerHits,
-                                  const std::vector<float> &muon_normChi2,
-                                  const std::vector<float> &muon_chi2LocalPosition,
-                                  const std::vector<float> &muon_kinkFinder,
-                                  const std::vector<float> &muon_segmentCompatability,
-                                  const std::vector<float> &muon_trkIso,
-                                  const std::vector<float> &muon_tuneP_Pt,
-                                  const std::vector<float> &muon_tuneP_PtErr,
-                                  const std::vector<float> &muon_tuneP_Eta,
-                                  const std::vector<float> &muon_tuneP_Phi,
-                                  const std::vector<int> &muon_tuneP_MuonBestTrackType,
-                                  const std::vector<bool> &muon_isHighPtMuon,
-                                  const std::vector<bool> &muon_isTrackerHighPtMuon,
-                                  const std::vector<float> &Jet_pt,
-                                  const std::vector<float> &Jet_eta,
-                                  const std::vector<float> &Jet_phi,
-                                  const std::vector<float> &Jet_mass,
-                                  const std::vector<float> &Jet_energy,
-                                  const std::vector<float> &Jet_pdgId,
-                                  const std::vector<float> &Jet_et,
-                                  const std::vector<float> &Jet_chargedEmEnergyFraction,
-                                  const std::vector<float> &Jet_neutralEmEnergyFraction,
-                                  const std::vector<float> &Jet_chargedHadronEnergyFraction,
-                                  const std::vector<float> &Jet_neutralHadronEnergyFraction,
-                                  const std::vector<float> &Jet_muonEnergyFraction,
-                                  const std::vector<int> &Jet_chargedMultiplicity,
-                                  const std::vector<int> &Jet_neutralMultiplicity,
-                                  const std::vector<float> &Jet_jetArea,
-                                  const std::vector<float> &Jet_pileupE,
-                                  const std::vector<float> &vect_mT,
-                                  const std::vector<bool> &passCutPt55,
-                                  const std::vector<bool> &passPreselection,
-                                  const std::vector<bool> &passPreselectionSept8,
-                                  const std::vector<bool> &passPreselectionTrigSys,
-                                  const std::vector<bool> &passSelection,
-                                  const std::vector<bool> &isPFMuon,
-                                  const std::vector<bool> &PFMuonPt,
-                                  const std::vector<float> &Charge,
-                                  const std::vector<float> &Pt,
-                                  const std::vector<float> &PtErr,
-                                  const std::vector<float> &Is_StripOnly,
-                                  const std::vector<float> &Ias,
-                                  const std::vector<float> &Ias_noTIBnoTIDno3TEC,
-                                  const std::vector<float> &Ias_PixelOnly,
-                                  const std::vector<float> &Ias_StripOnly,
-                                  const std::vector<float> &Ias_PixelOnly_noL1,
-                                  const std::vector<float> &Ih,
-                                  const std::vector<float> &Ick,
-                                  const std::vector<float> &Fmip,
-                                  const std::vector<float> &ProbXY,
-                                  const std::vector<float> &ProbXY_noL1,
-                                  const std::vector<float> &ProbQ,
-                                  const std::vector<float> &ProbQ_noL1,
-                                  const std::vector<float> &Ndof,
-                                  const std::vector<float> &Chi2,
-                                  const std::vector<int>   &QualityMask,
-                                  const std::vector<bool>  &isHighPurity,
-                                  const std::vector<float>  &EoverP,
-                                  const std::vector<bool>  &isMuon,
-                                  const std::vector<bool>  &isGlobalMuon,
-                                  const std::vector<bool>  &isPhoton,
-                                  const std::vector<bool>  &isElectron,
-                                  const std::vector<float>  &gsfFbremElectron,
-                                  const std::vector<float>  &gsfMomentumElectron,
-                                  const std::vector<float>  &PFMomentumElectron,
-                                  const std::vector<bool>  &isChHadron,
-                                  const std::vector<bool>  &isNeutHadron,
-                                  const std::vector<bool>  &isPfTrack,
-                                  const std::vector<bool>  &isUndefined,
-                                  const std::vector<float> &ECAL_energy,
-                                  const std::vector<float> &HCAL_energy,
-                                  const std::vector<float> &TOF,  //equal to invBeta
-                                  const std::vector<float> &TOFErr,
-                                  const std::vector<unsigned int> &TOF_ndof,
-                                  const std::vector<float> &DTTOF,
-                                  const std::vector<float> &DTTOFErr,
-                                  const std::vector<unsigned int> &DTTOF_ndof,
-                                  const std::vector<float> &CSCTOF,
-                                  const std::vector<float> &CSCTOFErr,
-                                  const std::vector<unsigned int> &CSCTOF_ndof,
-                                  const std::vector<float> &Mass,
-                                  const std::vector<float> &MassErr,
-                                  const std::vector<float> &dZ,
-                                  const std::vector<float> &dXY,
-                                  const std::vector<float> &dR,
-                                  const std::vector<float> &p,
-                                  const std::vector<float> &eta,
-                                  const std::vector<float> &phi,
-                                  const std::vector<unsigned int> &noh,
-                                  const std::vector<unsigned int> &noph,
-                                  const std::vector<float> &fovh,
-                                  const std::vector<unsigned int> &nomh,
-                                  const std::vector<float> &fovhd,
-                                  const std::vector<unsigned int> &nom,
-                                  const std::vector<float> &matchTrigMuon_minDeltaR,
-                                  const std::vector<float> &matchTrigMuon_pT,
-                                  const std::vector<float> &iso_TK,
-                                  const std::vector<float> &iso_ECAL,
-                                  const std::vector<float> &iso_HCAL,
-                                  const std::vector<float> &track_genTrackMiniIsoSumPt,
-                                  const std::vector<float> &track_genTrackAbsIsoSumPtFix,
-                                  const std::vector<float> &track_genTrackIsoSumPt_dr03,
-                                  const std::vector<float> &PFMiniIso_relative,
-                                  const std::vector<float> &PFMiniIso_wMuon_relative,
-                                  const std::vector<float> &track_PFIsolationR005_sumChargedHadronPt,
-                                  const std::vector<float> &track_PFIsolationR005_sumNeutralHadronPt,
-                                  const std::vector<float> &track_PFIsolationR005_sumPhotonPt,
-                                  const std::vector<float> &track_PFIsolationR005_sumPUPt,
-                                  const std::vector<float> &track_PFIsolationR01_sumChargedHadronPt,
-                                  const std::vector<float> &track_PFIsolationR01_sumNeutralHadronPt,
-                                  const std::vector<float> &track_PFIsolationR01_sumPhotonPt,
-                                  const std::vector<float> &track_PFIsolationR01_sumPUPt,
-                                  const std::vector<float> &track_PFIsolationR03_sumChargedHadronPt,
-                                  const std::vector<float> &track_PFIsolationR03_sumNeutralHadronPt,
-                                  const std::vector<float> &track_PFIsolationR03_sumPhotonPt,
-                                  const std::vector<float> &track_PFIsolationR03_sumPUPt,
-                                  const std::vector<float> &track_PFIsolationR05_sumChargedHadronPt,
-                                  const std::vector<float> &track_PFIsolationR05_sumNeutralHadronPt,
-                                  const std::vector<float> &track_PFIsolationR05_sumPhotonPt,
-                                  const std::vector<float> &track_PFIsolationR05_sumPUPt,
-                                  const std::vector<float> &muon_PFIsolationR03_sumChargedHadronPt,
-                                  const std::vector<float> &muon_PFIsolationR03_sumNeutralHadronPt,
-                                  const std::vector<float> &muon_PFIsolationR03_sumPhotonPt,
-                                  const std::vector<float> &muon_PFIsolationR03_sumPUPt,
-                                  const std::vector<float> &Ih_noL1,
-                                  const std::vector<float> &Ih_15drop,
-                                  const std::vector<float> &Ih_StripOnly,
-                                  const std::vector<float> &Ih_StripOnly_15drop,
-                                  const std::vector<float> &Ih_PixelOnly_noL1,
-                                  const std::vector<float> &Ih_SaturationCorrectionFromFits,
-                                  const std::vector<std::vector<float>> &clust_charge,
-                                  const std::vector<std::vector<float>> &clust_pathlength,
-                                  const std::vector<std::vector<unsigned int>> &clust_nstrip,
-                                  const std::vector<std::vector<bool>> &clust_sat254,
-                                  const std::vector<std::vector<bool>> &clust_sat255,
-                                  const std::vector<std::vector<uint32_t>> &clust_detid,
-                                  const std::vector<std::vector<bool>> &clust_isStrip,
-                                  const std::vector<std::vector<bool>> &clust_isPixel,
-                                  const std::vector<float> &genid,
-                                  const std::vector<float> &gencharge,
-                                  const std::vector<float> &genmass,
-                                  const std::vector<float> &genpt,
-                                  const std::vector<float> &geneta,
-                                  const std::vector<float> &genphi,
-                                  const std::vector<float> &HSCP_tuneP_Pt,
-                                  const std::vector<float> &HSCP_tuneP_PtErr,
-                                  const std::vector<float> &HSCP_tuneP_Eta,
-                                  const std::vector<float> &HSCP_tuneP_Phi,
-                                  const std::vector<int> &HSCP_tuneP_MuonBestTrackType,
-                                  const std::vector<int> &HSCP_ErrorHisto_bin,
-                                  const std::vector<int> &HSCP_type
-                                  ) {
+                                  const float &muonIdSFsDownEff) {
   tuple->Tree_Trig = Trig;
   tuple->Tree_Run = Run;
   tuple->Tree_Event = Event;
@@ -3525,14 +3056,6 @@ void TupleMaker::fillTreeBranches(Tuple *&tuple,
   tuple->Tree_nofVertices = nofVertices;
   tuple->Tree_npv = npv;
 
-  tuple->Tree_pvX = pvX;
-  tuple->Tree_pvY = pvY;
-  tuple->Tree_pvZ = pvZ;
-  tuple->Tree_pvRho = pvRho;
-  tuple->Tree_pvNdof = pvNdof;
-  tuple->Tree_pvChi2 = pvChi2;
-  tuple->Tree_pvSumPt2 = pvSumPt2;
-
   tuple->Tree_Hscp = Hscp;
   tuple->Tree_nMuons = nMuons;
   tuple->Tree_njets = njets;
@@ -3546,9 +3069,6 @@ void TupleMaker::fillTreeBranches(Tuple *&tuple,
   tuple->Tree_triggerObjectEta = triggerObjectEta;
   tuple->Tree_triggerObjectPhi = triggerObjectPhi;
 
-  tuple->Tree_HSCP_GenBeta = HSCP_GenBeta;
-  tuple->Tree_HSCP_dRclosestTrigAndCandidate = HSCP_dRclosestTrigAndCandidate;
-  tuple->Tree_HSCP_trigObjBeta = HSCP_trigObjBeta;
   tuple->Tree_trigObjBeta =trigObjBeta;
   tuple->Tree_trigObjEta =trigObjEta;
   tuple->Tree_HLT_Mu50 = HLT_Mu50;
@@ -3561,7 +3081,6 @@ void TupleMaker::fillTreeBranches(Tuple *&tuple,
   tuple->Tree_L1_22or25Phi = L1_22or25Phi;
   tuple->Tree_L1_22or25Mass = L1_22or25Mass;
 
-
   tuple->Tree_L1_mu22or25Filter0 = L1_mu22or25Filter0;
 
   tuple->Tree_L1_22or25F0PT = L1_22or25F0PT;
@@ -3619,249 +3138,9 @@ void TupleMaker::fillTreeBranches(Tuple *&tuple,
   tuple->Tree_muonIdSFsUpEff = muonIdSFsUpEff;
   tuple->Tree_muonIdSFsDownEff = muonIdSFsDownEff;
 
-
   tuple->Tree_matchedMuonWasFound = matchedMuonWasFound;
-  tuple->Tree_gParticleId = gParticleId;
-  tuple->Tree_gParticleStatus = gParticleStatus;
-  tuple->Tree_gParticleE = gParticleE;
-  tuple->Tree_gParticlePt = gParticlePt;
-  tuple->Tree_gParticlePz = gParticlePz;
-  tuple->Tree_gParticleEta = gParticleEta;
-  tuple->Tree_gParticlePhi = gParticlePhi;
-  tuple->Tree_gParticleBeta = gParticleBeta;
-  tuple->Tree_gParticleCharge = gParticleCharge;
-  tuple->Tree_gParticleProdVertexX = gParticleProdVertexX;
-  tuple->Tree_gParticleProdVertexY = gParticleProdVertexY;
-  tuple->Tree_gParticleProdVertexZ = gParticleProdVertexZ;
-  tuple->Tree_gParticleMotherId = gParticleMotherId;
-  tuple->Tree_gParticleMotherIndex = gParticleMotherIndex;
-
-
-  tuple->Tree_eleE = eleE;
-  tuple->Tree_elePt = elePt;
-  tuple->Tree_eleEta = eleEta;
-  tuple->Tree_elePhi = elePhi;
-  tuple->Tree_eleCharge = eleCharge;
-  tuple->Tree_eleE_SC = eleE_SC;
-  tuple->Tree_eleEta_SC = eleEta_SC;
-  tuple->Tree_elePhi_SC = elePhi_SC;
-  tuple->Tree_eleSigmaIetaIeta = eleSigmaIetaIeta;
-  tuple->Tree_eleFull5x5SigmaIetaIeta = eleFull5x5SigmaIetaIeta;
-  tuple->Tree_eleR9 = eleR9;
-  tuple->Tree_ele_dEta = ele_dEta;
-  tuple->Tree_ele_dPhi = ele_dPhi;
-  tuple->Tree_ele_HoverE = ele_HoverE;
-  tuple->Tree_ele_d0 = ele_d0;
-  tuple->Tree_ele_dZ = ele_dZ;
-  tuple->Tree_ele_pileupIso = ele_pileupIso;
-  tuple->Tree_ele_chargedIso = ele_chargedIso;
-  tuple->Tree_ele_photonIso = ele_photonIso;
-  tuple->Tree_ele_neutralHadIso = ele_neutralHadIso;
-  tuple->Tree_ele_MissHits = ele_MissHits;
-  tuple->Tree_ele_passCutBasedIDVeto = ele_passCutBasedIDVeto;
-  tuple->Tree_ele_passCutBasedIDLoose = ele_passCutBasedIDLoose;
-  tuple->Tree_ele_passCutBasedIDMedium = ele_passCutBasedIDMedium;
-  tuple->Tree_ele_passCutBasedIDTight = ele_passCutBasedIDTight;
-  tuple->Tree_ele_passMVAIsoIDWP80 = ele_passMVAIsoIDWP80;
-  tuple->Tree_ele_passMVAIsoIDWP90 = ele_passMVAIsoIDWP90;
-  tuple->Tree_ele_passMVAIsoIDWPHZZ = ele_passMVAIsoIDWPHZZ;
-  tuple->Tree_ele_passMVAIsoIDWPLoose = ele_passMVAIsoIDWPLoose;
-  tuple->Tree_ele_passMVANoIsoIDWP80 = ele_passMVANoIsoIDWP80;
-  tuple->Tree_ele_passMVANoIsoIDWP90 = ele_passMVANoIsoIDWP90;
-  tuple->Tree_ele_passMVANoIsoIDWPLoose = ele_passMVANoIsoIDWPLoose;
-  tuple->Tree_ele_PassConvVeto = ele_PassConvVeto;
-  tuple->Tree_ele_OneOverEminusOneOverP = ele_OneOverEminusOneOverP;
-
-
-
-
-
-
-  tuple->Tree_muonE = muonE;
-  tuple->Tree_muonPt = muonPt;
-  tuple->Tree_globalTrackMuonPt = globalTrackMuonPt;
-  tuple->Tree_rescaledPtUpGlobalMuon = rescaledPtUpGlobalMuon;
-  tuple->Tree_rescaledPtDownGlobalMuon = rescaledPtDownGlobalMuon;
-  tuple->Tree_innerTrackMuonPt = innerTrackMuonPt;
-  tuple->Tree_rescaledPtUpInnerMuon = rescaledPtUpInnerMuon;
-  tuple->Tree_rescaledPtDownInnerMuon = rescaledPtDownInnerMuon;
-  tuple->Tree_outerTrackMuonPt = outerTrackMuonPt;
-  tuple->Tree_muonPtErr = muonPtErr;
-  tuple->Tree_muonEta = muonEta;
-  tuple->Tree_muonPhi = muonPhi;
-  tuple->Tree_muonBeta = muonBeta;
-  tuple->Tree_muonCharge = muonCharge;
-  tuple->Tree_muonIsLoose = muonIsLoose;
-  tuple->Tree_muonIsMedium = muonIsMedium;
-  tuple->Tree_muonIsTight = muonIsTight;
-  tuple->Tree_muon_d0 = muon_d0;
-  tuple->Tree_muon_d0Err = muon_d0Err;
-  tuple->Tree_muon_dZ = muon_dZ;
-  tuple->Tree_muon_ip3d = muon_ip3d;
-  tuple->Tree_muon_ip3dSignificance = muon_ip3dSignificance;
-  tuple->Tree_muonType = muonType;
-  tuple->Tree_muonQuality = muonQuality;
-  tuple->Tree_muon_pileupIso = muon_pileupIso;
-  tuple->Tree_muon_chargedIso = muon_chargedIso;
-  tuple->Tree_muon_photonIso = muon_photonIso;
-  tuple->Tree_muon_neutralHadIso = muon_neutralHadIso;
-  tuple->Tree_muon_validFractionTrackerHits = muon_validFractionTrackerHits;
-  tuple->Tree_muon_normChi2 = muon_normChi2;
-  tuple->Tree_muon_chi2LocalPosition = muon_chi2LocalPosition;
-  tuple->Tree_muon_kinkFinder = muon_kinkFinder;
-  tuple->Tree_muon_segmentCompatability = muon_segmentCompatability;
-
-  tuple->Tree_muon_trkIso = muon_trkIso;
-  tuple->Tree_muon_tuneP_Pt = muon_tuneP_Pt;
-  tuple->Tree_muon_tuneP_PtErr = muon_tuneP_PtErr;
-  tuple->Tree_muon_tuneP_Eta = muon_tuneP_Eta;
-  tuple->Tree_muon_tuneP_Phi = muon_tuneP_Phi;
-  tuple->Tree_muon_tuneP_MuonBestTrackType = muon_tuneP_MuonBestTrackType;
-  tuple->Tree_muon_isHighPtMuon = muon_isHighPtMuon;
-  tuple->Tree_muon_isTrackerHighPtMuon = muon_isTrackerHighPtMuon;
-
-  tuple->Tree_jet_pt = Jet_pt;
-  tuple->Tree_jet_eta = Jet_eta;
-  tuple->Tree_jet_phi = Jet_phi;
-  tuple->Tree_jet_mass = Jet_mass;
-  tuple->Tree_jet_energy = Jet_energy;
-  tuple->Tree_jet_pdgId = Jet_pdgId;
-  tuple->Tree_jet_et = Jet_et;
-  tuple->Tree_jet_chargedEmEnergyFraction = Jet_chargedEmEnergyFraction;
-  tuple->Tree_jet_neutralEmEnergyFraction = Jet_neutralEmEnergyFraction;
-  tuple->Tree_jet_chargedHadronEnergyFraction = Jet_chargedHadronEnergyFraction;
-  tuple->Tree_jet_neutralHadronEnergyFraction = Jet_neutralHadronEnergyFraction;
-  tuple->Tree_jet_muonEnergyFraction = Jet_muonEnergyFraction;
-  tuple->Tree_jet_chargedMultiplicity = Jet_chargedMultiplicity;
-  tuple->Tree_jet_neutralMultiplicity = Jet_neutralMultiplicity;
-  tuple->Tree_jet_jetArea = Jet_jetArea;
-  tuple->Tree_jet_pileupE = Jet_pileupE;
-  tuple->Tree_vect_mT = vect_mT;
-  tuple->Tree_passCutPt55 = passCutPt55;
-  tuple->Tree_passPreselection = passPreselection;
-  tuple->Tree_passPreselectionSept8 = passPreselectionSept8;
-  tuple->Tree_passPreselectionTrigSys = passPreselectionTrigSys;
-  tuple->Tree_passSelection = passSelection;
-  tuple->Tree_isPFMuon = isPFMuon;
-  tuple->Tree_PFMuonPt = PFMuonPt;
-  tuple->Tree_Charge = Charge;
-  tuple->Tree_Pt = Pt;
-  tuple->Tree_PtErr = PtErr;
-  tuple->Tree_Is_StripOnly = Is_StripOnly;
-  tuple->Tree_Ias = Ias;
-  tuple->Tree_Ias_noTIBnoTIDno3TEC = Ias_noTIBnoTIDno3TEC;
-  tuple->Tree_Ias_PixelOnly = Ias_PixelOnly;
-  tuple->Tree_Ias_StripOnly = Ias_StripOnly;
-  tuple->Tree_Ias_PixelOnly_noL1 = Ias_PixelOnly_noL1;
-  tuple->Tree_Ih = Ih;
-  tuple->Tree_Ick = Ick;
-  tuple->Tree_Fmip = Fmip;
-  tuple->Tree_ProbXY = ProbXY;
-  tuple->Tree_ProbXY_noL1 = ProbXY_noL1;
-  tuple->Tree_ProbQ = ProbQ;
-  tuple->Tree_ProbQ_noL1 = ProbQ_noL1;
-  tuple->Tree_Ndof = Ndof;
-  tuple->Tree_Chi2 = Chi2;
-  tuple->Tree_QualityMask = QualityMask;
-  tuple->Tree_isHighPurity = isHighPurity;
-  tuple->Tree_EoverP = EoverP;
-  tuple->Tree_isMuon = isMuon;
-  tuple->Tree_isGlobalMuon = isGlobalMuon;
-  tuple->Tree_isPhoton = isPhoton;
-  tuple->Tree_isElectron = isElectron;
-  tuple->Tree_gsfFbremElectron = gsfFbremElectron;
-  tuple->Tree_gsfMomentumElectron = gsfMomentumElectron;
-  tuple->Tree_PFMomentumElectron =  PFMomentumElectron;
-  tuple->Tree_isChHadron = isChHadron;
-  tuple->Tree_isNeutHadron = isNeutHadron;
-  tuple->Tree_isPfTrack = isPfTrack;
-  tuple->Tree_isUndefined = isUndefined;
-  tuple->Tree_ECAL_energy = ECAL_energy;
-  tuple->Tree_HCAL_energy = HCAL_energy;
-  tuple->Tree_TOF = TOF;
-  tuple->Tree_TOFErr = TOFErr;
-  tuple->Tree_TOF_ndof = TOF_ndof;
-  tuple->Tree_DTTOF = DTTOF;
-  tuple->Tree_DTTOFErr = DTTOFErr;
-  tuple->Tree_DTTOF_ndof = DTTOF_ndof;
-  tuple->Tree_CSCTOF = CSCTOF;
-  tuple->Tree_CSCTOFErr = CSCTOFErr;
-  tuple->Tree_CSCTOF_ndof = CSCTOF_ndof;
-  tuple->Tree_Mass = Mass;
-  tuple->Tree_MassErr = MassErr;
-  tuple->Tree_dZ = dZ;
-  tuple->Tree_dXY = dXY;
-  tuple->Tree_dR = dR;
-  tuple->Tree_p = p;
-  tuple->Tree_eta = eta;
-  tuple->Tree_phi = phi;
-  tuple->Tree_NOH = noh;
-  tuple->Tree_NOPH = noph;
-  tuple->Tree_FOVH = fovh;
-  tuple->Tree_NOMH = nomh;
-  tuple->Tree_FOVHD = fovhd;
-  tuple->Tree_NOM = nom;
-  tuple->Tree_matchTrigMuon_minDeltaR = matchTrigMuon_minDeltaR;
-  tuple->Tree_matchTrigMuon_pT = matchTrigMuon_pT;
-  tuple->Tree_iso_TK = iso_TK;
-  tuple->Tree_iso_ECAL = iso_ECAL;
-  tuple->Tree_iso_HCAL = iso_HCAL;
-  tuple->Tree_track_genTrackMiniIsoSumPt = track_genTrackMiniIsoSumPt;
-  tuple->Tree_track_genTrackAbsIsoSumPtFix = track_genTrackAbsIsoSumPtFix;
-  tuple->Tree_track_genTrackIsoSumPt_dr03 = track_genTrackIsoSumPt_dr03;
-  tuple->Tree_PFMiniIso_relative = PFMiniIso_relative;
-  tuple->Tree_PFMiniIso_wMuon_relative = PFMiniIso_wMuon_relative;
-  tuple->Tree_track_PFIsolationR005_sumChargedHadronPt = track_PFIsolationR005_sumChargedHadronPt;
-  tuple->Tree_track_PFIsolationR005_sumNeutralHadronPt = track_PFIsolationR005_sumNeutralHadronPt;
-  tuple->Tree_track_PFIsolationR005_sumPhotonPt = track_PFIsolationR005_sumPhotonPt;
-  tuple->Tree_track_PFIsolationR005_sumPUPt = track_PFIsolationR005_sumPUPt;
-  tuple->Tree_track_PFIsolationR01_sumChargedHadronPt = track_PFIsolationR01_sumChargedHadronPt;
-  tuple->Tree_track_PFIsolationR01_sumNeutralHadronPt = track_PFIsolationR01_sumNeutralHadronPt;
-  tuple->Tree_track_PFIsolationR01_sumPhotonPt = track_PFIsolationR01_sumPhotonPt;
-  tuple->Tree_track_PFIsolationR01_sumPUPt = track_PFIsolationR01_sumPUPt;
-  tuple->Tree_track_PFIsolationR03_sumChargedHadronPt = track_PFIsolationR03_sumChargedHadronPt;
-  tuple->Tree_track_PFIsolationR03_sumNeutralHadronPt = track_PFIsolationR03_sumNeutralHadronPt;
-  tuple->Tree_track_PFIsolationR03_sumPhotonPt = track_PFIsolationR03_sumPhotonPt;
-  tuple->Tree_track_PFIsolationR03_sumPUPt = track_PFIsolationR03_sumPUPt;
-  tuple->Tree_track_PFIsolationR05_sumChargedHadronPt = track_PFIsolationR05_sumChargedHadronPt;
-  tuple->Tree_track_PFIsolationR05_sumNeutralHadronPt = track_PFIsolationR05_sumNeutralHadronPt;
-  tuple->Tree_track_PFIsolationR05_sumPhotonPt = track_PFIsolationR05_sumPhotonPt;
-  tuple->Tree_track_PFIsolationR05_sumPUPt = track_PFIsolationR05_sumPUPt;
-  tuple->Tree_muon_PFIsolationR03_sumChargedHadronPt = muon_PFIsolationR03_sumChargedHadronPt;
-  tuple->Tree_muon_PFIsolationR03_sumNeutralHadronPt = muon_PFIsolationR03_sumNeutralHadronPt;
-  tuple->Tree_muon_PFIsolationR03_sumPhotonPt = muon_PFIsolationR03_sumPhotonPt;
-  tuple->Tree_muon_PFIsolationR03_sumPUPt = muon_PFIsolationR03_sumPUPt;
-  tuple->Tree_Ih_noL1 = Ih_noL1;
-  tuple->Tree_Ih_15drop = Ih_15drop;
-  tuple->Tree_Ih_StripOnly = Ih_StripOnly;
-  tuple->Tree_Ih_StripOnly_15drop = Ih_StripOnly_15drop;
-  tuple->Tree_Ih_PixelOnly_noL1 = Ih_PixelOnly_noL1;
-  tuple->Tree_Ih_SaturationCorrectionFromFits = Ih_SaturationCorrectionFromFits;
-  tuple->Tree_clust_charge = clust_charge;
-  tuple->Tree_clust_pathlength = clust_pathlength;
-  tuple->Tree_clust_nstrip = clust_nstrip;
-  tuple->Tree_clust_sat254 = clust_sat254;
-  tuple->Tree_clust_sat255 = clust_sat255;
-  tuple->Tree_clust_detid = clust_detid;
-  tuple->Tree_clust_isStrip = clust_isStrip;
-  tuple->Tree_clust_isPixel = clust_isPixel;
-  tuple->Tree_GenId = genid;
-  tuple->Tree_GenCharge = gencharge;
-  tuple->Tree_GenMass = genmass;
-  tuple->Tree_GenPt = genpt;
-  tuple->Tree_GenEta = geneta;
-  tuple->Tree_GenPhi = genphi;
-
-  tuple->Tree_HSCP_tuneP_Pt = HSCP_tuneP_Pt;
-  tuple->Tree_HSCP_tuneP_PtErr = HSCP_tuneP_PtErr;
-  tuple->Tree_HSCP_tuneP_Eta = HSCP_tuneP_Eta;
-  tuple->Tree_HSCP_tuneP_Phi = HSCP_tuneP_Phi;
-  tuple->Tree_HSCP_tuneP_MuonBestTrackType = HSCP_tuneP_MuonBestTrackType;
-  tuple->Tree_HSCP_ErrorHisto_bin = HSCP_ErrorHisto_bin;
-  tuple->Tree_HSCP_type = HSCP_type;
-
-
-  // Save in the tree
+
+  // Save in the tree, the per-object branches are read directly from the TupleBlocks
   tuple->Tree->Fill();
 }
 
@@ -4248,36 +3527,83 @@ void TupleMaker::fillRegions(Tuple *&tuple,
                              float tof,
                              float w,
                              bool allRegions=true){
-  if(pt<=pt_cut){
-    if(ias<Ias_quantiles[1]) tuple->rA_ias50.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[1] && ias<Ias_quantiles[2] && allRegions) tuple->rB_50ias60.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[2] && ias<Ias_quantiles[3] && allRegions) tuple->rB_60ias70.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[3] && ias<Ias_quantiles[4] && allRegions) tuple->rB_70ias80.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[4] && ias<Ias_quantiles[5] && allRegions) tuple->rB_80ias90.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[1] && ias<Ias_quantiles[5]) tuple->rB_50ias90.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[1] && ias<Ias_quantiles[6] && allRegions) tuple->rB_50ias99.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[1] && ias<Ias_quantiles[7] && allRegions) tuple->rB_50ias999.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[5] && allRegions)                         tuple->rB_90ias100.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[6] && allRegions)                         tuple->rB_99ias100.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[7] && allRegions)                         tuple->rB_999ias100.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-  }else{
-    if(ias<Ias_quantiles[1]) tuple->rC_ias50.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[1] && ias<Ias_quantiles[2] && allRegions) tuple->rD_50ias60.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[2] && ias<Ias_quantiles[3] && allRegions) tuple->rD_60ias70.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[3] && ias<Ias_quantiles[4] && allRegions) tuple->rD_70ias80.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[4] && ias<Ias_quantiles[5] && allRegions) tuple->rD_80ias90.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[1] && ias<Ias_quantiles[5]) tuple->rD_50ias90.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[1] && ias<Ias_quantiles[6] && allRegions) tuple->rD_50ias99.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[1] && ias<Ias_quantiles[7] && allRegions) tuple->rD_50ias999.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w);
-    if(ias>=Ias_quantiles[5] && allRegions)        {tuple->rD_90ias100.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w,true);} 
-    if(ias>=Ias_quantiles[6] && allRegions)        {tuple->rD_99ias100.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w,true);} 
-    if(ias>=Ias_quantiles[7] && allRegions)        {tuple->rD_999ias100.fill(eta,p,pt,pterr,ih,ias,probq,m,tof,w,true);} 
+  // Each region covers the Ias quantile slots [firstSlot, lastSlot), where slot k is
+  // Ias_quantiles[k] <= ias < Ias_quantiles[k+1] (slot 0 below Ias_quantiles[1], slot 7 above Ias_quantiles[7])
+  static const int nRegions = 11;
+  static const int firstSlot[nRegions] = {0, 1, 2, 3, 4, 1, 1, 1, 5, 6, 7};
+  static const int lastSlot[nRegions] = {1, 2, 3, 4, 5, 5, 6, 7, 8, 8, 8};
+  static const bool alwaysFilled[nRegions] = {true, false, false, false, false, true, false, false, false, false, false};
+  if (std::isnan(ias))
+    return;
+  int slot = std::upper_bound(Ias_quantiles + 1, Ias_quantiles + 8, ias) - (Ias_quantiles + 1);
+
+  bool lowPt = pt <= pt_cut;
+  Region *regions[nRegions];
+  if (lowPt) {
+    Region *AB[nRegions] = {&tuple->rA_ias50,
+                            &tuple->rB_50ias60,
+                            &tuple->rB_60ias70,
+                            &tuple->rB_70ias80,
+                            &tuple->rB_80ias90,
+                            &tuple->rB_50ias90,
+                            &tuple->rB_50ias99,
+                            &tuple->rB_50ias999,
+                            &tuple->rB_90ias100,
+                            &tuple->rB_99ias100,
+                            &tuple->rB_999ias100};
+    std::copy(AB, AB + nRegions, regions);
+  } else {
+    Region *CD[nRegions] = {&tuple->rC_ias50,
+                            &tuple->rD_50ias60,
+                            &tuple->rD_60ias70,
+                            &tuple->rD_70ias80,
+                            &tuple->rD_80ias90,
+                            &tuple->rD_50ias90,
+                            &tuple->rD_50ias99,
+                            &tuple->rD_50ias999,
+                            &tuple->rD_90ias100,
+                            &tuple->rD_99ias100,
+                            &tuple->rD_999ias100};
+    std::copy(CD, CD + nRegions, regions);
+  }
+  for (int r = 0; r < nRegions; r++) {
+    if (slot < firstSlot[r] || slot >= lastSlot[r] || !(alwaysFilled[r] || allRegions))
+      continue;
+    // the ih_p_m_* histograms are only booked for the high Ias D regions
+    regions[r]->fill(eta, p, pt, pterr, ih, ias, probq, m, tof, w, !lowPt && r >= 8);
   }
 }
 
+// fill the histograms of the regions with the buffered candidates
+void TupleMaker::flushRegions(Tuple *&tuple) {
+  tuple->rA_ias50.flush();
+  tuple->rC_ias50.flush();
+  tuple->rB_50ias60.flush();
+  tuple->rB_60ias70.flush();
+  tuple->rB_70ias80.flush();
+  tuple->rB_80ias90.flush();
+  tuple->rB_50ias90.flush();
+  tuple->rB_50ias99.flush();
+  tuple->rB_50ias999.flush();
+  tuple->rB_90ias100.flush();
+  tuple->rB_99ias100.flush();
+  tuple->rB_999ias100.flush();
+  tuple->rD_50ias60.flush();
+  tuple->rD_60ias70.flush();
+  tuple->rD_70ias80.flush();
+  tuple->rD_80ias90.flush();
+  tuple->rD_50ias90.flush();
+  tuple->rD_50ias99.flush();
+  tuple->rD_50ias999.flush();
+  tuple->rD_90ias100.flush();
+  tuple->rD_99ias100.flush();
+  tuple->rD_999ias100.flush();
+}
+
 void TupleMaker::writeRegions(Tuple *&tuple,
                               TFileDirectory &dir){
   dir.cd();
+  flushRegions(tuple);
   tuple->rA_ias50.write();
   tuple->rC_ias50.write();
   tuple->rB_50ias60.write();
@@ -216,8 +216,17 @@ Analyzer::Analyzer(const edm::ParameterSet& iConfig)
       dEdxK_(iConfig.getUntrackedParameter<double>("DeDxK")),
       dEdxC_(iConfig.getUntrackedParameter<double>("DeDxC")),
       dEdxTemplate_(iConfig.getUntrackedParameter<string>("DeDxTemplate")),
+      dEdxTemplateCache_(iConfig.getUntrackedParameter<string>("DeDxTemplateCache")),
       timeOffset_(iConfig.getUntrackedParameter<string>("TimeOffset")),
+      timeOffsetCache_(iConfig.getUntrackedParameter<string>("TimeOffsetCache")),
       saveTree_(iConfig.getUntrackedParameter<int>("SaveTree")),
+      treeOutputFile_(iConfig.getUntrackedParameter<string>("TreeOutputFile")),
+      treeCompression_(iConfig.getUntrackedParameter<vector<string>>("TreeCompression")),
+      treeAutoFlush_(iConfig.getUntrackedParameter<int>("TreeAutoFlush")),
+      bookHistogramsOnFill_(iConfig.getUntrackedParameter<bool>("BookHistogramsOnFill")),
+      parallelCandidates_(iConfig.getUntrackedParameter<bool>("ParallelCandidates")),
+      earlyReject_(iConfig.getUntrackedParameter<bool>("EarlyReject")),
+      earlyRejectControlPrescale_(iConfig.getUntrackedParameter<int>("EarlyRejectControlPrescale")),
       plotsPreS_massSpectrumApproach_(iConfig.getUntrackedParameter<bool>("plotsPreS_massSpectrumApproach")),
       pixelCPE_(iConfig.getParameter<std::string>("PixelCPE")),
       debug_(iConfig.getUntrackedParameter<int>("DebugLevel")),
@@ -242,19 +251,16 @@ Analyzer::Analyzer(const edm::ParameterSet& iConfig)
   isSignal = (sampleType_ >= 2);
 
   bool splitByModuleType = true;
-  dEdxTemplatesPU.resize(NbPuBins_, NULL);
   // Option for Gi to have PU dependence
   if (puTreatment_){
-    for (int i = 0; i < NbPuBins_ ; i++){
-      dEdxTemplatesPU[i] = loadDeDxTemplate(dEdxTemplate_, splitByModuleType,true,(i+1));
-    }
+    iasTemplatesPU = loadDeDxTemplates(dEdxTemplate_, splitByModuleType, true, NbPuBins_, dEdxTemplateCache_);
   } else {
-      dEdxTemplates = loadDeDxTemplate(dEdxTemplate_, splitByModuleType,false,0);
+      iasTemplates = loadDeDxTemplates(dEdxTemplate_, splitByModuleType, false, 1, dEdxTemplateCache_)[0];
   }
   //protection
   if(calibrateTOF_){ 
       modGeometry.loadGeometry("CMS_GeomTree.root");
-      tofCalculator.loadTimeOffset(timeOffset_);
+      tofCalculator.loadTimeOffset(timeOffset_, timeOffsetCache_);
   }
   /*
   effl1Mu22 = new TEfficiency("eff1", "RAW EfficiencyL1 mu 22 vs bg", 100, 0, 5);
@@ -284,8 +290,15 @@ void Analyzer::beginJob() {
   tuple = new Tuple();
   
   initializeCuts(fs, CutPt_, CutI_, CutTOF_, CutPt_Flip_, CutI_Flip_, CutTOF_Flip_);
+  selectionGrid.set(CutPt_, CutI_, CutTOF_, typeMode_, false);
+  selectionGridFlip.set(CutPt_Flip_, CutI_Flip_, CutTOF_Flip_, typeMode_, true);
   
+  histos.setBookOnFill(bookHistogramsOnFill_);
+  eventCopies.setEnabled(debug_ > 0);
+  histoDir = dir.getBareDirectory();
   tuple_maker->initializeTuple(tuple,
+                               eventBlocks,
+                               histos,
                                dir,
                                saveTree_,
                                calcSyst_,
@@ -309,8 +322,11 @@ void Analyzer::beginJob() {
                                globalMinPt_,
                                globalMinTOF_,
                                tapeRecallOnly_);
+  if (saveTree_ > 0)
+    hscpTreeOutput.configure(tuple->Tree, treeOutputFile_, treeCompression_, treeAutoFlush_);
   
   tuple_maker->initializeRegions(tuple,
+                                 histos,
                                  dir,
                                  reg_etabins_,
                                  reg_ihbins_,
@@ -382,6 +398,59 @@ void Analyzer::beginJob() {
   } else {
     if (debug_> 0) edm::LogPrint(MOD) << "This is syst studies";
   }
+
+  //------------------------------------------------------------------
+  // Read in HLT trigger path list and muon HLT filter names from config files
+  //------------------------------------------------------------------
+  if (!triggerPathNames.load(triggerPathNamesFile_, NTriggersMAX)) {
+    LogError(MOD) << "ERROR!!! Could not open trigger path name file : " << edm::FileInPath(triggerPathNamesFile_.c_str()).fullPath().c_str() << "\n";
+  }
+  if (!muonHLTFilterNames.load(muonHLTFilterNamesFile_, MAX_MuonHLTFilters)) {
+    LogError(MOD) << "ERROR!!! Could not open trigger path name file : " << edm::FileInPath(muonHLTFilterNamesFile_.c_str()).fullPath().c_str() << "\n";
+  }
+  // patterns looked for in the HLT menu, the order is used in analyze
+  triggerPatterns = {trigger_met_,
+                     trigger_mu_,
+                     {"HLT_Mu50_v"},
+                     {"HLT_PFMET120_PFMHT120_IDTight_v"},
+                     {"HLT_PFHT500_PFMET100_PFMHT100_IDTight_v"},
+                     {"HLT_PFMETNoMu120_PFMHTNoMu120_IDTight_PFHT60_v"},
+                     {"HLT_MET105_IsoTrk50_v"},
+                     {"HLT_IsoMu27_v"},
+                     {"HLT_IsoMu24_v"}};
+
+  // trigger event filters and collections read in analyze, resolved once per event
+  const std::string singleMu22 = "hltL1sSingleMu22";
+  const std::string singleMu25 = "hltL1sSingleMu22or25";
+  const std::string singleMu22or25Filter0 = "hltL1fL1sMu22or25L1Filtered0";
+  const std::string singleMu22or25Filter10 = "hltL2fL1sMu22or25L1f0L2Filtered10Q";
+  const std::string singleMu22or25_l3Filter0 = "hltL1fForIterL3L1fL1sMu22or25L1Filtered0";
+  const std::string last_singlemu = "hltL3fL1sMu22Or25L1f0L2f10QL3Filtered50Q";
+  singleMu25FilterId_ = trigObjIndex.addFilter(singleMu25, "HLT");
+  singleMu22or25Filter0Id_ = trigObjIndex.addFilter(singleMu22or25Filter0, "HLT");
+  singleMu22or25Filter10Id_ = trigObjIndex.addFilter(singleMu22or25Filter10, "HLT");
+  lastSingleMuFilterId_ = trigObjIndex.addFilter(last_singlemu, "HLT");
+  singleMu22LabelId_ = trigObjIndex.addFilterLabel(singleMu22);
+  singleMu25LabelId_ = trigObjIndex.addFilterLabel(singleMu25);
+  singleMu22or25Filter0LabelId_ = trigObjIndex.addFilterLabel(singleMu22or25Filter0);
+  singleMu22or25Filter10LabelId_ = trigObjIndex.addFilterLabel(singleMu22or25Filter10);
+  singleMu22or25L3Filter0LabelId_ = trigObjIndex.addFilterLabel(singleMu22or25_l3Filter0);
+  lastSingleMuLabelId_ = trigObjIndex.addFilterLabel(last_singlemu);
+  hltMuonFilterId_ = trigObjIndex.addFilter(filterName_, "HLT");
+  muonHLTFilterIds.resize(MAX_MuonHLTFilters);
+  for (int q = 0; q < MAX_MuonHLTFilters; q++)
+    muonHLTFilterIds[q] = trigObjIndex.addFilter(muonHLTFilterNames.name(q), "HLT");
+  hltMetCollId_ = trigObjIndex.addCollection("hltMet::HLT");
+  hltMetCleanCollId_ = trigObjIndex.addCollection("hltMetClean::HLT");
+  hltMhtCollId_ = trigObjIndex.addCollection("hltMht::HLT");
+  hltPFMHTCollId_ = trigObjIndex.addCollection("hltPFMHTTightID::HLT");
+  hltPFMETCollId_ = trigObjIndex.addCollection("hltPFMETProducer::HLT");
+}
+
+// ------------ method called at the beginning of each run  ------------
+void Analyzer::beginRun(const edm::Run& iRun, const edm::EventSetup& iSetup) {
+  // the HLT menu can change with the run, the trigger index is rebuilt on the first event
+  triggerIndex.invalidate();
 }
 
 // ------------ method called for each event  ------------
@@ -390,6 +459,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   if (tapeRecallOnly_) return;
   
   eventWeight_ = 1.;
+  eventCopies.newEvent();
   
   static constexpr const char* const MOD = "Analyzer";
   static constexpr const float um2cmUnit = 0.0001;
@@ -412,20 +482,11 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   string year = period_;
   if(!isData) year="";
   int run_number=iEvent.id().run();
-  bool usePixel = true;
-  bool useStrip = true;
-  bool useTruncated = false;
   bool mustBeInside = true;
   size_t MaxStripNOM = 99;
   bool correctFEDSat = false;
-  int crossTalkInvAlgo = 1;
-  float dropLowerDeDxValue = 0.0;
   bool skipPixelL1 = false;
   int  skip_templates_ias = 0;
-  TH3F* localdEdxTemplates;
-  if (!createGiTemplates_ && !puTreatment_){
-    localdEdxTemplates = dEdxTemplates;
-  }
   float HSCPgenBeta1 = -1., HSCPgenBeta2 = -1.;
 
   //get generator weight and pthat
@@ -440,17 +501,20 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       }
   }
 
-  //get the collection of generated Particles
-  vector<reco::GenParticle> genColl;
+  //get the collection of generated Particles, empty for data
+  static const vector<reco::GenParticle> noGenParticles;
+  const vector<reco::GenParticle>* genCollPtr = &noGenParticles;
   if (!isData) {
     const edm::Handle<vector<reco::GenParticle>> genCollH = iEvent.getHandle(genParticleToken_);
     if (!genCollH.isValid()) {
       LogPrint(MOD) << "Invalid GenParticle collection, this event will be ignored!";
       return;
     } else {
-      genColl = *genCollH;
+      genCollPtr = genCollH.product();
     }
   }
+  const vector<reco::GenParticle>& genColl = *genCollPtr;
+  eventCopies.inPlace("genParticles", genColl);
 
   float SignalEventWeight = 1.0;
   if (isSignal) {
@@ -513,36 +577,104 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     }
   } // end condition for MC for gen stuff
 
+  //------------------------------------------------------------------
+  // Get trigger results for this event
+  //------------------------------------------------------------------
+  const edm::Handle<edm::TriggerResults> triggerH = iEvent.getHandle(triggerResultsToken_);
+  const auto triggerNames = iEvent.triggerNames(*triggerH);
+  // if (isData) iEvent.getByToken(triggerPrescalesToken_, triggerPrescales);
+
+  //edm::Handle<pat::PackedTriggerPrescales> triggerPrescales = iEvent.getHandle(triggerPrescalesToken_);
+
+
+
+   
+  //------------------------------------------------------------------
+  // Save trigger decisions in array of booleans
+  //------------------------------------------------------------------
+  // The HLT menu is resolved on the trigger path list once per run (see beginRun)
+  triggerIndex.update(triggerNames, triggerPathNames, triggerPatterns);
+
+  std::vector<bool> triggerDecision;
+  std::vector<int> triggerHLTPrescale(NTriggersMAX, 1);
+  triggerIndex.fillDecisions(*triggerH, triggerDecision);
+  //if (isData) triggerHLTPrescale[j] = triggerPrescales->getPrescaleForIndex(i);
+
+  // the order of the patterns is the one given in beginJob
+  bool metTrig = triggerIndex.passPatterns(*triggerH, 0);
+  bool muTrig = triggerIndex.passPatterns(*triggerH, 1);
+
+  // Early reject: an event w/o trigger decision or w/o any candidate track above the pt (nominal
+  // or shifted up for the pt systematics) and in the eta of the preselection can't have a
+  // preselected candidate. It is skipped before the gen, vertex and trigger object blocks, only
+  // the event counters are filled. One of every earlyRejectControlPrescale_ such events is
+  // still fully processed.
+  const auto& hscpCandidates = iEvent.get(hscpToken_);
+  eventCopies.inPlace("hscpCandidates", hscpCandidates);
+  if (earlyReject_) {
+    earlyRejectSeen_++;
+    bool viable = false;
+    if (metTrig || muTrig) {
+      for (const auto& hscp : hscpCandidates) {
+        if (typeMode_ == 0 && hscp.type() != susybsm::HSCParticleType::trackerMuon &&
+            hscp.type() != susybsm::HSCParticleType::globalMuon && hscp.type() != susybsm::HSCParticleType::innerTrack)
+          continue;
+        if (typeMode_ == 1 && hscp.type() != susybsm::HSCParticleType::trackerMuon &&
+            hscp.type() != susybsm::HSCParticleType::globalMuon)
+          continue;
+        if (typeMode_ == 3 && hscp.muonRef().isNull())
+          continue;
+        reco::TrackRef track = (typeMode_ != 3) ? hscp.trackRef() : hscp.muonRef()->standAloneMuon();
+        if (track.isNull() || fabs(track->eta()) >= globalMaxEta_)
+          continue;
+        float rescaledPtUp = track->pt() * (1 + shiftForPt(track->pt(), track->eta(), track->phi(), track->charge()));
+        if (std::max<float>(track->pt(), rescaledPtUp) > globalMinPt_) {
+          viable = true;
+          break;
+        }
+      }
+    }
+    if (!viable) {
+      earlyRejectFailed_++;
+      if (earlyRejectControlPrescale_ <= 0 || earlyRejectFailed_ % earlyRejectControlPrescale_ != 0) {
+        if (debug_ > 2) LogPrint(MOD) << " > No candidate can pass the preselection -- skip event";
+        // w/o the trigger object matching, the weight has no muon SFs and trigInfo_ is unknown
+        if (!isData) eventWeight_ *= mcWeight->getEventPUWeight(iEvent, pileupInfoToken_, PUSystFactor_);
+        tuple->EventWeight->Fill(eventWeight_);
+        tuple->NumEvents->Fill(1.);
+        if (muTrig || metTrig) tuple->NumEvents->Fill(2.);
+        return;
+      }
+      earlyRejectSampled_++;
+      if (debug_ > 2) LogPrint(MOD) << " > No candidate can pass the preselection, kept as control sample";
+    }
+  }
+
   //------------------------------------------------------------------
   // Vertex related quantities, finding the best (sum pT squared) vertex
   //------------------------------------------------------------------
   // Collection for vertices
-  vector<reco::Vertex> vertexColl = iEvent.get(offlinePrimaryVerticesToken_);
+  const vector<reco::Vertex>& vertexColl = iEvent.get(offlinePrimaryVerticesToken_);
+  eventCopies.inPlace("vertices", vertexColl);
   int numGoodVerts = 0;
-  std::vector<float> pvX;
-  std::vector<float> pvY;
-  std::vector<float> pvZ;
-  std::vector<float> pvRho;
-  std::vector<int> pvNdof;
-  std::vector<float> pvChi2;
-  std::vector<float> pvSumPt2;
+  VertexBlock& pvBlock = eventBlocks.vertex;
+  pvBlock.clear();
   
   // Loop on the vertices in the event
   bool foundPV = false;
   int highestSumPt2VertexIndex = -1;
-  reco::Vertex highestSumPt2Vertex = vertexColl.front();
   
   for (unsigned int i = 0; i < vertexColl.size(); i++) {
     if (vertexColl[i].isFake())continue;
     if (!vertexColl[i].isValid())continue;
     numGoodVerts++;
     
-    pvX.push_back(vertexColl[i].x());
-    pvY.push_back(vertexColl[i].y());
-    pvZ.push_back(vertexColl[i].z());
-    pvRho.push_back(vertexColl[i].position().rho());
-    pvNdof.push_back(vertexColl[i].ndof());
-    pvChi2.push_back(vertexColl[i].chi2());
+    pvBlock.X.push_back(vertexColl[i].x());
+    pvBlock.Y.push_back(vertexColl[i].y());
+    pvBlock.Z.push_back(vertexColl[i].z());
+    pvBlock.Rho.push_back(vertexColl[i].position().rho());
+    pvBlock.Ndof.push_back(vertexColl[i].ndof());
+    pvBlock.Chi2.push_back(vertexColl[i].chi2());
     
     // calculate sum pT squared
     double sum = 0.;
@@ -554,14 +686,15 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       
       sum += pT * pT;
     }
-    pvSumPt2.push_back(sum);
+    pvBlock.SumPt2.push_back(sum);
     
     if (!foundPV) {
-      highestSumPt2Vertex = vertexColl[i];
       foundPV = true;
       highestSumPt2VertexIndex = i;
     }
   } // end loop on vertexColl
+  // the first vertex if none is good
+  const reco::Vertex& highestSumPt2Vertex = vertexColl[foundPV ? highestSumPt2VertexIndex : 0];
   
   // A,B,C for 3 categories of PU
   bool PUA = (numGoodVerts < 15);
@@ -571,20 +704,8 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   //------------------------------------------------------------------
   // GenParticles to be saved in the HSCP candidate ntuples (Christina Wang)
   //------------------------------------------------------------------
-  std::vector<int> gParticleId;
-  std::vector<int> gParticleStatus;
-  std::vector<float> gParticleE;
-  std::vector<float> gParticlePt;
-  std::vector<float> gParticlePz;
-  std::vector<float> gParticleEta;
-  std::vector<float> gParticlePhi;
-  std::vector<float> gParticleBeta;
-  std::vector<int> gParticleCharge;
-  std::vector<float> gParticleProdVertexX;
-  std::vector<float> gParticleProdVertexY;
-  std::vector<float> gParticleProdVertexZ;
-  std::vector<int> gParticleMotherId;
-  std::vector<int> gParticleMotherIndex;
+  GenBlock& genBlock = eventBlocks.gen;
+  genBlock.clear();
 
   std::vector<const reco::Candidate*> prunedV;//Allows easier comparison for mother finding
 
@@ -605,94 +726,37 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
 
   //Look for mother particle and Fill gen variables
   for(unsigned int i = 0; i < prunedV.size(); i++) {
-    gParticleId.push_back(prunedV[i]->pdgId());
-    gParticleStatus.push_back(prunedV[i]->status());
-    gParticleE.push_back(prunedV[i]->energy());
-    gParticlePt.push_back(prunedV[i]->pt());
-    gParticlePz.push_back(prunedV[i]->pz());
-    gParticleEta.push_back(prunedV[i]->eta());
-    gParticlePhi.push_back(prunedV[i]->phi());
-    gParticleProdVertexX.push_back(prunedV[i]->vx());
-    gParticleProdVertexY.push_back(prunedV[i]->vy());
-    gParticleProdVertexZ.push_back(prunedV[i]->vz());
-    gParticleBeta.push_back(prunedV[i]->p()/prunedV[i]->energy());
-    gParticleCharge.push_back(prunedV[i]->charge());
-    gParticleMotherId.push_back(0);
-    gParticleMotherIndex.push_back(-1);
+    genBlock.Id.push_back(prunedV[i]->pdgId());
+    genBlock.Status.push_back(prunedV[i]->status());
+    genBlock.E.push_back(prunedV[i]->energy());
+    genBlock.Pt.push_back(prunedV[i]->pt());
+    genBlock.Pz.push_back(prunedV[i]->pz());
+    genBlock.Eta.push_back(prunedV[i]->eta());
+    genBlock.Phi.push_back(prunedV[i]->phi());
+    genBlock.ProdVertexX.push_back(prunedV[i]->vx());
+    genBlock.ProdVertexY.push_back(prunedV[i]->vy());
+    genBlock.ProdVertexZ.push_back(prunedV[i]->vz());
+    genBlock.Beta.push_back(prunedV[i]->p()/prunedV[i]->energy());
+    genBlock.Charge.push_back(prunedV[i]->charge());
+    genBlock.MotherId.push_back(0);
+    genBlock.MotherIndex.push_back(-1);
 
     if(prunedV[i]->numberOfMothers() > 0) {
       //find the ID of the first mother that has a different ID than the particle itself
       const reco::Candidate* firstMotherWithDifferentID = findFirstMotherWithDifferentID(prunedV[i]);
-      if (firstMotherWithDifferentID)gParticleMotherId[i] = firstMotherWithDifferentID->pdgId();
+      if (firstMotherWithDifferentID)genBlock.MotherId[i] = firstMotherWithDifferentID->pdgId();
 
       //find the mother and keep going up the mother chain if the ID's are the same
       const reco::Candidate* originalMotherWithSameID = findOriginalMotherWithSameID(prunedV[i]);
       for(unsigned int j = 0; j < prunedV.size(); j++) {
         if(prunedV[j] == originalMotherWithSameID) {
-          gParticleMotherIndex[i] = j;
+          genBlock.MotherIndex[i] = j;
           break;
         }
       }
     }
     else {
-      gParticleMotherIndex[i] = -1;
-    }
-  }
-  //------------------------------------------------------------------
-  // Get trigger results for this event
-  //------------------------------------------------------------------
-  const edm::Handle<edm::TriggerResults> triggerH = iEvent.getHandle(triggerResultsToken_);
-  const auto triggerNames = iEvent.triggerNames(*triggerH);
-  // if (isData) iEvent.getByToken(triggerPrescalesToken_, triggerPrescales);
-
-  //edm::Handle<pat::PackedTriggerPrescales> triggerPrescales = iEvent.getHandle(triggerPrescalesToken_);
-
-
-
-   
-  //------------------------------------------------------------------
-  //Read in HLT Trigger Path List from config file
-  //------------------------------------------------------------------
-  for (int i = 0; i<NTriggersMAX; ++i) triggerPathNames[i] = "";
-  ifstream myfile (edm::FileInPath(triggerPathNamesFile_.c_str()).fullPath().c_str()) ;
-  if (myfile.is_open()) {
-    std::string line;
-    int index;
-    std::string hltpathname;
-    while(myfile>>index>>hltpathname)
-    {
-      if (index < NTriggersMAX) triggerPathNames[index] = hltpathname;
-    }
-    myfile.close();
-  }
-  else {
-    LogError(MOD) << "ERROR!!! Could not open trigger path name file : " << edm::FileInPath(triggerPathNamesFile_.c_str()).fullPath().c_str() << "\n";
-  }
-
-  //------------------------------------------------------------------
-  // Save trigger decisions in array of booleans
-  //------------------------------------------------------------------
-  std::vector<bool> triggerDecision;
-  std::vector<int> triggerHLTPrescale;
-  for (unsigned int j = 0; j < NTriggersMAX; ++j) {
-    triggerDecision.push_back(false);
-    triggerHLTPrescale.push_back(1);
-
-  }
-
-  for (unsigned int i = 0, n = triggerH->size(); i < n; ++i) {
-    string hltPathNameReq = "HLT_";
-    if ((triggerNames.triggerName(i)).find(hltPathNameReq) == string::npos) continue;
-    if ((triggerNames.triggerName(i)).find_last_of("_") == string::npos) continue;
-    int lastUnderscorePos = (triggerNames.triggerName(i)).find_last_of("_");
-    string hltPathNameWithoutVersionNumber = (triggerNames.triggerName(i)).substr(0,lastUnderscorePos);
-
-    for (unsigned int j = 0; j < NTriggersMAX; ++j) {
-      if (triggerPathNames[j] == "") continue;
-      if (hltPathNameWithoutVersionNumber == triggerPathNames[j]) {
-      	triggerDecision[j] = triggerH->accept(i);
-      	//if (isData) triggerHLTPrescale[j] = triggerPrescales->getPrescaleForIndex(i);
-      }
+      genBlock.MotherIndex[i] = -1;
     }
   }
 
@@ -702,119 +766,40 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   // These are used in the tree alone, otherwise we use passTriggerPatterns to check the triggers
   edm::Handle<trigger::TriggerEvent> trigEvent2 = iEvent.getHandle(trigEventToken_);
 
-  std::string singleMu22 = "hltL1sSingleMu22";
-  std::string singleMu25 = "hltL1sSingleMu22or25";
-  std::string singleMu22or25Filter0 = "hltL1fL1sMu22or25L1Filtered0";
-  std::string singleMu22or25Filter10 = "hltL2fL1sMu22or25L1f0L2Filtered10Q";
-  std::string singleMu22or25_l3Filter0 = "hltL1fForIterL3L1fL1sMu22or25L1Filtered0";
-  std::string last_singlemu = "hltL3fL1sMu22Or25L1f0L2f10QL3Filtered50Q";
-
-  std::vector<float> L1_22or25PT;
-  std::vector<float> L1_22or25Eta;
-  std::vector<float> L1_22or25Phi;
-  std::vector<float> L1_22or25Mass;
-
-  std::vector<TLorentzVector> trigObjP4sL1Mu22or25;
-  trigtools::getP4sOfObsPassingFilter(trigObjP4sL1Mu22or25,*trigEvent2,singleMu25,"HLT");
-
-  for (const auto& objP4 : trigObjP4sL1Mu22or25){
-      double pT = objP4.Pt();
-      double eta = objP4.Eta();
-      double phi = objP4.Phi();
-      double mass = objP4.M();
-
-      L1_22or25PT.push_back(pT);
-      L1_22or25Eta.push_back(eta);
-      L1_22or25Phi.push_back(phi);
-      L1_22or25Mass.push_back(mass);
-  }
-
-  std::vector<float> L1_22or25F0PT;
-  std::vector<float> L1_22or25F0Eta;
-  std::vector<float> L1_22or25F0Phi;
-  std::vector<float> L1_22or25F0Mass;
-
-  std::vector<TLorentzVector> trigObjP4sL1Mu22or25Filter0;
-  trigtools::getP4sOfObsPassingFilter(trigObjP4sL1Mu22or25Filter0,*trigEvent2,singleMu22or25Filter0,"HLT");
-
-  for (const auto& objP4 : trigObjP4sL1Mu22or25Filter0){
-      double pT = objP4.Pt();
-      double eta = objP4.Eta();
-      double phi = objP4.Phi();
-      double mass = objP4.M();
-
-      L1_22or25F0PT.push_back(pT);
-      L1_22or25F0Eta.push_back(eta);
-      L1_22or25F0Phi.push_back(phi);
-      L1_22or25F0Mass.push_back(mass);
-  }
-
-  std::vector<float> L1_22or25F10PT;
-  std::vector<float> L1_22or25F10Eta;
-  std::vector<float> L1_22or25F10Phi;
-  std::vector<float> L1_22or25F10Mass;
-
-  std::vector<TLorentzVector> trigObjP4sL1Mu22or25Filter10;
-  trigtools::getP4sOfObsPassingFilter(trigObjP4sL1Mu22or25Filter10,*trigEvent2,singleMu22or25Filter10,"HLT");
-
-  for (const auto& objP4 : trigObjP4sL1Mu22or25Filter10){
-      double pT = objP4.Pt();
-      double eta = objP4.Eta();
-      double phi = objP4.Phi();
-      double mass = objP4.M();
-
-      L1_22or25F10PT.push_back(pT);
-      L1_22or25F10Eta.push_back(eta);
-      L1_22or25F10Phi.push_back(phi);
-      L1_22or25F10Mass.push_back(mass);
-  }
-
-  std::vector<float> HLT_lastFilterPT;
-  std::vector<float> HLT_lastFilterEta;
-  std::vector<float> HLT_lastFilterPhi;
-  std::vector<float> HLT_lastFilterMass;
-
-  std::vector<TLorentzVector> trigObjP4sLastHLTFilter;
-  trigtools::getP4sOfObsPassingFilter(trigObjP4sLastHLTFilter,*trigEvent2,last_singlemu,"HLT");
-
-  for (const auto& objP4 : trigObjP4sLastHLTFilter){
-      double pT = objP4.Pt();
-      double eta = objP4.Eta();
-      double phi = objP4.Phi();
-      double mass = objP4.M();
-
-      HLT_lastFilterPT.push_back(pT);
-      HLT_lastFilterEta.push_back(eta);
-      HLT_lastFilterPhi.push_back(phi);
-      HLT_lastFilterMass.push_back(mass);
-  }
-
-
-  bool L1mu22 = false;
-  bool L1mu22or25 = false;
-  bool L1mu22or25Filter0 = false;
-  bool L1mu22or25Filter10 = false;
-  bool L1mu22or25_l3Filter0 = false;
-  bool L1lastmu = false;
-  
-  if(trigtools::passedFilter(*trigEvent2,singleMu22)){
-      L1mu22 = true;
-  }
-  if(trigtools::passedFilter(*trigEvent2,singleMu25)){
-      L1mu22or25=true;
-  } 
-  if(trigtools::passedFilter(*trigEvent2,singleMu22or25Filter0)){
-      L1mu22or25Filter0=true;
-  } 
-  if(trigtools::passedFilter(*trigEvent2,singleMu22or25Filter10)){
-      L1mu22or25Filter10=true;
-  } 
-  if(trigtools::passedFilter(*trigEvent2,singleMu22or25_l3Filter0)){
-      L1mu22or25_l3Filter0=true;
-  } 
-  if(trigtools::passedFilter(*trigEvent2,last_singlemu)){
-      L1lastmu = true;
-  }
+  trigObjIndex.newEvent(*trigEvent2);
+  eventCopies.inPlace("triggerObjects", trigEvent2->getObjects());
+
+  trigtools::triggerObjects trigObjs;
+  trigObjIndex.getObjsPassingFilter(trigObjs, singleMu25FilterId_);
+  std::vector<float> L1_22or25PT = trigObjs.pt;
+  std::vector<float> L1_22or25Eta = trigObjs.eta;
+  std::vector<float> L1_22or25Phi = trigObjs.phi;
+  std::vector<float> L1_22or25Mass = trigObjs.mass;
+
+  trigObjIndex.getObjsPassingFilter(trigObjs, singleMu22or25Filter0Id_);
+  std::vector<float> L1_22or25F0PT = trigObjs.pt;
+  std::vector<float> L1_22or25F0Eta = trigObjs.eta;
+  std::vector<float> L1_22or25F0Phi = trigObjs.phi;
+  std::vector<float> L1_22or25F0Mass = trigObjs.mass;
+
+  trigObjIndex.getObjsPassingFilter(trigObjs, singleMu22or25Filter10Id_);
+  std::vector<float> L1_22or25F10PT = trigObjs.pt;
+  std::vector<float> L1_22or25F10Eta = trigObjs.eta;
+  std::vector<float> L1_22or25F10Phi = trigObjs.phi;
+  std::vector<float> L1_22or25F10Mass = trigObjs.mass;
+
+  trigObjIndex.getObjsPassingFilter(trigObjs, lastSingleMuFilterId_);
+  std::vector<float> HLT_lastFilterPT = trigObjs.pt;
+  std::vector<float> HLT_lastFilterEta = trigObjs.eta;
+  std::vector<float> HLT_lastFilterPhi = trigObjs.phi;
+  std::vector<float> HLT_lastFilterMass = trigObjs.mass;
+
+  bool L1mu22 = trigObjIndex.passedFilter(singleMu22LabelId_);
+  bool L1mu22or25 = trigObjIndex.passedFilter(singleMu25LabelId_);
+  bool L1mu22or25Filter0 = trigObjIndex.passedFilter(singleMu22or25Filter0LabelId_);
+  bool L1mu22or25Filter10 = trigObjIndex.passedFilter(singleMu22or25Filter10LabelId_);
+  bool L1mu22or25_l3Filter0 = trigObjIndex.passedFilter(singleMu22or25L3Filter0LabelId_);
+  bool L1lastmu = trigObjIndex.passedFilter(lastSingleMuLabelId_);
 
 
   bool HLT_Mu50 = false;
@@ -825,28 +810,13 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   bool HLT_isoMu24 = false;
   bool HLT_isoMu27 = false;
   
-  bool metTrig = passTriggerPatterns(triggerH, triggerNames, trigger_met_);
-  bool muTrig = passTriggerPatterns(triggerH, triggerNames, trigger_mu_);
-
-
-  
-  for (unsigned int i = 0; i < triggerH->size(); i++) {
-    if (TString(triggerNames.triggerName(i)).Contains("HLT_Mu50_v") && triggerH->accept(i))
-      HLT_Mu50 = true;
-    if (TString(triggerNames.triggerName(i)).Contains("HLT_PFMET120_PFMHT120_IDTight_v") && triggerH->accept(i))
-      HLT_PFMET120_PFMHT120_IDTight = true;
-    if (TString(triggerNames.triggerName(i)).Contains("HLT_PFHT500_PFMET100_PFMHT100_IDTight_v") && triggerH->accept(i))
-      HLT_PFHT500_PFMET100_PFMHT100_IDTight = true;
-    if (TString(triggerNames.triggerName(i)).Contains("HLT_PFMETNoMu120_PFMHTNoMu120_IDTight_PFHT60_v") &&
-        triggerH->accept(i))
-      HLT_PFMETNoMu120_PFMHTNoMu120_IDTight_PFHT60 = true;
-    if (TString(triggerNames.triggerName(i)).Contains("HLT_MET105_IsoTrk50_v") && triggerH->accept(i))
-      HLT_MET105_IsoTrk50 = true;
-    if (TString(triggerNames.triggerName(i)).Contains("HLT_IsoMu27_v") && triggerH->accept(i))
-      HLT_isoMu27 = true;
-    if (TString(triggerNames.triggerName(i)).Contains("HLT_IsoMu24_v") && triggerH->accept(i))
-      HLT_isoMu24 = true;
-  }
+  HLT_Mu50 = triggerIndex.passPatterns(*triggerH, 2);
+  HLT_PFMET120_PFMHT120_IDTight = triggerIndex.passPatterns(*triggerH, 3);
+  HLT_PFHT500_PFMET100_PFMHT100_IDTight = triggerIndex.passPatterns(*triggerH, 4);
+  HLT_PFMETNoMu120_PFMHTNoMu120_IDTight_PFHT60 = triggerIndex.passPatterns(*triggerH, 5);
+  HLT_MET105_IsoTrk50 = triggerIndex.passPatterns(*triggerH, 6);
+  HLT_isoMu27 = triggerIndex.passPatterns(*triggerH, 7);
+  HLT_isoMu24 = triggerIndex.passPatterns(*triggerH, 8);
 
   // Should this be a bin in error histo?
   if (HLT_Mu50 != triggerDecision.at(196)) cout << "TRIGGER DECISION DOESN'T AGREE!!" << endl;
@@ -854,12 +824,13 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   // Get handle for trigEvent
   edm::Handle<trigger::TriggerEvent> trigEvent = iEvent.getHandle(trigEventToken_);
   // Get muon collections
-  vector<reco::Muon> muonColl = iEvent.get(muonToken_);
+  const vector<reco::Muon>& muonColl = iEvent.get(muonToken_);
+  eventCopies.inPlace("muons", muonColl);
 
 
   // Match muon track to HLT muon track
   std::vector<TLorentzVector> trigObjP4s;
-  trigtools::getP4sOfObsPassingFilter(trigObjP4s,*trigEvent,filterName_,"HLT");
+  trigObjIndex.getP4sOfObsPassingFilter(trigObjP4s, hltMuonFilterId_);
 
 
   bool matchedMuonWasFound = false;
@@ -1188,6 +1159,15 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   // Retrieve CPE from the event setup
   edm::ESHandle<PixelClusterParameterEstimator> pixelCPE;
   iSetup.get<TkPixelCPERecord>().get(pixelCPE_, pixelCPE);
+  // CPE results are re-used by all the hit loops of the event (the HSCP candidates have their own caches)
+  cpeCache.newEvent(tkGeometry.product(), pixelCPE.product());
+  // module attributes are decoded once per geometry and topology, the pixel scale factors once per run
+  // (both watchers are checked every event so that each keeps track of its own record)
+  const bool tkGeometryChanged = tkGeometryWatcher.check(iSetup);
+  const bool tTopoChanged = tTopoWatcher.check(iSetup);
+  if (tkGeometryChanged || tTopoChanged)
+    detTable.build(tkGeometry.product(), tTopo);
+  detTable.setRun(year, run_number);
 
   // Handles for track collection, PF candidates, PF MET and PF jets, and Calo jets
   const edm::Handle<reco::TrackCollection> trackCollectionHandle = iEvent.getHandle(genTrackToken_);;
@@ -1197,6 +1177,48 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   const edm::Handle<std::vector<reco::CaloJet>> caloJetHandle = iEvent.getHandle(caloJetToken_);
   const edm::Handle<std::vector<reco::CaloMET>> recoCaloMETHandle = iEvent.getHandle(caloMETToken_);
 
+  // Closest Calo jet to each PF jet, it does not depend on the HSCP candidate
+  std::vector<float> dRMinPfCaloJet, dPtPfCaloJet;
+  if (pfJetHandle.isValid()) {
+    dRMinPfCaloJet.assign(pfJetHandle->size(), 9999.0);
+    dPtPfCaloJet.assign(pfJetHandle->size(), 9999.0);
+    for (unsigned int i = 0; i < pfJetHandle->size() && caloJetHandle.isValid(); i++) {
+      const reco::PFJet* jet = &(*pfJetHandle)[i];
+      for (unsigned int iCalo = 0; iCalo < caloJetHandle->size(); iCalo++) {
+        const reco::CaloJet* jetCalo = &(*caloJetHandle)[iCalo];
+        float drCalo = deltaR(jet->eta(), jet->phi(), jetCalo->eta(), jetCalo->phi());
+        if (drCalo < dRMinPfCaloJet[i]) {
+          dRMinPfCaloJet[i] = drCalo;
+          dPtPfCaloJet[i] = fabs(jet->pt() - jetCalo->pt());
+        }
+      }
+    }
+  }
+
+  // (eta, phi) grids used by the cone sums of the HSCP candidates
+  trackGrid.clear();
+  if (trackCollectionHandle.isValid())
+    trackGrid.fill(*trackCollectionHandle);
+  pfCandGrid.clear();
+  pfCandOfTrack.clear();
+  nextPfCandOfTrack.clear();
+  if (pfCandHandle.isValid()) {
+    pfCandGrid.fill(*pfCandHandle);
+    // PF candidates built from each track (by track key), the HSCP track itself is looked up here.
+    // Several PF candidates can share a track: pfCandOfTrack is the first one, nextPfCandOfTrack
+    // chains the others in collection order, -1 ends the chain
+    nextPfCandOfTrack.resize(pfCandHandle->size(), -1);
+    for (int i = pfCandHandle->size() - 1; i >= 0; i--) {
+      const reco::TrackRef& pfTrackRef = (*pfCandHandle)[i].trackRef();
+      if (pfTrackRef.isNull())
+        continue;
+      if (pfTrackRef.key() >= pfCandOfTrack.size())
+        pfCandOfTrack.resize(pfTrackRef.key() + 1, -1);
+      nextPfCandOfTrack[i] = pfCandOfTrack[pfTrackRef.key()];
+      pfCandOfTrack[pfTrackRef.key()] = i;
+    }
+  }
+
   //================= Handle For Muon DT/CSC Segment ===============
   if (!isBckg) {//do not recompute TOF on MC background
       iEvent.getByToken(muonCscSegmentToken_, CSCSegmentCollH);
@@ -1240,42 +1262,8 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   // Add all electrons
   edm::Handle<reco::GsfElectronCollection> electrons = iEvent.getHandle(electronToken_);
 
-  std::vector<float> eleE;
-  std::vector<float> elePt;
-  std::vector<float> eleEta;
-  std::vector<float> elePhi;
-  std::vector<float> eleCharge;
-  std::vector<float> eleE_SC;
-  std::vector<float> eleEta_SC;
-  std::vector<float> elePhi_SC;
-  std::vector<float> eleSigmaIetaIeta;
-  std::vector<float> eleFull5x5SigmaIetaIeta;
-  std::vector<float> eleR9;
-  std::vector<float> ele_dEta;
-  std::vector<float> ele_dPhi;
-  std::vector<float> ele_HoverE;
-  std::vector<float> ele_d0;
-  std::vector<float> ele_dZ;
-  std::vector<float> ele_pileupIso;
-  std::vector<float> ele_chargedIso;
-  std::vector<float> ele_photonIso;
-  std::vector<float> ele_neutralHadIso;
-  std::vector<int> ele_MissHits;
-  std::vector<bool> ele_passCutBasedIDVeto;
-  std::vector<bool> ele_passCutBasedIDLoose;
-  std::vector<bool> ele_passCutBasedIDMedium;
-  std::vector<bool> ele_passCutBasedIDTight;
-  std::vector<bool> ele_passMVAIsoIDWP80;
-  std::vector<bool> ele_passMVAIsoIDWP90;
-  std::vector<bool> ele_passMVAIsoIDWPHZZ;
-  std::vector<bool> ele_passMVAIsoIDWPLoose;
-  std::vector<bool> ele_passMVANoIsoIDWP80;
-  std::vector<bool> ele_passMVANoIsoIDWP90;
-  std::vector<bool> ele_passMVANoIsoIDWPLoose;
-  std::vector<bool> ele_PassConvVeto;
-  std::vector<float> ele_OneOverEminusOneOverP;
-
-
+  ElectronBlock& eleBlock = eventBlocks.electron;
+  eleBlock.clear();
 
   iEvent.getByToken(electron_cutbasedID_decisions_veto_Token_, electron_cutbasedID_decisions_veto);
   iEvent.getByToken(electron_cutbasedID_decisions_loose_Token_, electron_cutbasedID_decisions_loose);
@@ -1295,9 +1283,10 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   iEvent.getByToken(offlineBeamSpotToken_,beamSpot);
 
   // Loop on the electron collection
+  eventCopies.inPlace("electrons", *electrons);
 
   for (uint i = 0; i < electrons->size(); ++i){
-      const reco::GsfElectron ele = (*electrons)[i];
+      const reco::GsfElectron& ele = (*electrons)[i];
       reco::GsfElectronRef eleRef(electrons, i);
       if(ele.pt() < 5) continue;
       /*
@@ -1315,42 +1304,42 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
 
       //if(eleonvonve
 
-      eleE.push_back(ele.energy());
-      elePt.push_back(ele.pt());
-      eleEta.push_back(ele.eta());
-      elePhi.push_back(ele.phi());
-      eleCharge.push_back(ele.charge());
+      eleBlock.E.push_back(ele.energy());
+      eleBlock.Pt.push_back(ele.pt());
+      eleBlock.Eta.push_back(ele.eta());
+      eleBlock.Phi.push_back(ele.phi());
+      eleBlock.Charge.push_back(ele.charge());
       ele.hadronicOverEm();
-      eleE_SC.push_back(ele.superCluster()->energy());
-      eleEta_SC.push_back(ele.superCluster()->eta());
-      elePhi_SC.push_back(ele.superCluster()->phi());
-
-      eleSigmaIetaIeta.push_back(ele.sigmaIetaIeta());
-      eleFull5x5SigmaIetaIeta.push_back(ele.full5x5_sigmaIetaIeta());
-      eleR9.push_back(ele.r9());
-      ele_dEta.push_back(ele.deltaEtaSuperClusterTrackAtVtx() - ele.superCluster()->eta() + ele.superCluster()->seed()->eta());
-
-      ele_dPhi.push_back(ele.deltaPhiSuperClusterTrackAtVtx());
-      ele_HoverE.push_back(ele.hcalOverEcal());
-      ele_d0.push_back(ele.gsfTrack().get()->dxy(highestSumPt2Vertex.position()));
-      ele_dZ.push_back(ele.gsfTrack().get()->dz(highestSumPt2Vertex.position()));
-
-      ele_pileupIso.push_back(ele.pfIsolationVariables().sumPUPt);
-      ele_chargedIso.push_back(ele.pfIsolationVariables().sumChargedHadronPt);
-      ele_photonIso.push_back(ele.pfIsolationVariables().sumPhotonEt);
-      ele_neutralHadIso.push_back(ele.pfIsolationVariables().sumNeutralHadronEt);
-      ele_MissHits.push_back(ele.gsfTrack()->hitPattern().numberOfAllHits(reco::HitPattern::MISSING_INNER_HITS));
-      ele_passCutBasedIDVeto.push_back((*electron_cutbasedID_decisions_veto)[eleRef]);
-      ele_passCutBasedIDLoose.push_back((*electron_cutbasedID_decisions_loose)[eleRef]);
-      ele_passCutBasedIDMedium.push_back((*electron_cutbasedID_decisions_medium)[eleRef]);
-      ele_passCutBasedIDTight.push_back((*electron_cutbasedID_decisions_tight)[eleRef]);
-      ele_passMVAIsoIDWP80.push_back((*electron_mvaIsoID_decisions_wp80)[eleRef]);
-      ele_passMVAIsoIDWP90.push_back((*electron_mvaIsoID_decisions_wp90)[eleRef]);
-      ele_passMVAIsoIDWPHZZ.push_back((*electron_mvaIsoID_decisions_wpHZZ)[eleRef]);
-      ele_passMVAIsoIDWPLoose.push_back((*electron_mvaIsoID_decisions_wpLoose)[eleRef]);
-      ele_passMVANoIsoIDWP80.push_back((*electron_mvaNoIsoID_decisions_wp80)[eleRef]);
-      ele_passMVANoIsoIDWP90.push_back((*electron_mvaNoIsoID_decisions_wp90)[eleRef]);
-      ele_passMVANoIsoIDWPLoose.push_back((*electron_mvaNoIsoID_decisions_wpLoose)[eleRef]);
+      eleBlock.E_SC.push_back(ele.superCluster()->energy());
+      eleBlock.Eta_SC.push_back(ele.superCluster()->eta());
+      eleBlock.Phi_SC.push_back(ele.superCluster()->phi());
+
+      eleBlock.SigmaIetaIeta.push_back(ele.sigmaIetaIeta());
+      eleBlock.Full5x5SigmaIetaIeta.push_back(ele.full5x5_sigmaIetaIeta());
+      eleBlock.R9.push_back(ele.r9());
+      eleBlock.dEta.push_back(ele.deltaEtaSuperClusterTrackAtVtx() - ele.superCluster()->eta() + ele.superCluster()->seed()->eta());
+
+      eleBlock.dPhi.push_back(ele.deltaPhiSuperClusterTrackAtVtx());
+      eleBlock.HoverE.push_back(ele.hcalOverEcal());
+      eleBlock.d0.push_back(ele.gsfTrack().get()->dxy(highestSumPt2Vertex.position()));
+      eleBlock.dZ.push_back(ele.gsfTrack().get()->dz(highestSumPt2Vertex.position()));
+
+      eleBlock.pileupIso.push_back(ele.pfIsolationVariables().sumPUPt);
+      eleBlock.chargedIso.push_back(ele.pfIsolationVariables().sumChargedHadronPt);
+      eleBlock.photonIso.push_back(ele.pfIsolationVariables().sumPhotonEt);
+      eleBlock.neutralHadIso.push_back(ele.pfIsolationVariables().sumNeutralHadronEt);
+      eleBlock.MissHits.push_back(ele.gsfTrack()->hitPattern().numberOfAllHits(reco::HitPattern::MISSING_INNER_HITS));
+      eleBlock.passCutBasedIDVeto.push_back((*electron_cutbasedID_decisions_veto)[eleRef]);
+      eleBlock.passCutBasedIDLoose.push_back((*electron_cutbasedID_decisions_loose)[eleRef]);
+      eleBlock.passCutBasedIDMedium.push_back((*electron_cutbasedID_decisions_medium)[eleRef]);
+      eleBlock.passCutBasedIDTight.push_back((*electron_cutbasedID_decisions_tight)[eleRef]);
+      eleBlock.passMVAIsoIDWP80.push_back((*electron_mvaIsoID_decisions_wp80)[eleRef]);
+      eleBlock.passMVAIsoIDWP90.push_back((*electron_mvaIsoID_decisions_wp90)[eleRef]);
+      eleBlock.passMVAIsoIDWPHZZ.push_back((*electron_mvaIsoID_decisions_wpHZZ)[eleRef]);
+      eleBlock.passMVAIsoIDWPLoose.push_back((*electron_mvaIsoID_decisions_wpLoose)[eleRef]);
+      eleBlock.passMVANoIsoIDWP80.push_back((*electron_mvaNoIsoID_decisions_wp80)[eleRef]);
+      eleBlock.passMVANoIsoIDWP90.push_back((*electron_mvaNoIsoID_decisions_wp90)[eleRef]);
+      eleBlock.passMVANoIsoIDWPLoose.push_back((*electron_mvaNoIsoID_decisions_wpLoose)[eleRef]);
 
       //---------------
       //Conversion Veto
@@ -1359,150 +1348,81 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
 
       if( beamSpot.isValid() && conversions.isValid() )
       {
-          ele_PassConvVeto.push_back(!ConversionTools::hasMatchedConversion(ele,(*conversions),beamSpot->position()));
+          eleBlock.PassConvVeto.push_back(!ConversionTools::hasMatchedConversion(ele,(*conversions),beamSpot->position()));
       } else {
-          ele_PassConvVeto.push_back(false);
+          eleBlock.PassConvVeto.push_back(false);
       }
       // 1/E - 1/P
       if( ele.ecalEnergy() == 0 ){
-          ele_OneOverEminusOneOverP.push_back(1e30);
+          eleBlock.OneOverEminusOneOverP.push_back(1e30);
       } else if( !std::isfinite(ele.ecalEnergy())){
-          ele_OneOverEminusOneOverP.push_back(1e30);
+          eleBlock.OneOverEminusOneOverP.push_back(1e30);
       } else {
-          ele_OneOverEminusOneOverP.push_back(1./ele.ecalEnergy()  -  ele.eSuperClusterOverP()/ele.ecalEnergy());
+          eleBlock.OneOverEminusOneOverP.push_back(1./ele.ecalEnergy()  -  ele.eSuperClusterOverP()/ele.ecalEnergy());
       }
   } // end loop on electrons
 
 
   // add all muons
   unsigned int nMuons = 0;
-  std::vector<float> muonE;
-  
-  std::vector<float> globalTrackMuonPt;
-  std::vector<float> rescaledPtDownGlobalMuon;
-  std::vector<float> rescaledPtUpGlobalMuon;
-
-  std::vector<float> innerTrackMuonPt;
-  std::vector<float> rescaledPtDownInnerMuon;
-  std::vector<float> rescaledPtUpInnerMuon;
-
-  std::vector<float> outerTrackMuonPt;
-
-  std::vector<float> muonPt;
-  std::vector<float> muonPtErr;
-  std::vector<float> muonEta;
-  std::vector<float> muonPhi;
-  std::vector<float> muonBeta;
-  std::vector<int> muonCharge;
-  std::vector<bool> muonIsLoose;
-  std::vector<bool> muonIsMedium;
-  std::vector<bool> muonIsTight;
-  std::vector<float> muon_d0;
-  std::vector<float> muon_d0Err;
-  std::vector<float> muon_dZ;
-  std::vector<float> muon_ip3d;
-  std::vector<float> muon_ip3dSignificance;
-  std::vector<unsigned int> muonType;
-  std::vector<unsigned int> muonQuality;
-  std::vector<float> muon_pileupIso;
-  std::vector<float> muon_chargedIso;
-  std::vector<float> muon_photonIso;
-  std::vector<float> muon_neutralHadIso;
-  std::vector<float> muon_validFractionTrackerHits;
-  std::vector<float> muon_normChi2;
-  std::vector<float> muon_chi2LocalPosition;
-  std::vector<float> muon_kinkFinder;
-  std::vector<float> muon_segmentCompatability;
-  std::vector<float> muon_trkIso;
-  std::vector<float> muon_tuneP_Pt;
-  std::vector<float> muon_tuneP_PtErr;
-  std::vector<float> muon_tuneP_Eta;
-  std::vector<float> muon_tuneP_Phi;
-  std::vector<int> muon_tuneP_MuonBestTrackType;
-  std::vector<bool> muon_isHighPtMuon;
-  std::vector<bool> muon_isTrackerHighPtMuon;
-
-  // read muon HLT filter names
-  for (int i = 0; i<MAX_MuonHLTFilters; ++i) muonHLTFilterNames[i] = "";
-  ifstream myMuonHLTFilterFile (edm::FileInPath(muonHLTFilterNamesFile_.c_str()).fullPath().c_str()) ;
-  if (myMuonHLTFilterFile.is_open()) {
-      char tmp[1024];
-      string line;
-      int index;
-      string hltfiltername;
-
-      while(myMuonHLTFilterFile>>line) {
-
-          if ( line.empty() || line.substr(0,1) == "#") {
-              myMuonHLTFilterFile.getline(tmp,1024);
-              continue;
-          }
-          index = atoi(line.c_str());
-          myMuonHLTFilterFile >> hltfiltername;
-          if (index < MAX_MuonHLTFilters) {
-              muonHLTFilterNames[index] = hltfiltername;
-          }
-      }
-      myMuonHLTFilterFile.close();
-  } else {
-      LogError(MOD) << "ERROR!!! Could not open trigger path name file : " << edm::FileInPath(muonHLTFilterNamesFile_.c_str()).fullPath().c_str() << "\n";
-  }
+  MuonBlock& muBlock = eventBlocks.muon;
+  muBlock.clear();
 
   // loop on the muon collection
   for (unsigned int i = 0; i < muonColl.size(); i++) {
       const reco::Muon* mu = &(muonColl)[i];
-      muonBeta.push_back(mu->p()*1.0/0.1057);
-      muonE.push_back(mu->energy());
-      muonPt.push_back(mu->pt());
+      muBlock.Beta.push_back(mu->p()*1.0/0.1057);
+      muBlock.E.push_back(mu->energy());
+      muBlock.Pt.push_back(mu->pt());
       float shiftForPtValueGlobalMu = 0;
       float shiftForPtValueInnerMu = 0;
       if(mu->isGlobalMuon()){
           shiftForPtValueGlobalMu = shiftForPt(mu->globalTrack()->pt(),mu->globalTrack()->eta(),mu->globalTrack()->phi(),mu->globalTrack()->charge());
-          globalTrackMuonPt.push_back(mu->globalTrack()->pt());
-          rescaledPtDownGlobalMuon.push_back(mu->globalTrack()->pt() * (1-shiftForPtValueGlobalMu));
-          rescaledPtUpGlobalMuon.push_back(mu->globalTrack()->pt() * (1+shiftForPtValueGlobalMu));
+          muBlock.globalTrackPt.push_back(mu->globalTrack()->pt());
+          muBlock.rescaledPtDownGlobal.push_back(mu->globalTrack()->pt() * (1-shiftForPtValueGlobalMu));
+          muBlock.rescaledPtUpGlobal.push_back(mu->globalTrack()->pt() * (1+shiftForPtValueGlobalMu));
       }
       else{
-          globalTrackMuonPt.push_back(-99);
-          rescaledPtDownGlobalMuon.push_back(-99);
-          rescaledPtUpGlobalMuon.push_back(-99);
+          muBlock.globalTrackPt.push_back(-99);
+          muBlock.rescaledPtDownGlobal.push_back(-99);
+          muBlock.rescaledPtUpGlobal.push_back(-99);
       }
 
 
       if(mu->isTrackerMuon()){
           shiftForPtValueInnerMu = shiftForPt(mu->innerTrack()->pt(),mu->innerTrack()->eta(),mu->innerTrack()->phi(),mu->innerTrack()->charge());
-          innerTrackMuonPt.push_back(mu->innerTrack()->pt());
-          rescaledPtDownInnerMuon.push_back(mu->innerTrack()->pt()*(1-shiftForPtValueInnerMu));
-          rescaledPtUpInnerMuon.push_back(mu->innerTrack()->pt()*(1+shiftForPtValueInnerMu));
+          muBlock.innerTrackPt.push_back(mu->innerTrack()->pt());
+          muBlock.rescaledPtDownInner.push_back(mu->innerTrack()->pt()*(1-shiftForPtValueInnerMu));
+          muBlock.rescaledPtUpInner.push_back(mu->innerTrack()->pt()*(1+shiftForPtValueInnerMu));
       }
       else{
-          innerTrackMuonPt.push_back(-99);
-          rescaledPtDownInnerMuon.push_back(-99);
-          rescaledPtUpInnerMuon.push_back(-99);
+          muBlock.innerTrackPt.push_back(-99);
+          muBlock.rescaledPtDownInner.push_back(-99);
+          muBlock.rescaledPtUpInner.push_back(-99);
       }
 
       if(mu->isStandAloneMuon()){
-          outerTrackMuonPt.push_back(mu->outerTrack()->pt());
+          muBlock.outerTrackPt.push_back(mu->outerTrack()->pt());
       }
       else{
-          outerTrackMuonPt.push_back(-99);
-      }
-
-      muonPtErr.push_back(mu->muonBestTrack()->ptError());
-      muonEta.push_back(mu->eta());
-      muonPhi.push_back(mu->phi());
-      muonCharge.push_back(mu->charge());
-      muonIsLoose.push_back(muon::isLooseMuon(*mu));
-      muonIsMedium.push_back(muon::isMediumMuon(*mu));
-      muonIsTight.push_back(muon::isTightMuon(*mu, highestSumPt2Vertex));
-      muon_d0.push_back(-mu->muonBestTrack()->dxy(highestSumPt2Vertex.position()));
-      muon_d0Err.push_back(-mu->muonBestTrack()->dxyError());
-      muon_dZ.push_back(mu->muonBestTrack()->dz(highestSumPt2Vertex.position()));
-      // muon_ip3d.push_back(mu->dB(pat::Muon::PV3D));
-      // muon_ip3dSignificance.push_back(mu->dB(pat::Muon::PV3D)/mu->edB(pat::Muon::PV3D));
-      muonType.push_back(mu->isMuon() + 2*mu->isGlobalMuon() + 4*mu->isTrackerMuon() + 8*mu->isStandAloneMuon()
+          muBlock.outerTrackPt.push_back(-99);
+      }
+
+      muBlock.PtErr.push_back(mu->muonBestTrack()->ptError());
+      muBlock.Eta.push_back(mu->eta());
+      muBlock.Phi.push_back(mu->phi());
+      muBlock.Charge.push_back(mu->charge());
+      muBlock.IsLoose.push_back(muon::isLooseMuon(*mu));
+      muBlock.IsMedium.push_back(muon::isMediumMuon(*mu));
+      muBlock.IsTight.push_back(muon::isTightMuon(*mu, highestSumPt2Vertex));
+      muBlock.d0.push_back(-mu->muonBestTrack()->dxy(highestSumPt2Vertex.position()));
+      muBlock.d0Err.push_back(-mu->muonBestTrack()->dxyError());
+      muBlock.dZ.push_back(mu->muonBestTrack()->dz(highestSumPt2Vertex.position()));
+      // muBlock.ip3d.push_back(mu->dB(pat::Muon::PV3D));
+      // muBlock.ip3dSignificance.push_back(mu->dB(pat::Muon::PV3D)/mu->edB(pat::Muon::PV3D));
+      muBlock.Type.push_back(mu->isMuon() + 2*mu->isGlobalMuon() + 4*mu->isTrackerMuon() + 8*mu->isStandAloneMuon()
               + 16*mu->isCaloMuon() + 32*mu->isPFMuon() + 64*mu->isRPCMuon());
-      muonQuality.push_back(
+      muBlock.Quality.push_back(
               muon::isGoodMuon(*mu,muon::All)
               + pow(2,1)*muon::isGoodMuon(*mu,muon::AllGlobalMuons)
               + pow(2,2)*muon::isGoodMuon(*mu,muon::AllStandAloneMuons)
@@ -1537,23 +1457,23 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
                       && fabs(mu->innerTrack()->dz(highestSumPt2Vertex.position())) < 20.
                       ));
 
-      muon_pileupIso.push_back(mu->pfIsolationR04().sumPUPt);
-      muon_chargedIso.push_back(mu->pfIsolationR04().sumChargedHadronPt);
-      muon_photonIso.push_back(mu->pfIsolationR04().sumPhotonEt);
-      muon_neutralHadIso.push_back(mu->pfIsolationR04().sumNeutralHadronEt);
-      muon_validFractionTrackerHits.push_back((mu->innerTrack().isNonnull() ? mu->track()->validFraction() : -99.0));
-      muon_normChi2.push_back(( muon::isGoodMuon(*mu,muon::AllGlobalMuons) ? mu->globalTrack()->normalizedChi2() : -99.0));
-      muon_chi2LocalPosition.push_back(mu->combinedQuality().chi2LocalPosition);
-      muon_kinkFinder.push_back(mu->combinedQuality().trkKink);
-      muon_segmentCompatability.push_back(muon::segmentCompatibility(*mu));
-
-      muon_trkIso.push_back(mu->isolationR03().sumPt);
+      muBlock.pileupIso.push_back(mu->pfIsolationR04().sumPUPt);
+      muBlock.chargedIso.push_back(mu->pfIsolationR04().sumChargedHadronPt);
+      muBlock.photonIso.push_back(mu->pfIsolationR04().sumPhotonEt);
+      muBlock.neutralHadIso.push_back(mu->pfIsolationR04().sumNeutralHadronEt);
+      muBlock.validFractionTrackerHits.push_back((mu->innerTrack().isNonnull() ? mu->track()->validFraction() : -99.0));
+      muBlock.normChi2.push_back(( muon::isGoodMuon(*mu,muon::AllGlobalMuons) ? mu->globalTrack()->normalizedChi2() : -99.0));
+      muBlock.chi2LocalPosition.push_back(mu->combinedQuality().chi2LocalPosition);
+      muBlock.kinkFinder.push_back(mu->combinedQuality().trkKink);
+      muBlock.segmentCompatability.push_back(muon::segmentCompatibility(*mu));
+
+      muBlock.trkIso.push_back(mu->isolationR03().sumPt);
       // TuneP muon
-      muon_tuneP_Pt.push_back(mu->tunePMuonBestTrack()->pt());
-      muon_tuneP_PtErr.push_back(mu->tunePMuonBestTrack()->ptError());
-      muon_tuneP_Eta.push_back(mu->tunePMuonBestTrack()->eta());
-      muon_tuneP_Phi.push_back(mu->tunePMuonBestTrack()->phi());
-      muon_tuneP_MuonBestTrackType.push_back(mu->tunePMuonBestTrackType());
+      muBlock.tuneP_Pt.push_back(mu->tunePMuonBestTrack()->pt());
+      muBlock.tuneP_PtErr.push_back(mu->tunePMuonBestTrack()->ptError());
+      muBlock.tuneP_Eta.push_back(mu->tunePMuonBestTrack()->eta());
+      muBlock.tuneP_Phi.push_back(mu->tunePMuonBestTrack()->phi());
+      muBlock.tuneP_MuonBestTrackType.push_back(mu->tunePMuonBestTrackType());
       // case Muon::InnerTrack:
       //   return 0;
       // case Muon::OuterTrack:
@@ -1568,8 +1488,8 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       //   return 5;
       // case Muon::None:
       //   return 6;
-      muon_isHighPtMuon.push_back(muon::isHighPtMuon(*mu, highestSumPt2Vertex));
-      muon_isTrackerHighPtMuon.push_back(muon::isTrackerHighPtMuon(*mu, highestSumPt2Vertex));
+      muBlock.isHighPtMuon.push_back(muon::isHighPtMuon(*mu, highestSumPt2Vertex));
+      muBlock.isTrackerHighPtMuon.push_back(muon::isTrackerHighPtMuon(*mu, highestSumPt2Vertex));
 
 
       nMuons++;
@@ -1582,23 +1502,12 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   std::vector<std::vector<float>> triggerObjectEta;
   std::vector<std::vector<float>> triggerObjectPhi;
 
-  std::vector<TLorentzVector> trigObjP4sAll;
-  for ( int q=0; q<MAX_MuonHLTFilters;q++) {
-      trigtools::getP4sOfObsPassingFilter(trigObjP4sAll,*trigEvent,muonHLTFilterNames[q].c_str(),"HLT");
-      std::vector<float> triggerObjectE_temp;
-      std::vector<float> triggerObjectPt_temp;
-      std::vector<float> triggerObjectEta_temp;
-      std::vector<float> triggerObjectPhi_temp;
-      for(size_t objNr=0; objNr<trigObjP4sAll.size(); objNr++) {
-          triggerObjectE_temp.push_back(trigObjP4sAll[objNr].Energy());
-          triggerObjectPt_temp.push_back(trigObjP4sAll[objNr].Pt());
-          triggerObjectEta_temp.push_back(trigObjP4sAll[objNr].Eta());
-          triggerObjectPhi_temp.push_back(trigObjP4sAll[objNr].Phi());
-      }
-      triggerObjectE.push_back(triggerObjectE_temp);
-      triggerObjectPt.push_back(triggerObjectPt_temp);
-      triggerObjectEta.push_back(triggerObjectEta_temp);
-      triggerObjectPhi.push_back(triggerObjectPhi_temp);
+  for (int q = 0; q < MAX_MuonHLTFilters; q++) {
+      trigObjIndex.getObjsPassingFilter(trigObjs, muonHLTFilterIds[q]);
+      triggerObjectE.push_back(trigObjs.energy);
+      triggerObjectPt.push_back(trigObjs.pt);
+      triggerObjectEta.push_back(trigObjs.eta);
+      triggerObjectPhi.push_back(trigObjs.phi);
   }
 
   float RecoPFMET = -10, RecoPFMET_phi = -10, RecoPFMET_sigf = -10, RecoPFMHT = -10;
@@ -1632,65 +1541,32 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   const edm::Handle<trigger::TriggerEvent> hltTriggerSummaryHandle = iEvent.getHandle(trigEventToken_);
   if (hltTriggerSummaryHandle.isValid()) {
 
-      int caloMETKey = 0, caloMETCleanKey = 0, caloMHTKey = 0, pfMHTKey = 0, pfMETKey = 0;
-      // loop over trigger object collections to find HLT CaloMET, CaloMETClean, CaloMHT, PFMHT, PFMET collections
-      for (int iC = 0; iC < hltTriggerSummaryHandle->sizeCollections(); iC++) {
-          if(hltTriggerSummaryHandle->collectionTag(iC).encode()=="hltMet::HLT") {
-              // collectionKey(iC) gives trigger object key ONE PAST the object collection of interest
-              caloMETKey = hltTriggerSummaryHandle->collectionKey(iC);
-              // HLT MET object collections ALWAYS have four objects {MET, TET, MET significance, ELongitudinal}, hence -4 for MET value
-              HLTCaloMET = hltTriggerSummaryHandle->getObjects()[caloMETKey-4].pt();
-              HLTCaloMET_phi = hltTriggerSummaryHandle->getObjects()[caloMETKey-4].phi();
-              // and -2 for MET significance
-              // significance  saved as .pt() but obviously pt holds no meaning here
-              HLTCaloMET_sigf = hltTriggerSummaryHandle->getObjects()[caloMETKey-2].pt();
-          } if(hltTriggerSummaryHandle->collectionTag(iC).encode()=="hltMetClean::HLT") {
-              caloMETCleanKey = hltTriggerSummaryHandle->collectionKey(iC);
-              HLTCaloMETClean = hltTriggerSummaryHandle->getObjects()[caloMETCleanKey-4].pt();
-              HLTCaloMETClean_phi = hltTriggerSummaryHandle->getObjects()[caloMETCleanKey-4].phi();
-              HLTCaloMETClean_sigf = hltTriggerSummaryHandle->getObjects()[caloMETCleanKey-2].pt();
-          } if(hltTriggerSummaryHandle->collectionTag(iC).encode()=="hltMht::HLT") {
-              caloMHTKey = hltTriggerSummaryHandle->collectionKey(iC);
-              // HLT MHT object collections ALWAYS have four objects {MHT, THT, MHT significance, HLongitudinal}, hence -4 for MHT value
-              HLTCaloMHT = hltTriggerSummaryHandle->getObjects()[caloMHTKey-4].pt();
-              HLTCaloMHT_phi = hltTriggerSummaryHandle->getObjects()[caloMHTKey-4].phi();
-              // and -2 for MHT significance
-              // significance  saved as .pt() but obviously pt holds no meaning here
-              HLTCaloMHT_sigf = hltTriggerSummaryHandle->getObjects()[caloMHTKey-2].pt();
-          } if(hltTriggerSummaryHandle->collectionTag(iC).encode()=="hltPFMHTTightID::HLT") {
-              pfMHTKey = hltTriggerSummaryHandle->collectionKey(iC);
-              HLTPFMHT = hltTriggerSummaryHandle->getObjects()[pfMHTKey-4].pt();
-              HLTPFMHT_phi = hltTriggerSummaryHandle->getObjects()[pfMHTKey-4].phi();
-              HLTPFMHT_sigf = hltTriggerSummaryHandle->getObjects()[pfMHTKey-2].pt();
-          } if(hltTriggerSummaryHandle->collectionTag(iC).encode()=="hltPFMETProducer::HLT") {
-              pfMETKey = hltTriggerSummaryHandle->collectionKey(iC);
-              HLTPFMET = hltTriggerSummaryHandle->getObjects()[pfMETKey-4].pt();
-              HLTPFMET_phi = hltTriggerSummaryHandle->getObjects()[pfMETKey-4].phi();
-              HLTPFMET_sigf = hltTriggerSummaryHandle->getObjects()[pfMETKey-2].pt();
-          }
-      }
+      // collectionKey(iC) gives trigger object key ONE PAST the object collection of interest
+      // HLT MET (MHT) object collections ALWAYS have four objects {MET, TET, MET significance, ELongitudinal},
+      // hence -4 for MET value and -2 for MET significance
+      // significance  saved as .pt() but obviously pt holds no meaning here
+      const trigger::TriggerObjectCollection& hltObjects = hltTriggerSummaryHandle->getObjects();
+      auto hltMET = [&](unsigned int collId, float& met, float& phi, float& sigf) {
+          trigger::size_type iC = trigObjIndex.collectionIndex(collId);
+          if (iC >= hltTriggerSummaryHandle->sizeCollections()) return;
+          int key = hltTriggerSummaryHandle->collectionKey(iC);
+          met = hltObjects[key-4].pt();
+          phi = hltObjects[key-4].phi();
+          sigf = hltObjects[key-2].pt();
+      };
+      hltMET(hltMetCollId_, HLTCaloMET, HLTCaloMET_phi, HLTCaloMET_sigf);
+      hltMET(hltMetCleanCollId_, HLTCaloMETClean, HLTCaloMETClean_phi, HLTCaloMETClean_sigf);
+      hltMET(hltMhtCollId_, HLTCaloMHT, HLTCaloMHT_phi, HLTCaloMHT_sigf);
+      hltMET(hltPFMHTCollId_, HLTPFMHT, HLTPFMHT_phi, HLTPFMHT_sigf);
+      hltMET(hltPFMETCollId_, HLTPFMET, HLTPFMET_phi, HLTPFMET_sigf);
   }
 
   // PF jet info for the ntuple
   unsigned int pfJetsNum = 0;
   float pfJetHT = 0.;
 
-  std::vector<float> Jets_pt;
-  std::vector<float> Jets_eta;
-  std::vector<float> Jets_phi;
-  std::vector<float> Jets_mass;
-  std::vector<float> Jets_E;
-  std::vector<float> Jets_pdgId;
-  std::vector<float> Jets_et;
-  std::vector<float> Jets_chargedEmEnergyFraction;
-  std::vector<float> Jets_neutralEmEnergyFraction;
-  std::vector<float> Jets_chargedHadronEnergyFraction;
-  std::vector<float> Jets_neutralHadronEnergyFraction;
-  std::vector<float> Jets_muonEnergyFraction;
-  std::vector<int> Jets_chargedMultiplicity;
-  std::vector<int> Jets_neutralMultiplicity;
-  std::vector<float> Jets_jetArea;
-  std::vector<float> Jets_pileupE;
+  JetBlock& jetBlock = eventBlocks.jet;
+  jetBlock.clear();
 
   // Loop on pfJetColl for the ntuple, for histos there is a matching to the HSCP candidates
   if (pfJetHandle.isValid() && !pfJetHandle->empty()) {
@@ -1702,23 +1578,23 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
               continue;
           }
           pfJetsNum++;
-          Jets_pt.push_back(jet->pt());
-          Jets_eta.push_back(jet->eta());
-          Jets_phi.push_back(jet->phi());
-          Jets_mass.push_back(jet->mass());
-          Jets_E.push_back(jet->energy());
-          Jets_pdgId.push_back(jet->pdgId());
-          Jets_et.push_back(jet->et());
-          Jets_chargedEmEnergyFraction.push_back(jet->chargedEmEnergyFraction());
-          Jets_neutralEmEnergyFraction.push_back(jet->neutralEmEnergyFraction());
-          Jets_chargedHadronEnergyFraction.push_back(jet->chargedHadronEnergyFraction());
-          Jets_neutralHadronEnergyFraction.push_back(jet->neutralHadronEnergyFraction());
-          Jets_muonEnergyFraction.push_back(jet->muonEnergyFraction());
-          Jets_chargedMultiplicity.push_back(jet->chargedMultiplicity());
-          Jets_neutralMultiplicity.push_back(jet->neutralMultiplicity());
-
-          Jets_jetArea.push_back(jet->jetArea());
-          Jets_pileupE.push_back(jet->pileup());
+          jetBlock.pt.push_back(jet->pt());
+          jetBlock.eta.push_back(jet->eta());
+          jetBlock.phi.push_back(jet->phi());
+          jetBlock.mass.push_back(jet->mass());
+          jetBlock.energy.push_back(jet->energy());
+          jetBlock.pdgId.push_back(jet->pdgId());
+          jetBlock.et.push_back(jet->et());
+          jetBlock.chargedEmEnergyFraction.push_back(jet->chargedEmEnergyFraction());
+          jetBlock.neutralEmEnergyFraction.push_back(jet->neutralEmEnergyFraction());
+          jetBlock.chargedHadronEnergyFraction.push_back(jet->chargedHadronEnergyFraction());
+          jetBlock.neutralHadronEnergyFraction.push_back(jet->neutralHadronEnergyFraction());
+          jetBlock.muonEnergyFraction.push_back(jet->muonEnergyFraction());
+          jetBlock.chargedMultiplicity.push_back(jet->chargedMultiplicity());
+          jetBlock.neutralMultiplicity.push_back(jet->neutralMultiplicity());
+
+          jetBlock.jetArea.push_back(jet->jetArea());
+          jetBlock.pileupE.push_back(jet->pileup());
           // Jets_pileupId.push_back(jet->userFloat("pileupJetId:fullDiscriminant"));
           // Jets_pileupIdFlag.push_back(jet->userInt("pileupJetId:fullId")); //A bit map for loose, medium, and tight working points
 
@@ -1754,146 +1630,10 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   //load all event collection that will be used later on (HSCP, dEdx and TOF)
   unsigned int HSCP_count = 0;
 
-  std::vector<float> HSCP_mT;
-  std::vector<bool> HSCP_passCutPt55;
-  std::vector<bool> HSCP_passPreselection;
-  std::vector<bool> HSCP_passPreselectionSept8;
-  std::vector<bool> HSCP_passPreselectionTrigSys;
-  std::vector<bool> HSCP_passSelection;
-  std::vector<bool> HSCP_isPFMuon;
-  std::vector<bool> HSCP_PFMuonPt;
-  std::vector<float> HSCP_Charge;
-  std::vector<float> HSCP_Pt;
-
-
-  std::vector<float> HSCP_trigObjBeta;
-  std::vector<float> HSCP_dRclosestTrigAndCandidate;
-  std::vector<float> HSCP_GenBeta;
-
-  std::vector<float> HSCP_PtErr;
-  std::vector<float> HSCP_Is_StripOnly;
-  std::vector<float> HSCP_Ias;
-  std::vector<float> HSCP_Ias_noPix_noTIB_noTID_no3TEC;
-  std::vector<float> HSCP_Ias_PixelOnly;
-  std::vector<float> HSCP_Ias_StripOnly;
-  std::vector<float> HSCP_Ias_PixelOnly_noL1;
-  std::vector<float> HSCP_Ih;
-  std::vector<float> HSCP_Ick;//return (Ih-C)/K
-  std::vector<float> HSCP_Fmip;
-  std::vector<float> HSCP_ProbXY;
-  std::vector<float> HSCP_ProbXY_noL1;
-  std::vector<float> HSCP_ProbQ;
-  std::vector<float> HSCP_ProbQ_noL1;
+  HSCPBlock& hscpBlock = eventBlocks.hscp;
+  hscpBlock.clear();
+
   std::vector<float> HSCP_ProbQ_dEdx;
-  std::vector<float> HSCP_Ndof;
-  std::vector<float> HSCP_Chi2;
-  std::vector<int>   HSCP_QualityMask;
-  std::vector<bool>  HSCP_isHighPurity;
-  std::vector<float> HSCP_EoverP;
-  std::vector<bool>  HSCP_isMuon;
-  std::vector<bool>  HSCP_isGlobalMuon;
-  std::vector<bool>  HSCP_isPhoton;
-  std::vector<bool>  HSCP_isElectron;
-
-  std::vector<float>  HSCP_gsfFbremElectron;
-
-  std::vector<float>  HSCP_gsfMomentumElectron;
-  std::vector<float>  HSCP_PFMomentumElectron;
-
-  std::vector<bool>  HSCP_isChHadron;
-  std::vector<bool>  HSCP_isNeutHadron;
-  std::vector<bool>  HSCP_isPfTrack;
-  std::vector<bool>  HSCP_isUndefined;
-  std::vector<float> HSCP_ECAL_energy;
-  std::vector<float> HSCP_HCAL_energy;
-  std::vector<float> HSCP_TOF;
-  std::vector<float> HSCP_TOFErr;
-  std::vector<unsigned int> HSCP_TOF_ndof;
-  std::vector<float> HSCP_DTTOF;
-  std::vector<float> HSCP_DTTOFErr;
-  std::vector<unsigned int> HSCP_DTTOF_ndof;
-  std::vector<float> HSCP_CSCTOF;
-  std::vector<float> HSCP_CSCTOFErr;
-  std::vector<unsigned int> HSCP_CSCTOF_ndof;
-  std::vector<float> HSCP_Mass;
-  std::vector<float> HSCP_MassErr;
-  std::vector<float> HSCP_dZ;
-  std::vector<float> HSCP_dXY;
-  std::vector<float> HSCP_dR;
-  std::vector<float> HSCP_p;
-  std::vector<float> HSCP_eta;
-  std::vector<float> HSCP_phi;
-  // Number of (valid) track pixel+strip hits
-  std::vector<unsigned int> HSCP_NOH;
-  // Number of (valid) track pixel hits
-  std::vector<unsigned int> HSCP_NOPH;
-  // Fraction of valid track hits
-  std::vector<float> HSCP_FOVH;
-  // Number of missing hits from IP till last hit (excluding hits behind the last hit)
-  std::vector<unsigned int> HSCP_NOMH;
-  // Fraction of valid hits divided by total expected hits until the last one
-  std::vector<float> HSCP_FOVHD;
-  // Number of dEdx hits (= #strip+#pixel-#ClusterCleaned hits, but this depend on estimator used)
-  std::vector<unsigned int> HSCP_NOM;
-  std::vector<float> HSCP_matchTrigMuon_minDeltaR;
-  std::vector<float> HSCP_matchTrigMuon_pT;
-
-  std::vector<float> HSCP_iso_TK;
-  std::vector<float> HSCP_iso_ECAL;
-  std::vector<float> HSCP_iso_HCAL;
-  std::vector<float> HSCP_track_genTrackMiniIsoSumPt;
-  std::vector<float> HSCP_track_genTrackAbsIsoSumPtFix;
-  std::vector<float> HSCP_track_genTrackIsoSumPt_dr03;
-  std::vector<float> HSCP_PFMiniIso_relative;
-  std::vector<float> HSCP_PFMiniIso_wMuon_relative;
-  std::vector<float> HSCP_track_PFIsolationR005_sumChargedHadronPt;
-  std::vector<float> HSCP_track_PFIsolationR005_sumNeutralHadronPt;
-  std::vector<float> HSCP_track_PFIsolationR005_sumPhotonPt;
-  std::vector<float> HSCP_track_PFIsolationR005_sumPUPt;
-  std::vector<float> HSCP_track_PFIsolationR01_sumChargedHadronPt;
-  std::vector<float> HSCP_track_PFIsolationR01_sumNeutralHadronPt;
-  std::vector<float> HSCP_track_PFIsolationR01_sumPhotonPt;
-  std::vector<float> HSCP_track_PFIsolationR01_sumPUPt;
-  std::vector<float> HSCP_track_PFIsolationR03_sumChargedHadronPt;
-  std::vector<float> HSCP_track_PFIsolationR03_sumNeutralHadronPt;
-  std::vector<float> HSCP_track_PFIsolationR03_sumPhotonPt;
-  std::vector<float> HSCP_track_PFIsolationR03_sumPUPt;
-  std::vector<float> HSCP_track_PFIsolationR05_sumChargedHadronPt;
-  std::vector<float> HSCP_track_PFIsolationR05_sumNeutralHadronPt;
-  std::vector<float> HSCP_track_PFIsolationR05_sumPhotonPt;
-  std::vector<float> HSCP_track_PFIsolationR05_sumPUPt;
-  std::vector<float> HSCP_muon_PFIsolationR03_sumChargedHadronPt;
-  std::vector<float> HSCP_muon_PFIsolationR03_sumNeutralHadronPt;
-  std::vector<float> HSCP_muon_PFIsolationR03_sumPhotonPt;
-  std::vector<float> HSCP_muon_PFIsolationR03_sumPUPt;
-  std::vector<float> HSCP_Ih_noL1;
-  std::vector<float> HSCP_Ih_15drop;
-  std::vector<float> HSCP_Ih_StripOnly;
-  std::vector<float> HSCP_Ih_StripOnly_15drop;
-  std::vector<float> HSCP_Ih_PixelOnly_noL1;
-  std::vector<float> HSCP_Ih_SaturationCorrectionFromFits;
-  std::vector<std::vector<float>> HSCP_clust_charge;//dedx charge -> either strip or pixel
-  std::vector<std::vector<float>> HSCP_clust_pathlength;
-  std::vector<std::vector<unsigned int>> HSCP_clust_nstrip;
-  std::vector<std::vector<bool>> HSCP_clust_sat254;
-  std::vector<std::vector<bool>> HSCP_clust_sat255;
-  std::vector<std::vector<uint32_t>> HSCP_clust_detid;
-  std::vector<std::vector<bool>> HSCP_clust_isStrip;//is it a SiStrip cluster?
-  std::vector<std::vector<bool>> HSCP_clust_isPixel;//is it a Pixel hit?
-  std::vector<float> HSCP_GenId;
-  std::vector<float> HSCP_GenCharge;
-  std::vector<float> HSCP_GenMass;
-  std::vector<float> HSCP_GenPt;
-  std::vector<float> HSCP_GenEta;
-  std::vector<float> HSCP_GenPhi;
-  std::vector<float> HSCP_tuneP_Pt;
-  std::vector<float> HSCP_tuneP_PtErr;
-  std::vector<float> HSCP_tuneP_Eta;
-  std::vector<float> HSCP_tuneP_Phi;
-  std::vector<int> HSCP_tuneP_MuonBestTrackType;
-
-  std::vector<int> HSCP_ErrorHisto_bin;
-  std::vector<int> HSCP_type;
 
   //====================loop over HSCP candidates===================
   if (debug_ > 0 && trigInfo_ > 0) LogPrint(MOD) << "Loop over HSCP candidates:";
@@ -1925,8 +1665,89 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
   bool trigObjPassedPres = false;
 
   tuple->EventCutFlow->Fill(0.0, eventWeight_);
-  
-  for (const auto& hscp : iEvent.get(hscpToken_)) {
+
+  // Templates to be used: the inclusive ones, or the ones of the PU bin of the event
+  const dedxTemplate* eventIasTemplates = nullptr;
+  if (!puTreatment_) {
+    eventIasTemplates = &iasTemplates;
+  } else {
+    const int NPV = vertexColl.size();
+    for (int i = 0; i < NbPuBins_; i++) {
+      if (NPV > PuBins_[i] && NPV <= PuBins_[i + 1])
+        eventIasTemplates = &iasTemplatesPU[i];
+    }
+  }
+
+  // Isolation, gen matching, dE/dx estimators and recomputed TOF of each candidate: the candidates are
+  // independent so they are computed concurrently, each in its own record (with its own hit table and
+  // CPE cache), which the candidate loop below then reads in order to fill the histograms and the tree.
+  // The candidates the loop skips before reading them (type, track, muon segment, PV) are not computed
+  candRecords.assign(hscpCandidates.size(), candidateRecord());
+  if (candDedxTables.size() < hscpCandidates.size()) {
+    candDedxTables.resize(hscpCandidates.size());
+    candCPECaches.resize(hscpCandidates.size());
+  }
+  for (unsigned int ihscp = 0; ihscp < hscpCandidates.size(); ihscp++)
+    candCPECaches[ihscp].newEvent(tkGeometry.product(), pixelCPE.product());
+  const bool recomputeTOF = isData && calibrateTOF_ && typeMode_ > 1 && typeMode_ != 5;
+  if (!vertexColl.empty()) {
+    auto prepare = [&](unsigned int ihscp, std::vector<unsigned int>& cone, muonTimingCalculator& timing) {
+      const auto& hscp = hscpCandidates[ihscp];
+      if (typeMode_ == 0 && hscp.type() != susybsm::HSCParticleType::trackerMuon &&
+          hscp.type() != susybsm::HSCParticleType::globalMuon && hscp.type() != susybsm::HSCParticleType::innerTrack)
+        return;
+      if (typeMode_ == 1 && hscp.type() != susybsm::HSCParticleType::trackerMuon &&
+          hscp.type() != susybsm::HSCParticleType::globalMuon)
+        return;
+      reco::MuonRef muon = hscp.muonRef();
+      if (typeMode_ == 3 && muon.isNull()) return;
+      reco::TrackRef track = (typeMode_ != 3) ? hscp.trackRef() : muon->standAloneMuon();
+      if (track.isNull()) return;
+      if (typeMode_ > 1 && typeMode_ != 5 && (muon.isNull() || !muon->isStandAloneMuon())) return;
+
+      candidateRecord& record = candRecords[ihscp];
+      // Reco - GEN track matching, for signal only to a true HSCP
+      if (!isData)
+        record.gen.compute(genColl, *track, isSignal, [this](const reco::GenParticle& gen) { return isHSCPgenID(gen); });
+      if (highestSumPt2VertexIndex < 0) return;
+
+      float dz = track->dz(highestSumPt2Vertex.position());
+      record.iso.compute(track, dz, pfCandHandle, pfCandOfTrack, nextPfCandOfTrack, pfCandGrid, trackCollectionHandle, trackGrid, cone);
+
+      // Apply T0 correction on data but not on signal MC
+      if (recomputeTOF) {
+        reco::MuonRef muonCompute = muon;
+        timing.computeTOF(muonCompute, *CSCSegmentCollH, *DTSegmentCollH, 2, true);
+        record.tof.recomputed = true;
+        record.tof.dt = timing.dtTOF;
+        record.tof.csc = timing.cscTOF;
+        record.tof.combined = timing.combinedTOF;
+      }
+
+      if (typeMode_ != 3) {
+        reco::DeDxHitInfoRef dedxHitsRef = dedxCollH->get(track.key());
+        if (!dedxHitsRef.isNull())
+          record.dedx.compute(candDedxTables[ihscp], candCPECaches[ihscp], detTable, track, &(*dedxHitsRef), dEdxSF,
+                              eventIasTemplates, useClusterCleaning, mustBeInside, MaxStripNOM, useTemplateLayer_, correctFEDSat);
+      }
+    };
+    if (parallelCandidates_ && hscpCandidates.size() > 1) {
+      tbb::parallel_for(tbb::blocked_range<unsigned int>(0, hscpCandidates.size()),
+                        [&](const tbb::blocked_range<unsigned int>& range) {
+                          std::vector<unsigned int> cone;
+                          // the copies share the time offsets, only the matching and fit buffers are their own
+                          muonTimingCalculator timing(tofCalculator);
+                          for (unsigned int ihscp = range.begin(); ihscp != range.end(); ihscp++)
+                            prepare(ihscp, cone, timing);
+                        });
+    } else {
+      for (unsigned int ihscp = 0; ihscp < hscpCandidates.size(); ihscp++)
+        prepare(ihscp, coneIndices, tofCalculator);
+    }
+  }
+
+  for (unsigned int ihscp = 0; ihscp < hscpCandidates.size(); ihscp++) {
+    const auto& hscp = hscpCandidates[ihscp];
 
 
   // Number of tracks before any trigger or preselection
@@ -2048,44 +1869,27 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       tunePMuonBestTrackType = muon->tunePMuonBestTrackType();
     }
     
+    // Quantities computed before the candidate loop
+    const candidateRecord& record = candRecords[ihscp];
+    dedxHitTable& candDedxTable = candDedxTables[ihscp];
+    pixelCPECache& candCPECache = candCPECaches[ihscp];
+
     // Reco - GEN track matching
     // For signal only, make sure that the candidate is associated to a true HSCP
-    int closestGenIndex = -1;
-    float dRMinGen = 9999.0;
-    float dPtMinGen = 9999.0;
+    int closestGenIndex = record.gen.closestGenIndex;
+    float dRMinGen = record.gen.dRMinGen;
+    float dPtMinGen = record.gen.dPtMinGen;
     unsigned int closestHSCPsPDGsID = 0;
-    if (!isData) {
-      if (debug_> 0 && trigInfo_ > 0) LogPrint(MOD) << "  >> Background MC, Reco - GEN track matching";
-      if (debug_> 0 && trigInfo_ > 0) LogPrint(MOD) << "  >> GEN signal PDG IDs in the event: ";
-      if (debug_> 0 && trigInfo_ > 0) std::cout << "     ";
-      for (unsigned int g = 0; g < genColl.size(); g++) {
-        if (isSignal && !isHSCPgenID(genColl[g])) {
-          continue;
-        }
-        
-        if (genColl[g].pt() < 5) {
-          continue;
-        }
-        if (genColl[g].status() != 1) {
-          continue;
-        }
-        
-        if (isSignal && trigInfo_ > 0) {
-          if (debug_> 0) std::cout << genColl[g].pdgId() << " , " ;
-        }
-        
-        float dr = deltaR(genColl[g].eta(),genColl[g].phi(),track->eta(),track->phi());
-        float dPt = (fabs(genColl[g].pt() - track->pt()))/track->pt();
-
-        if (dr < dRMinGen) {
-          dRMinGen = dr;
-          closestGenIndex = g;
-        }
-        if (dPt < dPtMinGen) {
-          dPtMinGen = dPt;
+    if (!isData && debug_> 0 && trigInfo_ > 0) {
+      LogPrint(MOD) << "  >> Background MC, Reco - GEN track matching";
+      LogPrint(MOD) << "  >> GEN signal PDG IDs in the event: ";
+      std::cout << "     ";
+      if (isSignal) {
+        for (const auto& gen : genColl) {
+          if (isHSCPgenID(gen) && gen.pt() >= 5 && gen.status() == 1) std::cout << gen.pdgId() << " , " ;
         }
       }
-      if (debug_> 0 && trigInfo_ > 0) cout << endl;
+      cout << endl;
     }
     
     if (!isData && closestGenIndex < 0 ) {
@@ -2108,8 +1912,8 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     float genGammaBeta = (closestGenIndex > 0) ? genColl[closestGenIndex].p() /  genColl[closestGenIndex].mass() : -1.;
     float genBeta = (closestGenIndex > 0) ? genColl[closestGenIndex].p() / genColl[closestGenIndex].energy() : -1.f;
 
-    HSCP_GenBeta.push_back(genBeta);
-    HSCP_trigObjBeta.push_back(trigObjBeta);
+    hscpBlock.GenBeta.push_back(genBeta);
+    hscpBlock.trigObjBeta.push_back(trigObjBeta);
  
     if (!isData && trigInfo_ > 0 && doBefPreSplots_) {
       if (debug_ > 5) {
@@ -2234,7 +2038,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     //For TOF only analysis match to a SA track without vertex constraint for IP cuts
     if (typeMode_ == 3) {
       //Find closest NV track
-      const std::vector<reco::Track> noVertexTrackColl = iEvent.get(refittedStandAloneMuonsToken_);
+      const std::vector<reco::Track>& noVertexTrackColl = iEvent.get(refittedStandAloneMuonsToken_);
       reco::Track NVTrack;
       float minDr = 9999.;
       for (unsigned int i = 0; i < noVertexTrackColl.size(); i++) {
@@ -2249,7 +2053,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       }
       if (minDr < 0.4) {
         // Find displacement of tracks with respect to beam spot
-        const reco::BeamSpot beamSpotColl = iEvent.get(offlineBeamSpotToken_);
+        const reco::BeamSpot& beamSpotColl = iEvent.get(offlineBeamSpotToken_);
         dzFromBeamSpot = NVTrack.dz(beamSpotColl.position());
         dxyFromBeamSpot = NVTrack.dxy(beamSpotColl.position());
       }
@@ -2257,13 +2061,14 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       //      if (muonStations(NVTrack.hitPattern()) < minMuStations_) return false;
     } // End condition for TOF only analysis
     
-    // Save PF informations and isolation
-    float track_PFIso005_sumCharHadPt = 0, track_PFIso005_sumNeutHadPt = 0, track_PFIso005_sumPhotonPt = 0, track_PFIso005_sumPUPt = 0;
-    float track_PFIso01_sumCharHadPt = 0, track_PFIso01_sumNeutHadPt = 0, track_PFIso01_sumPhotonPt = 0, track_PFIso01_sumPUPt = 0;
-    float track_PFIso03_sumCharHadPt = 0, track_PFIso03_sumNeutHadPt = 0, track_PFIso03_sumPhotonPt = 0, track_PFIso03_sumPUPt = 0;
-    float track_PFIso05_sumCharHadPt = 0, track_PFIso05_sumNeutHadPt = 0, track_PFIso05_sumPhotonPt = 0, track_PFIso05_sumPUPt = 0;
-    float track_PFMiniIso_sumCharHadPt = 0, track_PFMiniIso_sumNeutHadPt = 0, track_PFMiniIso_sumPhotonPt = 0, track_PFMiniIso_sumPUPt = 0, track_PFMiniIso_sumMuonPt = 0;
-    float pf_energy=0, pf_ecal_energy = 0, pf_hcal_energy = 0;
+    // Save PF informations and isolation, computed before the candidate loop
+    const candidateIsolation& iso = record.iso;
+    float track_PFIso005_sumCharHadPt = iso.PFIso005.charHadPt, track_PFIso005_sumNeutHadPt = iso.PFIso005.neutHadPt, track_PFIso005_sumPhotonPt = iso.PFIso005.photonPt, track_PFIso005_sumPUPt = iso.PFIso005.puPt;
+    float track_PFIso01_sumCharHadPt = iso.PFIso01.charHadPt, track_PFIso01_sumNeutHadPt = iso.PFIso01.neutHadPt, track_PFIso01_sumPhotonPt = iso.PFIso01.photonPt, track_PFIso01_sumPUPt = iso.PFIso01.puPt;
+    float track_PFIso03_sumCharHadPt = iso.PFIso03.charHadPt, track_PFIso03_sumNeutHadPt = iso.PFIso03.neutHadPt, track_PFIso03_sumPhotonPt = iso.PFIso03.photonPt, track_PFIso03_sumPUPt = iso.PFIso03.puPt;
+    float track_PFIso05_sumCharHadPt = iso.PFIso05.charHadPt, track_PFIso05_sumNeutHadPt = iso.PFIso05.neutHadPt, track_PFIso05_sumPhotonPt = iso.PFIso05.photonPt, track_PFIso05_sumPUPt = iso.PFIso05.puPt;
+    float track_PFMiniIso_sumCharHadPt = iso.PFMiniIso.charHadPt, track_PFMiniIso_sumNeutHadPt = iso.PFMiniIso.neutHadPt, track_PFMiniIso_sumPhotonPt = iso.PFMiniIso.photonPt, track_PFMiniIso_sumPUPt = iso.PFMiniIso.puPt, track_PFMiniIso_sumMuonPt = iso.PFMiniIso_sumMuonPt;
+    float pf_energy = iso.pf_energy, pf_ecal_energy = iso.pf_ecal_energy, pf_hcal_energy = iso.pf_hcal_energy;
     
     // loop on PF Jets for the histograms
     float dRMinPfJetWithCuts = 9999.0;
@@ -2271,131 +2076,41 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     float closestPfJetMuonFraction = 0.0;
     float closestPfJetElectronFraction = 0.0;
     float closestPfJetPhotonFraction = 0.0; 
-    float EleGsfMomentum = 0;
-    float ElePFMomentum = 0;
-    float EleFbremLost = 0;
+    float EleGsfMomentum = iso.EleGsfMomentum;
+    float ElePFMomentum = iso.ElePFMomentum;
+    float EleFbremLost = iso.EleFbremLost;
     if (debug_ > 5) LogPrint(MOD) << "      >> Calculating PF quantities";
-    bool pf_isMuon = false, pf_isElectron = false, pf_isChHadron = false, pf_isNeutHadron = false;
-    bool pf_isPfTrack = false,  pf_isPhoton = false, pf_isUndefined = false;
-    float track_PFMiniIso_sumLeptonPt = 0;
-    float track_PFMiniIso_otherPt = 0;
-    if(pfCandHandle.isValid() && !pfCandHandle->empty()) {
-      const reco::PFCandidateCollection* pf = pfCandHandle.product();
-      for (unsigned int i = 0; i < pf->size(); i++){
-        // https://github.com/cms-sw/cmssw/blob/72d0fc00976da53d1fb745eb7f37b2a4ad965d7e/
-        // PhysicsTools/PatAlgos/plugins/PATIsolatedTrackProducer.cc#L555
-        const reco::PFCandidate* pfCand = &(*pf)[i];
-        bool pf_isElectronForIdx = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::e;
-        bool pf_isMuonForIdx = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::mu;
-        bool pf_isPhotonForIdx = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::gamma;
-        bool pf_isChHadronForIdx = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::h;
-        bool pf_isNeutHadronForIdx = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::h0;
-        
-        if (pfCand->trackRef().isNonnull() && pfCand->trackRef().key() == track.key()) {
-          pf_isElectron = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::e;
-          if(pf_isElectron){
-              const auto& gsfTrackRef = pfCand->gsfTrackRef();
-              const auto& gsfEleRef = pfCand->gsfElectronRef();
-              if (gsfTrackRef.isNonnull()) {
-                  EleGsfMomentum = gsfTrackRef->p();
-                  EleFbremLost = gsfEleRef->fbrem();
-                  ElePFMomentum =pfCand->p4().P();
-                  //std::cout << "The momentum associated to the track is : " << track->p() << " and the momentum associated to the GSF electon associated to the PF cand that is the HSCP = " << EleGsfMomentum << " and the momentum associated to the PF candidate : " << ElePFMomentum << " the fraction lost by brehmstrahlung : " <<EleFbremLost <<  std::endl;
-              }
-          }
-          pf_isMuon = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::mu;
-          //std::cout << "We have PF IS MUON = " << pf_isMuon << " and global muon = " << isGlobalMuon << std::endl;
-          pf_isPhoton = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::gamma;
-          
-          pf_isChHadron = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::h;
-          pf_isNeutHadron = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::h0;
-          pf_isUndefined = pfCand->translatePdgIdToType(pfCand->pdgId()) == reco::PFCandidate::ParticleType::X;
-          pf_isPfTrack = true;
-          pf_energy = pfCand->ecalEnergy() + pfCand->hcalEnergy();
-          pf_ecal_energy = pfCand->ecalEnergy();
-          pf_hcal_energy = pfCand->hcalEnergy();
-          
-          if (trigInfo_ > 0 && doBefPreSplots_) {
-            // Number of PF tracks matched to HSCP candidate track
-            tuple->BefPreS_PfType->Fill(1., eventWeight_);
-            if (pf_isElectron) {
-              tuple->BefPreS_PfType->Fill(2., eventWeight_);
-            } else if (pf_isMuon) {
-              tuple->BefPreS_PfType->Fill(3., eventWeight_);
-            } else if (pf_isPhoton) {
-              tuple->BefPreS_PfType->Fill(4., eventWeight_);
-            } else if (pf_isChHadron) {
-              tuple->BefPreS_PfType->Fill(5., eventWeight_);
-            } else if (pf_isNeutHadron) {
-              tuple->BefPreS_PfType->Fill(6., eventWeight_);
-            } else if (pf_isUndefined) {
-              tuple->BefPreS_PfType->Fill(7., eventWeight_);
-            } else {
-              tuple->BefPreS_PfType->Fill(8., eventWeight_);
-            }
-          }
-          if (debug_ > 4 && trigInfo_ > 0) LogPrint(MOD) << "      >> HSCP candidate track has ID " << pfCand->pdgId() << " categoriezed by PF as " << pfCand->translatePdgIdToType(pfCand->pdgId());
-          // The sum of the pt in the cone does not contain the pt of the track
-          // just the pt of the surrounding tracks in the cone
-          continue;
-        }
-        
-        float dr = deltaR(pfCand->eta(),pfCand->phi(),track->eta(),track->phi());
-        bool fromPV = (fabs(dz) < 0.1);
-        
-        float pt = pfCand->p4().pt();
-        float drForMiniIso = 0.0;
-        if (track->pt() < 50 ) {
-          drForMiniIso = 0.2;
-        } else if (track->pt() < 200) {
-          drForMiniIso = 10/track->pt();
-        } else {
-          drForMiniIso = 0.05;
-        }
-        if (dr<drForMiniIso) {
-          // Leptons get added to trackIso (this is not in the official definition)
-          if (pf_isElectronForIdx || pf_isMuonForIdx) track_PFMiniIso_sumLeptonPt+=pt;
-          // charged cands from PV get added to trackIso
-          if(pf_isChHadronForIdx && fromPV) track_PFMiniIso_sumCharHadPt+=pt;
-          // charged cands not from PV get added to pileup iso
-          else if(pf_isChHadronForIdx) track_PFMiniIso_sumPUPt+=pt;
-          // neutral hadron iso
-          if(pf_isNeutHadronForIdx) track_PFMiniIso_sumNeutHadPt+=pt;
-          // photon iso
-          if(pf_isPhotonForIdx) track_PFMiniIso_sumPhotonPt+=pt;
-          // muon iso
-          if(pf_isMuonForIdx) track_PFMiniIso_sumMuonPt+=pt;
-          if (!pf_isElectronForIdx && !pf_isMuonForIdx && !pf_isChHadronForIdx && !pf_isNeutHadronForIdx && !pf_isPhotonForIdx) {
-            track_PFMiniIso_otherPt+=pt;
+    bool pf_isMuon = iso.pf_isMuon, pf_isElectron = iso.pf_isElectron, pf_isChHadron = iso.pf_isChHadron, pf_isNeutHadron = iso.pf_isNeutHadron;
+    bool pf_isPfTrack = iso.pf_isPfTrack,  pf_isPhoton = iso.pf_isPhoton, pf_isUndefined = iso.pf_isUndefined;
+    float track_PFMiniIso_sumLeptonPt = iso.PFMiniIso_sumLeptonPt;
+    float track_PFMiniIso_otherPt = iso.PFMiniIso_otherPt;
+    if (pf_isPfTrack) {
+      // PF candidates built from the HSCP candidate track, each one is counted
+      for (int i = pfCandOfTrack[track.key()]; i >= 0; i = nextPfCandOfTrack[i]) {
+        const reco::PFCandidate& pfCand = (*pfCandHandle)[i];
+        const auto type = pfCand.translatePdgIdToType(pfCand.pdgId());
+        if (trigInfo_ > 0 && doBefPreSplots_) {
+          // Number of PF tracks matched to HSCP candidate track
+          tuple->BefPreS_PfType->Fill(1., eventWeight_);
+          if (type == reco::PFCandidate::ParticleType::e) {
+            tuple->BefPreS_PfType->Fill(2., eventWeight_);
+          } else if (type == reco::PFCandidate::ParticleType::mu) {
+            tuple->BefPreS_PfType->Fill(3., eventWeight_);
+          } else if (type == reco::PFCandidate::ParticleType::gamma) {
+            tuple->BefPreS_PfType->Fill(4., eventWeight_);
+          } else if (type == reco::PFCandidate::ParticleType::h) {
+            tuple->BefPreS_PfType->Fill(5., eventWeight_);
+          } else if (type == reco::PFCandidate::ParticleType::h0) {
+            tuple->BefPreS_PfType->Fill(6., eventWeight_);
+          } else if (type == reco::PFCandidate::ParticleType::X) {
+            tuple->BefPreS_PfType->Fill(7., eventWeight_);
+          } else {
+            tuple->BefPreS_PfType->Fill(8., eventWeight_);
           }
         }
-        if (dr<0.05) {
-          // charged cands from PV get added to trackIso
-          if(pf_isChHadronForIdx && fromPV) track_PFIso005_sumCharHadPt+=pt;
-          // charged cands not from PV get added to pileup iso
-          else if(pf_isChHadronForIdx) track_PFIso005_sumPUPt+=pt;
-          // neutral hadron iso
-          if(pf_isNeutHadronForIdx) track_PFIso005_sumNeutHadPt+=pt;
-          // photon iso
-          if(pf_isPhotonForIdx) track_PFIso005_sumPhotonPt+=pt;
-        } if(dr<0.1){
-          if(pf_isChHadronForIdx && fromPV) track_PFIso01_sumCharHadPt+=pt;
-          else if(pf_isChHadronForIdx) track_PFIso01_sumPUPt+=pt;
-          if(pf_isNeutHadronForIdx) track_PFIso01_sumNeutHadPt+=pt;
-          if(pf_isPhotonForIdx) track_PFIso01_sumPhotonPt+=pt;
-        } if(dr<0.3){
-          if(pf_isChHadronForIdx && fromPV) track_PFIso03_sumCharHadPt+=pt;
-          else if(pf_isChHadronForIdx) track_PFIso03_sumPUPt+=pt;
-          else if(pf_isNeutHadronForIdx) track_PFIso03_sumNeutHadPt+=pt;
-          else if(pf_isPhotonForIdx) track_PFIso03_sumPhotonPt+=pt;
-        } if(dr<0.5){
-          if(pf_isChHadronForIdx && fromPV) track_PFIso05_sumCharHadPt+=pt;
-          else if(pf_isChHadronForIdx) track_PFIso05_sumPUPt+=pt;
-          else if(pf_isNeutHadronForIdx) track_PFIso05_sumNeutHadPt+=pt;
-          else if(pf_isPhotonForIdx) track_PFIso05_sumPhotonPt+=pt;
-        }
-      } // end loop PFCandidates
-    } // close condition on the validity of PFCandidates
+        if (debug_ > 4 && trigInfo_ > 0) LogPrint(MOD) << "      >> HSCP candidate track has ID " << pfCand.pdgId() << " categoriezed by PF as " << type;
+      }
+    }
     
     // Calculate PF mini relative isolation
     // float miniRelIsoOfficial = (track_PFMiniIso_sumCharHadPt + std::max(0.0, track_PFMiniIso_sumNeutHadPt + track_PFMiniIso_sumPhotonPt - 0.5* track_PFMiniIso_sumPUPt))/track->pt();
@@ -2407,42 +2122,17 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     HSCP_count++;
     
     // Fixed size isolation and EoP variable
-    const edm::ValueMap<susybsm::HSCPIsolation> IsolationMap = iEvent.get(hscpIsoToken_);
+    const edm::ValueMap<susybsm::HSCPIsolation>& IsolationMap = iEvent.get(hscpIsoToken_);
     susybsm::HSCPIsolation hscpIso = IsolationMap.get((size_t)track.key());
+    eventCopies.copied("hscpIsolation", hscpIso);
     float IsoTK_SumEt = hscpIso.Get_TK_SumEt();
     float EoP = pf_energy / track->p();
     float ECalEoP = pf_ecal_energy / track->p();
     float HCalEoP = pf_hcal_energy / track->p();
     
-    // Loop on generalTracks to get genTrackMiniIso
-    float track_genTrackMiniIsoSumPt = 0;
-
-    float track_genTrackMiniIsoSumPtFix = 0;
-    for(unsigned int c=0;c<trackCollectionHandle->size();c++){
-      reco::TrackRef genTrackRef = reco::TrackRef( trackCollectionHandle.product(), c );
-        // Dont count the HSCP candidate in
-      if (genTrackRef.isNonnull() && genTrackRef.key() != track.key()) {
-        float drForMiniIsoFix = 0.3;
-
-        float drForMiniIso = 0.0;
-        if (track->pt() < 50 ) {
-          drForMiniIso = 0.2;
-        } else if (track->pt() < 200) {
-          drForMiniIso = 10/track->pt();
-        } else {
-          drForMiniIso = 0.05;
-        }
-        float pt = genTrackRef->pt();
-        float dr = deltaR(genTrackRef->eta(),genTrackRef->phi(),track->eta(),track->phi());
-        if(dr < drForMiniIsoFix) {
-          track_genTrackMiniIsoSumPtFix+=pt;
-        }
-
-        if (dr<drForMiniIso) {
-          track_genTrackMiniIsoSumPt+=pt;
-        }
-      }
-    }
+    // genTrackMiniIso from the generalTracks
+    float track_genTrackMiniIsoSumPt = iso.genTrackMiniIsoSumPt;
+    float track_genTrackMiniIsoSumPtFix = iso.genTrackIsoSumPt_dr03;
     
     std::vector<float> clust_charge;
     std::vector<float> clust_pathlength;
@@ -2495,20 +2185,16 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
         dttof = &(*tofDtMap)[hscp.muonRef()];
         csctof = &(*tofCscMap)[hscp.muonRef()];
       } else {
-        const CSCSegmentCollection& CSCSegmentColl = *CSCSegmentCollH;
-        const DTRecSegment4DCollection& DTSegmentColl = *DTSegmentCollH;
         // Apply T0 correction on data but not on signal MC
         tof = &(*tofMap)[hscp.muonRef()];
         dttof = &(*tofDtMap)[hscp.muonRef()];
         csctof = &(*tofCscMap)[hscp.muonRef()];
         
-        // Only recompute using tofCalculator once we have calibration ready
-        if(calibrateTOF_){ 
-            auto muonRefCompute = hscp.muonRef(); 
-            tofCalculator.computeTOF(muonRefCompute, CSCSegmentColl, DTSegmentColl, 2,true);
-            tof = &tofCalculator.combinedTOF;
-            dttof = &tofCalculator.dtTOF;
-            csctof = &tofCalculator.cscTOF;
+        // Only recompute using tofCalculator once we have calibration ready (done before the candidate loop)
+        if (record.tof.recomputed) {
+            tof = &record.tof.combined;
+            dttof = &record.tof.dt;
+            csctof = &record.tof.csc;
         }
       }
     } // end conditions for TOF including analysis variables
@@ -2521,26 +2207,9 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       continue;
     }
     
-    // Loop on the gen particles (again) to find if the 0.001 enviroment of the candidate has 91 or >2
-    bool candidateEnvHasStatus91 = false;
-    bool candidateEnvHasStatusHigherThan2 = false;
-    if (!isData) {
-      unsigned int usignedIntclosestGenIndex = 0;
-      if (closestGenIndex>0) usignedIntclosestGenIndex = closestGenIndex;
-      
-      for (unsigned int g = 0; g < genColl.size(); g++) {
-        // Exclude the canidate when looking at its envirment
-        if (g == usignedIntclosestGenIndex) continue;
-        // Look only at the R=0.001 enviroment of the candidate
-        if (deltaR(genColl[g].eta(),genColl[g].phi(),genColl[usignedIntclosestGenIndex].eta(),genColl[usignedIntclosestGenIndex].phi()) > 0.001) continue;
-        if (genColl[g].status() == 91) {
-          candidateEnvHasStatus91 = true;
-        }
-        if (genColl[g].status() > 2) {
-          candidateEnvHasStatusHigherThan2 = true;
-        }
-      }
-    }
+    // Whether the 0.001 enviroment of the candidate has 91 or >2, from the gen matching
+    bool candidateEnvHasStatus91 = !isData && record.gen.envHasStatus91;
+    bool candidateEnvHasStatusHigherThan2 = !isData && record.gen.envHasStatusHigherThan2;
     
     int nofClust_dEdxLowerThan = 0;
     
@@ -2588,8 +2257,6 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       }
     }
     
-    int numLayers = tkGeometry->numberOfLayers(PixelSubdetector::PixelBarrel);
-    
     // Include probQonTrack, probXYonTrack, probQonTrackNoL1, probXYonTrackNoL1 into one array
     float pixelProbs[4] = {0.0,0.0,0.0,0.0};
     int numRecHitsQ = 0, numRecHitsXY = 0;
@@ -2614,6 +2281,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       clust_isPixel.push_back(dedxHits->detId(i) >= 3 ? false : true);
       clust_detid.push_back(dedxHits->detId(i));
       DetId detid(dedxHits->detId(i));
+      const trackerDetInfo& det = detTable[detid];
       float factorChargeToE = (detid.subdetId() < 3) ? 3.61e-06 : 3.61e-06 * 265;
       
       if (detid.subdetId() < 3) {
@@ -2625,14 +2293,11 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
           if (debug_> 0 && trigInfo_ > 0) LogPrint(MOD) << "    >> At this point this should never happen";
           continue;
         }
-        // Check on which geometry unit the hit is
-        const GeomDetUnit& geomDet = *tkGeometry->idToDetUnit(detid);
-        // Get the local vector for the track direction
-        LocalVector lv = geomDet.toLocal(GlobalVector(track->px(), track->py(), track->pz()));
-        // Re-run the CPE on this cluster with the lv above
-        // getParameters will return std::tuple<LocalPoint, LocalError, SiPixelRecHitQuality::QualWordType>;
-        // from this we pick the 2nd, the QualWordType
-        auto reCPE = std::get<2>(pixelCPE->getParameters(*pixelCluster, geomDet, LocalTrajectoryParameters(dedxHits->pos(i), lv, track->charge())));
+        // Re-run of the CPE on this cluster with the track direction, cached for the candidate
+        const pixelCPEResult& cpe = candCPECache.get(track.key(), dedxHits, i, track->px(), track->py(), track->pz(), track->charge());
+        // Local vector for the track direction
+        LocalVector lv = cpe.localDir;
+        auto reCPE = cpe.qualWord;
         // extract probQ and probXY from this
         float probQ = SiPixelRecHitQuality::thePacking.probabilityQ(reCPE);
         float probXY = SiPixelRecHitQuality::thePacking.probabilityXY(reCPE);
@@ -2672,7 +2337,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
         }
         if (trigInfo_ > 0 && doBefPreSplots_) {
           if ( detid.subdetId() == PixelSubdetector::PixelBarrel) {
-            auto pixLayerIndex = abs(int(tTopo->pxbLayer(detid)));
+            auto pixLayerIndex = det.pixelLayer;
             tuple->BefPreS_CluProbQVsPixelLayer->Fill(probQ, pixLayerIndex, eventWeight_);
             tuple->BefPreS_CluProbXYVsPixelLayer->Fill(probXY, pixLayerIndex, eventWeight_);
             tuple->BefPreS_CluNormChargeVsPixelLayer->Fill(pixelNormCharge, pixLayerIndex, eventWeight_);
@@ -2717,9 +2382,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
         
         // Have a separate variable that excludes Layer 1
         // Layer 1 was very noisy in 2017/2018
-        bool conditionForPhase0 = (numLayers == 3);
-        bool conditionForPhase1 = ((numLayers == 4) && (( detid.subdetId() == PixelSubdetector::PixelEndcap) || ((detid.subdetId() == PixelSubdetector::PixelBarrel) && (tTopo->pxbLayer(detid) != 1))));
-        if (conditionForPhase0 || conditionForPhase1) {
+        if (det.isPixelNoL1) {
           nonL1PixHits++;
           float probQNoL1 = SiPixelRecHitQuality::thePacking.probabilityQ(reCPE);
           float probXYNoL1 = SiPixelRecHitQuality::thePacking.probabilityXY(reCPE);
@@ -2767,11 +2430,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
         
         if (trigInfo_ > 0) {
           float stripNormCharge = um2cmUnit * dedxHits->charge(i) * 265 / dedxHits->pathlength(i);
-          unsigned int stripLayerIndex = 0;
-          if (detid.subdetId() == StripSubdetector::TIB) stripLayerIndex = abs(int(tTopo->tibLayer(detid)));
-          if (detid.subdetId() == StripSubdetector::TOB) stripLayerIndex = abs(int(tTopo->tobLayer(detid))) + 4;
-          if (detid.subdetId() == StripSubdetector::TID) stripLayerIndex = abs(int(tTopo->tidWheel(detid))) + 10;
-          if (detid.subdetId() == StripSubdetector::TEC) stripLayerIndex = abs(int(tTopo->tecWheel(detid))) + 13;
+          unsigned int stripLayerIndex = det.layer;
           if (!isData && genGammaBeta > 0.31623 && genGammaBeta < 0.6  && doBefPreSplots_) {
             tuple->BefPreS_CluNormChargeVsStripLayer_lowBetaGamma->Fill(stripNormCharge, stripLayerIndex, eventWeight_);
           } else if (!isData && genGammaBeta > 0.6 ) {
@@ -2822,95 +2481,54 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     
     float Fmip = (float)nofClust_dEdxLowerThan / (float)dedxHits->size();
 
-    //computedEdx: track_eta, iSetup, run, year, 
-    //             hits, SF, templates, usePixel, useStrips,, useClusterCleaning, uneTrunc,
-    //             mustBeInside, MaxStripNOM, correctFEDSat, XtalkInv, lowDeDxDrop, dedxErr, useTemplateLayer_, 
-    //             skipPixelL1, skip_templates_ias, useMorrisMethod,
-    //             usePixelClusterCleaning,pixelCPE_,tTopo,track_px,track_py,track_pz,track_charge
-
-    //correction inverseXtalk = 0 --> take the raw amplitudes of the cluster
-    //correction inverseXtalk = 1 --> modify the amplitudes based on xtalk for non-saturated cluster + correct for saturation
-    //
-    //skip_templates_ias = 0 --> no skip
-    //skip_templates_ias = 1 --> no Pix, no TIB, no TID, no 3 first layers TEC
-    //skip_templates_ias = 2 --> Pixel Only
-    
-    
-    float dEdxErr = 0;
-    bool symmetricSmirnov = false;
-    bool useMorrisMethod = false;
+    // The hits of the track were decoded and cleaned once before the candidate loop, with the dEdx
+    // estimators evaluated on them (see candidateDeDx), the other estimators below use the same table
+    const candidateDeDx& dedx = record.dedx;
+    float dEdxErr = dedx.dEdxErr;
     
     // Ih
-    auto dedxMObj_FullTrackerTmp =
-        computedEdx(track->eta(),iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true,  useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_,
-                    false,0, false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxMObj_FullTrackerTmp = dedx.Ih;
     
 //    reco::DeDxData* dedxMObj_FullTracker = dedxMObj_FullTrackerTmp.numberOfMeasurements() > 0 ? &dedxMObj_FullTrackerTmp : nullptr;
     
     // Ih Up
-    auto dedxMUpObjTmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.15, 0, useTemplateLayer_,
-                    false,0, false, false, true,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxMUpObjTmp = dedx.IhUp;
     
     reco::DeDxData* dedxMUpObj = dedxMUpObjTmp.numberOfMeasurements() > 0 ? &dedxMUpObjTmp : nullptr;
     
     // Ih Down
     // For now it's a copy of Ih Up, I doubt that's what it should be...
     // Also I think this should be done on the top of Ih no pixel L1 not the full tracker version
-    auto dedxMDownObjTmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.15, 0, useTemplateLayer_,
-                    false,0, false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxMDownObjTmp = dedxMUpObjTmp;
 
     reco::DeDxData* dedxMDownObj = dedxMDownObjTmp.numberOfMeasurements() > 0 ? &dedxMDownObjTmp : nullptr;
 
     // Ih no pixel L1 
-    auto dedxIh_noL1_Tmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_, skipPixelL1 = true,
-                    0, false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxIh_noL1_Tmp = dedx.IhNoL1;
 
     reco::DeDxData* dedxIh_noL1 = dedxIh_noL1_Tmp.numberOfMeasurements() > 0 ? &dedxIh_noL1_Tmp : nullptr;
     
     // Ih 0.15 low values drop
-    // Should useTruncated be true ?
-    auto dedxIh_15drop_Tmp =
-      computedEdx(track->eta(),iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = true,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.15, &dEdxErr, useTemplateLayer_,
-                    false,0, false, false, true,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxIh_15drop_Tmp = dedx.Ih15drop;
     reco::DeDxData* dedxIh_15drop = dedxIh_15drop_Tmp.numberOfMeasurements() > 0 ? &dedxIh_15drop_Tmp : nullptr;
     
     // Ih Strip only  =======>  THE GOLDEN VARIABLE (change applied on March 29, 2023):
-    auto dedxIh_StripOnly_Tmp =
-    computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = false, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_,
-                    false,0, false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxIh_StripOnly_Tmp = dedx.IhStripOnly;
 
     reco::DeDxData* dedxIh_StripOnly = dedxIh_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIh_StripOnly_Tmp : nullptr;
     
     // Ih Strip only and 0.15 low values drop
-    auto dedxIh_StripOnly_15drop_Tmp =
-      computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = false, useStrip = true, useClusterCleaning, useTruncated = true,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.15, &dEdxErr, useTemplateLayer_, skipPixelL1 = true,
-                    0, false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxIh_StripOnly_15drop_Tmp = dedx.IhStripOnly15drop;
 
     reco::DeDxData* dedxIh_StripOnly_15drop = dedxIh_StripOnly_15drop_Tmp.numberOfMeasurements() > 0 ? &dedxIh_StripOnly_15drop_Tmp : nullptr;
     
     // Ih Pixel only no BPIXL1
-    auto dedxIh_PixelOnly_noL1_Tmp =
-      computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = false, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_, skipPixelL1 = true,
-                    0, false, false, true,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxIh_PixelOnly_noL1_Tmp = dedx.IhPixelOnlyNoL1;
 
     reco::DeDxData* dedxIh_PixelOnlyh_noL1 = dedxIh_PixelOnly_noL1_Tmp.numberOfMeasurements() > 0 ? &dedxIh_PixelOnly_noL1_Tmp : nullptr;
     
     // Ih correct saturation from fits
-    auto dedxIh_SaturationCorrectionFromFits_Tmp =
-      computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = false, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 2, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_, skipPixelL1 = true,
-                    0, false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+    auto dedxIh_SaturationCorrectionFromFits_Tmp = dedx.IhSaturationCorrectionFromFits;
 
     reco::DeDxData* dedxIh_SaturationCorrectionFromFits = dedxIh_SaturationCorrectionFromFits_Tmp.numberOfMeasurements() > 0 ? &dedxIh_SaturationCorrectionFromFits_Tmp : nullptr;
     
@@ -2930,126 +2548,28 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     reco::DeDxData* dedxIs_StripOnly = nullptr; //symmetric Smirnov discriminator - Is
     reco::DeDxData* dedxMorrisMethod_StripOnly = nullptr; // FiStrips
     
-    int NPV = vertexColl.size();
-    if(!puTreatment_) {
-        dedxIas_FullTrackerTmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplates, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false,
-                   mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_,
-                   false,0, false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-        dedxIas_FullTracker = dedxIas_FullTrackerTmp.numberOfMeasurements() > 0 ? &dedxIas_FullTrackerTmp : nullptr;
-
-        dedxIas_noL1Tmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplates, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false,
-               mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_,skipPixelL1 = true, skip_templates_ias = 2,
-                   false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-        dedxIas_noL1 = dedxIas_noL1Tmp.numberOfMeasurements() > 0 ? &dedxIas_noL1Tmp : nullptr;
-
-        dedxIas_noTIBnoTIDno3TEC_Tmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplates, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = true, skip_templates_ias = 1,
-                    false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-
-        dedxIas_noTIBnoTIDno3TEC = dedxIas_noTIBnoTIDno3TEC_Tmp.numberOfMeasurements() > 0 ? &dedxIas_noTIBnoTIDno3TEC_Tmp : nullptr;
-
-        dedxIas_PixelOnly_Tmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplates, usePixel = true, useStrip = false, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = false, skip_templates_ias = 2,
-                    false, false, true,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-        dedxIas_PixelOnly = dedxIas_PixelOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIas_PixelOnly_Tmp : nullptr;
-
-        dedxIas_StripOnly_Tmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplates, usePixel = false, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = false, skip_templates_ias = 0,
-                    false, false, true,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-        dedxIas_StripOnly = dedxIas_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIas_StripOnly_Tmp : nullptr;
-
-        dedxIas_PixelOnly_noL1_Tmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplates, usePixel = true, useStrip = false, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = true, skip_templates_ias = 2,
-                    false, false, true,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-        dedxIas_PixelOnly_noL1 = dedxIas_PixelOnly_noL1_Tmp.numberOfMeasurements() > 0 ? &dedxIas_PixelOnly_noL1_Tmp : nullptr;
-
-        dedxIs_StripOnly_Tmp =
-    computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplates, usePixel = true, useStrip = false, useClusterCleaning, useTruncated = false,
-                mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = true, skip_templates_ias = 2, symmetricSmirnov = true,
-                false, true,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-        dedxIs_StripOnly = dedxIs_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIs_StripOnly_Tmp : nullptr;
-      
-      // the FiStrips variable
-      dedxMorrisMethod_StripOnly_Tmp =
-      computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplates, usePixel = false, useStrip = true, useClusterCleaning, useTruncated = false,
-                  mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = false, skip_templates_ias = 0, 
-                  symmetricSmirnov = false, useMorrisMethod = true, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge() );
-      
+    // Templates of the event (the inclusive ones, or the ones of the PU bin), chosen before the candidate loop
+    if (eventIasTemplates) {
+      const std::vector<reco::DeDxData>& iasResults = dedx.ias;
+
+      dedxIas_FullTrackerTmp = iasResults[0];
+      dedxIas_noL1Tmp = iasResults[1];
+      dedxIas_noTIBnoTIDno3TEC_Tmp = iasResults[2];
+      dedxIas_PixelOnly_Tmp = iasResults[3];
+      dedxIas_StripOnly_Tmp = iasResults[4];
+      dedxIas_PixelOnly_noL1_Tmp = iasResults[5];
+      dedxIs_StripOnly_Tmp = iasResults[6];
+      dedxMorrisMethod_StripOnly_Tmp = iasResults[7];
+
+      dedxIas_FullTracker = dedxIas_FullTrackerTmp.numberOfMeasurements() > 0 ? &dedxIas_FullTrackerTmp : nullptr;
+      dedxIas_noL1 = dedxIas_noL1Tmp.numberOfMeasurements() > 0 ? &dedxIas_noL1Tmp : nullptr;
+      dedxIas_noTIBnoTIDno3TEC = dedxIas_noTIBnoTIDno3TEC_Tmp.numberOfMeasurements() > 0 ? &dedxIas_noTIBnoTIDno3TEC_Tmp : nullptr;
+      dedxIas_PixelOnly = dedxIas_PixelOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIas_PixelOnly_Tmp : nullptr;
+      dedxIas_StripOnly = dedxIas_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIas_StripOnly_Tmp : nullptr;
+      dedxIas_PixelOnly_noL1 = dedxIas_PixelOnly_noL1_Tmp.numberOfMeasurements() > 0 ? &dedxIas_PixelOnly_noL1_Tmp : nullptr;
+      dedxIs_StripOnly = dedxIs_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIs_StripOnly_Tmp : nullptr;
       dedxMorrisMethod_StripOnly = dedxMorrisMethod_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxMorrisMethod_StripOnly_Tmp : nullptr;
-      } else {
-        for(int i = 0 ; i < NbPuBins_ ; i++) {
-          if ( NPV > PuBins_[i] && NPV <= PuBins_[i+1] ){
-            //globalIas_
-            dedxIas_FullTrackerTmp =
-            computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplatesPU[i], usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false, mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_,
-                        false,0, false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-            dedxIas_FullTracker = dedxIas_FullTrackerTmp.numberOfMeasurements() > 0 ? &dedxIas_FullTrackerTmp : nullptr;
-
-            //globalIas_ no BPIXL1
-            dedxIas_noL1Tmp =
-            computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplatesPU[i], usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false, mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_,skipPixelL1 = true, skip_templates_ias = 2,
-                         false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-            dedxIas_noL1 = dedxIas_noL1Tmp.numberOfMeasurements() > 0 ? &dedxIas_noL1Tmp : nullptr;
-
-            //globalIas_ without TIB, TID, and 3 first TEC layers
-            dedxIas_noTIBnoTIDno3TEC_Tmp =
-                computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplatesPU[i], usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false, mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = true, skip_templates_ias = 1,
-                         false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-            dedxIas_noTIBnoTIDno3TEC = dedxIas_noTIBnoTIDno3TEC_Tmp.numberOfMeasurements() > 0 ? &dedxIas_noTIBnoTIDno3TEC_Tmp : nullptr;
-
-            //globalIas_ Pixel only
-            dedxIas_PixelOnly_Tmp =
-                computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplatesPU[i], usePixel = true, useStrip = false, useClusterCleaning, useTruncated = false, mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = false, skip_templates_ias = 2,
-                         false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-            dedxIas_PixelOnly = dedxIas_PixelOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIas_PixelOnly_Tmp : nullptr;
-
-            //globalIas_ Strip only
-            dedxIas_StripOnly_Tmp =
-                computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplatesPU[i], usePixel = false, useStrip = true, useClusterCleaning, useTruncated = false, mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = false, skip_templates_ias = 0,
-                         false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-            dedxIas_StripOnly = dedxIas_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIas_StripOnly_Tmp : nullptr;
-
-            //globalIas_ Pixel only no BPIXL1
-            dedxIas_PixelOnly_noL1_Tmp =
-                computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplatesPU[i], usePixel = true, useStrip = false, useClusterCleaning, useTruncated = false, mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = true, skip_templates_ias = 2,
-                         false, false, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-            dedxIas_PixelOnly_noL1 = dedxIas_PixelOnly_noL1_Tmp.numberOfMeasurements() > 0 ? &dedxIas_PixelOnly_noL1_Tmp : nullptr;
-
-            //symmetric Smirnov discriminator - Is
-            dedxIs_StripOnly_Tmp =
-            computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplatesPU[i], usePixel = true, useStrip = false, useClusterCleaning, useTruncated = false, mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = true, skip_templates_ias = 2, symmetricSmirnov = true,
-                         false, true,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-
-            dedxIs_StripOnly = dedxIs_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxIs_StripOnly_Tmp : nullptr;
-          
-            // the FiStrips variable
-            dedxMorrisMethod_StripOnly_Tmp =
-            computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = dEdxTemplatesPU[i], usePixel = false, useStrip = true, useClusterCleaning, useTruncated = false,
-                        mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, 0, useTemplateLayer_, skipPixelL1 = false, skip_templates_ias = 0, symmetricSmirnov = false, useMorrisMethod = true, true, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
-            
-            dedxMorrisMethod_StripOnly = dedxMorrisMethod_StripOnly_Tmp.numberOfMeasurements() > 0 ? &dedxMorrisMethod_StripOnly_Tmp : nullptr;
-          }//end condition on vertex numbers
-        } // end loop on vertex collection
-      } // end else
+    }
 
     //
     // Choice before March 29,2023
@@ -3092,7 +2612,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       float numSiblingsF = 9999.0;
       bool motherFound = false;
       float dRMinGenAndAunt = 9999.0;
-      reco::GenParticle& genCandidateUnderStudy = genColl[closestGenIndex];
+      const reco::GenParticle& genCandidateUnderStudy = genColl[closestGenIndex];
       
       // Loop through all the mothers of the gen particle
       for (unsigned int numMomIndx = 0; numMomIndx < genCandidateUnderStudy.numberOfMothers(); numMomIndx++) {
@@ -3223,32 +2743,9 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       //  }
 
       // Loop on generalTracks
-    track_genTrackMiniIsoSumPt = 0;
-    float track_genTrackIsoSumPt_dr03 = 0;
-
-    for(unsigned int c=0;c<trackCollectionHandle->size();c++){
-      reco::TrackRef genTrackRef = reco::TrackRef( trackCollectionHandle.product(), c );
-        // Dont count the HSCP candidate in
-      if (genTrackRef.isNonnull() && genTrackRef.key() != track.key()) {
-        float drForMiniIso = 0.0;
-        if (track->pt() < 50 ) {
-          drForMiniIso = 0.2;
-        } else if (track->pt() < 200) {
-          drForMiniIso = 10/track->pt();
-        } else {
-          drForMiniIso = 0.05;
-        }
-        float pt = genTrackRef->pt();
-        float dr = deltaR(genTrackRef->eta(),genTrackRef->phi(),track->eta(),track->phi());
-        if (dr<drForMiniIso) {
-          track_genTrackMiniIsoSumPt+=pt;
-        }
-        //drForMiniIso = 0.3;  //  fixed size cone for mass spectrum approach
-        if (dr<0.3) {
-          track_genTrackIsoSumPt_dr03+=pt;
-        }
-      }
-    }
+    // same cone sums as above
+    track_genTrackMiniIsoSumPt = iso.genTrackMiniIsoSumPt;
+    float track_genTrackIsoSumPt_dr03 = iso.genTrackIsoSumPt_dr03;
 
 
 
@@ -3264,21 +2761,8 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
         const reco::PFJet* jet = &(*pfJetColl)[i];
         float dr = deltaR(jet->eta(), jet->phi(), track->eta(), track->phi());
         
-        float dRMinPfCaloJet = 9999.0;
-        float dPtPfCaloJet = 9999.0;
-        if (caloJetHandle.isValid() && !caloJetHandle->empty()) {
-          for (unsigned int iCalo = 0; iCalo < caloJetHandle->size(); iCalo++) {
-            const reco::CaloJet* jetCalo = &(*caloJetHandle)[iCalo];
-            float drCalo = deltaR(jet->eta(), jet->phi(), jetCalo->eta(), jetCalo->phi());
-            
-            if (drCalo < dRMinPfCaloJet) {
-              dRMinPfCaloJet = drCalo;
-              dPtPfCaloJet = fabs(jet->pt()-jetCalo->pt());
-            }
-          }
-        }
         if (trigInfo_ > 0 && doBefPreSplots_) {
-          tuple->BefPreS_dRVsdPtPfCaloJet->Fill(dRMinPfCaloJet,dPtPfCaloJet, eventWeight_);
+          tuple->BefPreS_dRVsdPtPfCaloJet->Fill(dRMinPfCaloJet[i], dPtPfCaloJet[i], eventWeight_);
         }
         
         if (dr < dRMinPfJetWithNoCuts) {
@@ -3358,7 +2842,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     maxOpenAngle = deltaROpositeTrack(iEvent.get(hscpToken_), hscp);
     
     // Get the location of the outmost hit
-    const GlobalPoint outerHit = getOuterHitPos(iSetup, dedxHits);
+    const GlobalPoint outerHit = getOuterHitPos(dedxHits);
     const float furthersHitDxy = sqrt(outerHit.x()*outerHit.x()+outerHit.y()*outerHit.y());
     const float furthersHitDistance = sqrt(outerHit.x()*outerHit.x()+outerHit.y()*outerHit.y()+outerHit.z()*outerHit.z());
     
@@ -3871,9 +3355,8 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
 
     //check impact of no pixel cleaning 
     auto dedxIh_test_tmp3 =
-    computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_, skipPixelL1 = true,
-                    0, false, false, false, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+        candDedxTable.evaluate(dedxEstimator(nullptr, true, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, true, useTemplateLayer_, skipPixelL1 = true,
+                                         0, false, false, false), &dEdxErr);
     reco::DeDxData* dedxtest_nopixcl = dedxIh_test_tmp3.numberOfMeasurements() > 0 ? &dedxIh_test_tmp3 : nullptr;
 
     // Preselection cuts for a CR where the pT cut is flipped
@@ -3928,15 +3411,13 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       if (doPostPreSplots_) {
         //check impact of no clustercleaning (in strip and in pix)
         auto dedxIh_test_tmp =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = true, false, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_, skipPixelL1 = true,
-                    0, false, false, false,  pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+            candDedxTable.evaluate(dedxEstimator(nullptr, true, true, false, false, mustBeInside, MaxStripNOM, 0.0, true, useTemplateLayer_, skipPixelL1 = true,
+                                             0, false, false, false), &dEdxErr);
         reco::DeDxData* dedxtest_noclean = dedxIh_test_tmp.numberOfMeasurements() > 0 ? &dedxIh_test_tmp : nullptr;
         //check impact of no clustercleaning and no condition of the cluster to be inside the module
         auto dedxIh_test_tmp2 =
-        computedEdx(track->eta(), iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = true, false, useTruncated = false,
-                    false, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_, skipPixelL1 = true,
-                    0, false, false, false, pixelCPE_, tTopo, track->px(), track->py(), track->pz(), track->charge());
+            candDedxTable.evaluate(dedxEstimator(nullptr, true, true, false, false, false, MaxStripNOM, 0.0, true, useTemplateLayer_, skipPixelL1 = true,
+                                             0, false, false, false), &dEdxErr);
         reco::DeDxData* dedxtest_noinside = dedxIh_test_tmp2.numberOfMeasurements() > 0 ? &dedxIh_test_tmp2 : nullptr;
 
 
@@ -3953,17 +3434,13 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       }
       for(unsigned int h=0; h< dedxHits->size(); h++) {
         DetId detid(dedxHits->detId(h));
+        const trackerDetInfo& det = detTable[detid];
         int modulgeomForIndxH = 0;
         float pathlenghtForIndxH = 0.0;
         float chargeForIndxH = 0.0;
         float normMult = 265;
         float scaleFactor = dEdxSF_0_;
-        if (detid.subdetId() < 3) {
-          modulgeomForIndxH = 15;
-        } else {
-          SiStripDetId SSdetId(detid);
-          modulgeomForIndxH = SSdetId.moduleGeometry();
-        }
+        modulgeomForIndxH = det.moduleGeometry;
         pathlenghtForIndxH = dedxHits->pathlength(h) * 10;
         chargeForIndxH = dedxHits->charge(h);
 
@@ -3971,21 +3448,18 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
         bool dedx_inside = true;
         if (detid.subdetId() < 3) {
               // Pixel corrections
-              float pixelScaling = GetSFPixel(detid.subdetId(), detid, year, run_number);
+              float pixelScaling = det.pixelSF;
               chargeForIndxH *= pixelScaling;
 
 
               // Taking the pixel cluster
               auto const* pixelCluster =  dedxHits->pixelCluster(h);
               if (pixelCluster == nullptr)  continue;
-              // Check on which geometry unit the hit is
-              const GeomDetUnit& geomDet = *tkGeometry->idToDetUnit(detid);
-              // Get the local vector for the track direction
-              LocalVector lv = geomDet.toLocal(GlobalVector(track->px(), track->py(), track->pz()));
-              // Re-run the CPE on this cluster with the lv above
-              // getParameters will return std::tuple<LocalPoint, LocalError, SiPixelRecHitQuality::QualWordType>;
-              // from this we pick the 2nd, the QualWordType
-              auto reCPE = std::get<2>(pixelCPE->getParameters(*pixelCluster, geomDet, LocalTrajectoryParameters(dedxHits->pos(h), lv, track->charge())));
+              // Re-run of the CPE on this cluster with the track direction, cached for the candidate
+              const pixelCPEResult& cpe = candCPECache.get(track.key(), dedxHits, h, track->px(), track->py(), track->pz(), track->charge());
+              // Local vector for the track direction
+              LocalVector lv = cpe.localDir;
+              auto reCPE = cpe.qualWord;
               // extract probQ and probXY from this
               //float probQ = SiPixelRecHitQuality::thePacking.probabilityQ(reCPE);
               // To measure how often the CPE fails
@@ -4077,11 +3551,11 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
           // check if we are on the pixels
          if (detid.subdetId() < 3) {
            if (detid.subdetId() == PixelSubdetector::PixelBarrel) {
-             layer_num=tTopo->pxbLayer(detid);
+             layer_num=det.pixelLayer;
            }
            else {
             // Given the eta < 1 we nver get here
-            layer_num=tTopo->pxfDisk(detid)+4;
+            layer_num=det.pixelLayer+4;
           }
            //TODO March21
           tuple->PostPreS_CluPathLenghtVsPixLayer_CR_veryLowPt->Fill(pathL/um2cmUnit, layer_num, eventWeight_);
@@ -4091,10 +3565,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
           if (detid.subdetId() == PixelSubdetector::PixelBarrel && layer_num==4) tuple->Stab_CluDeDxPixLayer4_VsRun_CR_veryLowPt->Fill(currentRun_, scaleF*chargeForIndxH*factorChargeToE/pathL , eventWeight_);
          } // otherwise we are on the strips
          else {
-           if (detid.subdetId() == StripSubdetector::TIB) layer_num = abs(int(tTopo->tibLayer(detid)));
-           if (detid.subdetId() == StripSubdetector::TOB) layer_num = abs(int(tTopo->tobLayer(detid))) + 4;
-           if (detid.subdetId() == StripSubdetector::TID) layer_num = abs(int(tTopo->tidWheel(detid))) + 10;
-           if (detid.subdetId() == StripSubdetector::TEC) layer_num = abs(int(tTopo->tecWheel(detid))) + 13;
+           layer_num = det.layer;
            tuple->PostPreS_CluDeDxVsStripsLayer_CR_veryLowPt->Fill(scaleF*chargeForIndxH*factorChargeToE/pathL, layer_num, eventWeight_);
            if (layer_num==1) tuple->Stab_CluDeDxStripsLayer1_VsRun_CR_veryLowPt->Fill(currentRun_, scaleF*chargeForIndxH*factorChargeToE/pathL , eventWeight_);
            if (layer_num==2) tuple->Stab_CluDeDxStripsLayer2_VsRun_CR_veryLowPt->Fill(currentRun_, scaleF*chargeForIndxH*factorChargeToE/pathL , eventWeight_);
@@ -4206,10 +3677,10 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     passedCutsArrayForTriggerSyst[2] = true;
 
     float dRclosestTrigAndCandidate = (closestTrigObjIndex > -1) ? deltaR(trigObjP4s[closestTrigObjIndex].Eta(), trigObjP4s[closestTrigObjIndex].Phi(), track->eta(), track->phi()) : 9999;
-    HSCP_dRclosestTrigAndCandidate.push_back(dRclosestTrigAndCandidate);
+    hscpBlock.dRclosestTrigAndCandidate.push_back(dRclosestTrigAndCandidate);
 
     bool passSelTrigSys = passPreselection(passedCutsArrayForTriggerSyst, false);
-    HSCP_passPreselectionTrigSys.push_back(passSelTrigSys); 
+    hscpBlock.passPreselectionTrigSys.push_back(passSelTrigSys); 
 
     if (passPreselection(passedCutsArrayForTriggerSyst, false)) {
       if (HLT_Mu50 && dRclosestTrigAndCandidate < 0.15 ) trigObjPassedPres = true;
@@ -4689,7 +4160,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
         bool motherFound = false;
         float dRMinGenAndAunt = 9999.0;
         //        float dRMinGenAndGrandAunt = 9999.0;
-        reco::GenParticle& genCandidateUnderStudy = genColl[closestGenIndex];
+        const reco::GenParticle& genCandidateUnderStudy = genColl[closestGenIndex];
         
         if (genCandidateUnderStudy.numberOfMothers() == 0) {
           LogPrint(MOD) << "There are zero mothers, track ID" << abs(genCandidateUnderStudy.pdgId()) <<
@@ -4930,16 +4401,18 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       bool headerPixPrintedAlready = false;
       for (unsigned int i = 0; i < dedxHits->size(); i++) {
         DetId detid(dedxHits->detId(i));
+        const trackerDetInfo& det = detTable[detid];
         
         // The pixel part
         if (detid.subdetId() < 3 && passPre && trigInfo_ > 0) {
           // Taking the pixel cluster
           auto const* pixelCluster =  dedxHits->pixelCluster(i);
           // Get the local angles (axproximate from global)
-          const GeomDetUnit& geomDet = *tkGeometry->idToDetUnit(detid);
-          LocalVector lv = geomDet.toLocal(GlobalVector(track->px(), track->py(), track->pz()));
-          // Let's redo CPE too
-          auto reCPE = std::get<2>(pixelCPE->getParameters(*pixelCluster, geomDet, LocalTrajectoryParameters(dedxHits->pos(i), lv, track->charge())));
+          const GeomDetUnit& geomDet = *det.det;
+          // CPE was already re-run for this hit, take it from the cache
+          const pixelCPEResult& cpe = candCPECache.get(track.key(), dedxHits, i, track->px(), track->py(), track->pz(), track->charge());
+          LocalVector lv = cpe.localDir;
+          auto reCPE = cpe.qualWord;
           // extract probQ and probXY from this
           float probQ = SiPixelRecHitQuality::thePacking.probabilityQ(reCPE);
           float probXY = SiPixelRecHitQuality::thePacking.probabilityXY(reCPE);
@@ -4956,7 +4429,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
           auto clustSizeX = pixelCluster->sizeX();
           auto clustSizeY = pixelCluster->sizeY();
           auto pixelNormCharge = um2cmUnit * dedxHits->charge(i) / dedxHits->pathlength(i);
-          auto pixelNormChargeAfterSF = pixelNormCharge *  dEdxSF[1] *  GetSFPixel(detid.subdetId(), detid, year, currentRun_);
+          auto pixelNormChargeAfterSF = pixelNormCharge *  dEdxSF[1] *  det.pixelSF;
           
           float tmp1 = geomDet.surface().toGlobal(Local3DPoint(0.,0.,0.)).perp();
           float tmp2 = geomDet.surface().toGlobal(Local3DPoint(0.,0.,1.)).perp();
@@ -4969,7 +4442,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
           
           if (detid.subdetId() == PixelSubdetector::PixelBarrel && doPostPreSplots_) {
             
-            auto pixLayerIndex = abs(int(tTopo->pxbLayer(detid)));
+            auto pixLayerIndex = det.pixelLayer;
             tuple->PostPreS_CluProbQVsPixelLayer->Fill(probQ, pixLayerIndex, eventWeight_);
             tuple->PostPreS_CluProbXYVsPixelLayer->Fill(probXY, pixLayerIndex, eventWeight_);
             tuple->PostPreS_CluSizeVsPixelLayer->Fill(clustSize, pixLayerIndex, eventWeight_);
@@ -5042,11 +4515,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
           float stripNormCharge = um2cmUnit * dedxHits->charge(i) * 265 / dedxHits->pathlength(i);
           float stripSize = stripsCluster->amplitudes().size();
           
-          unsigned int stripLayerIndex = 0;
-          if (detid.subdetId() == StripSubdetector::TIB) stripLayerIndex = abs(int(tTopo->tibLayer(detid)));
-          if (detid.subdetId() == StripSubdetector::TOB) stripLayerIndex = abs(int(tTopo->tobLayer(detid))) + 4;
-          if (detid.subdetId() == StripSubdetector::TID) stripLayerIndex = abs(int(tTopo->tidWheel(detid))) + 10;
-          if (detid.subdetId() == StripSubdetector::TEC) stripLayerIndex = abs(int(tTopo->tecWheel(detid))) + 13;
+          unsigned int stripLayerIndex = det.layer;
           if (doPostPreSplots_) {
             if (!isData && genGammaBeta > 0.31623 && genGammaBeta < 0.6 ) {
               tuple->PostPreS_CluNormChargeVsStripLayer_lowBetaGamma->Fill(stripNormCharge, stripLayerIndex, eventWeight_);
@@ -5097,12 +4566,10 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       if (tof)
         MassComb = GetMassFromBeta(track->p(), (1 / (2 - tof->inverseBeta())));
       //Background check looking at region with TOF<1
-      for (unsigned int CutIndex = 0; CutIndex < CutPt_Flip_.size(); CutIndex++) {
-        tuple->Mass_Flip->Fill(CutIndex, Mass, eventWeight_);
-        if (tof && typeMode_ > 1) {
-          tuple->MassTOF_Flip->Fill(CutIndex, MassTOF, eventWeight_);
-          tuple->MassComb_Flip->Fill(CutIndex, MassComb, eventWeight_);
-        }
+      cutFiller.fill(tuple->Mass_Flip, selectionGridFlip.all(), Mass, eventWeight_);
+      if (tof && typeMode_ > 1) {
+        cutFiller.fill(tuple->MassTOF_Flip, selectionGridFlip.all(), MassTOF, eventWeight_);
+        cutFiller.fill(tuple->MassComb_Flip, selectionGridFlip.all(), MassComb, eventWeight_);
       }
     }
     
@@ -5162,12 +4629,10 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       if (debug_ > 3  && trigInfo_ > 0) LogPrint(MOD) << "      >> We enter the selection cut loop now";
       //==========================================================
       // Cut loop: over all possible selection (one of them, the optimal one, will be used later)
-      for (unsigned int CutIndex = 0; CutIndex < CutPt_.size(); CutIndex++) {
-        //Full Selection
-        if (!passSelection(track, dedxSObj, dedxMObj, tof, CutIndex, tuple, false, genBeta, false, 0, 0)) {
-          continue;
-        }
-        
+      // Full Selection, same decision as passSelection for each CutIndex
+      float MuonTOF = (tof) ? tof->inverseBeta() : globalMinTOF_;
+      selectionGrid.select(track->pt(), globalIas_, MuonTOF, cutMask, passingCuts);
+      for (int CutIndex : passingCuts) {
         if (CutIndex != 0) {
           PassNonTrivialSelection = true;
         }
@@ -5181,26 +4646,25 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
           MaxMass_SystHUp[CutIndex] = Mass;
         if (MassDown > MaxMass_SystHDown[CutIndex])
           MaxMass_SystHDown[CutIndex] = Mass;
-        
-        //Fill Mass Histograms
-        tuple->Mass->Fill(CutIndex, Mass, eventWeight_);
-        if (tof && typeMode_ > 1) {
-          tuple->MassTOF->Fill(CutIndex, MassTOF, eventWeight_);
-          tuple->MassComb->Fill(CutIndex, MassComb, eventWeight_);
-        }
-        
-        //Fill Mass Histograms for different Ih syst
-        if (calcSyst_) {
-          tuple->Mass_SystHUp->Fill(CutIndex, MassUp, eventWeight_);
-          tuple->Mass_SystHDown->Fill(CutIndex, MassDown, eventWeight_);
-        }
-        if (tof && typeMode_ > 1) {
-          tuple->MassTOF_SystH->Fill(CutIndex, MassTOF, eventWeight_);
-          tuple->MassComb_SystHUp->Fill(CutIndex, MassUpComb, eventWeight_);
-          tuple->MassComb_SystHDown->Fill(CutIndex, MassDownComb, eventWeight_);
-        }
-        
       }//end of Cut loop
+
+      //Fill Mass Histograms
+      cutFiller.fill(tuple->Mass, passingCuts, Mass, eventWeight_);
+      if (tof && typeMode_ > 1) {
+        cutFiller.fill(tuple->MassTOF, passingCuts, MassTOF, eventWeight_);
+        cutFiller.fill(tuple->MassComb, passingCuts, MassComb, eventWeight_);
+      }
+
+      //Fill Mass Histograms for different Ih syst
+      if (calcSyst_) {
+        cutFiller.fill(tuple->Mass_SystHUp, passingCuts, MassUp, eventWeight_);
+        cutFiller.fill(tuple->Mass_SystHDown, passingCuts, MassDown, eventWeight_);
+      }
+      if (tof && typeMode_ > 1) {
+        cutFiller.fill(tuple->MassTOF_SystH, passingCuts, MassTOF, eventWeight_);
+        cutFiller.fill(tuple->MassComb_SystHUp, passingCuts, MassUpComb, eventWeight_);
+        cutFiller.fill(tuple->MassComb_SystHDown, passingCuts, MassDownComb, eventWeight_);
+      }
     } // end of condition for passPre
     
     float Ick2 = (dedxMObj) ? GetIck(dedxMObj->dEdx(), dEdxK_, dEdxC_) : 0.f;
@@ -5220,7 +4684,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     float iso_HCAL = -1;
     
     if (typeMode_ != 3) {
-      const edm::ValueMap<susybsm::HSCPIsolation> IsolationMap = iEvent.get(hscpIsoToken_);
+      const edm::ValueMap<susybsm::HSCPIsolation>& IsolationMap = iEvent.get(hscpIsoToken_);
       susybsm::HSCPIsolation hscpIso = IsolationMap.get((size_t)track.key());
       iso_TK = hscpIso.Get_TK_SumEt();
       iso_ECAL = hscpIso.Get_ECAL_Energy();
@@ -5241,58 +4705,58 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     
     // HSCP type
     if ( hscp.type() == susybsm::HSCParticleType::globalMuon) {
-      HSCP_type.push_back(0);
+      hscpBlock.type.push_back(0);
     } else if ( hscp.type() == susybsm::HSCParticleType::trackerMuon) {
-      HSCP_type.push_back(1);
+      hscpBlock.type.push_back(1);
     } else if ( hscp.type() == susybsm::HSCParticleType::matchedStandAloneMuon) {
-      HSCP_type.push_back(2);
+      hscpBlock.type.push_back(2);
     } else if ( hscp.type() == susybsm::HSCParticleType::standAloneMuon) {
-      HSCP_type.push_back(3);
+      hscpBlock.type.push_back(3);
     } else if ( hscp.type() == susybsm::HSCParticleType::innerTrack) {
-      HSCP_type.push_back(4);
+      hscpBlock.type.push_back(4);
     } else if ( hscp.type() == susybsm::HSCParticleType::unknown) {
-      HSCP_type.push_back(5);
-    }
-    HSCP_passCutPt55.push_back(track->pt() > 55 ? true : false);
-    HSCP_passPreselection.push_back(passPre);
-    HSCP_passPreselectionSept8.push_back(passPreSept8);
-    HSCP_passSelection.push_back(PassNonTrivialSelection);
-    HSCP_Charge.push_back(track->charge());
-    HSCP_Pt.push_back(track->pt());
-    HSCP_PtErr.push_back(track->ptError());
-    HSCP_Is_StripOnly.push_back(dedxIs_StripOnly ? dedxIs_StripOnly->dEdx() : -1);
-    HSCP_Ias.push_back(dedxIas_FullTracker ? dedxIas_FullTracker->dEdx() : -1);
-    HSCP_Ias_noPix_noTIB_noTID_no3TEC.push_back(dedxIas_noTIBnoTIDno3TEC ? dedxIas_noTIBnoTIDno3TEC->dEdx() : -1);
-    HSCP_Ias_PixelOnly.push_back(dedxIas_PixelOnly ? dedxIas_PixelOnly->dEdx() : -1);
-    HSCP_Ias_StripOnly.push_back(dedxIas_StripOnly ? dedxIas_StripOnly->dEdx() : -1);
-    HSCP_Ias_PixelOnly_noL1.push_back(dedxIas_PixelOnly_noL1 ? dedxIas_PixelOnly_noL1->dEdx() : -1);
-//    HSCP_Ih.push_back(dedxMObj_FullTracker ? dedxMObj_FullTracker->dEdx() : -1);
-    HSCP_Ih.push_back(globalIh_);
-    HSCP_Ick.push_back(dedxMObj ? Ick2 : -99);
-    HSCP_Fmip.push_back(Fmip);
-    HSCP_ProbXY.push_back(probXYonTrack);
-    HSCP_ProbXY_noL1.push_back(probXYonTrackNoL1);
-    HSCP_ProbQ.push_back(probQonTrack);
-    HSCP_ProbQ_noL1.push_back(probQonTrackNoL1);
-    HSCP_Ndof.push_back(track->ndof());
-    HSCP_Chi2.push_back(track->chi2());
-    HSCP_QualityMask.push_back(track->qualityMask());
-    HSCP_isHighPurity.push_back(track->quality(reco::TrackBase::highPurity));
-    HSCP_EoverP.push_back(pf_energy/track->p());
-    HSCP_isMuon.push_back(pf_isMuon);
-    HSCP_isGlobalMuon.push_back(isGlobalMuon);
-    HSCP_isPhoton.push_back(pf_isPhoton);
-    HSCP_isElectron.push_back(pf_isElectron);
-    HSCP_gsfFbremElectron.push_back(EleFbremLost);
-    HSCP_gsfMomentumElectron.push_back(EleGsfMomentum);
-    HSCP_PFMomentumElectron.push_back(ElePFMomentum);
-
-    HSCP_isChHadron.push_back(pf_isChHadron);
-    HSCP_isNeutHadron.push_back(pf_isNeutHadron);
-    HSCP_isPfTrack.push_back(pf_isPfTrack);
-    HSCP_isUndefined.push_back(pf_isUndefined);
-    HSCP_ECAL_energy.push_back(pf_ecal_energy);
-    HSCP_HCAL_energy.push_back(pf_hcal_energy);
+      hscpBlock.type.push_back(5);
+    }
+    hscpBlock.passCutPt55.push_back(track->pt() > 55 ? true : false);
+    hscpBlock.passPreselection.push_back(passPre);
+    hscpBlock.passPreselectionSept8.push_back(passPreSept8);
+    hscpBlock.passSelection.push_back(PassNonTrivialSelection);
+    hscpBlock.Charge.push_back(track->charge());
+    hscpBlock.Pt.push_back(track->pt());
+    hscpBlock.PtErr.push_back(track->ptError());
+    hscpBlock.Is_StripOnly.push_back(dedxIs_StripOnly ? dedxIs_StripOnly->dEdx() : -1);
+    hscpBlock.Ias.push_back(dedxIas_FullTracker ? dedxIas_FullTracker->dEdx() : -1);
+    hscpBlock.Ias_noPix_noTIB_noTID_no3TEC.push_back(dedxIas_noTIBnoTIDno3TEC ? dedxIas_noTIBnoTIDno3TEC->dEdx() : -1);
+    hscpBlock.Ias_PixelOnly.push_back(dedxIas_PixelOnly ? dedxIas_PixelOnly->dEdx() : -1);
+    hscpBlock.Ias_StripOnly.push_back(dedxIas_StripOnly ? dedxIas_StripOnly->dEdx() : -1);
+    hscpBlock.Ias_PixelOnly_noL1.push_back(dedxIas_PixelOnly_noL1 ? dedxIas_PixelOnly_noL1->dEdx() : -1);
+//    hscpBlock.Ih.push_back(dedxMObj_FullTracker ? dedxMObj_FullTracker->dEdx() : -1);
+    hscpBlock.Ih.push_back(globalIh_);
+    hscpBlock.Ick.push_back(dedxMObj ? Ick2 : -99);
+    hscpBlock.Fmip.push_back(Fmip);
+    hscpBlock.ProbXY.push_back(probXYonTrack);
+    hscpBlock.ProbXY_noL1.push_back(probXYonTrackNoL1);
+    hscpBlock.ProbQ.push_back(probQonTrack);
+    hscpBlock.ProbQ_noL1.push_back(probQonTrackNoL1);
+    hscpBlock.Ndof.push_back(track->ndof());
+    hscpBlock.Chi2.push_back(track->chi2());
+    hscpBlock.QualityMask.push_back(track->qualityMask());
+    hscpBlock.isHighPurity.push_back(track->quality(reco::TrackBase::highPurity));
+    hscpBlock.EoverP.push_back(pf_energy/track->p());
+    hscpBlock.isMuon.push_back(pf_isMuon);
+    hscpBlock.isGlobalMuon.push_back(isGlobalMuon);
+    hscpBlock.isPhoton.push_back(pf_isPhoton);
+    hscpBlock.isElectron.push_back(pf_isElectron);
+    hscpBlock.gsfFbremElectron.push_back(EleFbremLost);
+    hscpBlock.gsfMomentumElectron.push_back(EleGsfMomentum);
+    hscpBlock.PFMomentumElectron.push_back(ElePFMomentum);
+
+    hscpBlock.isChHadron.push_back(pf_isChHadron);
+    hscpBlock.isNeutHadron.push_back(pf_isNeutHadron);
+    hscpBlock.isPfTrack.push_back(pf_isPfTrack);
+    hscpBlock.isUndefined.push_back(pf_isUndefined);
+    hscpBlock.ECAL_energy.push_back(pf_ecal_energy);
+    hscpBlock.HCAL_energy.push_back(pf_hcal_energy);
     /*
     double tofInit = tof ? tof->inverseBeta() : -99;
     double tofSmeared = tofInit; 
@@ -5310,93 +4774,93 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     if (smearingTOF_){
         tofSmeared = tofInit * valSmear;    
     }
-    if(tof) HSCP_TOF.push_back(tofSmeared);
-    if(!tof) HSCP_TOF.push_back(-99);
+    if(tof) hscpBlock.TOF.push_back(tofSmeared);
+    if(!tof) hscpBlock.TOF.push_back(-99);
     */
 
-    HSCP_TOF.push_back(tof ? tof->inverseBeta() : -99);
-    HSCP_TOFErr.push_back(tof ? tof->inverseBetaErr() : -99);
-    HSCP_TOF_ndof.push_back(tof ? tof->nDof() : -99);
-    HSCP_DTTOF.push_back(dttof ? dttof->inverseBeta() : -99);
-    HSCP_DTTOFErr.push_back(dttof ? dttof->inverseBetaErr() : -99);
-    HSCP_DTTOF_ndof.push_back(dttof ? dttof->nDof() : -99);
-    HSCP_CSCTOF.push_back(csctof ? csctof->inverseBeta() : -99);
-    HSCP_CSCTOFErr.push_back(csctof ? csctof->inverseBetaErr() : -99);
-    HSCP_CSCTOF_ndof.push_back(csctof ? csctof->nDof() : -99);
-    HSCP_Mass.push_back(Mass);
-    HSCP_MassErr.push_back(MassErr);
-    HSCP_dZ.push_back(dz);
-    HSCP_dXY.push_back(dxy);
-    HSCP_mT.push_back(massT);
-    HSCP_dR.push_back(maxOpenAngle);
-    HSCP_p.push_back(track->p());
-    HSCP_eta.push_back(track->eta());
-    HSCP_phi.push_back(track->phi());
-    HSCP_NOH.push_back(track->found());
-    HSCP_NOPH.push_back(nonL1PixHits);
-    HSCP_FOVH.push_back(track->validFraction());
-    HSCP_NOMH.push_back(missingHitsTillLast);
-    HSCP_FOVHD.push_back(validFractionTillLast);
-    HSCP_NOM.push_back(numDeDxHits);
-    HSCP_matchTrigMuon_minDeltaR.push_back(dr_min_hltMuon_hscpCand);
-    HSCP_matchTrigMuon_pT.push_back(hlt_match_pt);
-    HSCP_iso_TK.push_back(iso_TK);
-    HSCP_iso_ECAL.push_back(iso_ECAL);
-    HSCP_iso_HCAL.push_back(iso_HCAL);
-    HSCP_track_genTrackMiniIsoSumPt.push_back(track_genTrackMiniIsoSumPt);
-    HSCP_track_genTrackAbsIsoSumPtFix.push_back(track_genTrackMiniIsoSumPtFix);
-    HSCP_track_genTrackIsoSumPt_dr03.push_back(track_genTrackIsoSumPt_dr03);
-    HSCP_PFMiniIso_relative.push_back(miniRelIsoAll);
-    HSCP_PFMiniIso_wMuon_relative.push_back(miniRelIsoAll_wMuon);
-    HSCP_track_PFIsolationR005_sumChargedHadronPt.push_back(track_PFIso005_sumCharHadPt);
-    HSCP_track_PFIsolationR005_sumNeutralHadronPt.push_back(track_PFIso005_sumNeutHadPt);
-    HSCP_track_PFIsolationR005_sumPhotonPt.push_back(track_PFIso005_sumPhotonPt);
-    HSCP_track_PFIsolationR005_sumPUPt.push_back(track_PFIso005_sumPUPt);
-    HSCP_track_PFIsolationR01_sumChargedHadronPt.push_back(track_PFIso01_sumCharHadPt);
-    HSCP_track_PFIsolationR01_sumNeutralHadronPt.push_back(track_PFIso01_sumNeutHadPt);
-    HSCP_track_PFIsolationR01_sumPhotonPt.push_back(track_PFIso01_sumPhotonPt);
-    HSCP_track_PFIsolationR01_sumPUPt.push_back(track_PFIso01_sumPUPt);
-    HSCP_track_PFIsolationR03_sumChargedHadronPt.push_back(track_PFIso03_sumCharHadPt);
-    HSCP_track_PFIsolationR03_sumNeutralHadronPt.push_back(track_PFIso03_sumNeutHadPt);
-    HSCP_track_PFIsolationR03_sumPhotonPt.push_back(track_PFIso03_sumPhotonPt);
-    HSCP_track_PFIsolationR03_sumPUPt.push_back(track_PFIso03_sumPUPt);
-    HSCP_track_PFIsolationR05_sumChargedHadronPt.push_back(track_PFIso05_sumCharHadPt);
-    HSCP_track_PFIsolationR05_sumNeutralHadronPt.push_back(track_PFIso05_sumNeutHadPt);
-    HSCP_track_PFIsolationR05_sumPhotonPt.push_back(track_PFIso05_sumPhotonPt);
-    HSCP_track_PFIsolationR05_sumPUPt.push_back(track_PFIso05_sumPUPt);
-    HSCP_muon_PFIsolationR03_sumChargedHadronPt.push_back(muon_PFIso03_sumCharHadPt);
-    HSCP_muon_PFIsolationR03_sumNeutralHadronPt.push_back(muon_PFIso03_sumNeutHadPt);
-    HSCP_muon_PFIsolationR03_sumPhotonPt.push_back(muon_PFIso03_sumPhotonPt);
-    HSCP_muon_PFIsolationR03_sumPUPt.push_back(muon_PFIso03_sumPUPt);
-    HSCP_Ih_noL1.push_back(dedxIh_noL1 ? dedxIh_noL1->dEdx() : -1);
-    HSCP_Ih_15drop.push_back(dedxIh_15drop ? dedxIh_15drop->dEdx() : -1);
-    HSCP_Ih_StripOnly.push_back(dedxIh_StripOnly ? dedxIh_StripOnly->dEdx() : -1);
-    HSCP_Ih_StripOnly_15drop.push_back(dedxIh_StripOnly_15drop ? dedxIh_StripOnly_15drop->dEdx() : -1);
-    HSCP_Ih_PixelOnly_noL1.push_back(dedxIh_PixelOnlyh_noL1 ? dedxIh_PixelOnlyh_noL1->dEdx() : -1);
-    HSCP_Ih_SaturationCorrectionFromFits.push_back(
+    hscpBlock.TOF.push_back(tof ? tof->inverseBeta() : -99);
+    hscpBlock.TOFErr.push_back(tof ? tof->inverseBetaErr() : -99);
+    hscpBlock.TOF_ndof.push_back(tof ? tof->nDof() : -99);
+    hscpBlock.DTTOF.push_back(dttof ? dttof->inverseBeta() : -99);
+    hscpBlock.DTTOFErr.push_back(dttof ? dttof->inverseBetaErr() : -99);
+    hscpBlock.DTTOF_ndof.push_back(dttof ? dttof->nDof() : -99);
+    hscpBlock.CSCTOF.push_back(csctof ? csctof->inverseBeta() : -99);
+    hscpBlock.CSCTOFErr.push_back(csctof ? csctof->inverseBetaErr() : -99);
+    hscpBlock.CSCTOF_ndof.push_back(csctof ? csctof->nDof() : -99);
+    hscpBlock.Mass.push_back(Mass);
+    hscpBlock.MassErr.push_back(MassErr);
+    hscpBlock.dZ.push_back(dz);
+    hscpBlock.dXY.push_back(dxy);
+    hscpBlock.mT.push_back(massT);
+    hscpBlock.dR.push_back(maxOpenAngle);
+    hscpBlock.p.push_back(track->p());
+    hscpBlock.eta.push_back(track->eta());
+    hscpBlock.phi.push_back(track->phi());
+    hscpBlock.NOH.push_back(track->found());
+    hscpBlock.NOPH.push_back(nonL1PixHits);
+    hscpBlock.FOVH.push_back(track->validFraction());
+    hscpBlock.NOMH.push_back(missingHitsTillLast);
+    hscpBlock.FOVHD.push_back(validFractionTillLast);
+    hscpBlock.NOM.push_back(numDeDxHits);
+    hscpBlock.matchTrigMuon_minDeltaR.push_back(dr_min_hltMuon_hscpCand);
+    hscpBlock.matchTrigMuon_pT.push_back(hlt_match_pt);
+    hscpBlock.iso_TK.push_back(iso_TK);
+    hscpBlock.iso_ECAL.push_back(iso_ECAL);
+    hscpBlock.iso_HCAL.push_back(iso_HCAL);
+    hscpBlock.track_genTrackMiniIsoSumPt.push_back(track_genTrackMiniIsoSumPt);
+    hscpBlock.track_genTrackAbsIsoSumPtFix.push_back(track_genTrackMiniIsoSumPtFix);
+    hscpBlock.track_genTrackIsoSumPt_dr03.push_back(track_genTrackIsoSumPt_dr03);
+    hscpBlock.PFMiniIso_relative.push_back(miniRelIsoAll);
+    hscpBlock.PFMiniIso_wMuon_relative.push_back(miniRelIsoAll_wMuon);
+    hscpBlock.track_PFIsolationR005_sumChargedHadronPt.push_back(track_PFIso005_sumCharHadPt);
+    hscpBlock.track_PFIsolationR005_sumNeutralHadronPt.push_back(track_PFIso005_sumNeutHadPt);
+    hscpBlock.track_PFIsolationR005_sumPhotonPt.push_back(track_PFIso005_sumPhotonPt);
+    hscpBlock.track_PFIsolationR005_sumPUPt.push_back(track_PFIso005_sumPUPt);
+    hscpBlock.track_PFIsolationR01_sumChargedHadronPt.push_back(track_PFIso01_sumCharHadPt);
+    hscpBlock.track_PFIsolationR01_sumNeutralHadronPt.push_back(track_PFIso01_sumNeutHadPt);
+    hscpBlock.track_PFIsolationR01_sumPhotonPt.push_back(track_PFIso01_sumPhotonPt);
+    hscpBlock.track_PFIsolationR01_sumPUPt.push_back(track_PFIso01_sumPUPt);
+    hscpBlock.track_PFIsolationR03_sumChargedHadronPt.push_back(track_PFIso03_sumCharHadPt);
+    hscpBlock.track_PFIsolationR03_sumNeutralHadronPt.push_back(track_PFIso03_sumNeutHadPt);
+    hscpBlock.track_PFIsolationR03_sumPhotonPt.push_back(track_PFIso03_sumPhotonPt);
+    hscpBlock.track_PFIsolationR03_sumPUPt.push_back(track_PFIso03_sumPUPt);
+    hscpBlock.track_PFIsolationR05_sumChargedHadronPt.push_back(track_PFIso05_sumCharHadPt);
+    hscpBlock.track_PFIsolationR05_sumNeutralHadronPt.push_back(track_PFIso05_sumNeutHadPt);
+    hscpBlock.track_PFIsolationR05_sumPhotonPt.push_back(track_PFIso05_sumPhotonPt);
+    hscpBlock.track_PFIsolationR05_sumPUPt.push_back(track_PFIso05_sumPUPt);
+    hscpBlock.muon_PFIsolationR03_sumChargedHadronPt.push_back(muon_PFIso03_sumCharHadPt);
+    hscpBlock.muon_PFIsolationR03_sumNeutralHadronPt.push_back(muon_PFIso03_sumNeutHadPt);
+    hscpBlock.muon_PFIsolationR03_sumPhotonPt.push_back(muon_PFIso03_sumPhotonPt);
+    hscpBlock.muon_PFIsolationR03_sumPUPt.push_back(muon_PFIso03_sumPUPt);
+    hscpBlock.Ih_noL1.push_back(dedxIh_noL1 ? dedxIh_noL1->dEdx() : -1);
+    hscpBlock.Ih_15drop.push_back(dedxIh_15drop ? dedxIh_15drop->dEdx() : -1);
+    hscpBlock.Ih_StripOnly.push_back(dedxIh_StripOnly ? dedxIh_StripOnly->dEdx() : -1);
+    hscpBlock.Ih_StripOnly_15drop.push_back(dedxIh_StripOnly_15drop ? dedxIh_StripOnly_15drop->dEdx() : -1);
+    hscpBlock.Ih_PixelOnly_noL1.push_back(dedxIh_PixelOnlyh_noL1 ? dedxIh_PixelOnlyh_noL1->dEdx() : -1);
+    hscpBlock.Ih_SaturationCorrectionFromFits.push_back(
                                                    dedxIh_SaturationCorrectionFromFits ? dedxIh_SaturationCorrectionFromFits->dEdx() : -1);
-    HSCP_clust_charge.push_back(clust_charge);
-    HSCP_clust_pathlength.push_back(clust_pathlength);
-    HSCP_clust_nstrip.push_back(clust_nstrip);
-    HSCP_clust_sat254.push_back(clust_sat254);
-    HSCP_clust_sat255.push_back(clust_sat255);
-    HSCP_clust_detid.push_back(clust_detid);
-    HSCP_clust_isStrip.push_back(clust_isStrip);
-    HSCP_clust_isPixel.push_back(clust_isPixel);
-    HSCP_GenId.push_back(genid);
-    HSCP_GenCharge.push_back(gencharge);
-    HSCP_GenMass.push_back(genmass);
-    HSCP_GenPt.push_back(genpt);
-    HSCP_GenEta.push_back(geneta);
-    HSCP_GenPhi.push_back(genphi);
-    
-    HSCP_tuneP_Pt.push_back(tuneP_Pt);
-    HSCP_tuneP_PtErr.push_back(tuneP_PtErr);
-    HSCP_tuneP_Eta.push_back(tuneP_Eta);
-    HSCP_tuneP_Phi.push_back(tuneP_Phi);
-    HSCP_tuneP_MuonBestTrackType.push_back(tunePMuonBestTrackType);
-    
-    HSCP_ErrorHisto_bin.push_back(ErrorHisto_bin);
+    hscpBlock.clust_charge.push_back(std::move(clust_charge));
+    hscpBlock.clust_pathlength.push_back(std::move(clust_pathlength));
+    hscpBlock.clust_nstrip.push_back(std::move(clust_nstrip));
+    hscpBlock.clust_sat254.push_back(std::move(clust_sat254));
+    hscpBlock.clust_sat255.push_back(std::move(clust_sat255));
+    hscpBlock.clust_detid.push_back(std::move(clust_detid));
+    hscpBlock.clust_isStrip.push_back(std::move(clust_isStrip));
+    hscpBlock.clust_isPixel.push_back(std::move(clust_isPixel));
+    hscpBlock.GenId.push_back(genid);
+    hscpBlock.GenCharge.push_back(gencharge);
+    hscpBlock.GenMass.push_back(genmass);
+    hscpBlock.GenPt.push_back(genpt);
+    hscpBlock.GenEta.push_back(geneta);
+    hscpBlock.GenPhi.push_back(genphi);
+    
+    hscpBlock.tuneP_Pt.push_back(tuneP_Pt);
+    hscpBlock.tuneP_PtErr.push_back(tuneP_PtErr);
+    hscpBlock.tuneP_Eta.push_back(tuneP_Eta);
+    hscpBlock.tuneP_Phi.push_back(tuneP_Phi);
+    hscpBlock.tuneP_MuonBestTrackType.push_back(tunePMuonBestTrackType);
+    
+    hscpBlock.ErrorHisto_bin.push_back(ErrorHisto_bin);
   }//END loop over HSCP candidates
   
   if (passTechnicalChecks) {
@@ -5811,7 +5275,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
 
   // Make sure the track that passed preselection + highest Ih selection was filled
   if ((trigInfo_ > 0) && (bestCandidateIndex >= 0)) {
-    const auto hscpColl = iEvent.get(hscpToken_);
+    const auto& hscpColl = iEvent.get(hscpToken_);
     const auto bestCandidateHSCP = &(hscpColl)[bestCandidateIndex];
     
     if (debug_ > 3) LogPrint(MOD) << "After choosing the best candidate track" << endl;
@@ -5983,11 +5447,11 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     if (puTreatment_){
       for (int i = 0; i < NbPuBins_ ; i++){
         if (NPV > PuBins_[i] && NPV <= PuBins_[i+1]) {
-          ratioEntries = (dEdxTemplatesPU[i]->GetEntries()*1.0)/NominalEntries_[i];
+          ratioEntries = (iasTemplatesPU[i].entries()*1.0)/NominalEntries_[i];
         }
       }
     } else {
-        ratioEntries = (dEdxTemplates->GetEntries()*1.0)/std::accumulate(NominalEntries_.begin(),NominalEntries_.end(),0);
+        ratioEntries = (iasTemplates.entries()*1.0)/std::accumulate(NominalEntries_.begin(),NominalEntries_.end(),0);
     }
 
     float scaledParamTwo = (GiSysParamTwo_*1.0)/sqrt(ratioEntries);
@@ -6925,19 +6389,18 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
 
       float dEdxErr = 0;
 
+      dedxTable.fill(generalTrack->eta(), dedxHits, dEdxSF, detTable, cpeCache, generalTrack.key(),
+                     generalTrack->px(), generalTrack->py(), generalTrack->pz(), generalTrack->charge(), correctFEDSat);
+
       // Ih no pixel L1
       auto dedxIh_noL1_TmpFromGeneralTrack =
-        computedEdx(generalTrack->eta(), iSetup,  run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = true, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_, skipPixelL1 = true,
-                    0, false, false, true, pixelCPE_, tTopo, generalTrack->px(), generalTrack->py(), generalTrack->pz(), generalTrack->charge());
+          dedxTable.evaluate(dedxEstimator(nullptr, true, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, true, useTemplateLayer_, skipPixelL1 = true), &dEdxErr);
       
       reco::DeDxData* dedxIh_noL1FromGeneralTrack = dedxIh_noL1_TmpFromGeneralTrack.numberOfMeasurements() > 0 ? &dedxIh_noL1_TmpFromGeneralTrack : nullptr;
 
       // Ih Strip only
       auto dedxIh_StripOnly_TmpFromGeneralTrack =
-        computedEdx(generalTrack->eta(),iSetup, run_number, year, dedxHits, dEdxSF, localdEdxTemplates = nullptr, usePixel = false, useStrip = true, useClusterCleaning, useTruncated = false,
-                    mustBeInside, MaxStripNOM, correctFEDSat, crossTalkInvAlgo = 1, dropLowerDeDxValue = 0.0, &dEdxErr, useTemplateLayer_,
-                    false, 0, false, false, true, pixelCPE_, tTopo, generalTrack->px(), generalTrack->py(), generalTrack->pz(), generalTrack->charge());
+          dedxTable.evaluate(dedxEstimator(nullptr, false, true, useClusterCleaning, false, mustBeInside, MaxStripNOM, 0.0, true, useTemplateLayer_), &dEdxErr);
 
       reco::DeDxData* dedxIh_StripOnlyFromGeneralTrack = dedxIh_StripOnly_TmpFromGeneralTrack.numberOfMeasurements() > 0 ? &dedxIh_StripOnly_TmpFromGeneralTrack : nullptr;
       // TAV: Shouldnt we exit the loop in dedxIh_StripOnlyFromGeneralTrack is a nullptr? Caroline?
@@ -6956,19 +6419,17 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
     
       for (unsigned int i = 0; i < dedxHits->size(); i++) {
         DetId detid(dedxHits->detId(i));
+        const trackerDetInfo& det = detTable[detid];
         if (detid.subdetId() < 3) {
         // Calculate probQ and probXY for this pixel rechit
         // Taking the pixel cluster
         auto const* pixelCluster =  dedxHits->pixelCluster(i);
         if (pixelCluster == nullptr)  continue;
-        // Check on which geometry unit the hit is
-        const GeomDetUnit& geomDet = *tkGeometry->idToDetUnit(detid);
-        // Get the local vector for the track direction
-        LocalVector lv = geomDet.toLocal(GlobalVector(generalTrack->px(), generalTrack->py(), generalTrack->pz()));
-        // Re-run the CPE on this cluster with the lv above
-        // getParameters will return std::tuple<LocalPoint, LocalError, SiPixelRecHitQuality::QualWordType>;
-        // from this we pick the 2nd, the QualWordType
-        auto reCPE = std::get<2>(pixelCPE->getParameters(*pixelCluster, geomDet, LocalTrajectoryParameters(dedxHits->pos(i), lv, generalTrack->charge())));
+        // Re-run of the CPE on this cluster with the track direction, cached for the event
+        const pixelCPEResult& cpe = cpeCache.get(generalTrack.key(), dedxHits, i, generalTrack->px(), generalTrack->py(), generalTrack->pz(), generalTrack->charge());
+        // Local vector for the track direction
+        LocalVector lv = cpe.localDir;
+        auto reCPE = cpe.qualWord;
         // extract probQ and probXY from this
         float probQ = SiPixelRecHitQuality::thePacking.probabilityQ(reCPE);
         float probXY = SiPixelRecHitQuality::thePacking.probabilityXY(reCPE);
@@ -6997,12 +6458,9 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
         }
        */
 
-        int numLayers = tkGeometry->numberOfLayers(PixelSubdetector::PixelBarrel);
       // Have a separate variable that excludes Layer 1
       // Layer 1 was very noisy in 2017/2018
-        bool conditionForPhase0 = (numLayers == 3);
-        bool conditionForPhase1 = ((numLayers == 4) && (( detid.subdetId() == PixelSubdetector::PixelEndcap) || ((detid.subdetId() == PixelSubdetector::PixelBarrel) && (tTopo->pxbLayer(detid) != 1))));
-        if (conditionForPhase0 || conditionForPhase1) {
+        if (det.isPixelNoL1) {
           nonL1PixHitsFromGeneralTrack++;
           float probQNoL1 = SiPixelRecHitQuality::thePacking.probabilityQ(reCPE);
           float probXYNoL1 = SiPixelRecHitQuality::thePacking.probabilityXY(reCPE);
@@ -7139,6 +6597,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       // Loop on the dedxHits belonging to the generalTrack under study
       for(unsigned int h=0;h< dedxHits->size();h++){
           DetId detid(dedxHits->detId(h));
+          const trackerDetInfo& det = detTable[detid];
           float dedx_charge = dedxHits->charge(h);
           float dedx_pathlength = dedxHits->pathlength(h);
           float factorChargeToE = (detid.subdetId() < 3) ? 3.61e-06 : 3.61e-06 * 265;
@@ -7183,7 +6642,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
           else {
             scaleFactor *= dEdxSF[1];
             // Corrections from Tamas
-            float pixelScaling = GetSFPixel(detid.subdetId(), detid, year, run_number);
+            float pixelScaling = det.pixelSF;
             dedx_charge *= pixelScaling;
             float charge_over_pathlength = dedx_charge * scaleFactor * factorChargeToE / dedx_pathlength;
             float charge_over_path_nosf = dedx_charge * factorChargeToE / dedx_pathlength;
@@ -7192,14 +6651,11 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
             // Taking the pixel cluster
             auto const* pixelCluster =  dedxHits->pixelCluster(h);
             if (pixelCluster == nullptr)  continue;
-            // Check on which geometry unit the hit is
-            const GeomDetUnit& geomDet = *tkGeometry->idToDetUnit(detid);
-            // Get the local vector for the track direction
-            LocalVector lv = geomDet.toLocal(GlobalVector(generalTrack->px(), generalTrack->py(), generalTrack->pz()));
-            // Re-run the CPE on this cluster with the lv above
-            // getParameters will return std::tuple<LocalPoint, LocalError, SiPixelRecHitQuality::QualWordType>;
-            // from this we pick the 2nd, the QualWordType
-            auto reCPE = std::get<2>(pixelCPE->getParameters(*pixelCluster, geomDet, LocalTrajectoryParameters(dedxHits->pos(h), lv, generalTrack->charge())));
+            // Re-run of the CPE on this cluster with the track direction, cached for the event
+            const pixelCPEResult& cpe = cpeCache.get(generalTrack.key(), dedxHits, h, generalTrack->px(), generalTrack->py(), generalTrack->pz(), generalTrack->charge());
+            // Local vector for the track direction
+            LocalVector lv = cpe.localDir;
+            auto reCPE = cpe.qualWord;
             // extract probQ and probXY from this
             float probQ = SiPixelRecHitQuality::thePacking.probabilityQ(reCPE);
 
@@ -7224,9 +6680,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
             if (clustSizeX==1 && clustSizeY==1) HasCluSize1 = true;
 
             // BPIXL1 only for 2017 and 2018
-            bool isBPIXL1=false;
-            int numLayers = tkGeometry->numberOfLayers(PixelSubdetector::PixelBarrel);
-            if ((numLayers == 4) && ((detid.subdetId() == PixelSubdetector::PixelBarrel) && (tTopo->pxbLayer(detid) == 1))) isBPIXL1=true;
+            bool isBPIXL1 = det.isBPIXL1;
 
              // cleaning in the pixel
 //            if ((!specInCPE) && (probQ < 0.8) && (!isBPIXL1)) {
@@ -7268,13 +6722,6 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
                                 nPUmean,
                                 vertexColl.size(),
                                 numGoodVerts,
-                                pvX,
-                                pvY,
-                                pvZ,
-                                pvRho,
-                                pvNdof,
-                                pvChi2,
-                                pvSumPt2,
                                 HSCP_count,
                                 nMuons,
                                 pfJetsNum,
@@ -7287,9 +6734,6 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
                                 triggerObjectPt,
                                 triggerObjectEta,
                                 triggerObjectPhi,
-                                HSCP_GenBeta,
-                                HSCP_dRclosestTrigAndCandidate,
-                                HSCP_trigObjBeta,
                                 trigObjBeta,
                                 trigObjEta,
                                 L1mu22,
@@ -7343,63 +6787,6 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
                                 HLTPFMHT_phi,
                                 HLTPFMHT_sigf,
                                 matchedMuonWasFound,
-                                gParticleId,
-                                gParticleStatus,
-                                gParticleE,
-                                gParticlePt,
-                                gParticlePz,
-                                gParticleEta,
-                                gParticlePhi,
-                                gParticleBeta,
-                                gParticleCharge,
-                                gParticleProdVertexX,
-                                gParticleProdVertexY,
-                                gParticleProdVertexZ,
-                                gParticleMotherId,
-                                gParticleMotherIndex,
-                                eleE,
-                                elePt,
-                                eleEta,
-                                elePhi,
-                                eleCharge,
-                                eleE_SC,
-                                eleEta_SC,
-                                elePhi_SC,
-                                eleSigmaIetaIeta,
-                                eleFull5x5SigmaIetaIeta,
-                                eleR9,
-                                ele_dEta,
-                                ele_dPhi,
-                                ele_HoverE,
-                                ele_d0,
-                                ele_dZ,
-                                ele_pileupIso,
-                                ele_chargedIso,
-                                ele_photonIso,
-                                ele_neutralHadIso,
-                                ele_MissHits,
-                                ele_passCutBasedIDVeto,
-                                ele_passCutBasedIDLoose,
-                                ele_passCutBasedIDMedium,
-                                ele_passCutBasedIDTight,
-                                ele_passMVAIsoIDWP80,
-                                ele_passMVAIsoIDWP90,
-                                ele_passMVAIsoIDWPHZZ,
-                                ele_passMVAIsoIDWPLoose,
-                                ele_passMVANoIsoIDWP80,
-                                ele_passMVANoIsoIDWP90,
-                                ele_passMVANoIsoIDWPLoose,
-                                ele_PassConvVeto,
-                                ele_OneOverEminusOneOverP,
-                                muonE,
-                                muonPt,
-                                globalTrackMuonPt,
-                                rescaledPtUpGlobalMuon,
-                                rescaledPtDownGlobalMuon,
-                                innerTrackMuonPt,
-                                rescaledPtUpInnerMuon,
-                                rescaledPtDownInnerMuon,
-                                outerTrackMuonPt,
                                 triggerSystFactorUpTree,
                                 triggerSystFactorDownTree,
                                 muonTriggerSFsUpEff,
@@ -7407,177 +6794,7 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
                                 muonRecoSFsUpEff,
                                 muonRecoSFsDownEff,
                                 muonIdSFsUpEff,
-                                muonIdSFsDownEff,
-                                muonPtErr,
-                                muonEta,
-                                muonPhi,
-                                muonBeta,
-                                muonCharge,
-                                muonIsLoose,
-                                muonIsMedium,
-                                muonIsTight,
-                                muon_d0,
-                                muon_d0Err,
-                                muon_dZ,
-                                muon_ip3d,
-                                muon_ip3dSignificance,
-                                muonType,
-                                muonQuality,
-                                muon_pileupIso,
-                                muon_chargedIso,
-                                muon_photonIso,
-                                muon_neutralHadIso,
-                                muon_validFractionTrackerHits,
-                                muon_normChi2,
-                                muon_chi2LocalPosition,
-                                muon_kinkFinder,
-                                muon_segmentCompatability,
-                                muon_trkIso,
-                                muon_tuneP_Pt,
-                                muon_tuneP_PtErr,
-                                muon_tuneP_Eta,
-                                muon_tuneP_Phi,
-                                muon_tuneP_MuonBestTrackType,
-                                muon_isHighPtMuon,
-                                muon_isTrackerHighPtMuon,
-                                Jets_pt,
-                                Jets_eta,
-                                Jets_phi,
-                                Jets_mass,
-                                Jets_E,
-                                Jets_pdgId,
-                                Jets_et,
-                                Jets_chargedEmEnergyFraction,
-                                Jets_neutralEmEnergyFraction,
-                                Jets_chargedHadronEnergyFraction,
-                                Jets_neutralHadronEnergyFraction,
-                                Jets_muonEnergyFraction,
-                                Jets_chargedMultiplicity,
-                                Jets_neutralMultiplicity,
-                                Jets_jetArea,
-                                Jets_pileupE,
-                                HSCP_mT,
-                                HSCP_passCutPt55,
-                                HSCP_passPreselection,
-                                HSCP_passPreselectionSept8,
-                                HSCP_passPreselectionTrigSys,
-                                HSCP_passSelection,
-                                HSCP_isPFMuon,
-                                HSCP_PFMuonPt,
-                                HSCP_Charge,
-                                HSCP_Pt,
-                                HSCP_PtErr,
-                                HSCP_Is_StripOnly,
-                                HSCP_Ias,
-                                HSCP_Ias_noPix_noTIB_noTID_no3TEC,
-                                HSCP_Ias_PixelOnly,
-                                HSCP_Ias_StripOnly,
-                                HSCP_Ias_PixelOnly_noL1,
-                                HSCP_Ih,
-                                HSCP_Ick,
-                                HSCP_Fmip,
-                                HSCP_ProbXY,
-                                HSCP_ProbXY_noL1,
-                                HSCP_ProbQ,
-                                HSCP_ProbQ_noL1,
-                                HSCP_Ndof,
-                                HSCP_Chi2,
-                                HSCP_QualityMask,
-                                HSCP_isHighPurity,
-                                HSCP_EoverP,
-                                HSCP_isMuon,
-                                HSCP_isGlobalMuon,
-                                HSCP_isPhoton,
-                                HSCP_isElectron,
-                                HSCP_gsfFbremElectron,
-                                HSCP_gsfMomentumElectron,
-                                HSCP_PFMomentumElectron,
-                                HSCP_isChHadron,
-                                HSCP_isNeutHadron,
-                                HSCP_isPfTrack,
-                                HSCP_isUndefined,
-                                HSCP_ECAL_energy,
-                                HSCP_HCAL_energy,
-                                HSCP_TOF,
-                                HSCP_TOFErr,
-                                HSCP_TOF_ndof,
-                                HSCP_DTTOF,
-                                HSCP_DTTOFErr,
-                                HSCP_DTTOF_ndof,
-                                HSCP_CSCTOF,
-                                HSCP_CSCTOFErr,
-                                HSCP_CSCTOF_ndof,
-                                HSCP_Mass,
-                                HSCP_MassErr,
-                                HSCP_dZ,
-                                HSCP_dXY,
-                                HSCP_dR,
-                                HSCP_p,
-                                HSCP_eta,
-                                HSCP_phi,
-                                HSCP_NOH,
-                                HSCP_NOPH,
-                                HSCP_FOVH,
-                                HSCP_NOMH,
-                                HSCP_FOVHD,
-                                HSCP_NOM,
-                                HSCP_matchTrigMuon_minDeltaR,
-                                HSCP_matchTrigMuon_pT,
-                                HSCP_iso_TK,
-                                HSCP_iso_ECAL,
-                                HSCP_iso_HCAL,
-                                HSCP_track_genTrackMiniIsoSumPt,
-                                HSCP_track_genTrackAbsIsoSumPtFix,
-                                HSCP_track_genTrackIsoSumPt_dr03,
-                                HSCP_PFMiniIso_relative,
-                                HSCP_PFMiniIso_wMuon_relative,
-                                HSCP_track_PFIsolationR005_sumChargedHadronPt,
-                                HSCP_track_PFIsolationR005_sumNeutralHadronPt,
-                                HSCP_track_PFIsolationR005_sumPhotonPt,
-                                HSCP_track_PFIsolationR005_sumPUPt,
-                                HSCP_track_PFIsolationR01_sumChargedHadronPt,
-                                HSCP_track_PFIsolationR01_sumNeutralHadronPt,
-                                HSCP_track_PFIsolationR01_sumPhotonPt,
-                                HSCP_track_PFIsolationR01_sumPUPt,
-                                HSCP_track_PFIsolationR03_sumChargedHadronPt,
-                                HSCP_track_PFIsolationR03_sumNeutralHadronPt,
-                                HSCP_track_PFIsolationR03_sumPhotonPt,
-                                HSCP_track_PFIsolationR03_sumPUPt,
-                                HSCP_track_PFIsolationR05_sumChargedHadronPt,
-                                HSCP_track_PFIsolationR05_sumNeutralHadronPt,
-                                HSCP_track_PFIsolationR05_sumPhotonPt,
-                                HSCP_track_PFIsolationR05_sumPUPt,
-                                HSCP_muon_PFIsolationR03_sumChargedHadronPt,
-                                HSCP_muon_PFIsolationR03_sumNeutralHadronPt,
-                                HSCP_muon_PFIsolationR03_sumPhotonPt,
-                                HSCP_muon_PFIsolationR03_sumPUPt,
-                                HSCP_Ih_noL1,
-                                HSCP_Ih_15drop,
-                                HSCP_Ih_StripOnly,
-                                HSCP_Ih_StripOnly_15drop,
-                                HSCP_Ih_PixelOnly_noL1,
-                                HSCP_Ih_SaturationCorrectionFromFits,
-                                HSCP_clust_charge,
-                                HSCP_clust_pathlength,
-                                HSCP_clust_nstrip,
-                                HSCP_clust_sat254,
-                                HSCP_clust_sat255,
-                                HSCP_clust_detid,
-                                HSCP_clust_isStrip,
-                                HSCP_clust_isPixel,
-                                HSCP_GenId,
-                                HSCP_GenCharge,
-                                HSCP_GenMass,
-                                HSCP_GenPt,
-                                HSCP_GenEta,
-                                HSCP_GenPhi,
-                                HSCP_tuneP_Pt,
-                                HSCP_tuneP_PtErr,
-                                HSCP_tuneP_Eta,
-                                HSCP_tuneP_Phi,
-                                HSCP_tuneP_MuonBestTrackType,
-                                HSCP_ErrorHisto_bin,
-                                HSCP_type);
+                                muonIdSFsDownEff);
 
   //save event dependent information thanks to the bookkeeping
   for (unsigned int CutIndex = 0; CutIndex < CutPt_.size(); CutIndex++) {
@@ -7626,10 +6843,29 @@ void Analyzer::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
 // ------------ method called once each job just after ending the event loop  ------------
 void Analyzer::endJob() {
   if (tapeRecallOnly_) return;
+  static constexpr const char* const MOD = "Analyzer";
   
   delete RNG;
   delete RNG2;
 //  delete RNG3;
+  // the region histograms are filled by batch, give them the last candidates before they are written
+  tuple_maker->flushRegions(tuple);
+  std::ostringstream histoReport;
+  histos.report(histoDir, histoReport);
+  edm::LogPrint(MOD) << histoReport.str();
+  if (eventCopies.enabled()) {
+    std::ostringstream copyReport;
+    eventCopies.report(copyReport);
+    edm::LogPrint(MOD) << copyReport.str();
+  }
+  if (earlyReject_) {
+    edm::LogPrint(MOD) << "Early reject: " << earlyRejectFailed_ << " of the " << earlyRejectSeen_
+                       << " events had no viable candidate, " << earlyRejectFailed_ - earlyRejectSampled_
+                       << " were skipped (" << (earlyRejectSeen_ ? 100. * (earlyRejectFailed_ - earlyRejectSampled_) / earlyRejectSeen_ : 0.)
+                       << "%), " << earlyRejectSampled_ << " were kept as control sample";
+  }
+  // the tree is owned by its own file when it has one
+  hscpTreeOutput.close();
   delete tuple;
   if (!isData) {
     delete mcWeight;
@@ -7814,13 +7050,30 @@ void Analyzer::fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
   desc.addUntracked("DeDxK",2.3)->setComment("K constant, really controlled by the config for each era");
   desc.addUntracked("DeDxC",3.17)->setComment("C constant, really controlled by the config for each era");
   desc.addUntracked("SaveTree",6)->setComment("0: do not save tree, 6: everything is saved");
+  desc.addUntracked<std::string>("TreeOutputFile","")
+    ->setComment("File of its own for the HscpCandidates tree, at the same path as in the TFileService file; empty: the tree stays in the TFileService file");
+  desc.addUntracked<std::vector<std::string>>("TreeCompression",{})
+    ->setComment("Per branch compression of the HscpCandidates tree, rules pattern:algorithm:level with wildcards in the pattern, algorithm ZLIB, LZMA or LZ4, the last matching rule wins");
+  desc.addUntracked("TreeAutoFlush",0)->setComment("Entries per cluster of the HscpCandidates tree, 0: ROOT default");
+  desc.addUntracked("BookHistogramsOnFill",false)
+    ->setComment("Book the 2D and 3D histograms of the tuple on their first fill, the ones never filled take no memory and are not written");
+  desc.addUntracked("ParallelCandidates",true)
+    ->setComment("Compute the isolation, gen matching, dEdx estimators and recomputed TOF of the HSCP candidates of an event concurrently, the results do not depend on it");
+  desc.addUntracked("EarlyReject",false)
+    ->setComment("Skip the events w/o trigger decision or w/o any candidate track passing the pt (nominal or shifted up) and eta preselection before the gen, vertex and trigger object blocks: no tree entry, no object collections, no calibration plots for them; only EventWeight (w/o muon SFs) and the NumEvents bins 1-2 are filled");
+  desc.addUntracked("EarlyRejectControlPrescale",0)
+    ->setComment("With EarlyReject, fully process one of every N events that would be skipped, as a control sample; 0: none");
   desc.addUntracked<std::string>("DeDxTemplate","SUSYBSMAnalysis/HSCP/data/template_2017B.root")
     ->setComment("Norm charge vs path lenght vs module geometry templates for the strips detector, really controlled by the config for each era");
+  desc.addUntracked<std::string>("DeDxTemplateCache","")
+    ->setComment("Binary cache of the cumulative dEdx templates, written on the first job and read by the next ones; empty: no cache");
 
   desc.addUntracked("plotsPreS_massSpectrumApproach",true)->setComment("false: provide plots at PreS step with the ionisation approach preselection; true: provide plots at PreS step with the mass spectrum approach preselection");
 
   desc.addUntracked<std::string>("TimeOffset","SUSYBSMAnalysis/HSCP/data/MuonTimeOffset_2018Aruns112.txt")
     ->setComment("MuonTimeOffset info"); // I'm not sure we need this
+  desc.addUntracked<std::string>("TimeOffsetCache","")
+    ->setComment("Binary cache of the muon time offsets, written on the first job and read by the next ones; empty: no cache");
   desc.add<std::string>("PixelCPE","PixelCPETemplateReco")
     ->setComment("CPE used in the pixel reco, PixelCPEClusterRepair is the best available so far, template only is PixelCPETemplateReco");
   desc.addUntracked("DebugLevel",0)->setComment("Level of the debugging print statements ");
@@ -8313,7 +7566,9 @@ float Analyzer::shiftForPt(const float& pt, const float& eta, const float& phi,
 // based on https://twiki.cern.ch/twiki/bin/viewauth/CMS/MuonUL2018#Momentum_Resolution
 // AN-2018/008
 // factor 0.46 corresponds to the 10% shift uncertainty
-  RNG2 = new TRandom3();
+  // a generator in its initial state, as a new TRandom3() would be, w/o leaking one per call
+  if (!RNG2) RNG2 = new TRandom3();
+  RNG2->SetSeed(4357);
   float sigma = 0.0;
   if (fabs(eta) < 1.2) {
     sigma = 0.0141926 + 4.23456e-05*pt - 9.91644e-09*pt*pt;
@@ -8332,11 +7587,7 @@ float Analyzer::shiftForPt(const float& pt, const float& eta, const float& phi,
 //     Method to get hit position
 //
 //=============================================================
-GlobalPoint Analyzer::getOuterHitPos(const edm::EventSetup& iSetup, const reco::DeDxHitInfo* dedxHits) {
-// Retrieve tracker geometry from the event setup
-  edm::ESHandle<TrackerGeometry> tkGeometry;
-  iSetup.get<TrackerDigiGeometryRecord>().get(tkGeometry);
-
+GlobalPoint Analyzer::getOuterHitPos(const reco::DeDxHitInfo* dedxHits) {
   GlobalPoint point(0, 0, 0);
   if (!dedxHits) {
     return point;
@@ -8344,7 +7595,7 @@ GlobalPoint Analyzer::getOuterHitPos(const edm::EventSetup& iSetup, const reco::
   float outerDistance=-1;
   for (unsigned int h = 0; h < dedxHits->size(); h++) {
     const auto detid = dedxHits->detId(h);
-    const auto &surface = (*tkGeometry->idToDetUnit(detid)).surface();
+    const auto &surface = detTable[detid].det->surface();
     const GlobalPoint globalPoint = surface.toGlobal(Local3DPoint(dedxHits->pos(h).x(), dedxHits->pos(h).y(), dedxHits->pos(h).z()));
     float distanceForIdxH = sqrt(globalPoint.x()*globalPoint.x() + globalPoint.y()*globalPoint.y() + globalPoint.z()*globalPoint.z());
     if(distanceForIdxH>outerDistance) {
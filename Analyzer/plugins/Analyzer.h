@@ -18,9 +18,13 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <sstream>
 #include <exception>
 #include <unordered_map>
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 // ~~~~~~~~~ ROOT include files ~~~~~~~~~
 #include "TH1.h"
 #include "TH2.h"
@@ -42,6 +46,7 @@
 #include "FWCore/Framework/interface/EDAnalyzer.h"
 
 #include "FWCore/Framework/interface/ESHandle.h"
+#include "FWCore/Framework/interface/ESWatcher.h"
 #include "FWCore/ServiceRegistry/interface/Service.h"
 #include "CommonTools/UtilAlgos/interface/TFileService.h"
 #include "DataFormats/Common/interface/View.h"
@@ -70,6 +75,7 @@
 #include "FWCore/Framework/interface/Frameworkfwd.h"
 #include "FWCore/Framework/interface/MakerMacros.h"
 #include "FWCore/Framework/interface/Event.h"
+#include "FWCore/Framework/interface/Run.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 
@@ -121,6 +127,7 @@
 #include "RecoLocalTracker/Records/interface/TkPixelCPERecord.h"
 #include "RecoLocalTracker/ClusterParameterEstimator/interface/PixelClusterParameterEstimator.h"
 #include "Geometry/Records/interface/TrackerTopologyRcd.h"
+#include "Geometry/Records/interface/TrackerDigiGeometryRecord.h"
 #include "DataFormats/TrackerCommon/interface/TrackerTopology.h"
 #include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
 #include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
@@ -129,13 +136,21 @@
 #include "DataFormats/ParticleFlowReco/interface/PFDisplacedVertex.h"
 
 #include "SUSYBSMAnalysis/Analyzer/interface/CommonFunction.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/CandidateIsolation.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/CandidateRecord.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/CopyAudit.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/CutGrid.h"
 #include "SUSYBSMAnalysis/Analyzer/interface/DeDxUtility.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/DeDxEstimator.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/EtaPhiGrid.h"
 #include "SUSYBSMAnalysis/Analyzer/interface/TOFUtility.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/TreeOutput.h"
 #include "SUSYBSMAnalysis/Analyzer/interface/TupleMaker.h"
 #include "SUSYBSMAnalysis/Analyzer/interface/SaturationCorrection.h"
 #include "SUSYBSMAnalysis/Analyzer/interface/MCWeight.h"
 #include "SUSYBSMAnalysis/Analyzer/interface/Regions.h"
 #include "SUSYBSMAnalysis/Analyzer/interface/TrigToolsFuncs.h"
+#include "SUSYBSMAnalysis/Analyzer/interface/TriggerUtility.h"
 #include "SUSYBSMAnalysis/HSCP/interface/MuonTimingCalculator.h"
 
 
@@ -178,7 +193,7 @@ public:
                      const float RescaleT);
 
   float shiftForPt(const float& pt, const float& eta, const float& phi, const int& charge);
-  GlobalPoint getOuterHitPos(const edm::EventSetup& iSetup, const reco::DeDxHitInfo* dedxHits);
+  GlobalPoint getOuterHitPos(const reco::DeDxHitInfo* dedxHits);
   float SegSep(const reco::TrackRef track, const edm::Event& iEvent, float& minPhi, float& minEta);
   float combineProbs(float probOnTrackWMulti, int numRecHits) const;
   bool isHSCPgenID(const reco::GenParticle& gen);
@@ -200,6 +215,7 @@ public:
 
 private:
   virtual void beginJob() override;
+  virtual void beginRun(const edm::Run&, const edm::EventSetup&) override;
   virtual void analyze(const edm::Event&, const edm::EventSetup&) override;
   virtual void endJob() override;
 //  virtual void isPixelTrack(const edm::Ref<std::vector<Trajectory>>&, bool&, bool&);
@@ -245,9 +261,19 @@ private:
   string triggerPathNamesFile_;
   string muonHLTFilterNamesFile_;
   static const int NTriggersMAX = 1201;
-  string triggerPathNames[NTriggersMAX];
+  triggerNameTable triggerPathNames;
   static const int MAX_MuonHLTFilters = 69;
-  string muonHLTFilterNames[MAX_MuonHLTFilters];
+  triggerNameTable muonHLTFilterNames;
+  triggerPathIndex triggerIndex;
+  std::vector<std::vector<std::string>> triggerPatterns;
+  // filters and collections of the trigger event, by their id in trigObjIndex
+  trigtools::triggerObjectIndex trigObjIndex;
+  std::vector<unsigned int> muonHLTFilterIds;  // of the slots of muonHLTFilterNames
+  unsigned int hltMuonFilterId_;  // FilterName
+  unsigned int singleMu25FilterId_, singleMu22or25Filter0Id_, singleMu22or25Filter10Id_, lastSingleMuFilterId_;
+  unsigned int singleMu22LabelId_, singleMu25LabelId_, singleMu22or25Filter0LabelId_, singleMu22or25Filter10LabelId_,
+      singleMu22or25L3Filter0LabelId_, lastSingleMuLabelId_;
+  unsigned int hltMetCollId_, hltMetCleanCollId_, hltMhtCollId_, hltPFMHTCollId_, hltPFMETCollId_;
 
 
   bool matchToHLTTrigger_;
@@ -281,6 +307,10 @@ private:
 
   vector<float> CutPt_, CutI_, CutTOF_;
   vector<float> CutPt_Flip_, CutI_Flip_, CutTOF_Flip_;
+  cutGrid selectionGrid, selectionGridFlip;
+  cutIndexFiller cutFiller;
+  vector<unsigned char> cutMask;
+  vector<int> passingCuts;
   //map<string, vector<float>> VCuts;
 
   map<string, TProfile*> HCuts;
@@ -392,6 +422,17 @@ private:
 
   //=============================================================
   Tuple* tuple;
+  TupleBlocks eventBlocks;
+  histoRegistry histos;
+  copyAudit eventCopies;
+  TDirectory* histoDir;
+  bool bookHistogramsOnFill_;
+  bool parallelCandidates_;
+  bool earlyReject_;
+  int earlyRejectControlPrescale_;
+  unsigned long earlyRejectSeen_ = 0;
+  unsigned long earlyRejectFailed_ = 0;
+  unsigned long earlyRejectSampled_ = 0;
   Tuple* tuple_SigmaPt1_iso1_IhCut1_PtCut1;
   Tuple* tuple_SigmaPt2_iso1_IhCut1_PtCut1;
   Tuple* tuple_SigmaPt3_iso1_IhCut1_PtCut1;
@@ -407,8 +448,8 @@ private:
   TupleMaker* tuple_maker;
   //=============================================================
 
-  TH3F* dEdxTemplates = nullptr;
-  vector<TH3F*> dEdxTemplatesPU;
+  dedxTemplate iasTemplates;
+  vector<dedxTemplate> iasTemplatesPU;
 
   float dEdxSF_0_, dEdxSF_1_;
   float dEdxSF[2] = {dEdxSF_0_, dEdxSF_1_};
@@ -419,12 +460,32 @@ private:
   float globalIh_;
 
   dedxGainCorrector trackerCorrector;
+  dedxHitTable dedxTable;
+  pixelCPECache cpeCache;
+  trackerDetTable detTable;
+  edm::ESWatcher<TrackerDigiGeometryRecord> tkGeometryWatcher;
+  edm::ESWatcher<TrackerTopologyRcd> tTopoWatcher;
+  etaPhiGrid trackGrid;
+  etaPhiGrid pfCandGrid;
+  std::vector<int> pfCandOfTrack;
+  std::vector<int> nextPfCandOfTrack;
+  std::vector<unsigned int> coneIndices;
+  // of the HSCP candidates of the event, by index
+  std::vector<candidateRecord> candRecords;
+  std::vector<dedxHitTable> candDedxTables;
+  std::vector<pixelCPECache> candCPECaches;
   string dEdxTemplate_;
+  string dEdxTemplateCache_;
   bool enableDeDxCalibration_;
   string timeOffset_;
+  string timeOffsetCache_;
   muonTimingCalculator tofCalculator;
   moduleGeom modGeometry;
   unsigned int saveTree_;
+  string treeOutputFile_;
+  vector<string> treeCompression_;
+  int treeAutoFlush_;
+  treeOutput hscpTreeOutput;
 
   bool useClusterCleaning, isData, isBckg, isSignal;
   bool plotsPreS_massSpectrumApproach_;
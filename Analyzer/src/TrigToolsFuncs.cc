@@ -76,3 +76,99 @@ bool trigtools::passedFilter(const trigger::TriggerEvent& trigEvt, const std::st
   }
   return false;
 }
+
+unsigned int trigtools::triggerObjectIndex::add(std::unordered_map<std::string_view,unsigned int>& ids,std::deque<std::string>& names,const std::string& name)
+{
+  auto it = ids.find(name);
+  if(it!=ids.end()) return it->second;
+  names.push_back(name);
+  unsigned int id = ids.size();
+  ids[names.back()] = id;
+  return id;
+}
+
+unsigned int trigtools::triggerObjectIndex::addFilter(const std::string& filterName,const std::string& hltProcess)
+{
+  unsigned int id = add(filterIds_,filterNames_,edm::InputTag(filterName,"",hltProcess).encode());
+  filterIndex_.resize(filterIds_.size(),0);
+  return id;
+}
+
+unsigned int trigtools::triggerObjectIndex::addFilterLabel(const std::string& label)
+{
+  unsigned int id = add(labelIds_,labelNames_,label);
+  labelIndex_.resize(labelIds_.size(),0);
+  return id;
+}
+
+unsigned int trigtools::triggerObjectIndex::addCollection(const std::string& encodedTag)
+{
+  unsigned int id = add(collectionIds_,collectionNames_,encodedTag);
+  collectionIndex_.resize(collectionIds_.size(),0);
+  return id;
+}
+
+void trigtools::triggerObjectIndex::newEvent(const trigger::TriggerEvent& trigEvt)
+{
+  trigEvt_ = &trigEvt;
+  const trigger::size_type nFilters = trigEvt.sizeFilters();
+  const trigger::size_type nCollections = trigEvt.sizeCollections();
+  filterIndex_.assign(filterIds_.size(),nFilters);
+  labelIndex_.assign(labelIds_.size(),nFilters);
+  collectionIndex_.assign(collectionIds_.size(),nCollections);
+
+  //the first occurrence wins, as in the linear searches
+  for(trigger::size_type filterNr=0;filterNr<nFilters;filterNr++){
+    const std::string& encoded = trigEvt.filterTagEncoded(filterNr);
+    auto it = filterIds_.find(encoded);
+    if(it!=filterIds_.end() && filterIndex_[it->second]==nFilters) filterIndex_[it->second] = filterNr;
+    if(labelIds_.empty()) continue;
+    //the label is what comes before the first ':' of the encoded tag
+    it = labelIds_.find(std::string_view(encoded).substr(0,encoded.find(':')));
+    if(it!=labelIds_.end() && labelIndex_[it->second]==nFilters) labelIndex_[it->second] = filterNr;
+  }
+  for(trigger::size_type iC=0;iC<nCollections;iC++){
+    auto it = collectionIds_.find(trigEvt.collectionTagEncoded(iC));
+    if(it!=collectionIds_.end() && collectionIndex_[it->second]==nCollections) collectionIndex_[it->second] = iC;
+  }
+}
+
+bool trigtools::triggerObjectIndex::passedFilter(unsigned int labelId)const
+{
+  trigger::size_type filterNr = labelIndex_[labelId];
+  return filterNr<trigEvt_->sizeFilters() && !trigEvt_->filterKeys(filterNr).empty();
+}
+
+void trigtools::triggerObjectIndex::getObjsPassingFilter(triggerObjects& objs,unsigned int id)const
+{
+  objs.clear();
+  trigger::size_type filterIndex = filterIndex_[id];
+  if(filterIndex<trigEvt_->sizeFilters()){
+    const trigger::Keys& trigKeys = trigEvt_->filterKeys(filterIndex);
+    const trigger::TriggerObjectCollection & trigObjColl(trigEvt_->getObjects());
+    for(trigger::size_type key : trigKeys){
+      const trigger::TriggerObject& obj = trigObjColl[key];
+      objs.pt.push_back(obj.pt());
+      objs.eta.push_back(obj.eta());
+      objs.phi.push_back(obj.phi());
+      objs.energy.push_back(obj.energy());
+      objs.mass.push_back(obj.mass());
+    }
+  }
+}
+
+void trigtools::triggerObjectIndex::getP4sOfObsPassingFilter(std::vector<TLorentzVector>& p4s,unsigned int id)const
+{
+  p4s.clear();
+  trigger::size_type filterIndex = filterIndex_[id];
+  if(filterIndex<trigEvt_->sizeFilters()){
+    const trigger::Keys& trigKeys = trigEvt_->filterKeys(filterIndex);
+    const trigger::TriggerObjectCollection & trigObjColl(trigEvt_->getObjects());
+    for(trigger::size_type key : trigKeys){
+      const trigger::TriggerObject& obj = trigObjColl[key];
+      TLorentzVector objP4;
+      objP4.SetPtEtaPhiM(obj.pt(),obj.eta(),obj.phi(),obj.mass());
+      p4s.push_back(objP4);
+    }
+  }
+}
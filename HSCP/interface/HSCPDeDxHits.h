@@ -0,0 +1,86 @@
+#ifndef HSCPDeDxHits_h
+#define HSCPDeDxHits_h
+
+#include <cstdint>
+#include <vector>
+
+// dE/dx hits of all the tracks of a collection, in one set of columns
+// (same content as one susybsm::HSCPDeDxInfo per track). The hits of
+// track j are the entries offsets[j] to offsets[j+1] of every column.
+namespace susybsm {
+
+  class HSCPDeDxHits {
+  public:
+    // hits of one track, read in place
+    class TrackHits {
+    public:
+      TrackHits(const HSCPDeDxHits& hits, unsigned int first, unsigned int last)
+          : hits_(&hits), first_(first), size_(last - first) {}
+
+      unsigned int size() const { return size_; }
+      bool empty() const { return size_ == 0; }
+      float charge(unsigned int i) const { return hits_->charges[first_ + i]; }
+      float pathlength(unsigned int i) const { return hits_->pathlengths[first_ + i]; }
+      uint32_t detId(unsigned int i) const { return hits_->detIds[first_ + i]; }
+      float localPosX(unsigned int i) const { return hits_->localPosXs[first_ + i]; }
+      float localPosY(unsigned int i) const { return hits_->localPosYs[first_ + i]; }
+      uint32_t clusterIndex(unsigned int i) const { return hits_->clusterIndices[first_ + i]; }
+
+    private:
+      const HSCPDeDxHits* hits_;
+      unsigned int first_;
+      unsigned int size_;
+    };
+
+    HSCPDeDxHits() : offsets(1, 0) {}
+
+    void reserve(unsigned int nTracks, unsigned int nHits) {
+      offsets.reserve(nTracks + 1);
+      charges.reserve(nHits);
+      pathlengths.reserve(nHits);
+      detIds.reserve(nHits);
+      localPosXs.reserve(nHits);
+      localPosYs.reserve(nHits);
+      clusterIndices.reserve(nHits);
+    }
+
+    // back to no track, the capacity is kept
+    void clear() {
+      offsets.assign(1, 0);
+      charges.clear();
+      pathlengths.clear();
+      detIds.clear();
+      localPosXs.clear();
+      localPosYs.clear();
+      clusterIndices.clear();
+    }
+
+    // adds a hit to the track being filled
+    void push_back(float charge, float pathlength, uint32_t detId, float localPosX, float localPosY, uint32_t clusterIndex) {
+      charges.push_back(charge);
+      pathlengths.push_back(pathlength);
+      detIds.push_back(detId);
+      localPosXs.push_back(localPosX);
+      localPosYs.push_back(localPosY);
+      clusterIndices.push_back(clusterIndex);
+    }
+
+    // closes the track being filled, the next hits go to the next track
+    void endTrack() { offsets.push_back(charges.size()); }
+
+    unsigned int nTracks() const { return offsets.size() - 1; }
+    unsigned int nHits() const { return charges.size(); }
+    TrackHits track(unsigned int j) const { return TrackHits(*this, offsets[j], offsets[j + 1]); }
+
+    std::vector<uint32_t> offsets;
+    std::vector<float> charges;
+    std::vector<float> pathlengths;
+    std::vector<uint32_t> detIds;
+    std::vector<float> localPosXs;
+    std::vector<float> localPosYs;
+    std::vector<uint32_t> clusterIndices;
+  };
+
+}  // namespace susybsm
+
+#endif
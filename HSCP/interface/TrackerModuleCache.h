@@ -0,0 +1,124 @@
+#ifndef TrackerModuleCache_h
+#define TrackerModuleCache_h
+
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "DataFormats/DetId/interface/DetId.h"
+#include "DataFormats/TrackReco/interface/Track.h"
+#include "Geometry/TrackerGeometryBuilder/interface/TrackerGeometry.h"
+
+// Surface of a tracker module (units and glued/stacked dets), in global coordinates
+struct TrackerModuleSurface {
+  float pos[3];
+  float xAxis[3];
+  float yAxis[3];
+  float normal[3];
+};
+
+// Surfaces of all the tracker modules by DetId, to be rebuilt when the geometry changes.
+// crossing() propagates a track as a helix in a uniform field from its reference point
+// to the plane of a module, giving the cosine of the angle between the track and the
+// normal of the module, and the local position of the crossing, without a trajectory.
+class TrackerModuleCache {
+public:
+  TrackerModuleCache() {}
+
+  void build(const TrackerGeometry& tkGeom) {
+    modules_.clear();
+    index_.clear();
+    modules_.reserve(tkGeom.dets().size());
+    index_.reserve(tkGeom.dets().size());
+    for (const GeomDet* det : tkGeom.dets()) {
+      const Surface& surface = det->surface();
+      TrackerModuleSurface module;
+      setVector(module.pos, surface.position().x(), surface.position().y(), surface.position().z());
+      setVector(module.xAxis, surface.rotation().xx(), surface.rotation().xy(), surface.rotation().xz());
+      setVector(module.yAxis, surface.rotation().yx(), surface.rotation().yy(), surface.rotation().yz());
+      setVector(module.normal, surface.rotation().zx(), surface.rotation().zy(), surface.rotation().zz());
+      index_[det->geographicalId().rawId()] = modules_.size();
+      modules_.push_back(module);
+    }
+  }
+
+  bool empty() const { return modules_.empty(); }
+
+  // nullptr if the module is not in the geometry
+  const TrackerModuleSurface* find(DetId id) const {
+    auto it = index_.find(id.rawId());
+    return it == index_.end() ? nullptr : &modules_[it->second];
+  }
+
+  // bz: field in Tesla, false if the helix doesn't cross the plane of the module
+  static bool crossing(const reco::Track& track,
+                       float bz,
+                       const TrackerModuleSurface& module,
+                       float& cosine,
+                       float& localX,
+                       float& localY) {
+    const double pt = track.pt();
+    if (pt <= 0)
+      return false;
+    // signed curvature in 1/cm, along the transverse path length s
+    const double rho = -track.charge() * 0.0029979246 * bz / pt;
+    const double phi0 = track.phi();
+    const double tanLambda = track.pz() / pt;
+    const float* n = module.normal;
+
+    double s = 0, r[3], t[3];
+    bool converged = false;
+    for (int iter = 0; iter < 6; iter++) {
+      position(track, rho, phi0, tanLambda, s, r);
+      t[0] = cos(phi0 + rho * s);
+      t[1] = sin(phi0 + rho * s);
+      t[2] = tanLambda;
+      const double f = n[0] * (r[0] - module.pos[0]) + n[1] * (r[1] - module.pos[1]) + n[2] * (r[2] - module.pos[2]);
+      const double df = n[0] * t[0] + n[1] * t[1] + n[2] * t[2];
+      if (fabs(df) < 1e-6)
+        return false;
+      const double ds = -f / df;
+      s += ds;
+      if (fabs(ds) < 1e-4) {
+        converged = true;
+        break;
+      }
+    }
+    if (!converged)
+      return false;
+
+    position(track, rho, phi0, tanLambda, s, r);
+    t[0] = cos(phi0 + rho * s);
+    t[1] = sin(phi0 + rho * s);
+    t[2] = tanLambda;
+    cosine = (n[0] * t[0] + n[1] * t[1] + n[2] * t[2]) / sqrt(1 + tanLambda * tanLambda);
+    const double d[3] = {r[0] - module.pos[0], r[1] - module.pos[1], r[2] - module.pos[2]};
+    localX = module.xAxis[0] * d[0] + module.xAxis[1] * d[1] + module.xAxis[2] * d[2];
+    localY = module.yAxis[0] * d[0] + module.yAxis[1] * d[1] + module.yAxis[2] * d[2];
+    return true;
+  }
+
+private:
+  static void setVector(float* v, float x, float y, float z) {
+    v[0] = x;
+    v[1] = y;
+    v[2] = z;
+  }
+
+  // point of the helix at transverse path length s from the reference point of the track
+  static void position(const reco::Track& track, double rho, double phi0, double tanLambda, double s, double* r) {
+    if (fabs(rho * s) < 1e-6) {
+      r[0] = track.vx() + s * cos(phi0);
+      r[1] = track.vy() + s * sin(phi0);
+    } else {
+      r[0] = track.vx() + (sin(phi0 + rho * s) - sin(phi0)) / rho;
+      r[1] = track.vy() + (cos(phi0) - cos(phi0 + rho * s)) / rho;
+    }
+    r[2] = track.vz() + s * tanLambda;
+  }
+
+  std::vector<TrackerModuleSurface> modules_;
+  std::unordered_map<unsigned int, unsigned int> index_;
+};
+
+#endif
@@ -19,8 +19,11 @@
 //
 
 #include "SUSYBSMAnalysis/HSCP/plugins/HSCPDeDxInfoProducer.h"
+#include "FWCore/Utilities/interface/Exception.h"
 
 // system include files
+#include <algorithm>
+#include <cmath>
 
 
 using namespace reco;
@@ -30,7 +33,15 @@ using namespace edm;
 HSCPDeDxInfoProducer::HSCPDeDxInfoProducer(const edm::ParameterSet& iConfig)
 {
 
-   produces<ValueMap<susybsm::HSCPDeDxInfo> >();
+   // the per track ValueMap as before, and the hits of all the tracks in one set of columns only
+   // when ProduceDeDxHits is true: nothing reads the columns yet, storing both would double the
+   // payload. Workflows moving to the columns set ProduceDeDxHits and drop the map with ProduceDeDxInfoMap
+   produceDeDxInfoMap = iConfig.getUntrackedParameter<bool>("ProduceDeDxInfoMap", true);
+   produceDeDxHits    = iConfig.getUntrackedParameter<bool>("ProduceDeDxHits", false);
+   if(!produceDeDxInfoMap && !produceDeDxHits)
+      throw cms::Exception("Configuration") << "HSCPDeDxInfoProducer: ProduceDeDxInfoMap and ProduceDeDxHits are both false, nothing to produce";
+   if(produceDeDxHits)    produces<susybsm::HSCPDeDxHits>();
+   if(produceDeDxInfoMap) produces<ValueMap<susybsm::HSCPDeDxInfo> >();
 
 
    MaxNrStrips         = iConfig.getUntrackedParameter<unsigned>("maxNrStrips"        ,  255);
@@ -43,6 +54,14 @@ HSCPDeDxInfoProducer::HSCPDeDxInfoProducer(const edm::ParameterSet& iConfig)
    m_tracksTag = consumes<reco::TrackCollection>(iConfig.getParameter<edm::InputTag>("tracks"));
    m_trajTrackAssociationTag   = consumes<TrajTrackAssociationCollection>(iConfig.getParameter<edm::InputTag>("trajectoryTrackAssociation"));
    useTrajectory = iConfig.getUntrackedParameter<bool>("UseTrajectory", true);
+   // helix from the track parameters to the cached module surfaces, no trajectory needed;
+   // with ValidateHelix the trajectories are still read, to report the difference to them
+   useHelix = iConfig.getUntrackedParameter<bool>("UseHelix", false);
+   validateHelix = iConfig.getUntrackedParameter<bool>("ValidateHelix", false);
+   if(useHelix) useTrajectory = false;
+   bz = 0;
+   nCompared = 0; nHelixFailed = 0; nPathRatioBelow1pc = 0;
+   sumPathRatio = 0; sumPathRatio2 = 0; maxPathRatio = 0; sumLocalDist = 0;
 
    usePixel = iConfig.getParameter<bool>("UsePixel"); 
    useStrip = iConfig.getParameter<bool>("UseStrip");
@@ -75,31 +94,58 @@ void  HSCPDeDxInfoProducer::beginRun(edm::Run const& run, const edm::EventSetup&
       DeDxTools::makeCalibrationMap(m_calibrationPath, *tkGeom, calibGains, m_off);
    }
 
+   if(useHelix){
+      if(tkGeomWatcher.check(iSetup)){
+         edm::ESHandle<TrackerGeometry> tkGeom;
+         iSetup.get<TrackerDigiGeometryRecord>().get( tkGeom );
+         moduleCache.build(*tkGeom);
+      }
+      edm::ESHandle<MagneticField> magField;
+      iSetup.get<IdealMagneticFieldRecord>().get(magField);
+      bz = magField->inTesla(GlobalPoint(0,0,0)).z();
+   }
+
 //   DeDxTools::buildDiscrimMap(run, iSetup, Reccord,  ProbabilityMode, Prob_ChargePath);
 }
 
+void HSCPDeDxInfoProducer::endStream()
+{
+   if(!useHelix || !validateHelix) return;
+   const double n = std::max(nCompared, 1ul);
+   const double mean = sumPathRatio/n;
+   edm::LogPrint("HSCPDeDxInfoProducer") << "Helix vs trajectory pathlengths: " << nCompared << " hits compared, "
+      << nHelixFailed << " hits w/o helix crossing\n"
+      << "  pathlength ratio - 1: mean " << mean << ", rms " << sqrt(std::max(sumPathRatio2/n - mean*mean, 0.))
+      << ", max |.| " << maxPathRatio << ", " << 100.*nPathRatioBelow1pc/n << "% within 1%\n"
+      << "  mean local position distance " << sumLocalDist/n << " cm";
+}
+
 
 
 void HSCPDeDxInfoProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
 {
-  unique_ptr<ValueMap<susybsm::HSCPDeDxInfo> > trackDeDxAssociation(new ValueMap<susybsm::HSCPDeDxInfo> );
-  ValueMap<susybsm::HSCPDeDxInfo>::Filler filler(*trackDeDxAssociation);
-
   edm::Handle<reco::TrackCollection> trackCollectionHandle;
   iEvent.getByToken(m_tracksTag,trackCollectionHandle);
 
   Handle<TrajTrackAssociationCollection> trajTrackAssociationHandle;
-  if(useTrajectory)iEvent.getByToken(m_trajTrackAssociationTag, trajTrackAssociationHandle);
-
-  std::vector<susybsm::HSCPDeDxInfo> dEdxInfos( trackCollectionHandle->size() );
+  if(useTrajectory || (useHelix && validateHelix))iEvent.getByToken(m_trajTrackAssociationTag, trajTrackAssociationHandle);
+
+  // the columns are reserved from the number of rechits of the tracks (a matched hit gives two entries)
+  unsigned int nRecHits = 0;
+  for(const reco::Track& track : *trackCollectionHandle) nRecHits += track.recHitsSize();
+  // the hits are collected in the columns put in the event, or in the scratch columns of the stream
+  // (reused from event to event) when only the map is produced
+  unique_ptr<susybsm::HSCPDeDxHits> dEdxHitsProduct;
+  if(produceDeDxHits) dEdxHitsProduct.reset(new susybsm::HSCPDeDxHits);
+  else                dEdxHitsScratch.clear();
+  susybsm::HSCPDeDxHits* dEdxHits = produceDeDxHits ? dEdxHitsProduct.get() : &dEdxHitsScratch;
+  dEdxHits->reserve(trackCollectionHandle->size(), nRecHits);
 
   TrajTrackAssociationCollection::const_iterator cit;
-  if(useTrajectory)cit = trajTrackAssociationHandle->begin();
+  if(useTrajectory || (useHelix && validateHelix))cit = trajTrackAssociationHandle->begin();
   for(unsigned int j=0;j<trackCollectionHandle->size();j++){            
      const reco::TrackRef track = reco::TrackRef( trackCollectionHandle.product(), j );
 
-     susybsm::HSCPDeDxInfo hscpDeDxInfo;
- 
      if(useTrajectory){  //trajectory allows to take into account the local direction of the particle on the module sensor --> muc much better 'dx' measurement
         const edm::Ref<std::vector<Trajectory> > traj = cit->key; cit++;
         const vector<TrajectoryMeasurement> & measurements = traj->measurements();
@@ -112,7 +158,26 @@ void HSCPDeDxInfoProducer::produce(edm::Event& iEvent, const edm::EventSetup& iS
            LocalVector trackDirection = trajState.localDirection();
            float cosine = trackDirection.z()/trackDirection.mag();
 
-           processHit(recHit, trajState.localMomentum().mag(), cosine, hscpDeDxInfo, trajState.localPosition());
+           processHit(recHit, trajState.localMomentum().mag(), cosine, *dEdxHits, trajState.localPosition());
+        }
+
+     }else if(useHelix){ //helix from the track parameters, the local direction is taken where it crosses the module
+        if(validateHelix){ const edm::Ref<std::vector<Trajectory> > traj = cit->key; cit++; compareHelixToTrajectory(*track, *traj); }
+        for(unsigned int h=0;h<track->recHitsSize();h++){
+           const TrackingRecHit* recHit = &(*(track->recHit(h)));
+           auto const & thit = static_cast<BaseTrackerRecHit const&>(*recHit);
+           if(!thit.isValid())continue;//make sure it's a tracker hit
+
+           const TrackerModuleSurface* module = moduleCache.find(recHit->geographicalId());
+           float cosine, localX, localY;
+           if(!module || !TrackerModuleCache::crossing(*track, bz, *module, cosine, localX, localY)){
+              //same as w/o trajectory
+              const GlobalVector& ModuleNormal = recHit->detUnit()->surface().normalVector();
+              cosine = (track->px()*ModuleNormal.x()+track->py()*ModuleNormal.y()+track->pz()*ModuleNormal.z())/track->p();
+              localX = 0.0; localY = 0.0;
+           }
+
+           processHit(recHit, track->p(), cosine, *dEdxHits, LocalPoint(localX,localY));
         }
 
      }else{ //assume that the particles trajectory is a straight line originating from the center of the detector  (can be improved)
@@ -124,20 +189,72 @@ void HSCPDeDxInfoProducer::produce(edm::Event& iEvent, const edm::EventSetup& iS
            const GlobalVector& ModuleNormal = recHit->detUnit()->surface().normalVector();         
            float cosine = (track->px()*ModuleNormal.x()+track->py()*ModuleNormal.y()+track->pz()*ModuleNormal.z())/track->p();
 
-           processHit(recHit, track->p(), cosine, hscpDeDxInfo, LocalPoint(0.0,0.0));
+           processHit(recHit, track->p(), cosine, *dEdxHits, LocalPoint(0.0,0.0));
         } 
      }
 
-     dEdxInfos[j] = hscpDeDxInfo;
+     dEdxHits->endTrack();
   }
   ///////////////////////////////////////
-  
-  filler.insert(trackCollectionHandle, dEdxInfos.begin(), dEdxInfos.end());
-  filler.fill();
-  iEvent.put(std::move(trackDeDxAssociation));   
+
+  if(produceDeDxInfoMap){
+     std::vector<susybsm::HSCPDeDxInfo> dEdxInfos( trackCollectionHandle->size() );
+     for(unsigned int j=0;j<dEdxHits->nTracks();j++){
+        const susybsm::HSCPDeDxHits::TrackHits hits = dEdxHits->track(j);
+        susybsm::HSCPDeDxInfo& hscpDeDxInfo = dEdxInfos[j];
+        hscpDeDxInfo.charges.reserve(hits.size());
+        hscpDeDxInfo.pathlengths.reserve(hits.size());
+        hscpDeDxInfo.detIds.reserve(hits.size());
+        hscpDeDxInfo.localPosXs.reserve(hits.size());
+        hscpDeDxInfo.localPosYs.reserve(hits.size());
+        hscpDeDxInfo.clusterIndices.reserve(hits.size());
+        for(unsigned int h=0;h<hits.size();h++){
+           hscpDeDxInfo.charges.push_back(hits.charge(h));
+           hscpDeDxInfo.pathlengths.push_back(hits.pathlength(h));
+           hscpDeDxInfo.detIds.push_back(hits.detId(h));
+           hscpDeDxInfo.localPosXs.push_back(hits.localPosX(h));
+           hscpDeDxInfo.localPosYs.push_back(hits.localPosY(h));
+           hscpDeDxInfo.clusterIndices.push_back(hits.clusterIndex(h));
+        }
+     }
+
+     unique_ptr<ValueMap<susybsm::HSCPDeDxInfo> > trackDeDxAssociation(new ValueMap<susybsm::HSCPDeDxInfo> );
+     ValueMap<susybsm::HSCPDeDxInfo>::Filler filler(*trackDeDxAssociation);
+     filler.insert(trackCollectionHandle, dEdxInfos.begin(), dEdxInfos.end());
+     filler.fill();
+     iEvent.put(std::move(trackDeDxAssociation));
+  }
+  if(produceDeDxHits) iEvent.put(std::move(dEdxHitsProduct));
+}
+
+void HSCPDeDxInfoProducer::compareHelixToTrajectory(const reco::Track& track, const Trajectory& traj)
+{
+   const vector<TrajectoryMeasurement> & measurements = traj.measurements();
+   for(vector<TrajectoryMeasurement>::const_iterator it = measurements.begin(); it!=measurements.end(); it++){
+      TrajectoryStateOnSurface trajState=it->updatedState();
+      if( !trajState.isValid()) continue;
+
+      const TrackingRecHit * recHit=(*it->recHit()).hit();
+      if(!recHit || !recHit->isValid())continue;
+      const TrackerModuleSurface* module = moduleCache.find(recHit->geographicalId());
+      if(!module)continue;
+
+      float cosine, localX, localY;
+      if(!TrackerModuleCache::crossing(track, bz, *module, cosine, localX, localY)){ nHelixFailed++; continue; }
+
+      // pathlength of the helix over the one of the trajectory
+      LocalVector trackDirection = trajState.localDirection();
+      const double ratio = fabs(trackDirection.z()/trackDirection.mag()) / fabs(cosine) - 1;
+      nCompared++;
+      sumPathRatio  += ratio;
+      sumPathRatio2 += ratio*ratio;
+      maxPathRatio   = std::max(maxPathRatio, fabs(ratio));
+      if(fabs(ratio) < 0.01) nPathRatioBelow1pc++;
+      sumLocalDist  += hypot(localX - trajState.localPosition().x(), localY - trajState.localPosition().y());
+   }
 }
 
-void HSCPDeDxInfoProducer::processHit(const TrackingRecHit* recHit, float trackMomentum, float& cosine, susybsm::HSCPDeDxInfo& hscpDeDxInfo,  LocalPoint HitLocalPos){
+void HSCPDeDxInfoProducer::processHit(const TrackingRecHit* recHit, float trackMomentum, float& cosine, susybsm::HSCPDeDxHits& hscpDeDxHits,  LocalPoint HitLocalPos){
       auto const & thit = static_cast<BaseTrackerRecHit const&>(*recHit);
       if(!thit.isValid())return;
 
@@ -150,12 +267,7 @@ void HSCPDeDxInfoProducer::processHit(const TrackingRecHit* recHit, float trackM
           auto& detUnit     = *(recHit->detUnit());
           float pathLen     = detUnit.surface().bounds().thickness()/fabs(cosine);
           float chargeAbs   = clus.pixelCluster().charge();
-          hscpDeDxInfo.charges.push_back(chargeAbs);
-          hscpDeDxInfo.pathlengths.push_back(pathLen);
-          hscpDeDxInfo.detIds.push_back(thit.geographicalId());
-          hscpDeDxInfo.localPosXs.push_back(HitLocalPos.x());
-          hscpDeDxInfo.localPosYs.push_back(HitLocalPos.y());
-          hscpDeDxInfo.clusterIndices.push_back(clus.key());
+          hscpDeDxHits.push_back(chargeAbs, pathLen, thit.geographicalId(), HitLocalPos.x(), HitLocalPos.y(), clus.key());
        }else if(clus.isStrip() && !thit.isMatched()){
           if(!useStrip) return;
 
@@ -163,12 +275,7 @@ void HSCPDeDxInfoProducer::processHit(const TrackingRecHit* recHit, float trackM
           int   NSaturating = 0;
           float pathLen     = detUnit.surface().bounds().thickness()/fabs(cosine);
           float chargeAbs   = DeDxTools::getCharge(&(clus.stripCluster()),NSaturating, detUnit, calibGains, m_off);
-          hscpDeDxInfo.charges.push_back(chargeAbs);
-          hscpDeDxInfo.pathlengths.push_back(pathLen);
-          hscpDeDxInfo.detIds.push_back(thit.geographicalId());
-          hscpDeDxInfo.localPosXs.push_back(HitLocalPos.x());
-          hscpDeDxInfo.localPosYs.push_back(HitLocalPos.y());
-          hscpDeDxInfo.clusterIndices.push_back(clus.key());
+          hscpDeDxHits.push_back(chargeAbs, pathLen, thit.geographicalId(), HitLocalPos.x(), HitLocalPos.y(), clus.key());
        }else if(clus.isStrip() && thit.isMatched()){
           if(!useStrip) return;
           const SiStripMatchedRecHit2D* matchedHit=dynamic_cast<const SiStripMatchedRecHit2D*>(recHit);
@@ -178,25 +285,15 @@ void HSCPDeDxInfoProducer::processHit(const TrackingRecHit* recHit, float trackM
           int   NSaturating = 0;
           float pathLen     = detUnitM.surface().bounds().thickness()/fabs(cosine);
           float chargeAbs   = DeDxTools::getCharge(&(matchedHit->monoHit().stripCluster()),NSaturating, detUnitM, calibGains, m_off);
-          hscpDeDxInfo.charges.push_back(chargeAbs);
-          hscpDeDxInfo.pathlengths.push_back(pathLen);
-          hscpDeDxInfo.detIds.push_back(thit.geographicalId());
-          hscpDeDxInfo.localPosXs.push_back(HitLocalPos.x());
-          hscpDeDxInfo.localPosYs.push_back(HitLocalPos.y());
           const OmniClusterRef monoClusterRef = matchedHit->monoClusterRef();
-          hscpDeDxInfo.clusterIndices.push_back(monoClusterRef.key());
+          hscpDeDxHits.push_back(chargeAbs, pathLen, thit.geographicalId(), HitLocalPos.x(), HitLocalPos.y(), monoClusterRef.key());
 
           auto& detUnitS     = *(matchedHit->stereoHit().detUnit());
           NSaturating = 0;
           pathLen     = detUnitS.surface().bounds().thickness()/fabs(cosine);
           chargeAbs   = DeDxTools::getCharge(&(matchedHit->stereoHit().stripCluster()),NSaturating, detUnitS, calibGains, m_off);
-          hscpDeDxInfo.charges.push_back(chargeAbs);
-          hscpDeDxInfo.pathlengths.push_back(pathLen);
-          hscpDeDxInfo.detIds.push_back(thit.geographicalId());
-          hscpDeDxInfo.localPosXs.push_back(HitLocalPos.x());
-          hscpDeDxInfo.localPosYs.push_back(HitLocalPos.y());
           const OmniClusterRef stereoClusterRef = matchedHit->stereoClusterRef();
-          hscpDeDxInfo.clusterIndices.push_back(stereoClusterRef.key());
+          hscpDeDxHits.push_back(chargeAbs, pathLen, thit.geographicalId(), HitLocalPos.x(), HitLocalPos.y(), stereoClusterRef.key());
        }
 }
 
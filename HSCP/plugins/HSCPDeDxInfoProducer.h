@@ -10,10 +10,14 @@
 #include "FWCore/Framework/interface/MakerMacros.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/Framework/interface/ESHandle.h"
+#include "FWCore/Framework/interface/ESWatcher.h"
 
 #include "Geometry/TrackerGeometryBuilder/interface/TrackerGeometry.h"
 #include "Geometry/TrackerGeometryBuilder/interface/StripGeomDetUnit.h"
 #include "Geometry/TrackerGeometryBuilder/interface/PixelGeomDetUnit.h" 
+#include "Geometry/Records/interface/TrackerDigiGeometryRecord.h"
+#include "MagneticField/Engine/interface/MagneticField.h"
+#include "MagneticField/Records/interface/IdealMagneticFieldRecord.h"
 
 #include "DataFormats/Common/interface/ValueMap.h"
 #include "DataFormats/TrackReco/interface/DeDxData.h"
@@ -25,6 +29,8 @@
 #include "TrackingTools/PatternTools/interface/TrajTrackAssociation.h"
 
 #include "AnalysisDataFormats/SUSYBSMObjects/interface/HSCPDeDxInfo.h"
+#include "SUSYBSMAnalysis/HSCP/interface/HSCPDeDxHits.h"
+#include "SUSYBSMAnalysis/HSCP/interface/TrackerModuleCache.h"
 
 //
 // class declaration
@@ -38,9 +44,12 @@ public:
 private:
   virtual void beginRun(edm::Run const& run, const edm::EventSetup&) override;
   virtual void produce(edm::Event&, const edm::EventSetup&) override;
+  virtual void endStream() override;
+
+  void   compareHelixToTrajectory(const reco::Track& track, const Trajectory& traj);
 
   void   makeCalibrationMap(const TrackerGeometry& tkGeom);
-  void   processHit(const TrackingRecHit* recHit, float trackMomentum, float& cosine, susybsm::HSCPDeDxInfo& hscpDeDxInfo,  LocalPoint HitLocalPos);
+  void   processHit(const TrackingRecHit* recHit, float trackMomentum, float& cosine, susybsm::HSCPDeDxHits& hscpDeDxHits,  LocalPoint HitLocalPos);
 
   // ----------member data ---------------------------
 
@@ -48,6 +57,25 @@ private:
   edm::EDGetTokenT<reco::TrackCollection>  m_tracksTag;
 
   bool useTrajectory;
+  bool produceDeDxInfoMap;
+  bool produceDeDxHits;
+  susybsm::HSCPDeDxHits dEdxHitsScratch;
+  bool useHelix;
+  bool validateHelix;
+
+  // module surfaces and field for the helix mode, per geometry IOV and per run
+  edm::ESWatcher<TrackerDigiGeometryRecord> tkGeomWatcher;
+  TrackerModuleCache moduleCache;
+  float bz;
+
+  // helix vs trajectory comparison, reported at the end of the stream
+  unsigned long nCompared;
+  unsigned long nHelixFailed;
+  double sumPathRatio;
+  double sumPathRatio2;
+  double maxPathRatio;
+  unsigned long nPathRatioBelow1pc;
+  double sumLocalDist;
   bool usePixel;
   bool useStrip;
   float meVperADCPixel;
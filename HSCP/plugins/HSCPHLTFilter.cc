@@ -116,7 +116,7 @@ bool HSCPHLTFilter::filter(edm::Event& iEvent, const edm::EventSetup& iSetup)
 
    edm::Handle< trigger::TriggerEvent > trEvHandle;
    iEvent.getByToken(trEvToken, trEvHandle);             
-   trigger::TriggerEvent trEv = *trEvHandle;
+   const trigger::TriggerEvent& trEv = *trEvHandle;
 
    CountEvent++;
    //if(CountEvent<MaxPrint)printf("------------------------\n");
@@ -466,7 +466,7 @@ HSCPTreeBuilder::filter(edm::Event& iEvent, const edm::EventSetup& iSetup)
 
    edm::Handle<reco::VertexCollection> recoVertexHandle;
    iEvent.getByToken(m_recoVertexToken, recoVertexHandle);
-   reco::VertexCollection recoVertex = *recoVertexHandle;
+   const reco::VertexCollection& recoVertex = *recoVertexHandle;
 
    if(reccordVertexInfo){
    NVertices = 0;
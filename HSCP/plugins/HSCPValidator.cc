@@ -387,7 +387,7 @@ void HSCPValidator::makeHLTPlots(const edm::Event& iEvent)
 
   Handle< trigger::TriggerEvent > trEvHandle;
   iEvent.getByToken(trEvToken_, trEvHandle);
-  trigger::TriggerEvent trEv = *trEvHandle;
+  const trigger::TriggerEvent& trEv = *trEvHandle;
 
 
    unsigned int TrIndex_Unknown     = tr.size();
@@ -137,7 +137,7 @@ HSCPFilter::filter(edm::Event& iEvent, const edm::EventSetup& iSetup)
 
    edm::Handle<reco::VertexCollection> recoVertexHandle;
    iEvent.getByToken(recoVertexToken, recoVertexHandle);
-   reco::VertexCollection recoVertex = *recoVertexHandle;
+   const reco::VertexCollection& recoVertex = *recoVertexHandle;
 
    if(!filterFlag) return true;
 
@@ -18,7 +18,9 @@
 
 
 // system include files
+#include <algorithm>
 #include <memory>
+#include <numeric>
 
 // user include files
 #include "FWCore/Framework/interface/Frameworkfwd.h"
@@ -146,11 +148,28 @@ ProduceIsolationMap::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
    std::vector<std::vector<HSCPIsolation>> IsolationInfoColl(Label_.size());
    for(unsigned int i=0;i<Label_.size();i++){ IsolationInfoColl[i].resize(tkTracks->size());}
 
+   //sort the isolation tracks in eta once, for each candidate only the tracks
+   //within the largest cone in eta are tested and all the cones are filled in the same pass
+   double maxConeDR = 0;
+   for(unsigned int i=0;i<Label_.size();i++){ maxConeDR = std::max(maxConeDR, IsolationConeDR_[i]);}
+   const unsigned int nTK = TKHandle->size();
+   std::vector<double> tkEta(nTK), tkPhi(nTK), sortedEta(nTK);
+   std::vector<unsigned int> etaOrder(nTK);
+   for(unsigned int j=0;j<nTK;j++){ tkEta[j] = (*TKHandle)[j].eta(); tkPhi[j] = (*TKHandle)[j].phi();}
+   std::iota(etaOrder.begin(), etaOrder.end(), 0);
+   std::sort(etaOrder.begin(), etaOrder.end(), [&tkEta](unsigned int a, unsigned int b){ return tkEta[a] < tkEta[b];});
+   for(unsigned int k=0;k<nTK;k++){ sortedEta[k] = tkEta[etaOrder[k]];}
+   std::vector<unsigned int> neighbours;
+
+   std::vector<double> SumPt(Label_.size());
+   std::vector<double> Count(Label_.size());
+   std::vector<double> CountHighPt(Label_.size());
+
    int TkIndex=0;
    for(TrackCollection::const_iterator itTrack = tkTracks->begin(); itTrack != tkTracks->end(); ++itTrack, TkIndex++) {
-      std::vector<double> SumPt;      for(unsigned int i=0;i<Label_.size();i++){SumPt      .push_back(0);}
-      std::vector<double> Count;      for(unsigned int i=0;i<Label_.size();i++){Count      .push_back(0);} 
-      std::vector<double> CountHighPt;for(unsigned int i=0;i<Label_.size();i++){CountHighPt.push_back(0);}
+      std::fill(SumPt.begin(), SumPt.end(), 0);
+      std::fill(Count.begin(), Count.end(), 0);
+      std::fill(CountHighPt.begin(), CountHighPt.end(), 0);
 
       if(itTrack->pt()>=candMinPt_){
          TrackDetMatchInfo info = trackAssociator_.associate(iEvent, iSetup, trackAssociator_.getFreeTrajectoryState(iSetup, *itTrack), parameters_);
@@ -159,9 +178,18 @@ ProduceIsolationMap::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
             if(info.hcalRecHits.size()>0){IsolationInfoColl[i][TkIndex].Set_HCAL_Energy(info.coneEnergy(IsolationConeDR_[i], TrackDetMatchInfo::HcalRecHits));}
          }
         
-         for(TrackCollection::const_iterator itTrack2 = TKHandle->begin(); itTrack2 != TKHandle->end(); ++itTrack2){
+         //tracks in the eta window of the largest cone (with a margin for the rounding),
+         //taken back in the collection order so that the sums are done in the same order
+         const double eta = itTrack->eta(), phi = itTrack->phi();
+         std::vector<double>::const_iterator first = std::lower_bound(sortedEta.begin(), sortedEta.end(), eta - maxConeDR - 1E-5);
+         std::vector<double>::const_iterator last  = std::upper_bound(first, sortedEta.cend(), eta + maxConeDR + 1E-5);
+         neighbours.assign(etaOrder.begin() + (first - sortedEta.cbegin()), etaOrder.begin() + (last - sortedEta.cbegin()));
+         std::sort(neighbours.begin(), neighbours.end());
+
+         for(unsigned int j : neighbours){
+            const reco::Track* itTrack2 = &(*TKHandle)[j];
             if(fabs(itTrack->pt()-itTrack2->pt())<0.1 && fabs(itTrack->eta()-itTrack2->eta())<0.05)continue;
-            float dR = deltaR(itTrack->momentum(), itTrack2->momentum());
+            float dR = deltaR(eta, phi, tkEta[j], tkPhi[j]);
             for(unsigned int i=0;i<Label_.size();i++){
                if(dR>IsolationConeDR_[i])continue;
                SumPt[i]+= itTrack2->pt();
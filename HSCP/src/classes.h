@@ -0,0 +1,2 @@
+#include "DataFormats/Common/interface/Wrapper.h"
+#include "SUSYBSMAnalysis/HSCP/interface/HSCPDeDxHits.h"